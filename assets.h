@@ -0,0 +1,46 @@
+/*
+ * Phantom Slayer
+ * Image assets
+ *
+ * GENERATED by tools/asset-compiler from assets/assets.txt -- do not edit
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _IMAGE_ASSETS_HEADER_
+#define _IMAGE_ASSETS_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+#define PHANTOM_SHEET_WIDTH     173
+#define PHANTOM_SHEET_HEIGHT    150
+#define PHANTOM_FRAMES          6
+
+#define WORD_SHEET_WIDTH        82
+#define WORD_SHEET_HEIGHT       70
+#define WORD_FRAMES             10
+
+#define LOGO_SHEET_WIDTH        212
+#define LOGO_SHEET_HEIGHT       20
+
+#define CREDIT_SHEET_WIDTH      104
+#define CREDIT_SHEET_HEIGHT     34
+
+
+/*
+ *      GLOBALS
+ */
+extern const SpriteFrame  phantom_frames[];
+extern const RleSheet     phantom_sheet;
+extern const SpriteFrame  word_frames[];
+extern const uint16_t     word_sprites[];
+extern const uint16_t     logo_sprites[];
+extern const uint16_t     credit_sprites[];
+
+
+#endif  // _IMAGE_ASSETS_HEADER_
@@ -0,0 +1,1147 @@
+/*
+ * Phantom Slayer
+ * On-device performance benchmarks
+ *
+ * Build with BENCHMARK defined (see CMakeLists.txt) and
+ * watch the results over USB serial. The renderer benchmarks
+ * also run on the host: see 'game-bench' in tools/
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+
+using namespace picosystem;
+
+
+/*
+ *      EXTERNALLY-DEFINED GLOBALS
+ */
+extern Game         game;
+extern tinymt32_t   tinymt_store;
+
+
+namespace Bench {
+
+
+/*
+ *      STATIC PROTOTYPES
+ */
+static uint8_t walk_view_distance(int16_t x, int16_t y, uint8_t direction);
+static uint32_t sweep_phantoms(bool use_grid, uint32_t* queries);
+static uint8_t scan_phantom_on_square(uint16_t x, uint16_t y);
+static size_t tile_pack(uint8_t* pack, uint16_t side);
+static uint32_t sense_phantoms(uint8_t range);
+static uint32_t sample_clear_square(uint8_t margin, uint16_t* x, uint16_t* y);
+static void step_player();
+static uint32_t chase(uint16_t limit);
+static uint8_t branch_direction(int16_t dx, int16_t dy, uint8_t available, uint8_t toward, uint8_t direction, uint8_t* back_steps);
+
+
+/**
+    Run all of the benchmarks.
+ */
+void run() {
+    printf("\nPHANTOM SLAYER BENCHMARKS\n");
+    view();
+    bands();
+    step();
+    walls();
+    occupancy();
+    sizes();
+    placement();
+    pursuit();
+    swarm();
+    schedule();
+    decisions();
+    printf("BENCHMARKS DONE\n");
+}
+
+
+/**
+    Compare the cost of rendering the corridor with the original
+    primitive-by-primitive path and the span renderer, for every
+    square and direction on every map.
+ */
+void view() {
+    uint64_t legacy_us = 0;
+    uint64_t span_us = 0;
+    uint32_t frames = 0;
+    uint32_t hits = View::cache_hits();
+    uint32_t misses = View::cache_misses();
+    Frame frame;
+    take_snapshot(&frame);
+
+    for (uint8_t m = 0 ; m < Map::count() ; ++m) {
+        Map::select(m);
+        for (uint16_t y = 0 ; y < Map::height() ; ++y) {
+            for (uint16_t x = 0 ; x < Map::width() ; ++x) {
+                for (uint8_t d = DIRECTION_NORTH ; d <= DIRECTION_WEST ; ++d) {
+                    // Original path: clear, background, then frame by frame
+                    uint64_t start = time_us_64();
+                    Gfx::cls(BLACK);
+                    pen(15, 15, 0);
+                    frect(0, 40, 240, 160);
+                    uint8_t far_frame = Map::get_view_distance(x, y, d);
+                    for (int8_t f = far_frame ; f >= 0 ; --f) {
+                        uint16_t sx = x + (d == DIRECTION_EAST ? f : (d == DIRECTION_WEST ? -f : 0));
+                        uint16_t sy = y + (d == DIRECTION_SOUTH ? f : (d == DIRECTION_NORTH ? -f : 0));
+                        Gfx::draw_section(sx, sy, (d + 3) & 0x03, (d + 1) & 0x03, f, far_frame);
+                    }
+                    legacy_us += (time_us_64() - start);
+
+                    // Span path
+                    start = time_us_64();
+                    pen(BLACK);
+                    frect(0, 0, 240, VIEW_TOP);
+                    frect(0, VIEW_TOP + VIEW_HEIGHT, 240, 240 - VIEW_TOP - VIEW_HEIGHT);
+                    uint32_t sig = View::signature(frame, x, y, d);
+                    View::render(SCREEN, sig, View::prepare(sig), 0, 0, 240, 240);
+                    span_us += (time_us_64() - start);
+                    ++frames;
+                }
+            }
+        }
+    }
+
+    printf("VIEW: %lu frames\n", frames);
+    printf("  original: %lu ns/frame\n", (uint32_t)(legacy_us * 1000 / frames));
+    printf("  span:     %lu ns/frame\n", (uint32_t)(span_us * 1000 / frames));
+    printf("  cache:    %lu hits, %lu misses\n", View::cache_hits() - hits, View::cache_misses() - misses);
+}
+
+
+/**
+    Time whole in-play frames, drawn by both cores through the render
+    pipeline, for a range of band counts, for every square and
+    direction on every map. One band leaves core 0 idle, so it
+    shows the cost of drawing on a single core.
+ */
+void bands() {
+    const uint8_t counts[] = {1, 2, 4, 8, 16};
+    Frame frame;
+    take_snapshot(&frame);
+    frame.state = IN_PLAY;
+    frame.show_reticule = false;
+    frame.is_firing = false;
+
+    for (uint8_t c = 0 ; c < sizeof(counts) ; ++c) {
+        Gfx::set_bands(counts[c]);
+        uint64_t total_us = 0;
+        uint32_t frames = 0;
+
+        for (uint8_t m = 0 ; m < Map::count() ; ++m) {
+            Map::select(m);
+            for (uint16_t y = 0 ; y < Map::height() ; ++y) {
+                for (uint16_t x = 0 ; x < Map::width() ; ++x) {
+                    for (uint8_t d = DIRECTION_NORTH ; d <= DIRECTION_WEST ; ++d) {
+                        frame.viewer.x = x;
+                        frame.viewer.y = y;
+                        frame.viewer.direction = d;
+                        frame.player = frame.viewer;
+                        frame.dirty = DIRTY_VIEW;
+
+                        uint64_t start = time_us_64();
+                        Pipeline::submit(frame);
+                        Pipeline::wait();
+                        total_us += (time_us_64() - start);
+                        ++frames;
+                    }
+                }
+            }
+        }
+
+        printf("BANDS: %u, %lu frames, %lu ns/frame\n", counts[c], frames, (uint32_t)(total_us * 1000 / frames));
+    }
+
+    Gfx::set_bands(VIEW_BANDS);
+}
+
+
+/**
+    Compare the cost of drawing the in-between views of a step with
+    that of a view at rest, for every square and direction on every map.
+ */
+void step() {
+    Frame frame;
+    take_snapshot(&frame);
+    frame.state = IN_PLAY;
+
+    for (uint8_t p = 0 ; p < VIEW_PHASES ; ++p) {
+        frame.phase = p;
+        uint64_t total_us = 0;
+        uint32_t frames = 0;
+
+        for (uint8_t m = 0 ; m < Map::count() ; ++m) {
+            Map::select(m);
+            for (uint16_t y = 0 ; y < Map::height() ; ++y) {
+                for (uint16_t x = 0 ; x < Map::width() ; ++x) {
+                    for (uint8_t d = DIRECTION_NORTH ; d <= DIRECTION_WEST ; ++d) {
+                        uint64_t start = time_us_64();
+                        Gfx::draw_screen(frame, x, y, d);
+                        total_us += (time_us_64() - start);
+                        ++frames;
+                    }
+                }
+            }
+        }
+
+        printf("STEP PHASE: %u, %lu frames, %lu ns/frame\n", p, frames, (uint32_t)(total_us * 1000 / frames));
+    }
+}
+
+
+/**
+    Compare the cost of view distance queries made by walking the map
+    square by square with that of `Map::get_view_distance()`, for every
+    square and direction on every map, and check that they agree.
+ */
+void walls() {
+    const uint8_t passes = 10;
+    uint64_t walk_us = 0;
+    uint64_t lookup_us = 0;
+    uint32_t queries = 0;
+    uint32_t sum = 0;
+    uint32_t mismatches = 0;
+
+    for (uint8_t m = 0 ; m < Map::count() ; ++m) {
+        Map::select(m);
+        for (uint16_t y = 0 ; y < Map::height() ; ++y) {
+            for (uint16_t x = 0 ; x < Map::width() ; ++x) {
+                for (uint8_t d = DIRECTION_NORTH ; d <= DIRECTION_WEST ; ++d) {
+                    if (walk_view_distance(x, y, d) != Map::get_view_distance(x, y, d)) ++mismatches;
+                }
+            }
+        }
+
+        // Time the queries in batches, as each is too quick to time alone
+        for (uint8_t d = DIRECTION_NORTH ; d <= DIRECTION_WEST ; ++d) {
+            uint64_t start = time_us_64();
+            for (uint8_t p = 0 ; p < passes ; ++p) {
+                for (uint16_t y = 0 ; y < Map::height() ; ++y) {
+                    for (uint16_t x = 0 ; x < Map::width() ; ++x) sum += walk_view_distance(x, y, d);
+                }
+            }
+
+            walk_us += (time_us_64() - start);
+
+            start = time_us_64();
+            for (uint8_t p = 0 ; p < passes ; ++p) {
+                for (uint16_t y = 0 ; y < Map::height() ; ++y) {
+                    for (uint16_t x = 0 ; x < Map::width() ; ++x) sum += Map::get_view_distance(x, y, d);
+                }
+            }
+
+            lookup_us += (time_us_64() - start);
+            queries += passes * Map::width() * Map::height();
+        }
+    }
+
+    // NOTE 'sum' is printed so the timed loops can't be optimised away
+    printf("WALLS: %lu queries, %lu mismatches (%lu)\n", queries, mismatches, sum);
+    printf("  walk:     %lu ns/query\n", (uint32_t)(walk_us * 1000 / queries));
+    printf("  lookup:   %lu ns/query\n", (uint32_t)(lookup_us * 1000 / queries));
+}
+
+
+/**
+    Compare the cost of the Phantom queries the game makes when they
+    scan the Phantoms with that of reading the occupancy grid, for a
+    range of Phantom counts, and check that they agree. Each sweep
+    stands the player on every corridor square of map 0 and makes a
+    move cycle's queries: four per Phantom, for its exits, then the
+    senses check and the facing Phantom check.
+ */
+void occupancy() {
+    const uint8_t counts[] = {1, 2, 4, 8, 16};
+    std::vector<Phantom> saved = game.phantoms;
+    Map::select(0);
+
+    for (uint8_t c = 0 ; c < sizeof(counts) ; ++c) {
+        // Spread the Phantoms over the map's corridors
+        game.phantoms.resize(counts[c]);
+        uint16_t side = Map::width();
+        uint16_t square = 0;
+        for (Phantom& p : game.phantoms) {
+            do {
+                square = (square + 37) % (side * Map::height());
+            } while (Map::get_square_contents(square % side, square / side) == MAP_TILE_WALL);
+
+            p.x = square % side;
+            p.y = square / side;
+        }
+
+        Map::reset_occupancy();
+
+        uint32_t mismatches = 0;
+        for (uint16_t y = 0 ; y < Map::height() ; ++y) {
+            for (uint16_t x = 0 ; x < Map::width() ; ++x) {
+                if (scan_phantom_on_square(x, y) != Map::phantom_on_square(x, y)) ++mismatches;
+            }
+        }
+
+        uint32_t queries = 0;
+        uint64_t start = time_us_64();
+        uint32_t sum = sweep_phantoms(false, &queries);
+        uint64_t scan_us = time_us_64() - start;
+
+        start = time_us_64();
+        sum += sweep_phantoms(true, &queries);
+        uint64_t grid_us = time_us_64() - start;
+
+        // NOTE 'sum' is printed so the timed loops can't be optimised away
+        uint32_t cycles = Map::width() * Map::height();
+        printf("OCCUPANCY: %u phantoms, %lu queries/cycle, %lu mismatches (%lu)\n", counts[c], queries / 2 / cycles, mismatches, sum);
+        printf("  scan:     %lu ns/cycle\n", (uint32_t)(scan_us * 1000 / cycles));
+        printf("  grid:     %lu ns/cycle\n", (uint32_t)(grid_us * 1000 / cycles));
+    }
+
+    game.phantoms = saved;
+    Map::reset_occupancy();
+}
+
+
+/**
+    Time the parts of an in-play frame that look at the map, on maps
+    from the stock size up to the largest, to show that their cost
+    doesn't grow with the map: the view, a Phantom move cycle, the
+    senses check and the overhead map. The maps are map 0, tiled,
+    and the player stands on a spread of its corridor squares, with
+    the Phantoms close by.
+ */
+void sizes() {
+    const uint16_t sides[] = {MAP_PACK_WIDTH, 64, 128, MAP_SIZE_MAX};
+    const uint16_t samples = 400;
+    alignas(4) static uint8_t tiled[sizeof(MapPackHeader) + sizeof(MapPackMeta) + MAP_SIZE_MAX / 8 * MAP_SIZE_MAX];
+    std::vector<Phantom> saved = game.phantoms;
+    Player player = game.player;
+    game.phantoms.resize(MAX_PHANTOMS);
+    Frame frame;
+
+    for (uint8_t s = 0 ; s < sizeof(sides) / sizeof(sides[0]) ; ++s) {
+        uint16_t side = sides[s];
+        if (side > MAP_SIZE_MAX || !Map::load(tiled, tile_pack(tiled, side))) continue;
+        Map::select(0);
+        for (Phantom& p : game.phantoms) p.x = NOT_ON_BOARD;
+        Map::reset_occupancy();
+
+        uint64_t view_us = 0;
+        uint64_t move_us = 0;
+        uint64_t senses_us = 0;
+        uint64_t map_us = 0;
+        uint32_t sum = 0;
+        uint32_t square = 0;
+        uint32_t squares = side * side;
+        for (uint16_t i = 0 ; i < samples ; ++i) {
+            // Pick the player's square, then the Phantoms'
+            // on the corridor squares following it
+            do {
+                square = (square + 7919) % squares;
+            } while (Map::get_square_contents(square % side, square / side) == MAP_TILE_WALL);
+
+            game.player.x = square % side;
+            game.player.y = square / side;
+            game.player.direction = i & 0x03;
+            uint32_t next = square;
+            for (Phantom& p : game.phantoms) {
+                do {
+                    next = (next + 3) % squares;
+                } while (Map::get_square_contents(next % side, next / side) == MAP_TILE_WALL);
+
+                p.hp = 1;
+                p.set_square(next % side, next / side);
+            }
+
+            take_snapshot(&frame);
+            uint64_t start = time_us_64();
+            Gfx::draw_screen(frame, frame.viewer.x, frame.viewer.y, frame.viewer.direction);
+            view_us += (time_us_64() - start);
+
+            start = time_us_64();
+            for (Phantom& p : game.phantoms) sum += p.move();
+            move_us += (time_us_64() - start);
+
+            start = time_us_64();
+            sum += sense_phantoms(MAX_VIEW_RANGE);
+            senses_us += (time_us_64() - start);
+
+            start = time_us_64();
+            Map::draw(BASE_MAP_DELTA, true);
+            map_us += (time_us_64() - start);
+        }
+
+        // NOTE 'sum' is printed so the timed loops can't be optimised away
+        printf("SIZES: %ux%u, %u frames (%lu)\n", side, side, samples, sum);
+        printf("  view:     %lu ns/frame\n", (uint32_t)(view_us * 1000 / samples));
+        printf("  phantoms: %lu ns/frame\n", (uint32_t)(move_us * 1000 / samples));
+        printf("  senses:   %lu ns/frame\n", (uint32_t)(senses_us * 1000 / samples));
+        printf("  map:      %lu ns/frame\n", (uint32_t)(map_us * 1000 / samples));
+    }
+
+    // Put back the stock maps
+    Map::load(map_pack, MAP_PACK_BYTES);
+    Map::select(0);
+    game.phantoms = saved;
+    game.player = player;
+    Map::reset_occupancy();
+}
+
+
+/**
+    Compare the cost of placing a Phantom by drawing random squares
+    until one is far enough from the player, the way the game used
+    to, with that of picking one from the free-cell index, on map 0
+    and on larger copies of it. The worst case matters most: it is
+    a hitch at the start of a level.
+ */
+void placement() {
+    const uint16_t sides[] = {MAP_PACK_WIDTH, 64, 128, MAP_SIZE_MAX};
+    const uint16_t samples = 400;
+    alignas(4) static uint8_t tiled[sizeof(MapPackHeader) + sizeof(MapPackMeta) + MAP_SIZE_MAX / 8 * MAP_SIZE_MAX];
+    std::vector<Phantom> saved = game.phantoms;
+    Player player = game.player;
+    game.phantoms.resize(MAX_PHANTOMS);
+
+    for (uint8_t s = 0 ; s < sizeof(sides) / sizeof(sides[0]) ; ++s) {
+        uint16_t side = sides[s];
+        if (side > MAP_SIZE_MAX || !Map::load(tiled, tile_pack(tiled, side))) continue;
+        Map::select(0);
+        for (Phantom& p : game.phantoms) p.x = NOT_ON_BOARD;
+        Map::reset_occupancy();
+
+        uint32_t sample_us = 0;
+        uint32_t sample_worst_us = 0;
+        uint32_t draws = 0;
+        uint32_t worst_draws = 0;
+        uint32_t pick_us = 0;
+        uint32_t pick_worst_us = 0;
+        uint32_t errors = 0;
+        uint32_t square = 0;
+        for (uint16_t i = 0 ; i < samples ; ++i) {
+            // Stand the player on a spread of corridor squares
+            do {
+                square = (square + 7919) % (side * side);
+            } while (Map::get_square_contents(square % side, square / side) == MAP_TILE_WALL);
+
+            game.player.x = square % side;
+            game.player.y = square / side;
+
+            uint16_t x, y;
+            uint32_t start = time_us_32();
+            uint32_t n = sample_clear_square(4, &x, &y);
+            uint32_t took = time_us_32() - start;
+            sample_us += took;
+            if (took > sample_worst_us) sample_worst_us = took;
+            draws += n;
+            if (n > worst_draws) worst_draws = n;
+
+            // Place all the Phantoms, which each avoid the others
+            for (Phantom& p : game.phantoms) {
+                start = time_us_32();
+                p.place();
+                took = time_us_32() - start;
+                pick_us += took;
+                if (took > pick_worst_us) pick_worst_us = took;
+
+                // Check the rules were kept
+                if (p.x == NOT_ON_BOARD) continue;
+                if (Map::get_square_contents(p.x, p.y) == MAP_TILE_WALL) ++errors;
+                if (abs(p.x - game.player.x) <= 4 || abs(p.y - game.player.y) <= 4) ++errors;
+                if (Map::phantom_on_square(p.x, p.y) != (&p - &game.phantoms[0])) ++errors;
+            }
+        }
+
+        printf("PLACEMENT: %ux%u, %u players, %lu errors\n", side, side, samples, errors);
+        printf("  sample:   %lu us mean, %lu us worst, %lu draws worst\n", sample_us / samples, sample_worst_us, worst_draws);
+        printf("  index:    %lu us mean, %lu us worst\n", pick_us / samples / MAX_PHANTOMS, pick_worst_us);
+    }
+
+    // Put back the stock maps
+    Map::load(map_pack, MAP_PACK_BYTES);
+    Map::select(0);
+    game.phantoms = saved;
+    game.player = player;
+    Map::reset_occupancy();
+}
+
+
+/**
+    Time the Phantoms' distance field on map 0 and on larger copies
+    of it, as the player wanders: first its worst case, a search of
+    the whole map in one go after every step, then a tick's slice of
+    the search and the Phantoms' queries, for more and more Phantoms.
+    Then, on the stock maps, compare heading the player's way as
+    before, following the field and looking up the route tables: what
+    a move cycle's queries cost, and how quickly a lone Phantom catches
+    a player standing still.
+ */
+void pursuit() {
+    const uint16_t sides[] = {MAP_PACK_WIDTH, 64, 128, MAP_SIZE_MAX};
+    const uint16_t counts[] = {MAX_PHANTOMS, 16, 64};
+    const uint16_t steps = 200;
+    const uint16_t ticks_per_step = 4;
+    const uint16_t chases = 100;
+    const uint16_t limit = 1000;
+    alignas(4) static uint8_t tiled[sizeof(MapPackHeader) + sizeof(MapPackMeta) + MAP_SIZE_MAX / 8 * MAP_SIZE_MAX];
+    std::vector<Phantom> saved = game.phantoms;
+    Player player = game.player;
+    uint8_t mode = Pursuit::get_mode();
+    Pursuit::set_mode(PURSUIT_FIELD);
+
+    for (uint8_t s = 0 ; s < sizeof(sides) / sizeof(sides[0]) ; ++s) {
+        uint16_t side = sides[s];
+        if (side > MAP_SIZE_MAX || !Map::load(tiled, tile_pack(tiled, side))) continue;
+        Map::select(0);
+        Map::pick_clear_square(0, 0, 0, false, &game.player.x, &game.player.y);
+
+        // The whole map, from scratch
+        uint32_t fill_us = 0;
+        uint32_t fill_worst_us = 0;
+        uint32_t squares = 0;
+        uint32_t overflows = Pursuit::get_overflows();
+        for (uint16_t i = 0 ; i < steps ; ++i) {
+            step_player();
+            uint32_t start = time_us_32();
+            squares += Pursuit::fill();
+            uint32_t took = time_us_32() - start;
+            fill_us += took;
+            if (took > fill_worst_us) fill_worst_us = took;
+        }
+
+        printf("PURSUIT: %ux%u, %u steps, %lu squares/search, %lu overflows\n", side, side, steps, squares / steps, Pursuit::get_overflows() - overflows);
+        printf("  map:          %lu us mean, %lu us worst\n", fill_us / steps, fill_worst_us);
+
+        // What a tick costs, searching a slice at a time. Queries the
+        // fields can't answer yet leave Phantoms heading the player's way
+        for (uint8_t c = 0 ; c < sizeof(counts) / sizeof(counts[0]) ; ++c) {
+            game.phantoms.resize(counts[c]);
+            for (Phantom& p : game.phantoms) p.x = NOT_ON_BOARD;
+            Map::reset_occupancy();
+            for (Phantom& p : game.phantoms) p.place();
+            Pursuit::reset();
+
+            uint32_t tick_us = 0;
+            uint32_t tick_worst_us = 0;
+            uint32_t unanswered = 0;
+            uint32_t sum = 0;
+            for (uint16_t i = 0 ; i < steps * ticks_per_step ; ++i) {
+                if (i % ticks_per_step == 0) step_player();
+
+                uint32_t start = time_us_32();
+                Pursuit::update();
+                for (Phantom& p : game.phantoms) {
+                    uint8_t exits = Pursuit::closer_exits(p.x, p.y);
+                    if (exits == 0) ++unanswered;
+                    sum += exits;
+                }
+
+                uint32_t took = time_us_32() - start;
+                tick_us += took;
+                if (took > tick_worst_us) tick_worst_us = took;
+            }
+
+            // NOTE 'sum' is printed so the timed loops can't be optimised away
+            printf("  %3u phantoms: %lu us mean, %lu us worst, %lu%% unanswered (%lu)\n", counts[c], tick_us / (steps * ticks_per_step),
+                   tick_worst_us, unanswered * 100 / (steps * ticks_per_step * counts[c]), sum);
+        }
+    }
+
+    // Put back the stock maps, and chase the player round them
+    Map::load(map_pack, MAP_PACK_BYTES);
+    const uint8_t modes[] = {PURSUIT_GREEDY, PURSUIT_FIELD, PURSUIT_TABLE};
+    const char* names[] = {"GREEDY", "FIELD", "TABLE"};
+    for (uint8_t m = 0 ; m < sizeof(modes) ; ++m) {
+        Pursuit::set_mode(modes[m]);
+
+        // What a tick's search and queries cost as the player wanders...
+        uint32_t query_us = 0;
+        uint32_t query_worst_us = 0;
+        uint32_t sum = 0;
+        game.phantoms.resize(MAX_PHANTOMS);
+        for (uint8_t map = 0 ; map < Map::count() ; ++map) {
+            Map::select(map);
+            for (Phantom& p : game.phantoms) p.x = NOT_ON_BOARD;
+            Map::reset_occupancy();
+            Map::pick_clear_square(0, 0, 0, false, &game.player.x, &game.player.y);
+            for (Phantom& p : game.phantoms) p.place();
+            for (uint16_t i = 0 ; i < steps ; ++i) {
+                step_player();
+                uint32_t start = time_us_32();
+                Pursuit::update();
+                for (Phantom& p : game.phantoms) sum += Pursuit::closer_exits(p.x, p.y);
+                uint32_t took = time_us_32() - start;
+                query_us += took;
+                if (took > query_worst_us) query_worst_us = took;
+            }
+        }
+
+        // ...and how directly a lone Phantom reaches a player standing still
+        game.phantoms.resize(1);
+        uint32_t moves = 0;
+        uint32_t escapes = 0;
+        uint32_t start = time_us_32();
+        for (uint8_t map = 0 ; map < Map::count() ; ++map) {
+            Map::select(map);
+            for (uint16_t i = 0 ; i < chases ; ++i) {
+                game.phantoms[0].x = NOT_ON_BOARD;
+                Map::reset_occupancy();
+                Map::pick_clear_square(0, 0, 0, false, &game.player.x, &game.player.y);
+                game.phantoms[0].hp = 1;
+                game.phantoms[0].back_steps = 0;
+                game.phantoms[0].place();
+                uint32_t n = chase(limit);
+                moves += n;
+                if (n == limit) ++escapes;
+            }
+        }
+
+        uint32_t took = time_us_32() - start;
+        printf("PURSUIT %s: %lu moves/catch, %lu escapes, %lu ns/move\n", names[m],
+               moves / (Map::count() * chases), escapes, (uint32_t)((uint64_t)took * 1000 / moves));
+        printf("  phantoms: %lu us mean, %lu us worst (%lu)\n", query_us / (Map::count() * steps), query_worst_us, sum);
+    }
+
+    Pursuit::set_mode(mode);
+    Map::select(0);
+    game.phantoms = saved;
+    game.player = player;
+    Map::reset_occupancy();
+}
+
+
+/**
+    Time a move cycle for more and more Phantoms, as the player
+    wanders a copy of map 0 large enough to hold them all: first
+    as a swarm, moved by one pass over its arrays, then as `Phantom`
+    objects, moved one by one as `move_phantoms()` moves them. The
+    objects stop at 64, as the map's Phantom indexes are 8-bit. When
+    the player is caught, they're moved to a new square.
+ */
+void swarm() {
+    const uint16_t counts[] = {3, 16, 64, 256, 1024};
+    const uint16_t side = 128;
+    const uint16_t cycles = 100;
+    alignas(4) static uint8_t tiled[sizeof(MapPackHeader) + sizeof(MapPackMeta) + MAP_SIZE_MAX / 8 * MAP_SIZE_MAX];
+    std::vector<Phantom> saved = game.phantoms;
+    Player player = game.player;
+    if (side > MAP_SIZE_MAX || !Map::load(tiled, tile_pack(tiled, side))) return;
+    Map::select(0);
+
+    for (uint8_t c = 0 ; c < sizeof(counts) / sizeof(counts[0]) ; ++c) {
+        uint16_t number = counts[c];
+        if (number > SWARM_CAPACITY) break;
+
+        for (uint8_t as_objects = 0 ; as_objects < 2 ; ++as_objects) {
+            if (as_objects && number > 64) break;
+
+            game.phantoms.clear();
+            Map::reset_occupancy();
+            Swarm::clear();
+            Pursuit::reset();
+            Map::pick_clear_square(0, 0, 0, false, &game.player.x, &game.player.y);
+            if (as_objects) {
+                game.phantoms.resize(number);
+                for (Phantom& p : game.phantoms) p.place();
+            } else {
+                Swarm::populate(number, 1);
+            }
+
+            uint32_t cycle_us = 0;
+            uint32_t cycle_worst_us = 0;
+            uint32_t catches = 0;
+            for (uint16_t i = 0 ; i < cycles ; ++i) {
+                step_player();
+                Pursuit::update();
+
+                uint32_t start = time_us_32();
+                bool is_caught = false;
+                if (as_objects) {
+                    for (size_t j = 0 ; j < game.phantoms.size() ; ++j) {
+                        if (game.phantoms.at(j).move()) {
+                            is_caught = true;
+                            break;
+                        }
+                    }
+                } else {
+                    is_caught = (Swarm::move() != SWARM_NONE);
+                }
+
+                uint32_t took = time_us_32() - start;
+                cycle_us += took;
+                if (took > cycle_worst_us) cycle_worst_us = took;
+
+                if (is_caught) {
+                    ++catches;
+                    Map::pick_clear_square(game.player.x, game.player.y, 4, false, &game.player.x, &game.player.y);
+                }
+            }
+
+            printf("SWARM %4u %s: %lu us/cycle mean, %lu us worst, %lu ns/phantom, %lu catches\n", number, as_objects ? "OBJECTS" : "ARRAYS ",
+                   cycle_us / cycles, cycle_worst_us, (uint32_t)((uint64_t)cycle_us * 1000 / ((uint32_t)cycles * number)), catches);
+        }
+    }
+
+    // Put back the stock maps
+    Swarm::clear();
+    Map::load(map_pack, MAP_PACK_BYTES);
+    Map::select(0);
+    game.phantoms = saved;
+    game.player = player;
+    Map::reset_occupancy();
+}
+
+
+/**
+    Compare the Phantoms' cost frame by frame, at 40 frames a second
+    on map 0, as the player wanders: with every Phantom due on the
+    same frame, at the end of each move period, as they used to be,
+    and with their moves spread across the period. Each frame's cost
+    is its Phantom moves plus, once a period, the senses check. Frames
+    are counted by cost, in powers of two. When the player is caught,
+    they're moved to a new square.
+ */
+void schedule() {
+    const uint16_t counts[] = {MAX_PHANTOMS, 16, 64};
+    const uint32_t frame_us = 25000;
+    const uint16_t frames = 4000;
+    const uint8_t buckets = 12;
+    std::vector<Phantom> saved = game.phantoms;
+    Player player = game.player;
+    uint32_t speed = game.phantom_speed;
+    uint64_t last_move = game.last_phantom_move;
+    Map::select(0);
+
+    for (uint8_t c = 0 ; c < sizeof(counts) / sizeof(counts[0]) ; ++c) {
+        for (uint8_t is_staggered = 0 ; is_staggered < 2 ; ++is_staggered) {
+            game.phantoms.clear();
+            Map::reset_occupancy();
+            Map::pick_clear_square(0, 0, 0, false, &game.player.x, &game.player.y);
+            game.phantoms.resize(counts[c]);
+            for (Phantom& p : game.phantoms) p.place();
+
+            uint64_t now = 0;
+            game.phantom_speed = PHANTOM_MOVE_TIME_US;
+            schedule_phantoms(now);
+            if (!is_staggered) {
+                for (Phantom& p : game.phantoms) p.next_move = now + p.speed;
+            }
+
+            uint32_t histogram[buckets] = {0};
+            uint32_t worst_us = 0;
+            uint32_t sum = 0;
+            for (uint16_t i = 0 ; i < frames ; ++i) {
+                now += frame_us;
+                if (i % 8 == 0) step_player();
+                Pursuit::update();
+
+                uint32_t start = time_us_32();
+                bool is_caught = move_phantoms(now);
+                if (now - game.last_phantom_move > game.phantom_speed) {
+                    game.last_phantom_move = now;
+                    sum += sense_phantoms(game.audio_range);
+                }
+
+                uint32_t took = time_us_32() - start;
+                if (took > worst_us) worst_us = took;
+                uint8_t bucket = (took == 0 ? 0 : 32 - __builtin_clz(took));
+                histogram[bucket < buckets ? bucket : buckets - 1]++;
+
+                if (is_caught) Map::pick_clear_square(game.player.x, game.player.y, 4, false, &game.player.x, &game.player.y);
+            }
+
+            // NOTE 'sum' is printed so the timed loops can't be optimised away
+            printf("SCHEDULE %u phantoms, %s: %lu us worst (%lu)\n", counts[c], is_staggered ? "spread" : "at once", worst_us, sum);
+            for (uint8_t b = 0 ; b < buckets ; ++b) {
+                if (histogram[b] == 0) continue;
+                char range[16];
+                if (b < 2) {
+                    snprintf(range, sizeof(range), "%u", b);
+                } else {
+                    snprintf(range, sizeof(range), b < buckets - 1 ? "%lu-%lu" : "%lu+", 1ul << (b - 1), (1ul << b) - 1);
+                }
+
+                printf("  %9s us: %lu frames\n", range, histogram[b]);
+            }
+        }
+    }
+
+    game.phantoms = saved;
+    game.player = player;
+    game.phantom_speed = speed;
+    game.last_phantom_move = last_move;
+    Map::reset_occupancy();
+}
+
+
+/**
+    Check the Phantoms' table-driven move decisions against the
+    branches `Phantom::move()` used to take, for every input: every
+    set of available and field-favoured exits, vector to the player,
+    backing-off state and last move, each from a spread of random
+    generator states. Each must pick the same way, leave the same
+    backing-off state and draw the same random numbers. Then time
+    both, by how the way is picked: the only favoured exit, one of a
+    favoured pair, or any exit.
+ */
+void decisions() {
+    const int8_t signs[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+    const uint8_t directions[5] = {DIRECTION_NORTH, PHANTOM_NORTH, PHANTOM_EAST, PHANTOM_SOUTH, PHANTOM_WEST};
+    const char* kinds[3] = {"one way", "pair", "any"};
+    const uint8_t states = 8;
+    const uint8_t repeats = 8;
+    tinymt32_t saved = tinymt_store;
+
+    uint32_t checked = 0;
+    uint32_t errors = 0;
+    uint32_t count[3] = {0};
+    uint32_t table_us[3] = {0};
+    uint32_t branch_us[3] = {0};
+    uint32_t sum = 0;
+    for (uint8_t available = 1 ; available < 16 ; ++available) {
+        for (uint8_t toward = 0 ; toward < 16 ; ++toward) {
+            for (uint8_t s = 0 ; s < 8 ; ++s) {
+                for (uint8_t back = 0 ; back < 2 ; ++back) {
+                    for (uint8_t d = 0 ; d < 5 ; ++d) {
+                        int16_t dx = signs[s][0];
+                        int16_t dy = signs[s][1];
+
+                        // Check every input from several generator states
+                        uint8_t kind = 0;
+                        for (uint8_t i = 0 ; i < states ; ++i) {
+                            tinymt32_generate_uint32(&tinymt_store);
+                            tinymt32_t state = tinymt_store;
+                            uint8_t branch_back = back;
+                            uint8_t branch_way = branch_direction(dx, dy, available, toward, directions[d], &branch_back);
+                            tinymt32_t branch_state = tinymt_store;
+
+                            tinymt_store = state;
+                            uint8_t table_back = back;
+                            uint8_t favoured = Phantom::favour(dx, dy, available, toward, directions[d], &table_back);
+                            uint8_t table_way = Phantom::pick_direction(available, favoured, directions[d], &table_back);
+                            if (table_way != branch_way || table_back != branch_back || memcmp(&tinymt_store, &branch_state, sizeof(tinymt32_t)) != 0) {
+                                #ifdef DEBUG
+                                printf("BAD DECISION: %u %u %i %i %u %u\n", available, toward, dx, dy, back, directions[d]);
+                                #endif
+                                ++errors;
+                            }
+
+                            uint8_t usable = __builtin_popcount(available & favoured);
+                            kind = (usable == 1 ? 0 : (usable == 2 ? 1 : 2));
+                            ++checked;
+                        }
+
+                        // Time both ways of deciding
+                        uint32_t start = time_us_32();
+                        for (uint8_t i = 0 ; i < repeats ; ++i) {
+                            uint8_t steps = back;
+                            sum += branch_direction(dx, dy, available, toward, directions[d], &steps);
+                        }
+
+                        branch_us[kind] += time_us_32() - start;
+
+                        start = time_us_32();
+                        for (uint8_t i = 0 ; i < repeats ; ++i) {
+                            uint8_t steps = back;
+                            uint8_t favoured = Phantom::favour(dx, dy, available, toward, directions[d], &steps);
+                            sum += Phantom::pick_direction(available, favoured, directions[d], &steps);
+                        }
+
+                        table_us[kind] += time_us_32() - start;
+                        count[kind] += repeats;
+                    }
+                }
+            }
+        }
+    }
+
+    // NOTE 'sum' is printed so the timed loops can't be optimised away
+    printf("DECISIONS: %lu checked, %lu errors (%lu)\n", checked, errors, sum);
+    for (uint8_t k = 0 ; k < 3 ; ++k) {
+        if (count[k] == 0) continue;
+        printf("  %-8s %7lu: branches %lu ns, table %lu ns\n", kinds[k], count[k],
+               (uint32_t)((uint64_t)branch_us[k] * 1000 / count[k]), (uint32_t)((uint64_t)table_us[k] * 1000 / count[k]));
+    }
+
+    tinymt_store = saved;
+}
+
+
+/*
+    Make a move cycle's Phantom queries from every square of the
+    current map: see `occupancy()`. With `use_grid` unset, the queries
+    scan the Phantoms.
+ */
+static uint32_t sweep_phantoms(bool use_grid, uint32_t* queries) {
+    const int8_t range = 4;
+    uint32_t sum = 0;
+    uint32_t count = 0;
+
+    for (uint16_t y = 0 ; y < Map::height() ; ++y) {
+        for (uint16_t x = 0 ; x < Map::width() ; ++x) {
+            // Each Phantom's exits, then the senses check's box
+            // round the player, then the view ahead
+            uint16_t qx[64 + MAX_VIEW_RANGE];
+            uint16_t qy[64 + MAX_VIEW_RANGE];
+            uint8_t n = 0;
+            for (int8_t i = -range ; i < range ; ++i) {
+                for (int8_t j = -range ; j < range ; ++j) {
+                    qx[n] = x + j;
+                    qy[n++] = y + i;
+                }
+            }
+
+            for (uint8_t i = 0 ; i < MAX_VIEW_RANGE ; ++i) {
+                qx[n] = x;
+                qy[n++] = y - i;
+            }
+
+            for (Phantom& p : game.phantoms) {
+                uint16_t nx[4] = {p.x, (uint16_t)(p.x + 1), p.x, (uint16_t)(p.x - 1)};
+                uint16_t ny[4] = {(uint16_t)(p.y - 1), p.y, (uint16_t)(p.y + 1), p.y};
+                for (uint8_t d = 0 ; d < 4 ; ++d) {
+                    sum += use_grid ? Map::phantom_on_square(nx[d], ny[d]) : scan_phantom_on_square(nx[d], ny[d]);
+                }
+
+                count += 4;
+            }
+
+            for (uint8_t i = 0 ; i < n ; ++i) {
+                sum += use_grid ? Map::phantom_on_square(qx[i], qy[i]) : scan_phantom_on_square(qx[i], qy[i]);
+            }
+
+            count += n;
+        }
+    }
+
+    *queries += count;
+    return sum;
+}
+
+
+/*
+    Build a pack of one square map, `side` squares either way, from
+    copies of stock map 0 laid side by side.
+
+    - Returns: The size of the pack in bytes.
+ */
+static size_t tile_pack(uint8_t* pack, uint16_t side) {
+    MapPackHeader* head = (MapPackHeader*)pack;
+    head->magic = MAP_PACK_MAGIC;
+    head->version = MAP_PACK_VERSION;
+    head->count = 1;
+    head->width = side;
+    head->height = side;
+    head->record_size = MapPack::record_size(side, side);
+
+    MapPackMeta* info = (MapPackMeta*)(pack + sizeof(MapPackHeader));
+    info->start_x = MAP_PACK_NO_START;
+    info->start_y = MAP_PACK_NO_START;
+
+    uint8_t* grid = (uint8_t*)(info + 1);
+    uint16_t row_bytes = (side + 7) >> 3;
+    memset(grid, 0, head->record_size - sizeof(MapPackMeta));
+    for (uint16_t y = 0 ; y < side ; ++y) {
+        for (uint16_t x = 0 ; x < side ; ++x) {
+            if (MapPack::is_wall(map_pack, 0, x % MAP_PACK_WIDTH, y % MAP_PACK_HEIGHT)) {
+                grid[y * row_bytes + (x >> 3)] |= (1 << (x & 7));
+            }
+        }
+    }
+
+    return sizeof(MapPackHeader) + head->record_size;
+}
+
+
+/*
+    Look for Phantoms in the box round the player
+    the way `check_senses()` does, but silently.
+
+    - Returns: The number of Phantoms found.
+ */
+static uint32_t sense_phantoms(uint8_t range) {
+    uint32_t found = 0;
+    int dx = game.player.x - range;
+    int dy = game.player.y - range;
+    for (int x = dx ; x < dx + (range << 1) ; x++) {
+        if (x < 0) continue;
+        if (x >= Map::width()) break;
+        for (int y = dy ; y < dy + (range << 1) ; y++) {
+            if (y < 0) continue;
+            if (y >= Map::height()) break;
+            if (Map::phantom_on_square(x, y) != ERROR_CONDITION) ++found;
+        }
+    }
+
+    return found;
+}
+
+
+/*
+    Pick a clear square away from the player the way Phantoms used
+    to be placed: by drawing random squares until one will do.
+
+    - Returns: The number of squares drawn.
+ */
+static uint32_t sample_clear_square(uint8_t margin, uint16_t* x, uint16_t* y) {
+    uint32_t draws = 0;
+    while (true) {
+        ++draws;
+        uint16_t new_x = Utils::irandom(0, Map::width());
+        uint16_t new_y = Utils::irandom(0, Map::height());
+        if ((new_x < game.player.x - margin || new_x > game.player.x + margin) && (new_y < game.player.y - margin || new_y > game.player.y + margin)) {
+            if (Map::get_square_contents(new_x, new_y) == MAP_TILE_CLEAR) {
+                *x = new_x;
+                *y = new_y;
+                return draws;
+            }
+        }
+    }
+}
+
+
+/*
+    Move the player one square, through a random exit.
+ */
+static void step_player() {
+    uint8_t exits = Map::get_exits(game.player.x, game.player.y);
+    if (exits == 0) return;
+
+    uint8_t exit = 0;
+    do {
+        exit = 1 << (tinymt32_generate_uint32(&tinymt_store) & 0x03);
+    } while ((exits & exit) == 0);
+
+    if (exit == PHANTOM_NORTH) game.player.y--;
+    if (exit == PHANTOM_EAST) game.player.x++;
+    if (exit == PHANTOM_SOUTH) game.player.y++;
+    if (exit == PHANTOM_WEST) game.player.x--;
+}
+
+
+/*
+    Move the first Phantom until it catches the player,
+    or has had `limit` moves.
+
+    - Returns: The number of moves made.
+ */
+static uint32_t chase(uint16_t limit) {
+    Phantom &p = game.phantoms[0];
+    for (uint16_t i = 0 ; i < limit ; ++i) {
+        Pursuit::update();
+        if (p.move()) return i;
+    }
+
+    return limit;
+}
+
+
+/*
+    Pick a Phantom's way the way `Phantom::move()` used to: by
+    branches, counting round the exits for a random pick. See
+    `Phantom::favour()` and `Phantom::pick_direction()`.
+ */
+static uint8_t branch_direction(int16_t dx, int16_t dy, uint8_t available, uint8_t toward, uint8_t direction, uint8_t* back_steps) {
+    uint8_t exit_count = __builtin_popcount(available);
+    uint8_t came_from = PHANTOM_NORTH;
+    if (direction == PHANTOM_WEST)  came_from = PHANTOM_EAST;
+    if (direction == PHANTOM_EAST)  came_from = PHANTOM_WEST;
+    if (direction == PHANTOM_NORTH) came_from = PHANTOM_SOUTH;
+
+    uint8_t favoured = 0;
+    if (toward != 0) {
+        favoured = toward;
+        *back_steps = 0;
+    } else {
+        uint8_t from = 0;
+        if (*back_steps > 0) {
+            from = came_from;
+            if (exit_count > 2) {
+                *back_steps = 0;
+            } else {
+                dx *= -1;
+                dy *= -1;
+            }
+        }
+
+        if (dy > 0) favoured |= PHANTOM_NORTH;
+        if (dy < 0) favoured |= PHANTOM_SOUTH;
+        if (dx > 0) favoured |= PHANTOM_WEST;
+        if (dx < 0) favoured |= PHANTOM_EAST;
+        favoured &= (~from);
+    }
+
+    uint8_t usable = 0;
+    uint8_t count = 0;
+    for (uint8_t i = 0 ; i < 4 ; ++i) {
+        if ((available & (1 << i)) && (favoured & (1 << i))) {
+            ++count;
+            usable |= (1 << i);
+        }
+    }
+
+    if (count == 1) return usable;
+
+    uint8_t r = 0;
+    if (count == 2) {
+        r = (Utils::irandom(1, 100) % 2);
+    } else {
+        uint8_t ad = available & (~came_from);
+        if (ad != 0) available = ad;
+        usable = available;
+        r = Utils::irandom(0, 4);
+        *back_steps = 1;
+    }
+
+    uint8_t i = 0;
+    while (true) {
+        if (usable & (1 << i)) {
+            if (r == 0) return (usable & (1 << i));
+            r--;
+        }
+
+        ++i;
+        if (i > 3) i = 0;
+    }
+}
+
+
+/*
+    Find the Phantom on a square the way `Map::phantom_on_square()`
+    used to: by checking every Phantom in turn.
+ */
+static uint8_t scan_phantom_on_square(uint16_t x, uint16_t y) {
+    size_t number = game.phantoms.size();
+    for (size_t i = 0 ; i < number ; ++i) {
+        Phantom &p = game.phantoms.at(i);
+        if (x == p.x && y == p.y) return (i & 0x0F);
+    }
+
+    return ERROR_CONDITION;
+}
+
+
+/*
+    Find a view distance the way `Map::get_view_distance()` used to:
+    one square at a time, from the entity to the nearest wall.
+ */
+static uint8_t walk_view_distance(int16_t x, int16_t y, uint8_t direction) {
+    int8_t dx = direction == DIRECTION_EAST ? 1 : (direction == DIRECTION_WEST ? -1 : 0);
+    int8_t dy = direction == DIRECTION_SOUTH ? 1 : (direction == DIRECTION_NORTH ? -1 : 0);
+    uint8_t count = 0;
+
+    while (true) {
+        x += dx;
+        y += dy;
+        if (Map::get_square_contents(x, y) == MAP_TILE_WALL) break;
+        ++count;
+    }
+
+    if (count > MAX_VIEW_RANGE) count = MAX_VIEW_RANGE;
+    return count;
+}
+
+
+}   // namespace Bench
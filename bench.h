@@ -0,0 +1,34 @@
+/*
+ * Phantom Slayer
+ * On-device performance benchmarks
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _BENCHMARK_HEADER_
+#define _BENCHMARK_HEADER_
+
+
+/*
+ *      PROTOTYPES
+ */
+namespace Bench {
+    void        run();
+    void        view();
+    void        bands();
+    void        step();
+    void        walls();
+    void        occupancy();
+    void        sizes();
+    void        placement();
+    void        pursuit();
+    void        swarm();
+    void        schedule();
+    void        decisions();
+}
+
+
+#endif  // _BENCHMARK_HEADER_
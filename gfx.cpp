@@ -20,126 +20,257 @@ using std::string;
 extern tinymt32_t       tinymt_store;
 extern Game             game;
 extern Rect             rects[7];
-extern uint8_t          dead_phantom;
+extern FrameStats       frame_stats;
 
 
 /*
  *      GLOBALS
  */
 const uint8_t           radii[5] = {20, 16, 12, 8, 4};
-buffer_t*               word_buffer = buffer(82, 70, (void *)word_sprites);
-buffer_t*               phantom_buffer = buffer(173, 150, (void *)phantom_sprites);
-buffer_t*               zapped_buffer = buffer(173, 150, (void *)zapped_sprites);
-buffer_t*               logo_buffer = buffer(212, 20, (void *)logo_sprite);
-buffer_t*               credit_buffer = buffer(104, 34, (void *)credit_sprite);
-color_t                 side_data[240 * 240] __attribute__ ((aligned (4))) = {0};
-buffer_t*               side_buffer = buffer(240, 240, side_data);
+buffer_t*               word_buffer = buffer(WORD_SHEET_WIDTH, WORD_SHEET_HEIGHT, (void *)word_sprites);
+buffer_t*               logo_buffer = buffer(LOGO_SHEET_WIDTH, LOGO_SHEET_HEIGHT, (void *)logo_sprites);
+buffer_t*               credit_buffer = buffer(CREDIT_SHEET_WIDTH, CREDIT_SHEET_HEIGHT, (void *)credit_sprites);
+int8_t                  overlay_delta = 0;
+uint8_t                 view_bands = VIEW_BANDS;
+RenderJob               turn_job;
+
+// A hit Phantom is drawn with these colours swapped: from, to.
+// Other colours are unchanged
+const uint16_t          zapped_palette[] = {
+    0x00ff, 0xffff,
+    0x00ef, 0xffff,
+    0x0ff0, 0x0000,
+    0x0f20, 0x0000
+};
+
+const uint8_t           zapped_palette_size = sizeof(zapped_palette) / sizeof(uint16_t) / 2;
 
 
 namespace Gfx {
 
 
+/*
+ *      STATIC PROTOTYPES
+ */
+static void clear_hud();
+static color_t mix(color_t src, color_t dst, uint8_t alpha, uint8_t shift);
+static void blend_pixel(color_t src, color_t* dst);
+static color_t remap(color_t colour);
+
+
 /**
-    Render a single viewpoint frame at the specified square.
-    Progressively draw in walls, square by square, moving away
-    from (x,y) in the specified direction.
+    Make the drawing decisions for an in-play frame. Nothing is drawn
+    if the frame is unchanged, and only the overlay region is redrawn
+    if nothing else has changed.
+    NOTE This is called on core 1, before either core draws its bands.
 
     - Parameters:
+        - frame: The snapshot to draw.
+        - job:   The job to fill in.
+ */
+void prepare_frame(const Frame& frame, RenderJob* job) {
+    job->is_skipped = (frame.dirty == DIRTY_NONE);
+    if (job->is_skipped) {
+        frame_stats.skipped++;
+        return;
+    }
+
+    plan_view(frame, frame.viewer.x, frame.viewer.y, frame.viewer.direction, job);
+
+    if (frame.dirty & DIRTY_VIEW) {
+        clear_hud();
+        frame_stats.full++;
+    } else {
+        // Only the laser overlay has changed, so just repaint the
+        // part of the view it covers, now and on the last frame: the
+        // zap, which is always centred, and the reticule, which is
+        // shifted toward the Phantom it's on
+        int8_t low = 0;
+        int8_t high = 0;
+        if (game.crosshair_delta < low) low = game.crosshair_delta;
+        if (overlay_delta < low) low = overlay_delta;
+        if (game.crosshair_delta > high) high = game.crosshair_delta;
+        if (overlay_delta > high) high = overlay_delta;
+        job->clip_x = OVERLAY_X + low;
+        job->clip_y = OVERLAY_Y;
+        job->clip_w = OVERLAY_SIZE + high - low;
+        job->clip_h = OVERLAY_SIZE;
+        frame_stats.overlay++;
+    }
+}
+
+
+/**
+    Draw one core's share of a frame's bands: every other band,
+    starting at `first`.
+
+    - Parameters:
+        - job:   The frame's drawing decisions.
+        - first: The index of the first band to draw.
+ */
+void draw_bands(const RenderJob& job, uint8_t first) {
+    if (job.is_skipped) return;
+    for (uint8_t i = first ; i < view_bands ; i += 2) {
+        draw_band(job, VIEW_TOP + VIEW_HEIGHT * i / view_bands, VIEW_TOP + VIEW_HEIGHT * (i + 1) / view_bands);
+    }
+}
+
+
+/**
+    Complete an in-play frame, once all of its bands have been drawn,
+    by adding the laser overlays.
+    NOTE This is called on core 0.
+
+    - Parameters:
+        - frame: The snapshot being drawn.
+        - job:   The frame's drawing decisions.
+ */
+void finish_frame(const Frame& frame, const RenderJob& job) {
+    if (job.is_skipped) return;
+
+    // Don't show gunnery if a Phantom has been hit
+    if (frame.state != ZAP_PHANTOM) {
+        clip(job.clip_x, job.clip_y, job.clip_w, job.clip_h);
+
+        // Is the laser being fired?
+        if (frame.is_firing) draw_zap(frame.zap_frame);
+
+        // Has the player primed the laser?
+        if (frame.show_reticule) draw_reticule();
+
+        clip();
+    }
+
+    overlay_delta = game.crosshair_delta;
+}
+
+
+/**
+    Render a single viewpoint frame at the specified square,
+    in one go, into the current draw target.
+
+    - Parameters:
+        - frame:      The snapshot being drawn.
+        - x:          The square's X co-ordinate.
+        - y:          The square's Y co-ordinate.
+        - directions: The direction in which the viewer is facing.
+ */
+void draw_screen(const Frame& frame, uint16_t x, uint16_t y, uint8_t direction) {
+    RenderJob job;
+    plan_view(frame, x, y, direction, &job);
+    clear_hud();
+    draw_band(job, VIEW_TOP, VIEW_TOP + VIEW_HEIGHT);
+}
+
+
+/**
+    Work out what a viewpoint frame at the specified square contains:
+    the corridor, keyed on the view's signature, and where each
+    visible Phantom goes, furthest forward first.
+
+    - Parameters:
+        - frame:      The snapshot being drawn.
         - x:          The square's X co-ordinate.
         - y:          The square's Y co-ordinate.
         - directions: The direction in which the viewer is facing.
+        - job:        The job to fill in.
  */
-void draw_screen(uint8_t x, uint8_t y, uint8_t direction) {
+void plan_view(const Frame& frame, uint16_t x, uint16_t y, uint8_t direction, RenderJob* job) {
     uint8_t far_frame = Map::get_view_distance(x, y, direction);
-    int8_t frame = far_frame;
 
     // Set 'phantom_count' upper nibble to total number of
     // Phantoms facing the player; lower nibble is the 'current'
     // Phantom if the player can see more than one
-    uint8_t phantom_count = count_facing_phantoms(far_frame);
+    uint8_t phantom_count = count_facing_phantoms(frame, far_frame);
     phantom_count = (phantom_count << 4) | phantom_count;
-    uint8_t i = 0;
-
-    // Clear the screen
-    cls(BLACK);
-
-    if (game.state == DO_TELEPORT_ONE) {
-        // 3D View: red
-        pen(RED);
-        frect(0, 40, 240, 160);
-    } else {
-        // 3D View: yellow
-        pen(15, 15, 0);
-        frect(0, 40, 240, 160);
-    }
 
+    job->target = _dt;
+    job->offset = 0;
+    job->clip_x = 0;
+    job->clip_y = 0;
+    job->clip_w = 240;
+    job->clip_h = 240;
+    job->is_skipped = false;
+
+    // The corridor
+    job->signature = View::signature(frame, x, y, direction);
+    job->corridor = View::prepare(job->signature);
+
+    // Run through the squares from the view limit (inner frame) forward
+    // to the viewer's current square (outer frame), checking for the
+    // presence of a Phantom on each one and, if there is, place it
+    // NOTE 'phantom_count comes back so we can keep track of multiple
+    //      Phantoms in the player's field of view and space them
+    //      laterally
+    int8_t dx = 0;
+    int8_t dy = 0;
     switch(direction) {
         case DIRECTION_NORTH:
-            // Viewer is facing north, so left = West, right = East
-            // Run through the squares from the view limit (inner frame) forward
-            // to the player's current square (outer frame)
-            i = y - far_frame;
-            do {
-                // Draw the current frame
-                draw_section(x, i, DIRECTION_WEST, DIRECTION_EAST, frame, far_frame);
-
-                // Check for the presence of a Phantom on the drawn square
-                // and, if there is, draw it in
-                // NOTE 'phantom_count comes back so we can keep track of multiple
-                //      Phantoms in the player's field of view and space them
-                //      laterally
-                uint8_t n = Map::phantom_on_square(x, i);
-                if (phantom_count > 0 && n != ERROR_CONDITION) {
-                    draw_phantom(frame, &phantom_count, (n == dead_phantom));
-                }
-
-                // Move to the next frame and square
-                --frame;
-                ++i;
-            } while (frame >= 0);
-        break;
-
+            dy = -1;
+            break;
         case DIRECTION_EAST:
-            i = x + far_frame;
-            do {
-                draw_section(i, y, DIRECTION_NORTH, DIRECTION_SOUTH, frame, far_frame);
-                uint8_t n = Map::phantom_on_square(i, y);
-                if (phantom_count > 0 && n != ERROR_CONDITION) {
-                    draw_phantom(frame, &phantom_count, (n == dead_phantom));
-                }
-                --frame;
-                --i;
-            } while (frame >= 0);
+            dx = 1;
             break;
-
         case DIRECTION_SOUTH:
-            i = y + far_frame;
-            do {
-                draw_section(x, i, DIRECTION_EAST, DIRECTION_WEST, frame, far_frame);
-                uint8_t n = Map::phantom_on_square(x, i);
-                if (phantom_count > 0 && n != ERROR_CONDITION) {
-                    draw_phantom(frame, &phantom_count, (n == dead_phantom));
-                }
-                --frame;
-                --i;
-            } while (frame >= 0);
+            dy = 1;
             break;
-
         default:
-            i = x - far_frame;
-            do {
-                draw_section(i, y, DIRECTION_SOUTH, DIRECTION_NORTH, frame, far_frame);
-                uint8_t n = Map::phantom_on_square(i, y);
-                if (phantom_count > 0 && n != ERROR_CONDITION) {
-                    draw_phantom(frame, &phantom_count, (n == dead_phantom));
-                }
-                --frame;
-                ++i;
-            } while (frame >= 0);
+            dx = -1;
+    }
+
+    // Part way through a step, Phantoms past half way
+    // through it are drawn a frame nearer
+    job->sprite_count = 0;
+    for (int8_t f = far_frame ; f >= 0 ; --f) {
+        uint8_t n = Map::phantom_on_square(frame, x + dx * f, y + dy * f);
+        if (phantom_count > 0 && n != ERROR_CONDITION && job->sprite_count < MAX_PHANTOMS) {
+            uint8_t sprite_frame = (f > 0 && frame.phase >= (VIEW_PHASES >> 1)) ? f - 1 : f;
+            place_phantom(sprite_frame, &phantom_count, (n == frame.dead_phantom), &job->sprites[job->sprite_count++]);
+        }
     }
 }
 
 
+/**
+    Draw the rows of a view from `top` down to, but not including,
+    `bottom`. Nothing outside those rows (or the job's clip rectangle)
+    is written, and no SDK drawing state is used, so the two cores
+    can each draw a band of the same frame at the same time.
+
+    - Parameters:
+        - job:    The frame's drawing decisions.
+        - top:    The band's first row, in screen co-ordinates.
+        - bottom: The row below the band, in screen co-ordinates.
+ */
+void draw_band(const RenderJob& job, int32_t top, int32_t bottom) {
+    // Clip the band to the job's clip rectangle
+    int32_t x0 = job.clip_x;
+    int32_t x1 = job.clip_x + job.clip_w;
+    if (top < job.clip_y) top = job.clip_y;
+    if (bottom > job.clip_y + job.clip_h) bottom = job.clip_y + job.clip_h;
+    if (bottom <= top) return;
+
+    View::render(job.target, job.signature, job.corridor, x0, top, x1 - x0, bottom - top, job.offset);
+    for (uint8_t i = 0 ; i < job.sprite_count ; ++i) {
+        blit_phantom(job.target, job.sprites[i], x0, top, x1, bottom, job.offset);
+    }
+}
+
+
+/**
+    Set the number of horizontal bands the view is split into
+    for drawing on both cores.
+
+    - Parameters:
+        - count: The number of bands, 1 to `MAX_VIEW_BANDS`.
+ */
+void set_bands(uint8_t count) {
+    if (count < 1) count = 1;
+    if (count > MAX_VIEW_BANDS) count = MAX_VIEW_BANDS;
+    view_bands = count;
+}
+
+
 /**
     Draw a section of the view, ie. a frame.
 
@@ -154,15 +285,16 @@ void draw_screen(uint8_t x, uint8_t y, uint8_t direction) {
     - Returns: `true` when we've got to the furthest rendered square,
                `false` otherwise
  */
-bool draw_section(uint8_t x, uint8_t y, uint8_t left_dir, uint8_t right_dir, uint8_t current_frame, uint8_t furthest_frame) {
+bool draw_section(uint16_t x, uint16_t y, uint8_t left_dir, uint8_t right_dir, uint8_t current_frame, uint8_t furthest_frame) {
     // Is the square a teleporter? If so, draw it
     if (x == game.tele_x && y == game.tele_y) draw_teleporter(current_frame);
 
     // Draw in left and right wall segments
     // NOTE Second argument is true or false: wall section is
     //      open or closed, respectively
-    draw_left_wall(current_frame, (Map::get_view_distance(x, y, left_dir) > 0));
-    draw_right_wall(current_frame, (Map::get_view_distance(x, y, right_dir) > 0));
+    uint8_t exits = Map::get_exits(x, y);
+    draw_left_wall(current_frame, (exits & (1 << left_dir)) != 0);
+    draw_right_wall(current_frame, (exits & (1 << right_dir)) != 0);
 
     // Have we reached the furthest square the viewer can see?
     if (current_frame == furthest_frame) {
@@ -313,14 +445,16 @@ void draw_reticule() {
 
 
 /**
-    Draw a Phantom in the specified frame - which determines
+    Place a Phantom in the specified frame - which determines
     its x and y co-ordinates in the frame.
 
     - Parameters:
         - frame_index: The frame in which to place the Phantom.
         - count:       The number of Phantoms on screen.
+        - is_zapped:   Whether the Phantom has been hit.
+        - sprite:      The sprite placement to fill in.
  */
-void draw_phantom(uint8_t frame_index, uint8_t* count, bool is_zapped) {
+void place_phantom(uint8_t frame_index, uint8_t* count, bool is_zapped, PhantomSprite* sprite) {
     Rect r = rects[frame_index];
     uint8_t dx = 120;
     uint8_t c = *count;
@@ -345,21 +479,81 @@ void draw_phantom(uint8_t frame_index, uint8_t* count, bool is_zapped) {
     }
 
     // NOTE Screen render frame indices run from 0 to 5, front to back
-    uint8_t height = phantom_sizes[frame_index * 2];
-    uint8_t width =  phantom_sizes[frame_index * 2 + 1];
-    uint8_t sx =  0;
-    uint8_t sy =  0;
+    uint8_t height = phantom_frames[frame_index].height;
+    uint8_t width =  phantom_frames[frame_index].width;
     uint8_t dy = 120 - (height >> 1);
     dx -= (width >> 1);
 
-    if (frame_index > 0) {
-        for (uint8_t i = 0 ; i < frame_index ; i++) {
-            sx += phantom_sizes[i * 2 + 1];
+    sprite->frame = frame_index;
+    sprite->width = width;
+    sprite->height = height;
+    sprite->dx = dx;
+    sprite->dy = dy;
+    sprite->is_zapped = is_zapped;
+}
+
+
+/**
+    Paint in a Phantom, clipped to the specified rectangle, from its
+    run-length encoded sheet. Transparent pixels are skipped, opaque
+    runs copied, and the rest blended as the SDK's `ALPHA` mode does.
+    Hit Phantoms are recoloured through `zapped_palette` on the way.
+
+    - Parameters:
+        - target: The buffer to paint into.
+        - sprite: The Phantom's placement.
+        - x0:     The clip rectangle's left edge.
+        - y0:     The clip rectangle's top edge.
+        - x1:     The column right of the clip rectangle.
+        - y1:     The row below the clip rectangle.
+        - offset: How far left of its place in the view to paint each column.
+ */
+void blit_phantom(buffer_t* target, const PhantomSprite& sprite, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t offset) {
+    // Only the frame's stored rows need painting
+    const RleSheet& sheet = phantom_sheet;
+    const RleFrame& frame = sheet.frames[sprite.frame];
+    int32_t top = sprite.dy + frame.top;
+    if (sprite.dx > x0) x0 = sprite.dx;
+    if (top > y0) y0 = top;
+    if (sprite.dx + sprite.width < x1) x1 = sprite.dx + sprite.width;
+    if (top + frame.rows < y1) y1 = top + frame.rows;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    const uint16_t* rows = sheet.rows + frame.first_row + (y0 - top);
+    color_t* line = target->data + y0 * target->w - offset;
+
+    for (int32_t y = y0 ; y < y1 ; ++y) {
+        const uint16_t* ps = sheet.data + *rows++;
+        uint16_t runs = *ps++;
+        int32_t x = sprite.dx;
+
+        while (runs--) {
+            x += *ps++;
+            uint16_t count = *ps & RLE_COUNT_MASK;
+            bool do_blend = (*ps++ & RLE_BLEND) != 0;
+            if (x >= x1) break;
+
+            // Clip the run to [x0, x1)
+            int32_t from = x < x0 ? x0 : x;
+            int32_t to = x + count > x1 ? x1 : x + count;
+            if (to > from) {
+                const color_t* src = ps + (from - x);
+                color_t* dst = line + from;
+                if (sprite.is_zapped) {
+                    for (int32_t i = 0 ; i < to - from ; ++i) blend_pixel(remap(src[i]), &dst[i]);
+                } else if (do_blend) {
+                    for (int32_t i = 0 ; i < to - from ; ++i) blend_pixel(src[i], &dst[i]);
+                } else {
+                    memcpy(dst, src, (to - from) * sizeof(color_t));
+                }
+            }
+
+            ps += count;
+            x += count;
         }
-    }
 
-    // Paint in the Phantom
-    blit(is_zapped ? zapped_buffer : phantom_buffer, sx, sy, width, height, dx, dy);
+        line += target->w;
+    }
 }
 
 
@@ -367,20 +561,17 @@ void draw_phantom(uint8_t frame_index, uint8_t* count, bool is_zapped) {
     Display a pre-rendered word graphic.
 
     - Parameters:
-        - index: The word's index in the `word_sizes` array.
+        - index: The word's index in the `word_frames` array.
         - x:     The target X co-ordinate.
         - y:     The target Y co-ordinate.
  */
 void draw_word(uint8_t index, uint8_t x, uint8_t y, bool do_double) {
-    uint8_t w_x = word_sizes[index * 3];
-    uint8_t w_y = word_sizes[index * 3 + 1];
-    uint8_t w_len = word_sizes[index * 3 + 2];
-
+    const SpriteFrame& word = word_frames[index];
 
     if (do_double) {
-        blit(word_buffer, w_x, w_y, w_len, 10, x, y, (w_len << 1), 20);
+        blit(word_buffer, word.x, word.y, word.width, word.height, x, y, (word.width << 1), (word.height << 1));
     } else {
-        blit(word_buffer, w_x, w_y, w_len, 10, x, y);
+        blit(word_buffer, word.x, word.y, word.width, word.height, x, y);
     }
 }
 
@@ -389,7 +580,7 @@ void draw_word(uint8_t index, uint8_t x, uint8_t y, bool do_double) {
     Display a pre-rendered single-digit number graphic.
 
     - Parameters:
-        - index:     The word's index in the `word_sizes` array.
+        - index:     The word's index in the `word_frames` array.
         - x:         The target X co-ordinate.
         - y:         The target Y co-ordinate.
         - do_double: Render at 2x size.
@@ -443,21 +634,34 @@ void animate_credit(int16_t y) {
 
 
 /**
-    Draw the side view - the view the player will see next -
-    to the side buffer.
+    Plan the side view - the view the player will see next - so
+    that the turn animation can draw it in one slice at a time.
  */
 void animate_turn() {
-    // Draw the side view
-    target(side_buffer);
-    cls(BLACK);
-    draw_screen(game.player.x, game.player.y, game.player.direction);
-
-    // Reset back to the main display
-    target(SCREEN);
+    Frame frame;
+    take_snapshot(&frame);
+    plan_view(frame, game.player.x, game.player.y, game.player.direction, &turn_job);
+    clear_hud();
     blend(COPY);
 }
 
 
+/**
+    Draw one `SLICE`-wide column strip of the side view for
+    the turn animation.
+
+    - Parameters:
+        - sx: The strip's left edge in the side view.
+        - dx: The screen X co-ordinate to draw the strip at.
+ */
+void draw_turn_slice(int32_t sx, int32_t dx) {
+    turn_job.offset = sx - dx;
+    turn_job.clip_x = sx;
+    turn_job.clip_w = SLICE;
+    draw_band(turn_job, VIEW_TOP, VIEW_TOP + VIEW_HEIGHT);
+}
+
+
 /**
     Streamlined (sort of) blit code for left and right turn animations.
 
@@ -484,6 +688,67 @@ void alt_blit(buffer_t *src, int32_t sx, int32_t sy, int32_t w, int32_t h, int32
 }
 
 
+/**
+    Write the in-play redraw counts, and the average cost of help
+    screen frames, to the debug console.
+ */
+void show_debug_info() {
+    printf("FRAMES FULL: %lu, OVERLAY ONLY: %lu, SKIPPED: %lu\n", frame_stats.full, frame_stats.overlay, frame_stats.skipped);
+    if (frame_stats.static_full > 0) {
+        printf("HELP FRAMES DRAWN: %lu (%lu us each), SKIPPED: %lu (%lu us each)\n",
+               frame_stats.static_full, frame_stats.static_full_us / frame_stats.static_full,
+               frame_stats.static_skipped, frame_stats.static_skipped > 0 ? frame_stats.static_skipped_us / frame_stats.static_skipped : 0);
+    }
+}
+
+
+/*
+    Clear the areas above and below the 3D view.
+ */
+static void clear_hud() {
+    pen(BLACK);
+    frect(0, 0, 240, VIEW_TOP);
+    frect(0, VIEW_TOP + VIEW_HEIGHT, 240, 240 - VIEW_TOP - VIEW_HEIGHT);
+}
+
+
+/*
+    Paint one pixel over another, according to its alpha.
+ */
+static void blend_pixel(color_t src, color_t* dst) {
+    uint8_t a = (src >> 4) & 0x0F;
+    if (a == 0x0F) {
+        *dst = src;
+    } else if (a > 0) {
+        // Mix the red, blue and green nibbles; keep the alpha
+        color_t d = *dst;
+        *dst = (d & 0x00F0) | mix(src, d, a, 0) | mix(src, d, a, 8) | mix(src, d, a, 12);
+    }
+}
+
+
+/*
+    Swap a Phantom colour for its hit colour.
+ */
+static color_t remap(color_t colour) {
+    for (uint8_t i = 0 ; i < zapped_palette_size ; ++i) {
+        if (zapped_palette[i * 2] == colour) return zapped_palette[i * 2 + 1];
+    }
+
+    return colour;
+}
+
+
+/*
+    Blend one colour nibble of `src` over `dst`.
+ */
+static color_t mix(color_t src, color_t dst, uint8_t alpha, uint8_t shift) {
+    uint8_t s = (src >> shift) & 0x0F;
+    uint8_t d = (dst >> shift) & 0x0F;
+    return ((s * alpha + d * (15 - alpha)) / 15) << shift;
+}
+
+
 void cls(color_t colour) {
     pen(colour);
     clear();
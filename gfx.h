@@ -27,13 +27,23 @@ using namespace picosystem;
 #define PHRASE_ANY_KEY          8
 #define PHRASE_PLAYER_DEAD      9
 
+// The view is drawn in horizontal bands, shared between the cores
+#define VIEW_BANDS              2
+#define MAX_VIEW_BANDS          16
+
 
 /*
  *      PROTOTYPES
  */
 namespace Gfx {
-    void        draw_screen(uint8_t x, uint8_t y, uint8_t direction);
-    bool        draw_section(uint8_t x, uint8_t y, uint8_t left_dir, uint8_t right_dir,
+    void        prepare_frame(const Frame& frame, RenderJob* job);
+    void        draw_bands(const RenderJob& job, uint8_t first);
+    void        finish_frame(const Frame& frame, const RenderJob& job);
+    void        draw_screen(const Frame& frame, uint16_t x, uint16_t y, uint8_t direction);
+    void        plan_view(const Frame& frame, uint16_t x, uint16_t y, uint8_t direction, RenderJob* job);
+    void        draw_band(const RenderJob& job, int32_t top, int32_t bottom);
+    void        set_bands(uint8_t count);
+    bool        draw_section(uint16_t x, uint16_t y, uint8_t left_dir, uint8_t right_dir,
                              uint8_t current_frame, uint8_t furthest_frame);
     void        draw_floor_line(uint8_t frame_index);
     void        draw_teleporter(uint8_t frame_index);
@@ -44,7 +54,10 @@ namespace Gfx {
     void        draw_reticule();
     void        draw_zap(uint8_t frame);
     void        animate_turn();
-    void        draw_phantom(uint8_t frame_number, uint8_t* phantom_count, bool is_zapped);
+    void        draw_turn_slice(int32_t sx, int32_t dx);
+    void        place_phantom(uint8_t frame_number, uint8_t* phantom_count, bool is_zapped, PhantomSprite* sprite);
+    void        blit_phantom(buffer_t* target, const PhantomSprite& sprite, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                             int32_t offset = 0);
 
     void        draw_word(uint8_t index, uint8_t x, uint8_t y, bool do_double);
     void        draw_number(uint8_t number, uint8_t x, uint8_t y, bool do_double = false);
@@ -59,16 +72,4 @@ namespace Gfx {
 }
 
 
-/*
- *      EXTERNALLY-DEFINED GLOBALS
- */
-extern const uint16_t   phantom_sprites[];
-extern const uint16_t   zapped_sprites[];
-extern const uint8_t    phantom_sizes[];
-extern const uint8_t    word_sizes[];
-extern const uint16_t   word_sprites[];
-extern const uint16_t   logo_sprite[];
-extern const uint16_t   credit_sprite[];
-
-
 #endif  // _GFX_UTILS_HEADER_
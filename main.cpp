@@ -19,32 +19,39 @@ uint8_t     count_down = 5;
 uint8_t     dead_phantom = ERROR_CONDITION;
 uint8_t     help_page_count = 0;
 uint8_t     stab_count = 0;
+uint8_t     step_phase = 0;
 
 int16_t     logo_y = -21;
 int32_t     anim_x = 0;
+int32_t     drawn_x = 0;
+uint8_t     drawn_state = NOT_IN_PLAY;
 
-uint32_t    tele_flash_time = 0;
+uint64_t    tele_flash_time = 0;
 uint32_t    tick_count = 0;
 
+uint64_t    sim_last_update = 0;
+uint64_t    sim_banked = 0;
+uint8_t     sim_keys = 0;
+
 tinymt32_t  tinymt_store;
 
 bool        chase_mode = false;
 bool        map_mode = false;
 bool        tele_state = false;
+bool        frame_pending = false;
+bool        death_pending = false;
+bool        step_back = false;
 
+Player      step_view;
 Rect        rects[7];
 
 Game        game;
+FrameStats  frame_stats;
 
 voice_t     blip = voice(10, 0, 40, 40);
 voice_t     zap = voice(150, 0, 60, 350);
 voice_t     stab = voice(10, 10, 300, 200);
 
-/*
- *  EXTERNALLY-DEFINED GLOBALS
- */
-extern      buffer_t* side_buffer;
-
 
 /*
  *  PICOSYSTEM CALLBACKS
@@ -53,7 +60,7 @@ void init() {
     // Clear the display as soon as possible
     Gfx::cls(GREEN);
 
-#ifdef DEBUG
+#if defined(DEBUG) || defined(BENCHMARK)
     // Enable debugging
     stdio_init_all();
     sleep_ms(2000);
@@ -70,12 +77,62 @@ void init() {
     // NOTE This is all the stuff that is per session,
     //      not per game, or per level
     setup_device();
+
+#ifdef BENCHMARK
+    // Report rendering and game logic costs
+    Bench::run();
+    Gfx::cls(GREEN);
+#endif
 }
 
 
 void update(uint32_t tick_ms) {
-    uint32_t now = time_us_32();
+    // FROM 1.1.2
+    // Run the game a fixed step of simulated time at a time, so that
+    // it plays at the same speed, and the same way, however often this
+    // and `draw()` are called: bank the real time since the last call
+    // and spend it in whole steps. The buttons are read once a call,
+    // and a key tapped goes to the next step. A step or turn animation
+    // ignores keys, so taps made during one wait for it to end
+    uint64_t now = time_us_64();
+    sim_banked += now - sim_last_update;
+    sim_last_update = now;
+    if (sim_banked > (uint64_t)SIM_STEP_US * SIM_MAX_STEPS) sim_banked = (uint64_t)SIM_STEP_US * SIM_MAX_STEPS;
+
+    sim_keys |= Utils::inkey();
+    bool is_fire_held = button(A);
+    while (sim_banked >= SIM_STEP_US) {
+        sim_banked -= SIM_STEP_US;
+        uint8_t state = game.state;
+        step_game(sim_keys, is_fire_held);
+        if (state != ANIMATE_STEP && state != ANIMATE_RIGHT_TURN && state != ANIMATE_LEFT_TURN) sim_keys = 0;
+    }
+}
+
+
+/**
+    Advance the game by one `SIM_STEP_US` step of simulated time.
+
+    FROM 1.1.2 Everything that happens in the game happens here, timed
+    by `game.clock`, so a run of steps with the same input plays out
+    the same way whenever `draw()` is called. `draw()` only shows it.
+
+    - Parameters:
+        - keys:         The keys tapped since the last step, as `Utils::inkey()` bits.
+        - is_fire_held: Whether the fire button is down.
+ */
+void step_game(uint8_t keys, bool is_fire_held) {
+    game.clock += SIM_STEP_US;
+    uint64_t now = game.clock;
     uint8_t key = 0;
+
+    // FROM 1.1.2
+    // Put out the senses LED once it has been lit long enough
+    if (game.senses_led_time != 0 && now - game.senses_led_time > SENSES_LED_US) {
+        led(0, 0, 0);
+        game.senses_led_time = 0;
+    }
+
     switch (game.state) {
         case ANIMATE_LOGO:
             if (now - tele_flash_time > LOGO_ANIMATION_US) {
@@ -103,10 +160,8 @@ void update(uint32_t tick_ms) {
             }
             break;
         case OFFER_HELP:
-            key = Utils::inkey();
+            key = keys;
             if (key == 0x01) {
-                //Help::init();
-                Help::show_page(0);
                 help_page_count = 0;
                 game.state = SHOW_HELP;
                 beep();
@@ -116,8 +171,9 @@ void update(uint32_t tick_ms) {
             break;
         case SHOW_HELP:
             // Run through the help pages with each key press
-            if (Utils::inkey() > 0) {
+            if (keys > 0) {
                 help_page_count++;
+                invalidate(DIRTY_VIEW);
                 beep();
             }
 
@@ -127,7 +183,7 @@ void update(uint32_t tick_ms) {
             // Count down five seconds before
             // actually starting the game
             tick_count++;
-            if (tick_count % 50 == 0) {
+            if (tick_count % SIM_STEPS(COUNT_DOWN_US) == 0) {
                 count_down--;
                 beep();
             }
@@ -138,18 +194,24 @@ void update(uint32_t tick_ms) {
             }
             break;
         case PLAYER_IS_DEAD:
-            // NOTE Call 'death()' before coming here
             // Just await any key press to start again
-            if (Utils::inkey() > 0) start_new_game();
+            // FROM 1.1.2
+            // If the death screen hasn't been drawn yet, it never will be
+            if (keys > 0) {
+                retire_frame();
+                death_pending = false;
+                start_new_game();
+            }
             break;
         case DO_TELEPORT_ONE:
             // Flip between TELE_ONE and TELE_TWO
-            // every 1/4 second for two seconds
+            // every 1/10 second for two seconds
             tick_count++;
-            if (tick_count == 5) {
+            if (tick_count == SIM_STEPS(TELEPORT_FLASH_US)) {
                 tick_count = 0;
                 game.state = DO_TELEPORT_TWO;
-                if (now - tele_flash_time > 1000000) {
+                invalidate(DIRTY_VIEW);
+                if (now - tele_flash_time > TELEPORT_SWAP_US) {
                     // Half way through, switch co-ords
                     game.player.x = game.start_x;
                     game.player.y = game.start_y;
@@ -158,31 +220,48 @@ void update(uint32_t tick_ms) {
             break;
         case DO_TELEPORT_TWO:
             tick_count++;
-            if (tick_count == 5) {
+            if (tick_count == SIM_STEPS(TELEPORT_FLASH_US)) {
                 tick_count = 0;
-                game.state = now - tele_flash_time < 2000000 ? DO_TELEPORT_ONE : IN_PLAY;
+                game.state = now - tele_flash_time < TELEPORT_TIME_US ? DO_TELEPORT_ONE : IN_PLAY;
+                invalidate(DIRTY_VIEW);
             }
             break;
         case SHOW_TEMP_MAP:
             // Wait 3s while the post-kill
             // map is on screen
             tick_count++;
-            if (tick_count == 150) {
+            if (tick_count == SIM_STEPS(MAP_POST_KILL_SHOW_MS * 1000)) {
                 tick_count = 0;
                 game.state = IN_PLAY;
             }
             break;
+        case ANIMATE_STEP:
+            // Work through the step's in-between views while the
+            // world moves on, then return to play
+            step_phase++;
+            if (step_phase == VIEW_PHASES) game.state = IN_PLAY;
+            invalidate(DIRTY_VIEW);
+            update_world();
+            break;
         case ANIMATE_RIGHT_TURN:
         case ANIMATE_LEFT_TURN:
-            //anim_x += SLICE;
+            // FROM 1.1.2
+            // Turn a slice a step; `draw()` catches up with the slices.
+            // The view is redrawn whole at the end, in case it didn't
+            anim_x += SLICE;
             if (anim_x > 240) {
                 game.state = IN_PLAY;
                 blend(ALPHA);
+                invalidate(DIRTY_VIEW);
             }
             break;
         case ZAP_PHANTOM:
             tick_count++;
-            if (tick_count == 25) {
+            if (tick_count == SIM_STEPS(ZAP_SHOW_US)) {
+                // FROM 1.1.2
+                // The map replaces the view, and the level may be
+                // rebuilt, so let core 1 finish the last zap frame first
+                retire_frame();
                 tick_count = 0;
                 game.state = SHOW_TEMP_MAP;
                 bool last_phantom_killed = (game.level_kills == game.phantom_count);
@@ -193,9 +272,9 @@ void update(uint32_t tick_ms) {
                 // NOTE `manage_phantoms()` calls `start_new_level()`
                 //      if necessary
                 Phantom &p = game.phantoms.at(dead_phantom);
-                p.x = ERROR_CONDITION;
-                p.y = ERROR_CONDITION;
+                p.set_square(NOT_ON_BOARD, NOT_ON_BOARD);
                 dead_phantom = ERROR_CONDITION;
+                invalidate(DIRTY_VIEW);
                 manage_phantoms();
             }
         default:
@@ -203,13 +282,13 @@ void update(uint32_t tick_ms) {
             // NOTE Return as quickly as possible
 
             // Was a key tapped?
-            key = Utils::inkey();
+            key = keys;
 
             if ((key > 0x0F) && !game.show_reticule) {
                 // A move key has been pressed
                 uint8_t dir = get_direction(key);
-                uint8_t nx = game.player.x;
-                uint8_t ny = game.player.y;
+                uint16_t nx = game.player.x;
+                uint16_t ny = game.player.y;
 
                 if (dir == MOVE_FORWARD || dir == MOVE_BACKWARD) {
                     // Move player forward or backward if we can
@@ -218,11 +297,13 @@ void update(uint32_t tick_ms) {
                     if (game.player.direction == DIRECTION_EAST) nx += (dir == MOVE_FORWARD ? 1 : -1);
                     if (game.player.direction == DIRECTION_WEST) nx += (dir == MOVE_FORWARD ? -1 : 1);
 
-                    if (ny < 20 && nx < 20 && Map::get_square_contents(nx, ny) != MAP_TILE_WALL) {
+                    if (ny < Map::height() && nx < Map::width() && Map::get_square_contents(nx, ny) != MAP_TILE_WALL) {
                         // Has the player walked up to a Phantom?
                         if (Map::phantom_on_square(nx, ny) != ERROR_CONDITION) {
-                            // Yes -- so the player is dead!
-                            death();
+                            // Yes -- so the player is dead! But core 1 may
+                            // be drawing, so leave the death screen to `draw()`
+                            game.state = PLAYER_IS_DEAD;
+                            death_pending = true;
 
                             #ifdef DEBUG
                             printf("\nPLAYER IS DEAD\n");
@@ -231,8 +312,19 @@ void update(uint32_t tick_ms) {
                         }
 
                         // Set the new square for rendering later
+                        Player from = game.player;
                         game.player.x = nx;
                         game.player.y = ny;
+                        invalidate(DIRTY_VIEW);
+
+                        // Animate the step: forward steps move on from the old
+                        // view; backward steps replay a forward step into the new one
+                        if (!chase_mode && !map_mode) {
+                            step_back = (dir == MOVE_BACKWARD);
+                            step_view = step_back ? game.player : from;
+                            step_phase = 1;
+                            game.state = ANIMATE_STEP;
+                        }
 
                         #ifdef DEBUG
                         printf("MOVED PLAYER (KEY: %02x), DIRECTION: %i\n", key, game.player.direction);
@@ -250,7 +342,9 @@ void update(uint32_t tick_ms) {
                         #endif
 
                         anim_x = -SLICE;
+                        drawn_x = -SLICE;
                         game.state = ANIMATE_RIGHT_TURN;
+                        retire_frame();
                         Gfx::animate_turn();
                         return;
                     }
@@ -266,7 +360,9 @@ void update(uint32_t tick_ms) {
                         #endif
 
                         anim_x = -SLICE;
+                        drawn_x = -SLICE;
                         game.state = ANIMATE_LEFT_TURN;
+                        retire_frame();
                         Gfx::animate_turn();
                         return;
                     }
@@ -285,6 +381,7 @@ void update(uint32_t tick_ms) {
                 #ifdef DEBUG
                 // Map mode should be for debugging only
                 map_mode = !map_mode;
+                invalidate(DIRTY_VIEW);
                 #endif
 
                 // Lower radar range
@@ -309,11 +406,12 @@ void update(uint32_t tick_ms) {
             // Check for firing
             // NOTE This uses separate code because it requires the button
             //      to be held down (fire on release)
-            if (button(A)) {
+            if (is_fire_held) {
                 if (game.can_fire) {
                     // Button A pressed
                     if (!game.show_reticule) {
                         game.show_reticule = true;
+                        invalidate(DIRTY_OVERLAY);
 
                         #ifdef DEBUG
                         printf("READY TO FIRE\n");
@@ -361,11 +459,9 @@ void draw(uint32_t tick_ms) {
         case LOGO_PAUSE:
             break;
         case OFFER_HELP:
-            Help::show_offer();
-            break;
         case SHOW_HELP:
-            // Display a help page
-            Help::show_page(help_page_count);
+            // Display the help offer or a help page
+            draw_static_screen();
             break;
         case START_COUNT:
             // Update the on-screen countdown
@@ -382,53 +478,71 @@ void draw(uint32_t tick_ms) {
             break;
         case SHOW_TEMP_MAP:
             // We've already drawn the post kill map, so just exit
+            // FROM 1.1.2 once no frame is left for core 1 to finish
+            retire_frame();
+            break;
         case PLAYER_IS_DEAD:
-            // We've already drawn the end-of-game map, so just exit
+            // FROM 1.1.2
+            // Draw the end-of-game map once core 1 is idle, or
+            // just exit if we've already drawn it
+            if (death_pending) {
+                retire_frame();
+                death_pending = false;
+                death();
+            }
             break;
         case ANIMATE_RIGHT_TURN:
-            anim_x += SLICE;
-            if (anim_x > 240 - SLICE) break;
+            // FROM 1.1.2
+            // Draw every slice `update()` has turned since the last frame
+            while (drawn_x < anim_x) {
+                drawn_x += SLICE;
+                if (drawn_x > 240 - SLICE) break;
 
-            // Blit screen left by one slice
-            Gfx::alt_blit(SCREEN, SLICE, 40, 240 - SLICE, 160, 0, 40);
+                // Blit screen left by one slice
+                Gfx::alt_blit(SCREEN, SLICE, 40, 240 - SLICE, 160, 0, 40);
 
-            // Blit side slice to last slice of screen
-            Gfx::alt_blit(side_buffer, anim_x, 40, SLICE, 160, 240 - SLICE, 40);
+                // Draw side slice to last slice of screen
+                Gfx::draw_turn_slice(drawn_x, 240 - SLICE);
+            }
             break;
         case ANIMATE_LEFT_TURN:
-            anim_x += SLICE;
-            if (anim_x > 240) break;
+            while (drawn_x < anim_x) {
+                drawn_x += SLICE;
+                if (drawn_x > 240) break;
 
-            for (int32_t x = 240 - (SLICE * 2) ; x >= 0 ; x -= SLICE) {
-                Gfx::alt_blit(SCREEN, x, 40, SLICE, 160, x + SLICE, 40);
-            }
+                for (int32_t x = 240 - (SLICE * 2) ; x >= 0 ; x -= SLICE) {
+                    Gfx::alt_blit(SCREEN, x, 40, SLICE, 160, x + SLICE, 40);
+                }
 
-            // Blit side slice to last slice of screen
-            Gfx::alt_blit(side_buffer, 240 - anim_x, 40, SLICE, 160, 0, 40);
+                // Draw side slice to first slice of screen
+                Gfx::draw_turn_slice(240 - drawn_x, 0);
+            }
             break;
         default:
-            // Render the screen
-            if (chase_mode) {
-                // Show the first Phantom's view
-                Phantom &p = game.phantoms.at(0);
-                Gfx::draw_screen(p.x, p.y, p.direction);
-            } else if (map_mode) {
-                // Draw an overhead view
-                Map::draw(BASE_MAP_DELTA, true);
+            if (map_mode) {
+                // Draw an overhead view, or just update it if
+                // it's already on screen
+                if (game.state != drawn_state || (game.dirty & DIRTY_VIEW)) {
+                    Map::draw(BASE_MAP_DELTA, true);
+                    game.dirty = DIRTY_NONE;
+                    frame_stats.full++;
+                } else {
+                    Map::refresh(BASE_MAP_DELTA, true);
+                    frame_stats.overlay++;
+                }
             } else {
-                // Show the player's view
-                Gfx::draw_screen(game.player.x, game.player.y, game.player.direction);
+                // Have core 1 draw the view -- if `update()` didn't
+                // hand it over already -- and wait for it to finish
+                publish_frame();
+                retire_frame();
             }
+    }
 
-            // Don't show gunnery if a Phantom has been hit
-            if (game.state == ZAP_PHANTOM) return;
-
-            // Is the laser being fired?
-            if (game.is_firing) Gfx::draw_zap(game.zap_frame);
+    drawn_state = game.state;
 
-            // Has the player primed the laser?
-            if (game.show_reticule) Gfx::draw_reticule();
-    }
+    #ifdef DEBUG
+    if (((frame_stats.full + frame_stats.overlay + frame_stats.skipped + frame_stats.static_full + frame_stats.static_skipped) % 1000) == 999) Gfx::show_debug_info();
+    #endif
 }
 
 
@@ -474,8 +588,20 @@ void setup_device() {
         rects[c++] = a_rect;
     }
 
+    // Build the corridor span tables from the rects
+    View::init();
+
+    #ifdef DEBUG
+    // Make sure the maps' wall bitboards can be trusted
+    printf("MAP WALL ERRORS: %lu\n", Map::check_walls());
+    #endif
+
+    // Set core 1 up as the in-play renderer
+    Pipeline::start();
+
     // Start the game loop at the intro animation
     game.state = ANIMATE_LOGO;
+    sim_last_update = time_us_64();
 
     #ifdef DEBUG
     printf("DONE SETUP_DEVICE\n");
@@ -586,6 +712,8 @@ void init_phantoms() {
         game.phantoms.push_back(p);
     }
 
+    Map::reset_occupancy();
+
     game.phantom_speed = PHANTOM_MOVE_TIME_US << 1;
     game.last_phantom_move = 0;
 
@@ -606,13 +734,14 @@ void start_new_level() {
     game.map = Map::init(game.map);
     init_level();
 
-    // Place the player near the centre
-    uint8_t x = 9;
-    uint8_t y = 9;
+    // Place the player at the map's start square, if it has one,
+    // or near the centre
+    uint16_t x = Map::width() / 2 - 1;
+    uint16_t y = Map::height() / 2 - 1;
 
-    while (true) {
-        x = 9 + (Utils::irandom(0, 3) - 1);
-        y = 9 + (Utils::irandom(0, 3) - 1);
+    while (!Map::get_start(&x, &y)) {
+        x = Map::width() / 2 - 1 + (Utils::irandom(0, 3) - 1);
+        y = Map::height() / 2 - 1 + (Utils::irandom(0, 3) - 1);
         if (Map::get_square_contents(x, y) == MAP_TILE_CLEAR) break;
     }
 
@@ -636,9 +765,11 @@ void start_new_level() {
     for (uint8_t i = 0 ; i < game.phantom_count ; i++) {
         Phantom &p = game.phantoms.at(i);
         p.init();
-        p.place(i);
+        p.place();
     }
 
+    schedule_phantoms(game.clock);
+
     /* TEST DATA
     game.player.x = 0;
     game.player.y = 0;
@@ -655,16 +786,12 @@ void start_new_level() {
     Randomly roll a teleport square.
  */
 void set_teleport_square() {
-    while (true) {
-        // Pick a random co-ordinate
-        uint8_t x = Utils::irandom(0, 20);
-        uint8_t y = Utils::irandom(0, 20);
-
-        if (Map::get_square_contents(x, y) == MAP_TILE_CLEAR && x != game.player.x && y != game.player.y) {
-            game.tele_x = x;
-            game.tele_y = y;
-            break;
-        }
+    // Pick a clear square off the player's row and column.
+    // If there isn't one, the teleporter stays where it is
+    uint16_t x, y;
+    if (Map::pick_clear_square(game.player.x, game.player.y, 0, false, &x, &y)) {
+        game.tele_x = x;
+        game.tele_y = y;
     }
 }
 
@@ -674,23 +801,41 @@ void set_teleport_square() {
     Called from the main `update()` callback.
  */
 void update_world() {
-    // Move the Phantom(s) periodically -- this is how
+    // Hand this tick's view to core 1 to draw while the world moves on
+    publish_frame();
+
+    // FROM 1.1.2
+    // Take the Phantoms' search for the player on a slice
+    Pursuit::update();
+
+    // FROM 1.1.2
+    // Move each Phantom when it's due. Their moves are spread
+    // across the move period, rather than all made on one tick
+    uint64_t now = game.clock;
+    if (move_phantoms(now)) {
+        // Player was killed -- but core 1 may be drawing,
+        // so leave the death screen to `draw()`
+        game.state = PLAYER_IS_DEAD;
+        death_pending = true;
+
+        #ifdef DEBUG
+        printf("PLAYER IS DEAD\n");
+        #endif
+
+        return;
+    }
+
+    // Listen for Phantoms once a move period -- this is how
     // we increase their speed as the game progresses
-    uint32_t now = time_us_32();
     if (now - game.last_phantom_move > game.phantom_speed) {
         game.last_phantom_move = now;
-        if (!move_phantoms()) {
-            check_senses();
-        } else {
-            // Player was killed
-            death();
 
-            #ifdef DEBUG
-            printf("PLAYER IS DEAD\n");
-            #endif
+        #ifdef DEBUG
+        uint32_t errors = Map::check_occupancy();
+        if (errors > 0) printf("OCCUPANCY ERRORS: %lu\n", errors);
+        #endif
 
-            return;
-        }
+        check_senses();
     }
 
     // Check for a laser recharge
@@ -706,11 +851,121 @@ void update_world() {
         } else {
             game.zap_frame++;
             game.zap_fire_time = now;
+            invalidate(DIRTY_OVERLAY);
         }
     }
 }
 
 
+/**
+    Copy the state the in-play renderer needs into a frame.
+
+    - Parameters:
+        - frame: The frame to fill.
+ */
+void take_snapshot(Frame* frame) {
+    frame->player = game.player;
+    frame->viewer = game.player;
+    if (chase_mode) {
+        // Show the first Phantom's view
+        Phantom &p = game.phantoms.at(0);
+        frame->viewer.x = p.x;
+        frame->viewer.y = p.y;
+        frame->viewer.direction = p.direction;
+    }
+
+    frame->phase = 0;
+    if (game.state == ANIMATE_STEP) {
+        frame->viewer = step_view;
+        frame->phase = step_back ? VIEW_PHASES - step_phase : step_phase;
+    }
+
+    frame->state = game.state;
+    frame->dirty = game.dirty;
+    frame->tele_x = game.tele_x;
+    frame->tele_y = game.tele_y;
+    frame->dead_phantom = dead_phantom;
+    frame->zap_frame = game.zap_frame;
+    frame->show_reticule = game.show_reticule;
+    frame->is_firing = game.is_firing;
+
+    for (uint8_t i = 0 ; i < MAX_PHANTOMS ; ++i) {
+        frame->phantom_x[i] = NOT_ON_BOARD;
+        frame->phantom_y[i] = NOT_ON_BOARD;
+        if (i < game.phantoms.size()) {
+            Phantom &p = game.phantoms.at(i);
+            frame->phantom_x[i] = p.x;
+            frame->phantom_y[i] = p.y;
+        }
+    }
+}
+
+
+/**
+    Hand the current 3D view to core 1 to draw, at most once per
+    tick, and only in states which show it. Arriving from another
+    state always needs a full redraw.
+ */
+void publish_frame() {
+    if (frame_pending || map_mode) return;
+    if (game.state != IN_PLAY && game.state != ZAP_PHANTOM && game.state != DO_TELEPORT_ONE && game.state != DO_TELEPORT_TWO && game.state != ANIMATE_STEP) return;
+
+    Frame frame;
+    take_snapshot(&frame);
+    if (game.state != drawn_state) frame.dirty |= DIRTY_VIEW;
+    game.dirty = DIRTY_NONE;
+
+    Pipeline::submit(frame);
+    frame_pending = true;
+}
+
+
+/**
+    Wait for core 1 to finish any frame it has been handed, so that
+    core 0 can draw to the screen, or change what the frame shows.
+ */
+void retire_frame() {
+    Pipeline::wait();
+    frame_pending = false;
+}
+
+
+/**
+    Draw a screen whose content only changes on input. It is rendered
+    once when its state is entered, and again only when `update()`
+    invalidates it; every other frame leaves the screen as it is.
+ */
+void draw_static_screen() {
+    #ifdef DEBUG
+    uint32_t start = time_us_32();
+    #endif
+
+    bool do_draw = (game.state != drawn_state || (game.dirty & DIRTY_VIEW));
+    if (do_draw) {
+        if (game.state == OFFER_HELP) {
+            Help::show_offer();
+        } else {
+            Help::show_page(help_page_count);
+        }
+
+        game.dirty = DIRTY_NONE;
+    }
+
+    #ifdef DEBUG
+    // Record what the frame cost, so rendered and skipped
+    // frames can be compared
+    uint32_t time = time_us_32() - start;
+    if (do_draw) {
+        frame_stats.static_full++;
+        frame_stats.static_full_us += time;
+    } else {
+        frame_stats.static_skipped++;
+        frame_stats.static_skipped_us += time;
+    }
+    #endif
+}
+
+
 /**
     Check whether we need to increase the number of phantoms
     on the board or increase their speed -- all caused by a
@@ -747,8 +1002,7 @@ void manage_phantoms() {
         // Take all existing Phantoms off the board
         for (uint8_t i = 0 ; i < MAX_PHANTOMS ; i++) {
             Phantom &p = game.phantoms.at(i);
-            p.x = ERROR_CONDITION;
-            p.y = ERROR_CONDITION;
+            p.set_square(NOT_ON_BOARD, NOT_ON_BOARD);
         }
 
         // Create a new level
@@ -794,23 +1048,23 @@ uint8_t get_facing_phantom(uint8_t range) {
         case DIRECTION_NORTH:
             if (game.player.y == 0) return ERROR_CONDITION;
             if (game.player.y - range < 0) range = game.player.y;
-            for (int8_t i = game.player.y ; i > game.player.y - range ; --i) {
+            for (int32_t i = game.player.y ; i > game.player.y - range ; --i) {
                 p_index = Map::phantom_on_square(game.player.x, i);
                 if (p_index != ERROR_CONDITION) return p_index;
             }
             break;
         case DIRECTION_EAST:
-            if (game.player.x == MAP_MAX) return ERROR_CONDITION;
-            if (game.player.x + range > MAP_MAX) range = MAP_MAX - game.player.x;
-            for (int8_t i = game.player.x ; i < game.player.x + range ; ++i) {
+            if (game.player.x == Map::width() - 1) return ERROR_CONDITION;
+            if (game.player.x + range > Map::width() - 1) range = Map::width() - 1 - game.player.x;
+            for (int32_t i = game.player.x ; i < game.player.x + range ; ++i) {
                 p_index = Map::phantom_on_square(i, game.player.y);
                 if (p_index != ERROR_CONDITION) return p_index;
             }
             break;
         case DIRECTION_SOUTH:
-            if (game.player.y == MAP_MAX) return ERROR_CONDITION;
-            if (game.player.y + range > MAP_MAX) range = MAP_MAX - game.player.y;
-            for (int8_t i = game.player.y ; i < game.player.y + range ; ++i) {
+            if (game.player.y == Map::height() - 1) return ERROR_CONDITION;
+            if (game.player.y + range > Map::height() - 1) range = Map::height() - 1 - game.player.y;
+            for (int32_t i = game.player.y ; i < game.player.y + range ; ++i) {
                 p_index = Map::phantom_on_square(game.player.x, i);
                 if (p_index != ERROR_CONDITION) return p_index;
             }
@@ -818,7 +1072,7 @@ uint8_t get_facing_phantom(uint8_t range) {
         default:
             if (game.player.x == 0) return ERROR_CONDITION;
             if (game.player.x - range < 0) range = game.player.x;
-            for (int8_t i = game.player.x ; i > game.player.x - range ; --i) {
+            for (int32_t i = game.player.x ; i > game.player.x - range ; --i) {
                 p_index = Map::phantom_on_square(i, game.player.y);
                 if (p_index != ERROR_CONDITION) return p_index;
             }
@@ -829,62 +1083,75 @@ uint8_t get_facing_phantom(uint8_t range) {
 
 
 /**
-    Return the number of Phantoms in front of the player.
+    Return the number of Phantoms in front of the viewer.
+    NOTE This works on a snapshot because it is called by the renderer,
+         and counts from the snapshot's viewer, which the view is
+         drawn from -- part-way through a step, that isn't the player.
 
     - Parameters:
+        - frame: The snapshot being drawn.
         - range: The number of squares to iterate over.
 
-    - Returns: The number of Phantoms in front of the Player.
+    - Returns: The number of Phantoms in front of the viewer.
  */
-uint8_t count_facing_phantoms(uint8_t range) {
+uint8_t count_facing_phantoms(const Frame& frame, uint8_t range) {
     uint8_t phantom_count = 0;
-    switch(game.player.direction) {
+    switch(frame.viewer.direction) {
         case DIRECTION_NORTH:
-            if (game.player.y == 0) return phantom_count;
-            if (game.player.y - range < 0) range = game.player.y;
-            for (int8_t i = game.player.y ; i >= game.player.y - range ; --i) {
-                phantom_count += (Map::phantom_on_square(game.player.x, i) != ERROR_CONDITION ? 1 : 0);
+            if (frame.viewer.y == 0) return phantom_count;
+            if (frame.viewer.y - range < 0) range = frame.viewer.y;
+            for (int32_t i = frame.viewer.y ; i >= frame.viewer.y - range ; --i) {
+                phantom_count += (Map::phantom_on_square(frame, frame.viewer.x, i) != ERROR_CONDITION ? 1 : 0);
             }
             break;
         case DIRECTION_EAST:
-            if (game.player.x == MAP_MAX) {
-                Gfx::draw_number(8, 90, 12);
-                return phantom_count;
-            }
-            if (game.player.x + range > MAP_MAX) range = MAP_MAX - game.player.x;
-            for (int8_t i = game.player.x ; i <= game.player.x + range ; ++i) {
-                phantom_count += (Map::phantom_on_square((uint8_t)i, game.player.y) != ERROR_CONDITION ? 1 : 0);
+            if (frame.viewer.x == Map::width() - 1) return phantom_count;
+            if (frame.viewer.x + range > Map::width() - 1) range = Map::width() - 1 - frame.viewer.x;
+            for (int32_t i = frame.viewer.x ; i <= frame.viewer.x + range ; ++i) {
+                phantom_count += (Map::phantom_on_square(frame, (uint16_t)i, frame.viewer.y) != ERROR_CONDITION ? 1 : 0);
             }
             break;
         case DIRECTION_SOUTH:
-            if (game.player.y == MAP_MAX) return phantom_count;
-            if (game.player.y + range > MAP_MAX) range = MAP_MAX - game.player.y;
-            for (int8_t i = game.player.y ; i <= game.player.y + range ; ++i) {
-                phantom_count += (Map::phantom_on_square(game.player.x, i) != ERROR_CONDITION ? 1 : 0);
+            if (frame.viewer.y == Map::height() - 1) return phantom_count;
+            if (frame.viewer.y + range > Map::height() - 1) range = Map::height() - 1 - frame.viewer.y;
+            for (int32_t i = frame.viewer.y ; i <= frame.viewer.y + range ; ++i) {
+                phantom_count += (Map::phantom_on_square(frame, frame.viewer.x, i) != ERROR_CONDITION ? 1 : 0);
             }
             break;
         default:
-            if (game.player.x == 0) return phantom_count;
-            if (game.player.x - range < 0) range = game.player.x;
-            for (int8_t i = game.player.x ; i >= game.player.x - range ; --i) {
-                phantom_count += (Map::phantom_on_square(i, game.player.y) != ERROR_CONDITION ? 1 : 0);
+            if (frame.viewer.x == 0) return phantom_count;
+            if (frame.viewer.x - range < 0) range = frame.viewer.x;
+            for (int32_t i = frame.viewer.x ; i >= frame.viewer.x - range ; --i) {
+                phantom_count += (Map::phantom_on_square(frame, i, frame.viewer.y) != ERROR_CONDITION ? 1 : 0);
             }
     }
 
-    Gfx::draw_number(phantom_count, 80, 12);
     return phantom_count;
 }
 
 
 /**
-    Tell all of the current Phantoms to move.
+    Tell the Phantoms that are due to move to do so.
+
+    FROM 1.1.2 Each Phantom has its own deadline.
+
+    - Parameters:
+        - now: The game clock, in microseconds.
 
     - Returns: `true` if a Phantom caught the Player,
                otherwise `false`.
 */
-bool move_phantoms() {
-    for (uint8_t i = 0 ; i < MAX_PHANTOMS ; i++) {
+bool move_phantoms(uint64_t now) {
+    size_t number = game.phantoms.size();
+    for (size_t i = 0 ; i < number ; ++i) {
         Phantom &p = game.phantoms.at(i);
+        if (now < p.next_move) continue;
+
+        // Set the next deadline a period on. If the Phantom has missed
+        // more than that, eg. while the map was shown, skip whole
+        // periods so that it keeps its place among the others
+        p.next_move += p.speed;
+        if (now >= p.next_move) p.next_move += ((now - p.next_move) / p.speed + 1) * p.speed;
         if (p.move()) return true;
     }
 
@@ -892,6 +1159,32 @@ bool move_phantoms() {
 }
 
 
+/**
+    Set the Phantoms' move deadlines: each moves at the current
+    Phantom speed, but they're spaced evenly across the move
+    period, and apart from the senses check at its start.
+
+    - Parameters:
+        - now: The game clock, in microseconds.
+*/
+void schedule_phantoms(uint64_t now) {
+    // Space out only the Phantoms on the board
+    uint32_t number = 0;
+    for (Phantom& p : game.phantoms) {
+        if (p.x != NOT_ON_BOARD) ++number;
+    }
+
+    uint32_t slot = 0;
+    for (Phantom& p : game.phantoms) {
+        p.speed = game.phantom_speed;
+        if (p.x != NOT_ON_BOARD) ++slot;
+        p.next_move = now + (uint64_t)p.speed * slot / (number + 1);
+    }
+
+    game.last_phantom_move = now;
+}
+
+
 /**
     Scan around the player for nearby Phantoms.
  */
@@ -902,17 +1195,21 @@ void check_senses() {
 
     for (int x = dx ; x < (dx + (game.audio_range << 1)) ; x++) {
         if (x < 0) continue;
-        if (x > MAP_MAX) break;
+        if (x >= Map::width()) break;
         for (int y = dy ; y < (dy + (game.audio_range << 1)) ; y++) {
             if (y < 0) continue;
-            if (y > MAP_MAX) break;
+            if (y >= Map::height()) break;
             uint8_t nabbed = Map::phantom_on_square(x, y);
             if (nabbed != ERROR_CONDITION) {
                 // There's a Phantom in range, so sound a tone
+                // FROM 1.1.2
+                // and light the LED, which `update()` puts out,
+                // rather than hold up the game while it's lit
                 led(100, 0, 0);
                 beep();
-                sleep_ms(200);
-                led(0, 0, 0);
+                // NOTE A time of 0 means the LED is out, but the
+                //      game clock is past 0 by the first step
+                game.senses_led_time = game.clock;
 
                 // Only play one beep, no matter
                 // how many nearby phantoms there are
@@ -928,6 +1225,17 @@ void beep() {
 }
 
 
+/**
+    Flag part of the display as needing a redraw on the next frame.
+
+    - Parameters:
+        - flags: The `DIRTY_*` bits to raise.
+ */
+void invalidate(uint8_t flags) {
+    game.dirty |= flags;
+}
+
+
 /*
  *      ACTIONS
  */
@@ -938,7 +1246,7 @@ void beep() {
 void do_teleport() {
     // Move the player to the stored square
     game.state = DO_TELEPORT_ONE;
-    tele_flash_time = time_us_32();
+    tele_flash_time = game.clock;
 
     // Reset the laser if it's firing
     reset_laser();
@@ -954,6 +1262,7 @@ void do_teleport() {
 void fire_laser() {
     // Did we hit a Phantom?
     play(zap, 640, 200);
+    invalidate(DIRTY_OVERLAY);
     uint8_t n = get_facing_phantom(MAX_VIEW_RANGE);
     if (n != ERROR_CONDITION) {
         // A hit! A palpable hit!
@@ -993,9 +1302,10 @@ void fire_laser() {
     Reset the laser after firing.
  */
 void reset_laser() {
+    invalidate(DIRTY_OVERLAY);
     game.is_firing = false;
     game.can_fire = false;
-    game.zap_charge_time = time_us_32();
+    game.zap_charge_time = game.clock;
     game.zap_frame = 0;
 }
 
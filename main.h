@@ -22,13 +22,30 @@
 #include <cstdlib>
 #include <cstdint>
 #include <cstring>
+#include <atomic>
 
+// Defined below, but needed by the module headers
+struct Frame;
+struct PhantomSprite;
+struct RenderJob;
+
+#include "sprite.h"
+#include "assets.h"
 #include "gfx.h"
 #include "help.h"
+#include "maze.h"
+#include "map_pack.h"
+#include "maps.h"
+#include "routes.h"
 #include "map.h"
 #include "phantom.h"
+#include "pursuit.h"
+#include "swarm.h"
 #include "tinymt32.h"
 #include "utils.h"
+#include "view.h"
+#include "pipeline.h"
+#include "bench.h"
 
 
 #ifdef __cplusplus
@@ -67,7 +84,8 @@ enum {
     SHOW_TEMP_MAP,
     PLAYER_IS_DEAD,
     ANIMATE_RIGHT_TURN,
-    ANIMATE_LEFT_TURN
+    ANIMATE_LEFT_TURN,
+    ANIMATE_STEP
 };
 
 // Timer limits
@@ -75,8 +93,23 @@ enum {
 #define LASER_RECHARGE_US                               2000000
 #define MAP_POST_KILL_SHOW_MS                           3000
 #define LASER_FIRE_US                                   200000
+#define SENSES_LED_US                                   200000
 #define LOGO_ANIMATION_US                               9000
 #define LOGO_PAUSE_TIME                                 5000000
+#define COUNT_DOWN_US                                   1000000
+#define TELEPORT_FLASH_US                               100000
+#define TELEPORT_SWAP_US                                1000000
+#define TELEPORT_TIME_US                                2000000
+#define ZAP_SHOW_US                                     500000
+
+// FROM 1.1.2
+// The game runs in fixed steps of simulated time, however often
+// `update()` and `draw()` are called: see `update()`. If it falls
+// more than `SIM_MAX_STEPS` behind, it drops the time rather than
+// trying to catch up
+#define SIM_STEP_US                                     20000
+#define SIM_MAX_STEPS                                   4
+#define SIM_STEPS(us)                                   ((us) / SIM_STEP_US)
 
 // Map square types
 #define MAP_TILE_WALL                                   0xEE
@@ -105,13 +138,23 @@ enum {
 // Turn animation screen slice size
 #define SLICE                                           16
 
+// Redraw flags: what has changed since the last frame was drawn
+#define DIRTY_NONE                                      0x00
+#define DIRTY_VIEW                                      0x01
+#define DIRTY_OVERLAY                                   0x02
+
+// Laser overlay bounds: zap circle and (undeflected) reticule
+#define OVERLAY_X                                       100
+#define OVERLAY_Y                                       100
+#define OVERLAY_SIZE                                    41
+
 
 /*
  * STRUCTURE DEFINITIONS
  */
 typedef struct {
-    uint8_t                 x;
-    uint8_t                 y;
+    uint16_t                x;
+    uint16_t                y;
     uint8_t                 direction;
 } Player;
 
@@ -123,7 +166,8 @@ typedef struct {
     std::vector<Phantom>    phantoms;
     uint8_t                 phantom_count;
     uint32_t                phantom_speed;
-    uint32_t                last_phantom_move;
+    uint64_t                last_phantom_move;
+    uint64_t                senses_led_time;
     int8_t                  crosshair_delta;
 
     Player                  player;
@@ -131,10 +175,10 @@ typedef struct {
     uint8_t                 state;
     uint8_t                 map;
     uint8_t                 audio_range;
-    uint8_t                 tele_x;
-    uint8_t                 tele_y;
-    uint8_t                 start_x;
-    uint8_t                 start_y;
+    uint16_t                tele_x;
+    uint16_t                tele_y;
+    uint16_t                start_x;
+    uint16_t                start_y;
 
     uint16_t                level;
     uint16_t                score;
@@ -143,11 +187,75 @@ typedef struct {
     uint16_t                level_kills;
     uint16_t                level_hits;
 
-    uint32_t                zap_charge_time;
-    uint32_t                zap_fire_time;
+    uint64_t                zap_charge_time;
+    uint64_t                zap_fire_time;
     uint8_t                 zap_frame;
+
+    uint8_t                 dirty;
+
+    // The simulated time, in us, which every game timer reads
+    uint64_t                clock;
 } Game;
 
+// An immutable copy of everything the in-play renderer needs,
+// taken on core 0 and drawn on core 1
+typedef struct Frame {
+    Player                  viewer;
+    Player                  player;
+
+    uint8_t                 state;
+    uint8_t                 dirty;
+    uint16_t                tele_x;
+    uint16_t                tele_y;
+    uint8_t                 dead_phantom;
+    uint8_t                 zap_frame;
+    uint8_t                 phase;
+    bool                    show_reticule;
+    bool                    is_firing;
+
+    uint16_t                phantom_x[MAX_PHANTOMS];
+    uint16_t                phantom_y[MAX_PHANTOMS];
+} Frame;
+
+typedef struct {
+    uint32_t                full;
+    uint32_t                overlay;
+    uint32_t                skipped;
+
+    // Help screens: frames rendered and skipped, and the
+    // microseconds spent on each kind
+    uint32_t                static_full;
+    uint32_t                static_skipped;
+    uint32_t                static_full_us;
+    uint32_t                static_skipped_us;
+} FrameStats;
+
+// Where one Phantom sprite lands on screen
+typedef struct PhantomSprite {
+    uint8_t                 frame;
+    uint8_t                 width;
+    uint8_t                 height;
+    int16_t                 dx;
+    int16_t                 dy;
+    bool                    is_zapped;
+} PhantomSprite;
+
+// A frame's drawing decisions, made once so that the view can
+// then be painted band by band, on either core
+typedef struct RenderJob {
+    buffer_t*               target;
+    uint32_t                signature;
+    const ViewCacheEntry*   corridor;
+    int16_t                 offset;
+    int16_t                 clip_x;
+    int16_t                 clip_y;
+    int16_t                 clip_w;
+    int16_t                 clip_h;
+    uint8_t                 sprite_count;
+    PhantomSprite           sprites[MAX_PHANTOMS];
+    bool                    is_skipped;
+} RenderJob;
+
 typedef struct {
     uint8_t                 x;
     uint8_t                 y;
@@ -168,14 +276,20 @@ void        init_level();
 void        start_new_level();
 void        set_teleport_square();
 
+void        step_game(uint8_t keys, bool is_fire_held);
 void        update_world();
+void        take_snapshot(Frame* frame);
+void        publish_frame();
+void        retire_frame();
+void        draw_static_screen();
 void        check_senses();
-bool        move_phantoms();
+bool        move_phantoms(uint64_t now);
+void        schedule_phantoms(uint64_t now);
 void        manage_phantoms();
 
 uint8_t     get_direction(uint8_t key_pressed);
 uint8_t     get_facing_phantom(uint8_t range);
-uint8_t     count_facing_phantoms(uint8_t range);
+uint8_t     count_facing_phantoms(const Frame& frame, uint8_t range);
 
 void        fire_laser();
 void        reset_laser();
@@ -187,6 +301,7 @@ void        show_scores(bool show_tele = false);
 uint8_t     fix_num_width(uint8_t value, uint8_t current);
 
 void        beep();
+void        invalidate(uint8_t flags);
 
 
 #ifdef __cplusplus
@@ -16,299 +16,270 @@ using namespace picosystem;
 /*
  *      EXTERNALLY-DEFINED GLOBALS
  */
-extern Game     game;
+extern Game         game;
+extern tinymt32_t   tinymt_store;
 
 
 /*
  *      GLOBALS
  */
-uint8_t         *current_map[20];
-
-/*
- *      MAP DATA
- */
-uint8_t base_map_00[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_01[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_02[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-uint8_t base_map_03[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_04[20] = {0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_05[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_06[20] = {0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_07[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_08[20] = {0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_09[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_10[20] = {0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_11[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_12[20] = {0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_13[20] = {0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_14[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_15[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE};
-uint8_t base_map_16[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE};
-uint8_t base_map_17[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_18[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_19[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-
-uint8_t base_map_20[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_21[20] = {0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_22[20] = {0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_23[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_24[20] = {0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_25[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_26[20] = {0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-uint8_t base_map_27[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_28[20] = {0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_29[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_30[20] = {0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_31[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_32[20] = {0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE};
-uint8_t base_map_33[20] = {0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_34[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-uint8_t base_map_35[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_36[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_37[20] = {0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_38[20] = {0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_39[20] = {0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-
-uint8_t base_map_40[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_41[20] = {0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE};
-uint8_t base_map_42[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE};
-uint8_t base_map_43[20] = {0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_44[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_45[20] = {0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_46[20] = {0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_47[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_48[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_49[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_50[20] = {0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_51[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_52[20] = {0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_53[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_54[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_55[20] = {0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_56[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_57[20] = {0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-uint8_t base_map_58[20] = {0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_59[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-
-uint8_t base_map_60[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_61[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_62[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_63[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_64[20] = {0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_65[20] = {0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_66[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_67[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_68[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_69[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_70[20] = {0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_71[20] = {0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_72[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_73[20] = {0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_74[20] = {0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_75[20] = {0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_76[20] = {0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_77[20] = {0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_78[20] = {0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_79[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-
-uint8_t base_map_80[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_81[20] = {0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_82[20] = {0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_83[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_84[20] = {0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_85[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE};
-uint8_t base_map_86[20] = {0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_87[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE};
-uint8_t base_map_88[20] = {0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE};
-uint8_t base_map_89[20] = {0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_90[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_91[20] = {0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_92[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_93[20] = {0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_94[20] = {0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_95[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_96[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_97[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-uint8_t base_map_98[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_99[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-
-uint8_t base_map_100[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_101[20] = {0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE};
-uint8_t base_map_102[20] = {0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_103[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_104[20] = {0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_105[20] = {0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_106[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_107[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_108[20] = {0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_109[20] = {0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_110[20] = {0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_111[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF};
-uint8_t base_map_112[20] = {0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE};
-uint8_t base_map_113[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_114[20] = {0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_115[20] = {0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_116[20] = {0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF};
-uint8_t base_map_117[20] = {0xFF, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF};
-uint8_t base_map_118[20] = {0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF};
-uint8_t base_map_119[20] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+// The map pack in use, and the current map's size and start square
+const uint8_t*  pack = map_pack;
+uint16_t        map_width = MAP_PACK_WIDTH;
+uint16_t        map_height = MAP_PACK_HEIGHT;
+uint16_t        start_x = MAP_NO_START;
+uint16_t        start_y = MAP_NO_START;
+
+// The current map's index in the stock pack, if it is an
+// unaltered stock map, otherwise `MAP_NOT_STOCK`
+uint8_t         stock_map = MAP_NOT_STOCK;
+static_assert(MAP_PACK_WIDTH <= MAP_SIZE_MAX && MAP_PACK_HEIGHT <= MAP_SIZE_MAX, "Packed maps must fit the map");
+static_assert(MAP_SIZE_MAX % 32 == 0 && MAP_SIZE_MAX <= 0x8000, "Bad maximum map size");
+
+// Part of the maze as drawn by `draw()`, one pixel per square, without
+// the teleporter or any occupant: the `MAP_VIEW_SQUARES` squares either
+// way from (view_x, view_y). Drawn 8x to the screen
+buffer_t*       map_buffer = buffer(MAP_VIEW_SQUARES, MAP_VIEW_SQUARES);
+uint16_t        view_x = 0;
+uint16_t        view_y = 0;
+bool            is_rasterised = false;
+static_assert(MAP_VIEW_SQUARES <= 32 && MAP_VIEW_SQUARES <= MAP_SIZE_MAX, "Map view too large");
+
+// The squares `draw()` painted over the background, relative to
+// the view, so that `refresh()` can restore them
+uint8_t         marked_count = 0;
+uint8_t         marked_x[MAX_PHANTOMS + 2];
+uint8_t         marked_y[MAX_PHANTOMS + 2];
+
+// The current map's walls as bitboards, one per row and one per
+// column. Bit n of word w + 1 of a line is set if square 32w + n
+// along it is a wall: so bit x of `rows[y]` and bit y of `columns[x]`,
+// counting from the second word, are both square (x, y). The first
+// and last words, and the squares past the map's edge, are all wall,
+// so a view can be read off either end of a line without checks.
+// NOTE These are the only copy of the current map in RAM
+uint32_t        rows[MAP_SIZE_MAX][MAP_LINE_WORDS];
+uint32_t        columns[MAP_SIZE_MAX][MAP_LINE_WORDS];
+
+// Which squares of the current map have Phantoms on them, a bit
+// per square, by row
+uint32_t        occupied[MAP_SIZE_MAX * MAP_SIZE_MAX / 32];
+
+// The free-cell index: how many clear squares each row of the
+// current map has, so that `pick_clear_square()` can skip whole
+// rows without reading them
+uint16_t        clear_in_row[MAP_SIZE_MAX];
+
+// The latest generated maze, as rows of wall bits
+uint32_t        generated_rows[MAZE_SIZE];
+static_assert(MAZE_SIZE <= MAP_SIZE_MAX, "Generated mazes must fit the map");
 
 
 namespace Map {
 
 
+/*
+ *      STATIC PROTOTYPES
+ */
+static void     rasterise(uint16_t origin_x, uint16_t origin_y);
+static void     get_view_origin(uint16_t* x, uint16_t* y);
+static void     set_wall(uint16_t x, uint16_t y, bool is_wall);
+static uint32_t line_window(const uint32_t* line, int32_t first);
+static void     index_row(uint16_t y);
+static uint32_t eligible_in_row(uint16_t y, int32_t band_left, uint32_t band, bool avoid_phantoms);
+static uint32_t eligible_bits(uint16_t y, uint8_t word, int32_t band_left, uint32_t band, bool avoid_phantoms);
+static bool     is_occupied(uint16_t x, uint16_t y);
+static void     draw_marks(uint8_t y_delta, bool show_entities, bool show_tele);
+static void     mark_square(uint16_t x, uint16_t y, uint8_t y_delta, color_t colour);
+static void     draw_player(uint8_t y_delta);
+
+
 uint8_t init(uint8_t last_map) {
     // FROM 1.0.2
     // Don't pick the same map as last time
+    // NOTE A generated maze is new every time, so it may follow another
     uint8_t map;
     do {
-        map = Utils::irandom(0, NUMBER_OF_MAPS);
-    } while (map == last_map);
+        map = Utils::irandom(0, count() + 1);
+    } while (map == last_map && map != count());
 
     /* TEST VALUE
     map = 1;
     */
 
-    switch(map) {
-        case 0:
-            current_map[0] = base_map_00;
-            current_map[1] = base_map_01;
-            current_map[2] = base_map_02;
-            current_map[3] = base_map_03;
-            current_map[4] = base_map_04;
-            current_map[5] = base_map_05;
-            current_map[6] = base_map_06;
-            current_map[7] = base_map_07;
-            current_map[8] = base_map_08;
-            current_map[9] = base_map_09;
-            current_map[10] = base_map_10;
-            current_map[11] = base_map_11;
-            current_map[12] = base_map_12;
-            current_map[13] = base_map_13;
-            current_map[14] = base_map_14;
-            current_map[15] = base_map_15;
-            current_map[16] = base_map_16;
-            current_map[17] = base_map_17;
-            current_map[18] = base_map_18;
-            current_map[19] = base_map_19;
-            break;
-        case 1:
-            current_map[0] = base_map_40;
-            current_map[1] = base_map_41;
-            current_map[2] = base_map_42;
-            current_map[3] = base_map_43;
-            current_map[4] = base_map_44;
-            current_map[5] = base_map_45;
-            current_map[6] = base_map_46;
-            current_map[7] = base_map_47;
-            current_map[8] = base_map_48;
-            current_map[9] = base_map_49;
-            current_map[10] = base_map_50;
-            current_map[11] = base_map_51;
-            current_map[12] = base_map_52;
-            current_map[13] = base_map_53;
-            current_map[14] = base_map_54;
-            current_map[15] = base_map_55;
-            current_map[16] = base_map_56;
-            current_map[17] = base_map_57;
-            current_map[18] = base_map_58;
-            current_map[19] = base_map_59;
-            break;
-        case 2:
-            current_map[0] = base_map_60;
-            current_map[1] = base_map_61;
-            current_map[2] = base_map_62;
-            current_map[3] = base_map_63;
-            current_map[4] = base_map_64;
-            current_map[5] = base_map_65;
-            current_map[6] = base_map_66;
-            current_map[7] = base_map_67;
-            current_map[8] = base_map_68;
-            current_map[9] = base_map_69;
-            current_map[10] = base_map_70;
-            current_map[11] = base_map_71;
-            current_map[12] = base_map_72;
-            current_map[13] = base_map_73;
-            current_map[14] = base_map_74;
-            current_map[15] = base_map_75;
-            current_map[16] = base_map_76;
-            current_map[17] = base_map_77;
-            current_map[18] = base_map_78;
-            current_map[19] = base_map_79;
-            break;
-        case 3:
-            current_map[0] = base_map_80;
-            current_map[1] = base_map_81;
-            current_map[2] = base_map_82;
-            current_map[3] = base_map_83;
-            current_map[4] = base_map_84;
-            current_map[5] = base_map_85;
-            current_map[6] = base_map_86;
-            current_map[7] = base_map_87;
-            current_map[8] = base_map_88;
-            current_map[9] = base_map_89;
-            current_map[10] = base_map_90;
-            current_map[11] = base_map_91;
-            current_map[12] = base_map_92;
-            current_map[13] = base_map_93;
-            current_map[14] = base_map_94;
-            current_map[15] = base_map_95;
-            current_map[16] = base_map_96;
-            current_map[17] = base_map_97;
-            current_map[18] = base_map_98;
-            current_map[19] = base_map_99;
-            break;
-        case 4:
-            current_map[0] = base_map_100;
-            current_map[1] = base_map_101;
-            current_map[2] = base_map_102;
-            current_map[3] = base_map_103;
-            current_map[4] = base_map_104;
-            current_map[5] = base_map_105;
-            current_map[6] = base_map_106;
-            current_map[7] = base_map_107;
-            current_map[8] = base_map_108;
-            current_map[9] = base_map_109;
-            current_map[10] = base_map_110;
-            current_map[11] = base_map_111;
-            current_map[12] = base_map_112;
-            current_map[13] = base_map_113;
-            current_map[14] = base_map_114;
-            current_map[15] = base_map_115;
-            current_map[16] = base_map_116;
-            current_map[17] = base_map_117;
-            current_map[18] = base_map_118;
-            current_map[19] = base_map_119;
-        default:
-            current_map[0] = base_map_20;
-            current_map[1] = base_map_21;
-            current_map[2] = base_map_22;
-            current_map[3] = base_map_23;
-            current_map[4] = base_map_24;
-            current_map[5] = base_map_25;
-            current_map[6] = base_map_26;
-            current_map[7] = base_map_27;
-            current_map[8] = base_map_28;
-            current_map[9] = base_map_29;
-            current_map[10] = base_map_30;
-            current_map[11] = base_map_31;
-            current_map[12] = base_map_32;
-            current_map[13] = base_map_33;
-            current_map[14] = base_map_34;
-            current_map[15] = base_map_35;
-            current_map[16] = base_map_36;
-            current_map[17] = base_map_37;
-            current_map[18] = base_map_38;
-            current_map[19] = base_map_39;
+    if (map != count()) {
+        select(map);
+    } else if (!generate(tinymt32_generate_uint32(&tinymt_store))) {
+        // Fall back on a stock map if the maze is no good
+        map = 0;
+        select(map);
     }
 
     return map;
 }
 
 
+/*
+    Generate a new maze and make it the current map.
+
+    - Parameters:
+        - seed: The maze's random seed. The same seed always
+                gives the same maze.
+
+    - Returns: `true` if the maze meets the generator's constraints,
+               otherwise `false`.
+ */
+bool generate(uint32_t seed) {
+    uint32_t rows[MAZE_SIZE];
+    MazeStats stats;
+    bool is_valid = Maze::generate(seed, rows, &stats);
+
+    #ifdef DEBUG
+    printf("MAZE %08lx: %i LOOPS, %i DEAD ENDS, %i TRIES, VALID: %i\n", seed, stats.loops, stats.dead_ends, stats.tries, is_valid);
+    #endif
+
+    memcpy(generated_rows, rows, sizeof(generated_rows));
+    select(count());
+    return is_valid;
+}
+
+
+/*
+    Point the current map at the rows of the specified base map.
+
+    - Parameters:
+        - map: The index of the map in the pack, or `count()`
+               for the latest generated maze.
+ */
+void select(uint8_t map) {
+    // Start from solid wall, then dig out the map's corridors
+    memset(rows, 0xFF, sizeof(rows));
+    memset(columns, 0xFF, sizeof(columns));
+
+    uint16_t number = count();
+    if (map == number) {
+        map_width = MAZE_SIZE;
+        map_height = MAZE_SIZE;
+        for (uint16_t y = 0 ; y < map_height ; ++y) {
+            for (uint16_t x = 0 ; x < map_width ; ++x) {
+                if (((generated_rows[y] >> x) & 1) == 0) set_wall(x, y, false);
+            }
+        }
+
+        start_x = MAP_NO_START;
+        start_y = MAP_NO_START;
+        stock_map = MAP_NOT_STOCK;
+    } else {
+        // FROM 1.1.2
+        // Any other out-of-range map is the last map, as before
+        if (map > number) map = number - 1;
+        map_width = MapPack::header(pack)->width;
+        map_height = MapPack::header(pack)->height;
+        for (uint16_t y = 0 ; y < map_height ; ++y) {
+            for (uint16_t x = 0 ; x < map_width ; ++x) {
+                if (!MapPack::is_wall(pack, map, x, y)) set_wall(x, y, false);
+            }
+        }
+
+        const MapPackMeta *info = MapPack::meta(pack, map);
+        bool has_start = (info->start_x != MAP_PACK_NO_START);
+        start_x = has_start ? info->start_x : MAP_NO_START;
+        start_y = has_start ? info->start_y : MAP_NO_START;
+        stock_map = (pack == map_pack ? map : MAP_NOT_STOCK);
+    }
+
+    for (uint16_t y = 0 ; y < map_height ; ++y) index_row(y);
+    is_rasterised = false;
+    Pursuit::reset();
+}
+
+
+/*
+    Use a different map pack. The pack is read in place, so it
+    must stay in memory for as long as it is in use.
+    NOTE The current map is unchanged until the next `select()`.
+
+    - Parameters:
+        - data: The pack, aligned to four bytes.
+        - size: The size of the pack in bytes.
+
+    - Returns: `true` if the pack is good and its maps fit the
+               game, otherwise `false`.
+ */
+bool load(const uint8_t* data, size_t size) {
+    const char* error = nullptr;
+    bool is_good = MapPack::validate(data, size, &error);
+    if (is_good && (MapPack::header(data)->width > MAP_SIZE_MAX || MapPack::header(data)->height > MAP_SIZE_MAX)) {
+        error = "maps too large";
+        is_good = false;
+    }
+
+    #ifdef DEBUG
+    if (!is_good) printf("BAD MAP PACK: %s\n", error);
+    #endif
+
+    if (is_good) pack = data;
+    return is_good;
+}
+
+
+/*
+    Return the number of maps in use from the pack: all of them,
+    up to `MAX_MAPS`. This is also the index of the generated maze.
+ */
+uint8_t count() {
+    uint16_t number = MapPack::header(pack)->count;
+    return number < MAX_MAPS ? number : MAX_MAPS;
+}
+
+
+/*
+    Return the current map's width in squares.
+ */
+uint16_t width() {
+    return map_width;
+}
+
+
+/*
+    Return the current map's height in squares.
+ */
+uint16_t height() {
+    return map_height;
+}
+
+
+/*
+    Return the current map's start square, if it has one.
+
+    - Parameters:
+        - x: Pointer to receive the square's x co-ordinate.
+        - y: Pointer to receive the square's y co-ordinate.
+
+    - Returns: `true` if the map has a start square, otherwise `false`.
+ */
+bool get_start(uint16_t* x, uint16_t* y) {
+    if (start_x == MAP_NO_START) return false;
+    *x = start_x;
+    *y = start_y;
+    return true;
+}
+
+
+/*
+    Return the current map's index in the stock map pack, or
+    `MAP_NOT_STOCK` if it's a generated maze, from another pack,
+    or has been changed since it was selected.
+ */
+uint8_t get_stock_map() {
+    return stock_map;
+}
+
+
 /*
     Draw the current map on the screen buffer, centred but
-    vertically adjusted according to `y_delta`.
+    vertically adjusted according to `y_delta`. Maps larger
+    than the screen show the area around the player.
     If `show_entities` is `true`, the phantom locations
     are plotted in. The player and the teleport sqaure positions
     are always shown.
@@ -319,75 +290,242 @@ uint8_t init(uint8_t last_map) {
     - parameters:
         - y_delta:       Offset in the y-axis.
         - show_entities: Display phantoms.
+        - show_tele:     Display the teleport square.
  */
 void draw(uint8_t y_delta, bool show_entities, bool show_tele) {
     // Set the map background (blue)
     pen(BLUE);
     frect(0, 0, 240, 240);
 
-    // Draw the map
-    uint8_t x = 40;
-    uint8_t y = 40 + y_delta;
+    // Draw the maze from the cached background, updating
+    // that first if the view has moved, then the squares
+    // that differ from it
+    uint16_t x, y;
+    get_view_origin(&x, &y);
+    if (!is_rasterised || x != view_x || y != view_y) rasterise(x, y);
+    blit(map_buffer, 0, 0, MAP_VIEW_SQUARES, MAP_VIEW_SQUARES, MAP_LEFT, MAP_TOP + y_delta, MAP_VIEW_SQUARES * MAP_SQUARE, MAP_VIEW_SQUARES * MAP_SQUARE);
+    marked_count = 0;
+    draw_marks(y_delta, show_entities, show_tele);
+}
 
-    for (uint8_t i = 0 ; i < 20 ; ++i) {
-        uint8_t *line = current_map[i];
-        for (uint8_t j = 0 ; j < 20 ; ++j) {
-            uint8_t pixel = line[j];
 
-            // Draw and empty (path) square
-            if (pixel != MAP_TILE_WALL) {
-                pen(YELLOW);
+/*
+    Update a map already on screen: repaint the squares that
+    `draw()` or the last refresh marked from the cached
+    background, then mark the current ones. If the view
+    has moved, the whole map is drawn again.
 
-                if (i == game.tele_y && j == game.tele_x && show_tele) {
-                    // Show the teleport square in green
-                    pen(GREEN);
-                }
+    - parameters:
+        - y_delta:       Offset in the y-axis. Must match the on-screen map's.
+        - show_entities: Display phantoms.
+        - show_tele:     Display the teleport square.
+ */
+void refresh(uint8_t y_delta, bool show_entities, bool show_tele) {
+    uint16_t origin_x, origin_y;
+    get_view_origin(&origin_x, &origin_y);
+    if (!is_rasterised || origin_x != view_x || origin_y != view_y) {
+        draw(y_delta, show_entities, show_tele);
+        return;
+    }
 
-                if (show_entities) {
-                    // Show any phantoms at the current square as a red square
-                    for (size_t k = 0 ; k < game.phantoms.size() ; ++k) {
-                        Phantom &p = game.phantoms.at(k);
-                        if (j == p.x && i == p.y) {
-                            pen(RED);
-                        }
-                    }
-                }
+    for (uint8_t i = 0 ; i < marked_count ; ++i) {
+        uint8_t x = marked_x[i];
+        uint8_t y = marked_y[i];
+        blit(map_buffer, x, y, 1, 1, MAP_LEFT + x * MAP_SQUARE, MAP_TOP + y_delta + y * MAP_SQUARE, MAP_SQUARE, MAP_SQUARE);
+    }
 
-                frect(x + j * 8, y + i * 8, 8, 8);
-            }
+    marked_count = 0;
+    draw_marks(y_delta, show_entities, show_tele);
+}
 
-            // Show the player as an arrow at the current square
-            if (j == game.player.x && i == game.player.y) {
-                pen(RED);
-                switch(game.player.direction) {
-                    case DIRECTION_NORTH:
-                        frect(x + j * 8 + 3, y + i * 8, 2, 3);
-                        frect(x + j * 8, y + i * 8 + 3, 8, 2);
-                        frect(x + j * 8, y + i * 8 + 5, 2, 3);
-                        frect(x + j * 8 + 6, y + i * 8 + 5, 2, 3);
-                        break;
-                    case DIRECTION_EAST:
-                        frect(x + j * 8, y + i * 8, 3, 2);
-                        frect(x + j * 8, y + i * 8 + 6, 3, 2);
-                        frect(x + j * 8 + 3, y + i * 8, 2, 8);
-                        frect(x + j * 8 + 5, y + i * 8 + 3, 3, 2);
-                        break;
-                    case DIRECTION_SOUTH:
-                        frect(x + j * 8 + 3, y + i * 8 + 5, 2, 3);
-                        frect(x + j * 8, y + i * 8 + 3, 8, 2);
-                        frect(x + j * 8, y + i * 8, 2, 3);
-                        frect(x + j * 8 + 6, y + i * 8, 2, 3);
-                        break;
-                    default:
-                        frect(x + j * 8 + 5, y + i * 8, 3, 2);
-                        frect(x + j * 8 + 5, y + i * 8 + 6, 3, 2);
-                        frect(x + j * 8 + 3, y + i * 8, 2, 8);
-                        frect(x + j * 8, y + i * 8 + 3, 3, 2);
-                       break;
-                }
-            }
+
+/*
+    Rasterise the part of the current map in view into the
+    background cache: corridor squares yellow, walls blue.
+ */
+static void rasterise(uint16_t origin_x, uint16_t origin_y) {
+    for (uint8_t i = 0 ; i < MAP_VIEW_SQUARES ; ++i) {
+        uint32_t line = line_window(rows[origin_y + i], origin_x);
+        for (uint8_t j = 0 ; j < MAP_VIEW_SQUARES ; ++j) {
+            map_buffer->data[i * MAP_VIEW_SQUARES + j] = ((line >> j) & 1 ? BLUE : YELLOW);
         }
     }
+
+    view_x = origin_x;
+    view_y = origin_y;
+    is_rasterised = true;
+}
+
+
+/*
+    Find the top-left square of the overhead map's view: the
+    player's square is centred unless that puts the view
+    past the edge of the map.
+ */
+static void get_view_origin(uint16_t* x, uint16_t* y) {
+    int32_t left = (int32_t)game.player.x - MAP_VIEW_SQUARES / 2;
+    int32_t top = (int32_t)game.player.y - MAP_VIEW_SQUARES / 2;
+    if (left > map_width - MAP_VIEW_SQUARES) left = map_width - MAP_VIEW_SQUARES;
+    if (top > map_height - MAP_VIEW_SQUARES) top = map_height - MAP_VIEW_SQUARES;
+    *x = left < 0 ? 0 : left;
+    *y = top < 0 ? 0 : top;
+}
+
+
+/*
+    Set or clear one square in the wall bitboards.
+ */
+static void set_wall(uint16_t x, uint16_t y, bool is_wall) {
+    uint32_t *in_row = &rows[y][(x >> 5) + 1];
+    uint32_t *in_column = &columns[x][(y >> 5) + 1];
+    if (is_wall) {
+        *in_row |= (1u << (x & 31));
+        *in_column |= (1u << (y & 31));
+    } else {
+        *in_row &= ~(1u << (x & 31));
+        *in_column &= ~(1u << (y & 31));
+    }
+}
+
+
+/*
+    Bring one row's entry in the free-cell index up to date.
+ */
+static void index_row(uint16_t y) {
+    uint16_t count = 0;
+    for (uint8_t w = 1 ; w <= MAP_SIZE_MAX / 32 ; ++w) count += __builtin_popcount(~rows[y][w]);
+    clear_in_row[y] = count;
+}
+
+
+/*
+    Count a row's squares that `pick_clear_square()` may pick: its
+    clear squares, from the index, less those in the excluded
+    columns and, if there are any in the row, under Phantoms.
+ */
+static uint32_t eligible_in_row(uint16_t y, int32_t band_left, uint32_t band, bool avoid_phantoms) {
+    uint32_t count = clear_in_row[y] - __builtin_popcount(~line_window(rows[y], band_left) & band);
+    if (avoid_phantoms) {
+        for (size_t i = 0 ; i < game.phantoms.size() ; ++i) {
+            if (game.phantoms[i].y != y) continue;
+
+            // Recount the row the slow way
+            count = 0;
+            for (uint8_t w = 0 ; w < MAP_SIZE_MAX / 32 ; ++w) count += __builtin_popcount(eligible_bits(y, w, band_left, band, true));
+            break;
+        }
+    }
+
+    return count;
+}
+
+
+/*
+    Return one word of a row's squares that `pick_clear_square()`
+    may pick: bit n is set if square 32 * `word` + n may be picked.
+ */
+static uint32_t eligible_bits(uint16_t y, uint8_t word, int32_t band_left, uint32_t band, bool avoid_phantoms) {
+    uint32_t bits = ~rows[y][word + 1];
+
+    // Take out the excluded columns that fall in the word
+    int32_t shift = band_left - (word << 5);
+    if (shift >= 0 && shift < 32) bits &= ~(band << shift);
+    if (shift < 0 && shift > -32) bits &= ~(band >> -shift);
+
+    if (avoid_phantoms) bits &= ~occupied[(y * MAP_SIZE_MAX >> 5) + word];
+    return bits;
+}
+
+
+/*
+    Read 32 squares of a row or column bitboard, from square
+    `first` on: bit n of the result is square `first` + n. Squares
+    off either end of the line read as wall.
+ */
+static uint32_t line_window(const uint32_t* line, int32_t first) {
+    int32_t bit = first + 32;
+    if (bit < 0 || bit >= (MAP_LINE_WORDS - 1) * 32) return 0xFFFFFFFF;
+    uint64_t pair = line[bit >> 5] | ((uint64_t)line[(bit >> 5) + 1] << 32);
+    return (uint32_t)(pair >> (bit & 31));
+}
+
+
+/*
+    Paint the squares that differ from the background: the
+    teleporter (green), then any Phantoms (red), then the player.
+ */
+static void draw_marks(uint8_t y_delta, bool show_entities, bool show_tele) {
+    if (show_tele) mark_square(game.tele_x, game.tele_y, y_delta, GREEN);
+
+    if (show_entities) {
+        // Show any phantoms as red squares
+        for (size_t k = 0 ; k < game.phantoms.size() ; ++k) {
+            Phantom &p = game.phantoms.at(k);
+            if (p.x < map_width && p.y < map_height) mark_square(p.x, p.y, y_delta, RED);
+        }
+    }
+
+    draw_player(y_delta);
+}
+
+
+/*
+    Fill a corridor square, if it's in view, and note it for `refresh()`.
+ */
+static void mark_square(uint16_t x, uint16_t y, uint8_t y_delta, color_t colour) {
+    if (get_square_contents(x, y) == MAP_TILE_WALL) return;
+    if (x < view_x || x >= view_x + MAP_VIEW_SQUARES || y < view_y || y >= view_y + MAP_VIEW_SQUARES) return;
+
+    x -= view_x;
+    y -= view_y;
+    pen(colour);
+    frect(MAP_LEFT + x * MAP_SQUARE, MAP_TOP + y_delta + y * MAP_SQUARE, MAP_SQUARE, MAP_SQUARE);
+    marked_x[marked_count] = x;
+    marked_y[marked_count] = y;
+    marked_count++;
+}
+
+
+/*
+    Show the player as an arrow at the current square.
+ */
+static void draw_player(uint8_t y_delta) {
+    // NOTE The view is always around the player
+    uint8_t view_column = game.player.x - view_x;
+    uint8_t view_row = game.player.y - view_y;
+    uint8_t x = MAP_LEFT + view_column * MAP_SQUARE;
+    uint8_t y = MAP_TOP + y_delta + view_row * MAP_SQUARE;
+    marked_x[marked_count] = view_column;
+    marked_y[marked_count] = view_row;
+    marked_count++;
+
+    pen(RED);
+    switch(game.player.direction) {
+        case DIRECTION_NORTH:
+            frect(x + 3, y, 2, 3);
+            frect(x, y + 3, 8, 2);
+            frect(x, y + 5, 2, 3);
+            frect(x + 6, y + 5, 2, 3);
+            break;
+        case DIRECTION_EAST:
+            frect(x, y, 3, 2);
+            frect(x, y + 6, 3, 2);
+            frect(x + 3, y, 2, 8);
+            frect(x + 5, y + 3, 3, 2);
+            break;
+        case DIRECTION_SOUTH:
+            frect(x + 3, y + 5, 2, 3);
+            frect(x, y + 3, 8, 2);
+            frect(x, y, 2, 3);
+            frect(x + 6, y, 2, 3);
+            break;
+        default:
+            frect(x + 5, y, 3, 2);
+            frect(x + 5, y + 6, 3, 2);
+            frect(x + 3, y, 2, 8);
+            frect(x, y + 3, 3, 2);
+           break;
+    }
 }
 
 
@@ -400,10 +538,9 @@ void draw(uint8_t y_delta, bool show_entities, bool show_tele) {
 
     - Returns: The contents of the square.
  */
-uint8_t get_square_contents(uint8_t x, uint8_t y) {
-    if (x > MAP_MAX || y > MAP_MAX) return MAP_TILE_WALL;
-    uint8_t *line = current_map[y];
-    return line[x];
+uint8_t get_square_contents(uint16_t x, uint16_t y) {
+    if (x >= map_width || y >= map_height) return MAP_TILE_WALL;
+    return ((rows[y][(x >> 5) + 1] >> (x & 31)) & 1) ? MAP_TILE_WALL : MAP_TILE_CLEAR;
 }
 
 
@@ -413,18 +550,114 @@ uint8_t get_square_contents(uint8_t x, uint8_t y) {
     - Parameters:
         - x:     The square's x co-ordinate.
         - y:     The square's y co-ordinate.
-        - value: The square's new contents.
+        - value: The square's new contents: anything but
+                 `MAP_TILE_WALL` clears the square.
 
     - Returns: `true` if the square was set, otherwise `false`.
  */
-bool set_square_contents(uint8_t x, uint8_t y, uint8_t value) {
-    if (x > MAP_MAX || y > MAP_MAX) return false;
-    uint8_t *line = current_map[y];
-    line[x] = value;
+bool set_square_contents(uint16_t x, uint16_t y, uint8_t value) {
+    if (x >= map_width || y >= map_height) return false;
+    set_wall(x, y, value == MAP_TILE_WALL);
+    index_row(y);
+    is_rasterised = false;
+    stock_map = MAP_NOT_STOCK;
+    Pursuit::reset();
     return true;
 }
 
 
+/*
+    Pick a clear square at random, in a time bounded by the map's
+    height rather than by luck: the rows' entries in the free-cell
+    index are totalled to choose a row, and only that row is read.
+    Squares in the rows and columns within `margin` of the specified
+    square are excluded, as, optionally, are squares with a Phantom
+    on them.
+
+    - Parameters:
+        - x:              The x co-ordinate of the square to avoid.
+        - y:              The y co-ordinate of the square to avoid.
+        - margin:         How many rows and columns either side of
+                          the square to avoid as well, up to 15.
+        - avoid_phantoms: Exclude squares with a Phantom on them.
+        - pick_x:         Pointer to receive the square's x co-ordinate.
+        - pick_y:         Pointer to receive the square's y co-ordinate.
+
+    - Returns: `true` if a square was picked, or `false` if
+               there are no squares to pick from.
+ */
+bool pick_clear_square(uint16_t x, uint16_t y, uint8_t margin, bool avoid_phantoms, uint16_t* pick_x, uint16_t* pick_y) {
+    // The excluded columns, as a mask for a window of a row
+    // that starts at the leftmost of them
+    if (margin > 15) margin = 15;
+    int32_t band_left = (int32_t)x - margin;
+    uint32_t band = (1u << (margin * 2 + 1)) - 1;
+    int32_t top = (int32_t)y - margin;
+    int32_t bottom = (int32_t)y + margin;
+
+    uint32_t total = 0;
+    for (uint16_t r = 0 ; r < map_height ; ++r) {
+        if (r < top || r > bottom) total += eligible_in_row(r, band_left, band, avoid_phantoms);
+    }
+
+    if (total == 0) return false;
+
+    // Find the row, then the word, then the bit
+    uint32_t pick = tinymt32_generate_uint32(&tinymt_store) % total;
+    for (uint16_t r = 0 ; r < map_height ; ++r) {
+        if (r >= top && r <= bottom) continue;
+        uint32_t count = eligible_in_row(r, band_left, band, avoid_phantoms);
+        if (pick >= count) {
+            pick -= count;
+            continue;
+        }
+
+        for (uint8_t w = 0 ; w < MAP_SIZE_MAX / 32 ; ++w) {
+            uint32_t bits = eligible_bits(r, w, band_left, band, avoid_phantoms);
+            count = __builtin_popcount(bits);
+            if (pick >= count) {
+                pick -= count;
+                continue;
+            }
+
+            while (pick-- > 0) bits &= (bits - 1);
+            *pick_x = (w << 5) + __builtin_ctz(bits);
+            *pick_y = r;
+            return true;
+        }
+    }
+
+    // Not reached unless the index is stale
+    return false;
+}
+
+
+/*
+    Return the directions in which there is a clear square
+    next to the specified grid reference.
+
+    - Parameters:
+        - x: The square's x co-ordinate.
+        - y: The square's y co-ordinate.
+
+    - Returns: The open exits, as `PHANTOM_*` bits: none
+               if the square is off the map.
+ */
+uint8_t get_exits(uint16_t x, uint16_t y) {
+    if (x >= map_width || y >= map_height) return 0;
+
+    // Bits 0 and 2 are the squares either side
+    uint32_t across = line_window(rows[y], x - 1);
+    uint32_t down = line_window(columns[x], y - 1);
+    uint8_t exits = 0;
+    if ((down & 1) == 0) exits |= PHANTOM_NORTH;
+    if ((across & 4) == 0) exits |= PHANTOM_EAST;
+    if ((down & 4) == 0) exits |= PHANTOM_SOUTH;
+    if ((across & 1) == 0) exits |= PHANTOM_WEST;
+    return exits;
+}
+
+
 /*
     Return the number of squares an entity can see.
 
@@ -436,48 +669,168 @@ bool set_square_contents(uint8_t x, uint8_t y, uint8_t value) {
     - Returns: The number of visible squares up to a maximum,
                excluding the entity's square.
  */
-uint8_t get_view_distance(int8_t x, int8_t y, uint8_t direction) {
-    uint8_t count = 0;
+uint8_t get_view_distance(int16_t x, int16_t y, uint8_t direction) {
+    // Read the squares ahead off the line of view, nearest first
+    // at the bottom of the window looking east or south, at the
+    // top looking west or north, and count the clear squares up to
+    // the nearest wall. A bit set at the range limit caps the count
     switch(direction) {
         case DIRECTION_NORTH:
-            if (y == 0) return count;
-            --y;
-            do {
-                if (get_square_contents(x, y) == MAP_TILE_WALL) break;
-                ++count;
-                --y;
-            } while (y >= 0);
-            break;
+            if (x < 0 || x >= map_width) return 0;
+            return __builtin_clz(line_window(columns[x], y - 32) | (1u << (31 - MAX_VIEW_RANGE)));
         case DIRECTION_EAST:
-            if (x > 18) return count;
-            x++;
-            do {
-                if (get_square_contents(x, y) == MAP_TILE_WALL) break;
-                ++count;
-                ++x;
-            } while (x < 20);
-            break;
+            if (y < 0 || y >= map_height) return 0;
+            return __builtin_ctz(line_window(rows[y], x + 1) | (1u << MAX_VIEW_RANGE));
         case DIRECTION_SOUTH:
-            if (y > 18) return count;
-            ++y;
-            do {
-                if (get_square_contents(x, y) == MAP_TILE_WALL) break;
-                ++count;
-                ++y;
-            } while (y < 20);
-            break;
+            if (x < 0 || x >= map_width) return 0;
+            return __builtin_ctz(line_window(columns[x], y + 1) | (1u << MAX_VIEW_RANGE));
         default:
-            if (x == 0) return count;
-            --x;
-            do {
-                if (get_square_contents(x, y) == MAP_TILE_WALL) break;
-                ++count;
-                --x;
-            } while (x >= 0);
+            if (y < 0 || y >= map_height) return 0;
+            return __builtin_clz(line_window(rows[y], x - 32) | (1u << (31 - MAX_VIEW_RANGE)));
     }
+}
 
-    if (count > MAX_VIEW_RANGE) count = MAX_VIEW_RANGE;
-    return count;
+
+#ifdef DEBUG
+/*
+    Check the wall bitboards of every map against a walk
+    across the map itself.
+    NOTE This leaves the last map selected.
+
+    - Returns: The number of squares found to be wrong.
+ */
+uint32_t check_walls() {
+    static const int8_t steps[4][2] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+    uint32_t errors = 0;
+    for (uint8_t m = 0 ; m < count() ; ++m) {
+        select(m);
+        for (uint16_t y = 0 ; y < map_height ; ++y) {
+            for (uint16_t x = 0 ; x < map_width ; ++x) {
+                bool is_good = true;
+                for (uint8_t d = DIRECTION_NORTH ; d <= DIRECTION_WEST ; ++d) {
+                    // Walk up to the range limit, or the first wall
+                    uint8_t range = 0;
+                    while (range < MAX_VIEW_RANGE) {
+                        int32_t sx = x + steps[d][0] * (range + 1);
+                        int32_t sy = y + steps[d][1] * (range + 1);
+                        if (sx < 0 || sy < 0 || get_square_contents(sx, sy) == MAP_TILE_WALL) break;
+                        range++;
+                    }
+
+                    // Exits should match the neighbouring squares...
+                    bool has_exit = (get_exits(x, y) & (1 << d)) != 0;
+                    if (has_exit != (range > 0)) is_good = false;
+
+                    // ...and view distances the walk
+                    if (get_view_distance(x, y, d) != range) is_good = false;
+                }
+
+                if (!is_good) {
+                    printf("BAD WALLS: MAP %i, %i, %i\n", m, x, y);
+                    ++errors;
+                }
+            }
+        }
+    }
+
+    return errors;
+}
+#endif
+
+
+/*
+    Bring one square of the occupancy bitboard up to date. Call
+    this for the square a Phantom leaves and the one it arrives on,
+    after it has moved. Squares off the map are ignored.
+
+    - Parameters:
+        - x: The square's x co-ordinate.
+        - y: The square's y co-ordinate.
+ */
+void update_occupancy(uint16_t x, uint16_t y) {
+    if (x >= map_width || y >= map_height) return;
+
+    // NOTE Phantoms can, in principle, share a square, so
+    //      check them all rather than just clear the square
+    bool is_taken = false;
+    for (size_t i = 0 ; i < game.phantoms.size() ; ++i) {
+        Phantom &p = game.phantoms[i];
+        if (x == p.x && y == p.y) {
+            is_taken = true;
+            break;
+        }
+    }
+
+    uint32_t square = (uint32_t)y * MAP_SIZE_MAX + x;
+    if (is_taken) {
+        occupied[square >> 5] |= (1u << (square & 31));
+    } else {
+        occupied[square >> 5] &= ~(1u << (square & 31));
+    }
+}
+
+
+/*
+    Rebuild the whole occupancy bitboard from the Phantoms.
+ */
+void reset_occupancy() {
+    memset(occupied, 0, sizeof(occupied));
+    for (size_t i = 0 ; i < game.phantoms.size() ; ++i) {
+        Phantom &p = game.phantoms[i];
+        if (p.x < map_width && p.y < map_height) {
+            uint32_t square = (uint32_t)p.y * MAP_SIZE_MAX + p.x;
+            occupied[square >> 5] |= (1u << (square & 31));
+        }
+    }
+}
+
+
+#ifdef DEBUG
+/*
+    Check the occupancy bitboard against a scan of the Phantoms:
+    every Phantom's square should be marked, and nothing else.
+
+    - Returns: The number of squares found to be wrong.
+ */
+uint32_t check_occupancy() {
+    uint32_t errors = 0;
+    uint32_t squares = 0;
+    for (size_t i = 0 ; i < game.phantoms.size() ; ++i) {
+        Phantom &p = game.phantoms.at(i);
+        if (p.x >= map_width || p.y >= map_height) continue;
+        if (!is_occupied(p.x, p.y)) {
+            printf("BAD OCCUPANCY: %i, %i NOT MARKED\n", p.x, p.y);
+            ++errors;
+        }
+
+        // Count each occupied square once
+        bool is_first = true;
+        for (size_t j = 0 ; j < i ; ++j) {
+            if (game.phantoms.at(j).x == p.x && game.phantoms.at(j).y == p.y) is_first = false;
+        }
+
+        if (is_first) ++squares;
+    }
+
+    uint32_t marked = 0;
+    for (size_t i = 0 ; i < sizeof(occupied) / sizeof(occupied[0]) ; ++i) marked += __builtin_popcount(occupied[i]);
+    if (marked != squares) {
+        printf("BAD OCCUPANCY: %lu SQUARES MARKED, NOT %lu\n", marked, squares);
+        errors += (marked > squares ? marked - squares : squares - marked);
+    }
+
+    return errors;
+}
+#endif
+
+
+/*
+    Is the specified square, which must be on the map,
+    marked in the occupancy bitboard?
+ */
+static bool is_occupied(uint16_t x, uint16_t y) {
+    uint32_t square = (uint32_t)y * MAP_SIZE_MAX + x;
+    return (occupied[square >> 5] >> (square & 31)) & 1;
 }
 
 
@@ -485,13 +838,35 @@ uint8_t get_view_distance(int8_t x, int8_t y, uint8_t direction) {
     Is there a Phantom on the specified square?
 
     - Returns: The index of the Phantom in the vector,
-               or `ERROR_CONDITION` if the square is empty.
+               or `ERROR_CONDITION` if the square is empty
+               or off the map.
  */
-uint8_t phantom_on_square(uint8_t x, uint8_t y) {
-    size_t number = game.phantoms.size();
-    for (size_t i = 0 ; i < number ; ++i) {
-        Phantom &p = game.phantoms.at(i);
-        if (x == p.x && y == p.y) return (i & 0x0F);
+uint8_t phantom_on_square(uint16_t x, uint16_t y) {
+    // Most squares are empty, so only look for the
+    // Phantom when the bitboard says there is one
+    if (x >= map_width || y >= map_height || !is_occupied(x, y)) return ERROR_CONDITION;
+    for (size_t i = 0 ; i < game.phantoms.size() ; ++i) {
+        Phantom &p = game.phantoms[i];
+        if (x == p.x && y == p.y) return i;
+    }
+
+    return ERROR_CONDITION;
+}
+
+
+/*
+    Is there a Phantom on the specified square of a snapshot frame?
+
+    - Returns: The index of the Phantom in the frame,
+               or `ERROR_CONDITION` if the square is empty
+               or off the map.
+ */
+uint8_t phantom_on_square(const Frame& frame, uint16_t x, uint16_t y) {
+    // NOTE Phantoms off the board are at `NOT_ON_BOARD`, which
+    //      is also where a view that steps off the map ends up
+    if (x >= map_width || y >= map_height) return ERROR_CONDITION;
+    for (uint8_t i = 0 ; i < MAX_PHANTOMS ; ++i) {
+        if (x == frame.phantom_x[i] && y == frame.phantom_y[i]) return i;
     }
 
     return ERROR_CONDITION;
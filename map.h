@@ -15,8 +15,32 @@
 /*
  * CONSTANTS
  */
-#define NUMBER_OF_MAPS              6
-#define MAP_MAX                     19
+// The largest map, in squares either way. Maps' actual sizes come
+// from their pack. Must be a multiple of 32
+#ifndef MAP_SIZE_MAX
+#define MAP_SIZE_MAX                256
+#endif
+
+// Words per row or column of the wall bitboards: the line itself,
+// then a word of wall at either end
+#define MAP_LINE_WORDS              (MAP_SIZE_MAX / 32 + 2)
+
+// Map indexes are 8-bit, and the top few are out-of-range rolls, so
+// only this many of a pack's maps are used
+#define MAX_MAPS                    200
+
+// A map with no start square
+#define MAP_NO_START                0xFFFF
+
+// The current map isn't one of the stock maps as they were built
+#define MAP_NOT_STOCK               0xFF
+
+// Where the overhead map sits on screen, its squares' size, and
+// how many squares it shows either way. Larger maps scroll
+#define MAP_LEFT                    40
+#define MAP_TOP                     40
+#define MAP_SQUARE                  8
+#define MAP_VIEW_SQUARES            20
 
 
 /*
@@ -24,11 +48,31 @@
  */
 namespace Map {
     uint8_t         init(uint8_t last_map) ;
+    void            select(uint8_t map);
+    bool            generate(uint32_t seed);
+    bool            load(const uint8_t* data, size_t size);
+    uint8_t         count();
+    uint16_t        width();
+    uint16_t        height();
+    bool            get_start(uint16_t* x, uint16_t* y);
+    uint8_t         get_stock_map();
     void            draw(uint8_t y_delta, bool show_entities, bool show_tele = true);
-    bool            set_square_contents(uint8_t x, uint8_t y, uint8_t value);
-    uint8_t         get_square_contents(uint8_t x, uint8_t y);
-    uint8_t         get_view_distance(int8_t x, int8_t y, uint8_t direction);
-    uint8_t         phantom_on_square(uint8_t x, uint8_t y);
+    void            refresh(uint8_t y_delta, bool show_entities, bool show_tele = true);
+    bool            set_square_contents(uint16_t x, uint16_t y, uint8_t value);
+    uint8_t         get_square_contents(uint16_t x, uint16_t y);
+    uint8_t         get_exits(uint16_t x, uint16_t y);
+    uint8_t         get_view_distance(int16_t x, int16_t y, uint8_t direction);
+    bool            pick_clear_square(uint16_t x, uint16_t y, uint8_t margin, bool avoid_phantoms, uint16_t* pick_x, uint16_t* pick_y);
+#ifdef DEBUG
+    uint32_t        check_walls();
+#endif
+    void            update_occupancy(uint16_t x, uint16_t y);
+    void            reset_occupancy();
+#ifdef DEBUG
+    uint32_t        check_occupancy();
+#endif
+    uint8_t         phantom_on_square(uint16_t x, uint16_t y);
+    uint8_t         phantom_on_square(const Frame& frame, uint16_t x, uint16_t y);
 }
 
 
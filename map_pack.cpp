@@ -0,0 +1,140 @@
+/*
+ * Phantom Slayer
+ * Map pack format
+ *
+ * Packs are read in place, from flash on the device or from a
+ * mapped file on the host, so selecting a map is just indexing
+ * into its records
+ *
+ * NOTE This has no SDK dependencies, so the host tools build it too
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <cstddef>
+#include <cstdint>
+#include "map_pack.h"
+
+
+static_assert(sizeof(MapPackHeader) == 16, "Map pack header must be 16 bytes");
+static_assert(sizeof(MapPackMeta) == 4, "Map pack metadata must be 4 bytes");
+
+
+namespace MapPack {
+
+
+/**
+    Calculate the size of a pack's map records.
+
+    - Parameters:
+        - width:  The maps' width in squares.
+        - height: The maps' height in squares.
+
+    - Returns: The size of each record in bytes.
+ */
+uint32_t record_size(uint16_t width, uint16_t height) {
+    uint32_t size = sizeof(MapPackMeta) + (uint32_t)((width + 7) >> 3) * height;
+    return (size + 3) & ~3u;
+}
+
+
+/**
+    Check that a block of memory holds a well-formed pack, so
+    that the other functions can read it without checks.
+
+    - Parameters:
+        - pack:  The pack's data, aligned to four bytes.
+        - size:  The size of the data in bytes.
+        - error: Optional pointer to receive a description of
+                 the first problem found.
+
+    - Returns: `true` if the pack is good, otherwise `false`.
+ */
+bool validate(const uint8_t* pack, size_t size, const char** error) {
+    const char* problem = nullptr;
+    const MapPackHeader* head = header(pack);
+
+    if (pack == nullptr || size < sizeof(MapPackHeader)) {
+        problem = "too small for a header";
+    } else if (((uintptr_t)pack & 3) != 0) {
+        problem = "not aligned to four bytes";
+    } else if (head->magic != MAP_PACK_MAGIC) {
+        problem = "not a map pack";
+    } else if (head->version != MAP_PACK_VERSION) {
+        problem = "unsupported version";
+    } else if (head->count == 0 || head->width == 0 || head->height == 0) {
+        problem = "no maps";
+    } else if (head->record_size != record_size(head->width, head->height)) {
+        problem = "bad record size";
+    } else if (size < sizeof(MapPackHeader) + (size_t)head->count * head->record_size) {
+        problem = "truncated";
+    } else {
+        for (uint16_t i = 0 ; i < head->count ; ++i) {
+            const MapPackMeta* info = meta(pack, i);
+            if (info->start_x == MAP_PACK_NO_START && info->start_y == MAP_PACK_NO_START) continue;
+            if (info->start_x >= head->width || info->start_y >= head->height || is_wall(pack, i, info->start_x, info->start_y)) {
+                problem = "bad start square";
+                break;
+            }
+        }
+    }
+
+    if (error != nullptr) *error = problem;
+    return problem == nullptr;
+}
+
+
+/**
+    Return a pack's header.
+ */
+const MapPackHeader* header(const uint8_t* pack) {
+    return (const MapPackHeader*)pack;
+}
+
+
+/**
+    Return the metadata of one of a pack's maps.
+
+    - Parameters:
+        - pack:  A validated pack.
+        - index: The map's index, less than the pack's `count`.
+ */
+const MapPackMeta* meta(const uint8_t* pack, uint16_t index) {
+    const MapPackHeader* head = header(pack);
+    return (const MapPackMeta*)(pack + sizeof(MapPackHeader) + (size_t)index * head->record_size);
+}
+
+
+/**
+    Return the wall grid of one of a pack's maps.
+
+    - Parameters:
+        - pack:  A validated pack.
+        - index: The map's index, less than the pack's `count`.
+ */
+const uint8_t* grid(const uint8_t* pack, uint16_t index) {
+    return (const uint8_t*)(meta(pack, index) + 1);
+}
+
+
+/**
+    Check one square of one of a pack's maps.
+
+    - Parameters:
+        - pack:  A validated pack.
+        - index: The map's index, less than the pack's `count`.
+        - x:     The square's x co-ordinate.
+        - y:     The square's y co-ordinate.
+
+    - Returns: `true` if the square is a wall, otherwise `false`.
+ */
+bool is_wall(const uint8_t* pack, uint16_t index, uint16_t x, uint16_t y) {
+    const uint8_t* row = grid(pack, index) + (size_t)y * ((header(pack)->width + 7) >> 3);
+    return (row[x >> 3] >> (x & 7)) & 1;
+}
+
+
+}   // namespace MapPack
@@ -0,0 +1,61 @@
+/*
+ * Phantom Slayer
+ * Map pack format
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _MAP_PACK_HEADER_
+#define _MAP_PACK_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+// A pack is a `MapPackHeader` then `count` map records, each
+// `record_size` bytes: a `MapPackMeta`, then the wall grid, by row,
+// `(width + 7) / 8` bytes a row. Bit n of a row's byte m is set if
+// square 8m + n is a wall. Records are padded to four bytes, and
+// all values are little-endian
+#define MAP_PACK_MAGIC              0x504D5350      // 'PSMP'
+#define MAP_PACK_VERSION            1
+
+// A map with no start square
+#define MAP_PACK_NO_START           0xFFFF
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint32_t                magic;
+    uint16_t                version;
+    uint16_t                count;          // Maps in the pack
+    uint16_t                width;          // Squares across each map
+    uint16_t                height;
+    uint32_t                record_size;    // Bytes per map
+} MapPackHeader;
+
+typedef struct {
+    uint16_t                start_x;        // The player's start square,
+    uint16_t                start_y;        // or `MAP_PACK_NO_START`
+} MapPackMeta;
+
+
+/*
+ *      PROTOTYPES
+ */
+namespace MapPack {
+    uint32_t                record_size(uint16_t width, uint16_t height);
+    bool                    validate(const uint8_t* pack, size_t size, const char** error = nullptr);
+    const MapPackHeader*    header(const uint8_t* pack);
+    const MapPackMeta*      meta(const uint8_t* pack, uint16_t index);
+    const uint8_t*          grid(const uint8_t* pack, uint16_t index);
+    bool                    is_wall(const uint8_t* pack, uint16_t index, uint16_t x, uint16_t y);
+}
+
+
+#endif  // _MAP_PACK_HEADER_
@@ -0,0 +1,56 @@
+/*
+ * Phantom Slayer
+ * Map pack file
+ *
+ * GENERATED by tools/map-compiler from maps/maps.txt -- do not edit
+ *
+ * MAPS: 6, 20x20 squares, 400 bytes
+ * MAP   CORRIDOR  AREAS     START  NOTES
+ * 0          237      1         -
+ * 1          241      1         -
+ * 2          247      1         -
+ * 3          226      1         -
+ * 4          249      1         -
+ * 5          225      1         -
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+
+
+/*
+ *      MAP PACK
+ */
+alignas(4) const uint8_t map_pack[] = {
+    0x50, 0x53, 0x4d, 0x50, 0x01, 0x00, 0x06, 0x00, 0x14, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xb6, 0xb7, 0x0d, 0x06, 0x10, 0x08, 0xa8, 0xc6, 0x05,
+    0x0b, 0xf0, 0x01, 0x60, 0x3b, 0x0c, 0x0f, 0x80, 0x01, 0x78, 0x35, 0x0c, 0x22, 0x80, 0x01, 0x88,
+    0xfb, 0x0b, 0xd3, 0x7f, 0x00, 0x08, 0x0d, 0x0d, 0x62, 0xb8, 0x01, 0x3f, 0x03, 0x04, 0xb0, 0xbb,
+    0x01, 0xa5, 0x3b, 0x0e, 0x16, 0xb0, 0x0f, 0xc0, 0x07, 0x00, 0x55, 0xb7, 0x0a, 0x01, 0x00, 0x08,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x77, 0xef, 0x0f, 0x00, 0xe0, 0x0f, 0x77, 0x0f, 0x00,
+    0x00, 0xbc, 0x0b, 0x7d, 0xa1, 0x03, 0x7c, 0x0b, 0x05, 0x41, 0x62, 0x00, 0x95, 0x08, 0x0b, 0xa0,
+    0xe2, 0x01, 0x37, 0x1c, 0x04, 0x80, 0xc1, 0x05, 0xbf, 0xd7, 0x01, 0x00, 0x10, 0x0a, 0xb6, 0xe6,
+    0x02, 0x34, 0x08, 0x04, 0x81, 0xef, 0x05, 0x3a, 0x00, 0x08, 0xba, 0xda, 0x0a, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x55, 0xdd, 0x0a, 0x55, 0x48, 0x00, 0x00, 0x13, 0x05,
+    0x5b, 0x4d, 0x02, 0x34, 0x54, 0x07, 0xc5, 0xc2, 0x02, 0x10, 0x96, 0x04, 0xd6, 0x30, 0x02, 0x95,
+    0xca, 0x0c, 0xa9, 0x2f, 0x03, 0x2a, 0x82, 0x05, 0x80, 0x5a, 0x00, 0xda, 0x60, 0x07, 0x5c, 0x2a,
+    0x0d, 0x89, 0x5a, 0x00, 0x24, 0x01, 0x0d, 0xae, 0x6a, 0x01, 0xae, 0x7a, 0x07, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xdd, 0x7b, 0x0d, 0x1d, 0x78, 0x00, 0xd8, 0x73, 0x0b,
+    0x02, 0x07, 0x00, 0x58, 0xb6, 0x0f, 0x9f, 0x00, 0x01, 0xd1, 0x7b, 0x0c, 0x04, 0xe3, 0x0f, 0x7e,
+    0x08, 0x00, 0x78, 0xaf, 0x0b, 0x22, 0x20, 0x00, 0x88, 0xcd, 0x07, 0xff, 0xe1, 0x07, 0xe2, 0x0d,
+    0x04, 0x08, 0xd0, 0x01, 0xe5, 0x9d, 0x07, 0x71, 0x20, 0x08, 0x75, 0xb5, 0x0a, 0x01, 0x00, 0x08,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xee, 0xed, 0x0a, 0x6c, 0x6c, 0x02, 0x01, 0x45, 0x05,
+    0xd5, 0x11, 0x00, 0x14, 0x54, 0x05, 0xd6, 0x52, 0x04, 0xc1, 0x25, 0x01, 0x94, 0xcc, 0x05, 0xb3,
+    0x5a, 0x01, 0x88, 0x32, 0x07, 0x26, 0x88, 0x02, 0xda, 0x6a, 0x08, 0x80, 0x03, 0x07, 0xaa, 0x5a,
+    0x05, 0x11, 0x50, 0x00, 0xa4, 0x2b, 0x05, 0x32, 0xa2, 0x01, 0xb6, 0x6b, 0x07, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x7b, 0x6b, 0x05, 0x7b, 0x20, 0x00, 0xc0, 0x8b, 0x0b,
+    0x9b, 0xf1, 0x00, 0x21, 0xfd, 0x0b, 0xbc, 0x00, 0x08, 0x11, 0xfe, 0x03, 0xcc, 0xf8, 0x0a, 0xe1,
+    0x02, 0x00, 0xfe, 0xf8, 0x07, 0x18, 0x43, 0x04, 0x43, 0x37, 0x09, 0x7f, 0x84, 0x03, 0x30, 0x31,
+    0x08, 0x86, 0xc7, 0x03, 0xf0, 0x77, 0x0b, 0x07, 0x00, 0x00, 0x77, 0x55, 0x0b, 0x07, 0x00, 0x08
+};
+
+static_assert(sizeof(map_pack) == MAP_PACK_BYTES, "Map pack size mismatch");
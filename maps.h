@@ -0,0 +1,31 @@
+/*
+ * Phantom Slayer
+ * Map pack
+ *
+ * GENERATED by tools/map-compiler from maps/maps.txt -- do not edit
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _MAP_PACK_DATA_HEADER_
+#define _MAP_PACK_DATA_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+#define MAP_PACK_WIDTH          20
+#define MAP_PACK_HEIGHT         20
+#define MAP_PACK_BYTES          400
+
+
+/*
+ *      GLOBALS
+ */
+extern const uint8_t    map_pack[];
+
+
+#endif  // _MAP_PACK_DATA_HEADER_
@@ -0,0 +1,340 @@
+/*
+ * Phantom Slayer
+ * Maze generator
+ *
+ * Mazes are grown as a spanning tree of 'rooms' on the even-numbered
+ * squares, joined through the odd-numbered squares between them,
+ * then opened up with extra passages until they have enough loops
+ * and few enough dead ends.
+ *
+ * NOTE This has no SDK dependencies, so the host tools build it too
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <cstdint>
+#include <cstring>
+#include "tinymt32.h"
+#include "maze.h"
+
+
+/*
+ *      CONSTANTS
+ */
+#define MAZE_ROOMS                  ((MAZE_SIZE + 1) / 2)
+#define MAZE_ROW_MASK               (MAZE_SIZE == 32 ? 0xFFFFFFFF : ((1u << (MAZE_SIZE & 31)) - 1))
+
+static_assert(MAZE_SIZE >= 8 && MAZE_SIZE <= 32, "Mazes must be 8 to 32 squares across");
+
+
+namespace Maze {
+
+
+/*
+ *      STATIC PROTOTYPES
+ */
+static void     carve_tree(uint32_t* rows, tinymt32_t* rng);
+static void     add_loops(uint32_t* rows, tinymt32_t* rng, uint16_t count);
+static void     remove_dead_ends(uint32_t* rows, tinymt32_t* rng);
+static void     clear_centre(uint32_t* rows);
+static bool     open_passage(uint32_t* rows, uint16_t room, uint8_t direction);
+static bool     has_passage(const uint32_t* rows, uint16_t room, uint8_t direction);
+static int16_t  neighbour(uint16_t room, uint8_t direction);
+static uint8_t  room_exits(const uint32_t* rows, uint16_t room);
+static uint32_t roll(tinymt32_t* rng, uint32_t max);
+
+
+/**
+    Generate a maze. The same seed always gives the same maze.
+
+    - Parameters:
+        - seed:  The maze's random seed.
+        - rows:  `MAZE_SIZE` rows to fill in: bit x of row y is set
+                 if square (x, y) is a wall.
+        - stats: Optional structure to receive the maze's measurements.
+
+    - Returns: `true` if the maze meets all of the constraints, `false`
+               if it doesn't after `MAZE_MAX_TRIES` attempts.
+ */
+bool generate(uint32_t seed, uint32_t* rows, MazeStats* stats) {
+    // NOTE TinyMT reads its parameters from the state, so zero them
+    //      as the game's own (static) state is, or the same seed
+    //      won't always give the same maze
+    tinymt32_t rng = {};
+    tinymt32_init(&rng, seed);
+
+    MazeStats result;
+    for (uint8_t tries = 1 ; tries <= MAZE_MAX_TRIES ; ++tries) {
+        carve_tree(rows, &rng);
+        add_loops(rows, &rng, MAZE_MIN_LOOPS);
+        remove_dead_ends(rows, &rng);
+        clear_centre(rows);
+
+        measure(rows, &result);
+        result.tries = tries;
+        if (result.is_valid) break;
+    }
+
+    if (stats != nullptr) *stats = result;
+    return result.is_valid;
+}
+
+
+/**
+    Measure a maze against the generator's constraints.
+
+    - Parameters:
+        - rows:  The maze's `MAZE_SIZE` rows, walls as set bits.
+        - stats: The structure to fill in.
+ */
+void measure(const uint32_t* rows, MazeStats* stats) {
+    uint32_t clear[MAZE_SIZE];
+    uint32_t left[MAZE_SIZE];
+    uint16_t edges = 0;
+    stats->clear = 0;
+    stats->dead_ends = 0;
+
+    for (uint8_t y = 0 ; y < MAZE_SIZE ; ++y) clear[y] = ~rows[y] & MAZE_ROW_MASK;
+
+    for (uint8_t y = 0 ; y < MAZE_SIZE ; ++y) {
+        // Count the corridor squares, and the links between them
+        stats->clear += __builtin_popcount(clear[y]);
+        edges += __builtin_popcount(clear[y] & (clear[y] >> 1));
+        if (y < MAZE_SIZE - 1) edges += __builtin_popcount(clear[y] & clear[y + 1]);
+
+        // A dead end has exactly one corridor square beside it
+        for (uint8_t x = 0 ; x < MAZE_SIZE ; ++x) {
+            if ((clear[y] & (1u << x)) == 0) continue;
+            uint8_t ways = 0;
+            if (x > 0 && (clear[y] & (1u << (x - 1)))) ++ways;
+            if (x < MAZE_SIZE - 1 && (clear[y] & (1u << (x + 1)))) ++ways;
+            if (y > 0 && (clear[y - 1] & (1u << x))) ++ways;
+            if (y < MAZE_SIZE - 1 && (clear[y + 1] & (1u << x))) ++ways;
+            if (ways == 1) stats->dead_ends++;
+        }
+    }
+
+    // Count the connected areas by flood filling each in turn,
+    // a whole row of squares at a time
+    uint16_t areas = 0;
+    memcpy(left, clear, sizeof(left));
+    for (uint8_t y = 0 ; y < MAZE_SIZE ; ++y) {
+        while (left[y] != 0) {
+            uint32_t fill[MAZE_SIZE] = {0};
+            fill[y] = left[y] & -left[y];
+            bool is_growing = true;
+            while (is_growing) {
+                is_growing = false;
+                for (uint8_t i = 0 ; i < MAZE_SIZE ; ++i) {
+                    uint32_t grown = fill[i] | (fill[i] << 1) | (fill[i] >> 1);
+                    if (i > 0) grown |= fill[i - 1];
+                    if (i < MAZE_SIZE - 1) grown |= fill[i + 1];
+                    grown &= left[i];
+                    if (grown != fill[i]) {
+                        fill[i] = grown;
+                        is_growing = true;
+                    }
+                }
+            }
+
+            for (uint8_t i = 0 ; i < MAZE_SIZE ; ++i) left[i] &= ~fill[i];
+            ++areas;
+        }
+    }
+
+    // Each link beyond those needed to join up an area closes a loop
+    stats->loops = edges + areas - stats->clear;
+    stats->is_connected = (areas == 1);
+
+    stats->is_centre_clear = true;
+    for (uint8_t y = MAZE_CENTRE - MAZE_CENTRE_RADIUS ; y <= MAZE_CENTRE + MAZE_CENTRE_RADIUS ; ++y) {
+        for (uint8_t x = MAZE_CENTRE - MAZE_CENTRE_RADIUS ; x <= MAZE_CENTRE + MAZE_CENTRE_RADIUS ; ++x) {
+            if ((clear[y] & (1u << x)) == 0) stats->is_centre_clear = false;
+        }
+    }
+
+    stats->tries = 0;
+    stats->is_valid = stats->is_connected && stats->is_centre_clear
+                      && stats->loops >= MAZE_MIN_LOOPS && stats->dead_ends <= MAZE_MAX_DEAD_ENDS;
+}
+
+
+/*
+    Fill the maze with wall, then carve a spanning tree of rooms
+    through it, depth first from a random room.
+ */
+static void carve_tree(uint32_t* rows, tinymt32_t* rng) {
+    uint16_t stack[MAZE_ROOMS * MAZE_ROOMS];
+    bool visited[MAZE_ROOMS * MAZE_ROOMS] = {false};
+    uint16_t depth = 0;
+
+    for (uint8_t y = 0 ; y < MAZE_SIZE ; ++y) rows[y] = MAZE_ROW_MASK;
+
+    uint16_t room = roll(rng, MAZE_ROOMS * MAZE_ROOMS);
+    rows[(room / MAZE_ROOMS) * 2] &= ~(1u << ((room % MAZE_ROOMS) * 2));
+    visited[room] = true;
+    stack[depth++] = room;
+
+    while (depth > 0) {
+        // Find the current room's unvisited neighbours
+        room = stack[depth - 1];
+        uint8_t choices[4];
+        uint8_t count = 0;
+        for (uint8_t d = 0 ; d < 4 ; ++d) {
+            int16_t next = neighbour(room, d);
+            if (next >= 0 && !visited[next]) choices[count++] = d;
+        }
+
+        if (count == 0) {
+            // Dead end: back up
+            --depth;
+            continue;
+        }
+
+        uint8_t direction = choices[roll(rng, count)];
+        open_passage(rows, room, direction);
+        room = neighbour(room, direction);
+        visited[room] = true;
+        stack[depth++] = room;
+    }
+}
+
+
+/*
+    Open up `count` extra passages between rooms. Every room is
+    already reachable, so each new passage closes a loop.
+ */
+static void add_loops(uint32_t* rows, tinymt32_t* rng, uint16_t count) {
+    // NOTE Give up eventually, in case the maze is too small
+    //      to hold the loops asked for
+    uint16_t attempts = count * 16;
+    while (count > 0 && attempts-- > 0) {
+        uint16_t room = roll(rng, MAZE_ROOMS * MAZE_ROOMS);
+        if (open_passage(rows, room, roll(rng, 4))) --count;
+    }
+}
+
+
+/*
+    Join dead ends to a neighbouring room, preferring one that is
+    also a dead end, until there are few enough.
+ */
+static void remove_dead_ends(uint32_t* rows, tinymt32_t* rng) {
+    while (true) {
+        uint16_t dead_ends[MAZE_ROOMS * MAZE_ROOMS];
+        uint16_t count = 0;
+        for (uint16_t room = 0 ; room < MAZE_ROOMS * MAZE_ROOMS ; ++room) {
+            if (room_exits(rows, room) == 1) dead_ends[count++] = room;
+        }
+
+        // NOTE Clearing the centre can only remove dead ends, so
+        //      it's safe to count them before it's done
+        if (count <= MAZE_MAX_DEAD_ENDS) return;
+
+        // Every room has at least two neighbours, so a dead
+        // end always has a closed passage to open
+        uint16_t room = dead_ends[roll(rng, count)];
+        uint8_t choice = 0;
+        bool is_chosen = false;
+        for (uint8_t d = 0 ; d < 4 ; ++d) {
+            int16_t next = neighbour(room, d);
+            if (next < 0 || has_passage(rows, room, d)) continue;
+            if (!is_chosen || room_exits(rows, next) == 1) choice = d;
+            is_chosen = true;
+        }
+
+        open_passage(rows, room, choice);
+    }
+}
+
+
+/*
+    Clear the squares round the centre of the maze. They
+    all touch a room, so the maze stays connected.
+ */
+static void clear_centre(uint32_t* rows) {
+    uint32_t mask = ((1u << (MAZE_CENTRE_RADIUS * 2 + 1)) - 1) << (MAZE_CENTRE - MAZE_CENTRE_RADIUS);
+    for (uint8_t y = MAZE_CENTRE - MAZE_CENTRE_RADIUS ; y <= MAZE_CENTRE + MAZE_CENTRE_RADIUS ; ++y) rows[y] &= ~mask;
+}
+
+
+/*
+    Open the passage from a room in the specified direction,
+    and the room it leads to.
+
+    - Returns: `true` if the passage was opened, `false` if it was
+               already open or would lead out of the maze.
+ */
+static bool open_passage(uint32_t* rows, uint16_t room, uint8_t direction) {
+    int16_t next = neighbour(room, direction);
+    if (next < 0 || has_passage(rows, room, direction)) return false;
+
+    // The passage square lies halfway between the rooms
+    uint8_t x = (room % MAZE_ROOMS) + (next % MAZE_ROOMS);
+    uint8_t y = (room / MAZE_ROOMS) + (next / MAZE_ROOMS);
+    rows[y] &= ~(1u << x);
+    rows[(next / MAZE_ROOMS) * 2] &= ~(1u << ((next % MAZE_ROOMS) * 2));
+    return true;
+}
+
+
+/*
+    Is the passage from a room in the specified direction open?
+ */
+static bool has_passage(const uint32_t* rows, uint16_t room, uint8_t direction) {
+    int16_t next = neighbour(room, direction);
+    if (next < 0) return false;
+
+    uint8_t x = (room % MAZE_ROOMS) + (next % MAZE_ROOMS);
+    uint8_t y = (room / MAZE_ROOMS) + (next / MAZE_ROOMS);
+    return (rows[y] & (1u << x)) == 0;
+}
+
+
+/*
+    The room next to a room in the specified direction: 0 to 3
+    for north, east, south and west.
+
+    - Returns: The room's index, or -1 if it would be off the maze.
+ */
+static int16_t neighbour(uint16_t room, uint8_t direction) {
+    uint8_t rx = room % MAZE_ROOMS;
+    uint8_t ry = room / MAZE_ROOMS;
+    switch(direction) {
+        case 0:
+            return ry > 0 ? room - MAZE_ROOMS : -1;
+        case 1:
+            return rx < MAZE_ROOMS - 1 ? room + 1 : -1;
+        case 2:
+            return ry < MAZE_ROOMS - 1 ? room + MAZE_ROOMS : -1;
+        default:
+            return rx > 0 ? room - 1 : -1;
+    }
+}
+
+
+/*
+    The number of open passages out of a room.
+ */
+static uint8_t room_exits(const uint32_t* rows, uint16_t room) {
+    uint8_t count = 0;
+    for (uint8_t d = 0 ; d < 4 ; ++d) {
+        if (has_passage(rows, room, d)) ++count;
+    }
+
+    return count;
+}
+
+
+/*
+    A random number from 0 to `max` - 1.
+ */
+static uint32_t roll(tinymt32_t* rng, uint32_t max) {
+    return tinymt32_generate_uint32(rng) % max;
+}
+
+
+}   // namespace Maze
@@ -0,0 +1,57 @@
+/*
+ * Phantom Slayer
+ * Maze generator
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _MAZE_GENERATOR_HEADER_
+#define _MAZE_GENERATOR_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+// Mazes are square, and may be up to 32 squares across
+#define MAZE_SIZE                   20
+
+// The generator's constraints:
+//   - The minimum number of loops: independent cycles in the corridors
+//   - The maximum number of dead ends: corridor squares with one way out
+//   - The clear area round the centre, for placing the player
+#define MAZE_MIN_LOOPS              16
+#define MAZE_MAX_DEAD_ENDS          12
+#define MAZE_CENTRE                 (MAZE_SIZE / 2 - 1)
+#define MAZE_CENTRE_RADIUS          1
+
+// Attempts at a maze that meets the constraints before giving up
+#define MAZE_MAX_TRIES              4
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint16_t                clear;          // Corridor squares
+    uint16_t                loops;
+    uint16_t                dead_ends;
+    uint8_t                 tries;          // Attempts taken by `generate()`
+    bool                    is_connected;   // Every corridor square can reach every other
+    bool                    is_centre_clear;
+    bool                    is_valid;       // All of the constraints are met
+} MazeStats;
+
+
+/*
+ *      PROTOTYPES
+ */
+namespace Maze {
+    bool        generate(uint32_t seed, uint32_t* rows, MazeStats* stats = nullptr);
+    void        measure(const uint32_t* rows, MazeStats* stats);
+}
+
+
+#endif  // _MAZE_GENERATOR_HEADER_
@@ -20,6 +20,79 @@ extern Game         game;
 extern tinymt32_t   tinymt_store;
 
 
+/*
+    Build the tables `favour()` and `pick_direction()` choose a move by.
+
+    A decision holds the candidate exits in its low nibble and how to
+    draw among them in its top bits. One favoured, available exit is
+    drawn from a set of one, needing no roll; two from a pair, on an
+    `irandom(1, 100) % 2` roll; otherwise the draw is any available
+    exit but the way back, if that leaves one, on an `irandom(0, 4)`
+    roll. Either roll lands in -3 to 3, and counts round the candidates
+    from `PHANTOM_NORTH` -- as a `uint8_t`, which is how `move()` has
+    always counted negative rolls -- so the picks are by roll plus three.
+ */
+static constexpr MoveTables make_move_tables() {
+    MoveTables tables = {};
+    for (uint8_t i = 0 ; i < 16 ; ++i) {
+        for (uint8_t bit = 0 ; bit < 4 ; ++bit) {
+            if (i & (1 << bit)) ++tables.exit_count[i];
+        }
+
+        tables.way_back[i] = 0;
+    }
+
+    tables.way_back[PHANTOM_NORTH] = 2;
+    tables.way_back[PHANTOM_EAST] = 3;
+    tables.way_back[PHANTOM_WEST] = 1;
+    tables.north_south[0] = PHANTOM_SOUTH;
+    tables.north_south[2] = PHANTOM_NORTH;
+    tables.east_west[0] = PHANTOM_EAST;
+    tables.east_west[2] = PHANTOM_WEST;
+
+    for (uint8_t available = 0 ; available < 16 ; ++available) {
+        for (uint8_t favoured = 0 ; favoured < 16 ; ++favoured) {
+            for (uint8_t back = 0 ; back < 4 ; ++back) {
+                uint8_t usable = available & favoured;
+                uint8_t decision = usable | MOVE_DRAW_NONE;
+                if (tables.exit_count[usable] == 2) decision = usable | MOVE_DRAW_PAIR;
+                if (tables.exit_count[usable] != 1 && tables.exit_count[usable] != 2) {
+                    uint8_t ways = available & ~(1 << back);
+                    if (ways == 0) ways = available;
+                    decision = ways | MOVE_DRAW_ANY;
+                }
+
+                tables.decisions[available][favoured][back] = decision;
+            }
+        }
+    }
+
+    for (uint8_t candidates = 1 ; candidates < 16 ; ++candidates) {
+        for (int8_t roll = -3 ; roll <= 3 ; ++roll) {
+            uint8_t n = (uint8_t)roll % tables.exit_count[candidates];
+            for (uint8_t bit = 0 ; bit < 4 ; ++bit) {
+                if ((candidates & (1 << bit)) == 0) continue;
+                if (n == 0) {
+                    tables.picks[candidates][roll + 3] = (1 << bit);
+                    break;
+                }
+
+                --n;
+            }
+        }
+    }
+
+    return tables;
+}
+
+
+/*
+ *      GLOBALS
+ */
+// Built by the compiler, above, so they sit in flash
+constexpr MoveTables move_tables = make_move_tables();
+
+
 /*
     Constructor.
 
@@ -30,11 +103,13 @@ extern tinymt32_t   tinymt_store;
         - start_y: Inital Y co-ordinate. Default: off the board.
  */
 Phantom::Phantom() {
-    // Use 'NOT_ON_BOARD' (== ERROR_CONDITION) as 'not on board yet'
+    // Use 'NOT_ON_BOARD' as 'not on board yet'
     init();
     direction = DIRECTION_NORTH;
     x = NOT_ON_BOARD;
     y = NOT_ON_BOARD;
+    next_move = 0;
+    speed = PHANTOM_MOVE_TIME_US << 1;
 }
 
 
@@ -57,38 +132,19 @@ void Phantom::init() {
 /*
     Set the Phantom on a new square.
  */
-void Phantom::place(uint8_t my_index) {
-    while (true) {
-        // Pick a random co-ordinate
-        uint8_t new_x = Utils::irandom(0, 20);
-        uint8_t new_y = Utils::irandom(0, 20);
-
-        // Make sure we're selecting a clear square, the player is not there
-        // already and is not in a nearby square either
-        if ((new_x < game.player.x - 4 || new_x > game.player.x + 4) && (new_y < game.player.y - 4 || new_y > game.player.y + 4)) {
-            if (Map::get_square_contents(new_x, new_y) == MAP_TILE_CLEAR) {
-                bool good = true;
-
-                // Make sure the square is not occupied by another Phantom
-                if (game.phantom_count > 1) {
-                    for (uint8_t i = 0 ; i < game.phantom_count ; ++i) {
-                        if (i == my_index) continue;
-                        Phantom &p = game.phantoms.at(i);
-                        if (p.x == new_x && p.y == new_y) {
-                            good = false;
-                            break;
-                        }
-                    }
-                }
-
-                if (good) {
-                    x = new_x;
-                    y = new_y;
-                    break;
-                }
-            }
-        }
+void Phantom::place() {
+    // Pick a clear square with no other Phantom on it, away from the
+    // player: not in the four rows or columns either side of the player's
+    set_square(NOT_ON_BOARD, NOT_ON_BOARD);
+    uint16_t new_x, new_y;
+    if (Map::pick_clear_square(game.player.x, game.player.y, 4, true, &new_x, &new_y)
+        || Map::pick_clear_square(game.player.x, game.player.y, 0, true, &new_x, &new_y)) {
+        set_square(new_x, new_y);
     }
+
+    #ifdef DEBUG
+    if (x == NOT_ON_BOARD) printf("NO SQUARE FOR PHANTOM\n");
+    #endif
 }
 
 
@@ -102,177 +158,140 @@ bool Phantom::move() {
     // Has the Phantom been zapped? Don't move it
     if (x == NOT_ON_BOARD || hp < 1) return false;
 
-    uint8_t new_x = x;
-    uint8_t new_y = y;
-    uint8_t new_direction = direction;
-    uint8_t *p_x = &new_x;
-    uint8_t *p_y = &new_y;
-
     // Get distance to player
-    int8_t dx = x - game.player.x;
-    int8_t dy = y - game.player.y;
+    int16_t dx = x - game.player.x;
+    int16_t dy = y - game.player.y;
 
     // Has the phantom got the player?
     if (dx == 0 && dy == 0) return true;
 
-    // Set up direction storage
-    uint8_t available_directions = 0;
-    uint8_t favoured_directions = 0;
-    uint8_t usable_directions = 0;
-    uint8_t exit_count = 0;
-
     // Determine the directions in which the phantom *can* move: empty spaces with no phantom already there
-    if (x > 0 && Map::get_square_contents(x - 1, y) != MAP_TILE_WALL && Map::phantom_on_square(x - 1, y) == ERROR_CONDITION) {
-        available_directions |= PHANTOM_WEST;
-        ++exit_count;
+    uint8_t exits = Map::get_exits(x, y);
+    uint8_t available = exits;
+    if ((exits & PHANTOM_WEST) && Map::phantom_on_square(x - 1, y) != ERROR_CONDITION) available &= ~PHANTOM_WEST;
+    if ((exits & PHANTOM_EAST) && Map::phantom_on_square(x + 1, y) != ERROR_CONDITION) available &= ~PHANTOM_EAST;
+    if ((exits & PHANTOM_NORTH) && Map::phantom_on_square(x, y - 1) != ERROR_CONDITION) available &= ~PHANTOM_NORTH;
+    if ((exits & PHANTOM_SOUTH) && Map::phantom_on_square(x, y + 1) != ERROR_CONDITION) available &= ~PHANTOM_SOUTH;
+
+    if (available == 0) {
+        // Phantom can't move anywhere -- all its exits are currently blocked
+        return false;
     }
 
-    if (x < MAP_MAX && Map::get_square_contents(x + 1, y) != MAP_TILE_WALL && Map::phantom_on_square(x + 1, y) == ERROR_CONDITION) {
-        available_directions |= PHANTOM_EAST;
-        ++exit_count;
-    }
+    // FROM 1.1.2
+    // Choose the way by table: see `favour()` and `pick_direction()`
+    uint8_t favoured = favour(dx, dy, available, Pursuit::closer_exits(x, y), direction, &back_steps);
+    uint8_t new_direction = pick_direction(available, favoured, direction, &back_steps);
 
-    if (y > 0 && Map::get_square_contents(x, y - 1) != MAP_TILE_WALL && Map::phantom_on_square(x, y - 1) == ERROR_CONDITION) {
-        available_directions |= PHANTOM_NORTH;
-        ++exit_count;
-    }
+    // Set the Phantom's new location
+    uint16_t new_x = x;
+    uint16_t new_y = y;
+    move_one_square(new_direction, &new_x, &new_y);
+    if (new_x != x || new_y != y) invalidate(DIRTY_VIEW);
+    set_square(new_x, new_y);
+    direction = new_direction;
 
-    if (y < MAP_MAX && Map::get_square_contents(x, y + 1) != MAP_TILE_WALL && Map::phantom_on_square(x, y + 1) == ERROR_CONDITION) {
-        available_directions |= PHANTOM_SOUTH;
-        ++exit_count;
-    }
+    return false;
+}
 
-    if (available_directions == 0) {
-        // Phantom can't move anywhere -- all its exits are currently blocked
-        return false;
+
+/**
+    Work out the exits a Phantom would like to take. If there's a
+    distance field or a route table, that's any exit that leads a
+    square nearer the player, and the Phantom never backs off.
+    Otherwise it's the player's way -- or, if the Phantom is backing
+    off and not yet at a junction, the opposite way -- but never the
+    way it came while backing off.
+
+    - Parameters:
+        - dx:         The Phantom's x co-ordinate less the player's.
+        - dy:         The Phantom's y co-ordinate less the player's.
+        - available:  The exits the Phantom can take, as `PHANTOM_*` bits.
+        - toward:     The exits that lead nearer the player, or 0.
+        - direction:  The way the Phantom last moved.
+        - back_steps: Pointer to the Phantom's backing-off state,
+                      which is reset at a junction.
+
+    - Returns: The favoured exits, as `PHANTOM_*` bits.
+ */
+uint8_t Phantom::favour(int16_t dx, int16_t dy, uint8_t available, uint8_t toward, uint8_t direction, uint8_t* back_steps) {
+    if (toward != 0) {
+        *back_steps = 0;
+        return toward;
     }
 
     // FROM 1.0.1
-    // Move away from the player if the Phantom is reversing
-    uint8_t from = 0;
-    if (back_steps > 0) {
-        // Phantom is indeed reversing, so get the direction
-        // from which it moved into this square -- we'll use this
-        // to prevent the Phantom from back-tracking if in the next
-        // lines it can go after the player again
-        from = came_from();
-        if (exit_count > 2) {
-            // The Phantom has reached a junction, ie. a square with more than
-            // two exits, so reset the reversal and try to move toward the player again
-            back_steps = 0;
-        } else {
-            // The Phantom isn't at a junction, so calculate its
-            // vector away from the player ('dx' and 'dy'
-            // vector toward the player unless changed here)
-            dx *= -1;
-            dy *= -1;
-        }
+    // A junction is a square with more than two ways on
+    bool is_backing_off = (*back_steps > 0);
+    bool is_reversing = is_backing_off && move_tables.exit_count[available] <= 2;
+    if (is_backing_off && !is_reversing) *back_steps = 0;
+
+    // Reversing flips the signs of the Phantom's vector to the player
+    uint8_t ns = (dy > 0) - (dy < 0) + 1;
+    uint8_t ew = (dx > 0) - (dx < 0) + 1;
+    if (is_reversing) {
+        ns = 2 - ns;
+        ew = 2 - ew;
     }
 
-    // Get the Phantom's move preferences -- the direction(s)
-    // in which it would like to go
-    if (dy > 0) favoured_directions |= PHANTOM_NORTH;
-    if (dy < 0) favoured_directions |= PHANTOM_SOUTH;
-    if (dx > 0) favoured_directions |= PHANTOM_WEST;
-    if (dx < 0) favoured_directions |= PHANTOM_EAST;
+    uint8_t from = is_backing_off ? (1 << move_tables.way_back[direction & 0x0F]) : 0;
+    return (move_tables.north_south[ns] | move_tables.east_west[ew]) & ~from;
+}
 
-    // FROM 1.0.1
-    // Remove the way the Phantom has come from its list of
-    // favoured directions. This is used when it's reversing
-    // and has reached a junction (ie. 'from != 0')
-    favoured_directions &= (~from);
-
-    // Count up the number of ways favoured moves and available squares match
-    uint8_t count = 0;
-    for (uint8_t i = 0 ; i < 4 ; ++i) {
-        if ((available_directions & (1 << i)) && (favoured_directions & (1 << i))) {
-            // Phantom wants to go in a certain direction and it has an exit
-            // so record this as a usable direction
-            ++count;
-            usable_directions |= (1 << i);
-        }
-    }
 
-    // Handle the move itself
-    if (count == 1) {
-        // Only one way for the Phantom to go, so take it
-        move_one_square(usable_directions, p_x, p_y);
-        new_direction = usable_directions;
-    } else if (count == 2) {
-        // The Phantom has two ways to go, so pick one of them at random:
-        // even roll go the first way (0); odd roll go the second (1)
-        uint8_t r = (Utils::irandom(1, 100) % 2);
-        uint8_t i = 0;
-        while(true) {
-            // Iterate through the directions until we have that can be
-            // used and then is selectable (r == 0)
-            if (usable_directions & (1 << i)) {
-                if (r == 0) {
-                    // Take this direction
-                    move_one_square((usable_directions & (1 << i)), p_x, p_y);
-                    new_direction = (usable_directions & (1 << i));
-                    break;
-                } else {
-                    // Ignore this direction
-                    r--;
-                }
-            }
+/**
+    Pick the way a Phantom goes. If one favoured exit is available,
+    it's taken; if two, one of them at random. Otherwise, the Phantom
+    takes any available exit at random, but not the way it came unless
+    that's the only way, and starts backing off.
 
-            ++i;
-            if (i > 3) i = 0;
-        }
-    } else {
-        // Count == 0 -- this is the special case where phantom can't move
-        //  where it wants so must move away or wait (if it has NOWHERE to go)
-        if (available_directions != 0) {
-            // Just pick a random available direction and take it,
-            // but remove the way the phantom came (provided it
-            // doesn't leave it with no way out)
-            // NOTE re-calculate 'from' here so we don't mess up
-            //      the ealier case when it needs to be zero
-            from = came_from();
-            uint8_t ad = available_directions;
-            ad &= (~from);
-
-            // Just in case removing from leaves the Phantom nowhere to go
-            // ie. it's at a dead end
-            if (ad != 0) available_directions = ad;
-
-            // Pick a random value and count down through the available exits
-            // until it comes to zero -- then take that one
-            uint8_t i = 0;
-            uint8_t r = Utils::irandom(0, 4);
-            while (true) {
-                if ((available_directions & (1 << i)) > 0) {
-                    if (r == 0) {
-                        move_one_square((available_directions & (1 << i)), p_x, p_y);
-                        new_direction = (available_directions & (1 << i));
-                        back_steps = 1;
-                        break;
-                    } else {
-                        r--;
-                    }
-                }
+    The choice comes from a table, by the exits and the way back. Any
+    random draw comes from the one roll the choice needs -- the same
+    roll `Phantom::move()` has always made -- and picks its exit from
+    another table.
 
-                ++i;
-                if (i > 3) i = 0;
-            }
-        }
+    - Parameters:
+        - available:  The exits the Phantom can take, as `PHANTOM_*` bits.
+        - favoured:   The exits the Phantom would like to take.
+        - direction:  The way the Phantom last moved.
+        - back_steps: Pointer to the Phantom's backing-off state.
+
+    - Returns: The way to go, as a `PHANTOM_*` value.
+ */
+uint8_t Phantom::pick_direction(uint8_t available, uint8_t favoured, uint8_t direction, uint8_t* back_steps) {
+    uint8_t decision = move_tables.decisions[available & 0x0F][favoured & 0x0F][move_tables.way_back[direction & 0x0F]];
+    uint8_t draw = (decision & MOVE_DRAW_MASK);
+
+    // NOTE `Utils::irandom()` may roll negative, hence the offset
+    int8_t roll = 0;
+    if (draw == MOVE_DRAW_PAIR) roll = Utils::irandom(1, 100) % 2;
+    if (draw == MOVE_DRAW_ANY) {
+        roll = Utils::irandom(0, 4);
+        *back_steps = 1;
     }
 
-    // Set the Phantom's new location
+    return move_tables.picks[decision & 0x0F][roll + 3];
+}
+
+
+/*
+    Put the Phantom on a square, or take it off the board with
+    `NOT_ON_BOARD`, and update the map's occupancy grid to match.
+ */
+void Phantom::set_square(uint16_t new_x, uint16_t new_y) {
+    uint16_t old_x = x;
+    uint16_t old_y = y;
     x = new_x;
     y = new_y;
-    direction = new_direction;
-
-    return false;
+    Map::update_occupancy(old_x, old_y);
+    Map::update_occupancy(new_x, new_y);
 }
 
 
 /*
     Move the Phantom one space according in the chosen direction.
  */
-void Phantom::move_one_square(uint8_t nd, uint8_t *nx, uint8_t *ny) {
+void Phantom::move_one_square(uint8_t nd, uint16_t *nx, uint16_t *ny) {
     if (nd == PHANTOM_NORTH) *ny = y - 1;
     if (nd == PHANTOM_SOUTH) *ny = y + 1;
     if (nd == PHANTOM_EAST)  *nx = x + 1;
@@ -284,8 +303,6 @@ void Phantom::move_one_square(uint8_t nd, uint8_t *nx, uint8_t *ny) {
     Return the direction the phantom has come from.
  */
 uint8_t Phantom::came_from() {
-    if (direction == PHANTOM_WEST)  return PHANTOM_EAST;
-    if (direction == PHANTOM_EAST)  return PHANTOM_WEST;
-    if (direction == PHANTOM_NORTH) return PHANTOM_SOUTH;
-    return PHANTOM_NORTH;
+    return (1 << move_tables.way_back[direction & 0x0F]);
 }
+
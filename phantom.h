@@ -15,7 +15,14 @@
 /*
  *  CONSTANTS
  */
-# define NOT_ON_BOARD       99
+# define NOT_ON_BOARD       0xFFFF
+
+// How a Phantom's move decision draws its way: not at all, one of a
+// favoured pair, or any available exit -- in the top bits of a decision
+#define MOVE_DRAW_NONE      0x00
+#define MOVE_DRAW_PAIR      0x10
+#define MOVE_DRAW_ANY       0x20
+#define MOVE_DRAW_MASK      0x30
 
 
 const uint8_t level_data[84] = {
@@ -43,6 +50,20 @@ const uint8_t level_data[84] = {
 };
 
 
+/*
+ *  STRUCTURES
+ */
+// The look-ups a Phantom's move is chosen by -- see `phantom.cpp`
+typedef struct {
+    uint8_t     exit_count[16];             // By a set of exits: how many there are
+    uint8_t     way_back[16];               // By direction: the bit number of the way back
+    uint8_t     north_south[3];             // By sign of dy, plus one: the favoured exit
+    uint8_t     east_west[3];               // By sign of dx, plus one: the favoured exit
+    uint8_t     decisions[16][16][4];       // By available, favoured and way back: draw | candidates
+    uint8_t     picks[16][7];               // By candidates and roll, plus three: the exit taken
+} MoveTables;
+
+
 /*
  *  PROTOTYPES
  */
@@ -52,19 +73,24 @@ class Phantom {
         Phantom();
 
         void        init();
-        void        place(uint8_t my_index);
+        void        place();
         bool        move();
-        void        move_one_square(uint8_t nd, uint8_t* nx, uint8_t* ny);
+        void        set_square(uint16_t new_x, uint16_t new_y);
+        void        move_one_square(uint8_t nd, uint16_t* nx, uint16_t* ny);
         uint8_t     came_from();
 
+        static uint8_t  favour(int16_t dx, int16_t dy, uint8_t available, uint8_t toward, uint8_t direction, uint8_t* back_steps);
+        static uint8_t  pick_direction(uint8_t available, uint8_t favoured, uint8_t direction, uint8_t* back_steps);
 
 
         // Properties
-        uint8_t     x;
-        uint8_t     y;
+        uint16_t    x;
+        uint16_t    y;
         int8_t      hp;
         uint8_t     direction;
         uint8_t     back_steps;
+        uint64_t    next_move;      // When the Phantom is next due to move,
+        uint32_t    speed;          // and how long between its moves, in us
 };
 
 
@@ -0,0 +1,107 @@
+/*
+ * Phantom Slayer
+ * Core 0 to core 1 render pipeline
+ *
+ * Core 0 runs the game logic and, each tick, hands a snapshot of
+ * the in-play view to core 1, which plans it and starts drawing
+ * while core 0 moves the world on. The view is split into bands:
+ * core 1 draws the even ones; core 0 draws the odd ones when it
+ * has finished the tick's logic, then adds the overlays before the
+ * SDK flips the frame to the display.
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+
+
+/*
+ *      GLOBALS
+ */
+Queue<Frame, PIPELINE_DEPTH>    frame_queue;
+std::atomic<uint32_t>           frames_prepared {0};
+std::atomic<uint32_t>           frames_rendered {0};
+uint32_t                        frames_submitted = 0;
+uint32_t                        frames_joined = 0;
+
+// The frame being drawn, and its plan, written by core 1
+// before it bumps 'frames_prepared'
+Frame                           current_frame;
+RenderJob                       current_job;
+
+
+namespace Pipeline {
+
+
+/*
+ *      STATIC PROTOTYPES
+ */
+static void render_loop();
+
+
+/**
+    Launch the renderer on core 1.
+ */
+void start() {
+    multicore_launch_core1(render_loop);
+}
+
+
+/**
+    Hand a frame to core 1 for drawing. Any frame already
+    in flight is finished first, since core 0 draws part of it.
+
+    - Parameters:
+        - frame: The snapshot to draw.
+ */
+void submit(const Frame& frame) {
+    wait();
+    while (!frame_queue.push(frame)) __wfe();
+    ++frames_submitted;
+    __sev();
+}
+
+
+/**
+    Draw core 0's bands of the frame in flight, if there is one,
+    then wait for core 1 to draw its bands and add the overlays.
+ */
+void wait() {
+    if (frames_joined == frames_submitted) return;
+
+    while (frames_prepared.load(std::memory_order_acquire) != frames_submitted) __wfe();
+    Gfx::draw_bands(current_job, 1);
+
+    while (frames_rendered.load(std::memory_order_acquire) != frames_submitted) __wfe();
+    Gfx::finish_frame(current_frame, current_job);
+    frames_joined = frames_submitted;
+}
+
+
+/*
+    Core 1's main loop: plan frames as they arrive, then
+    draw the even bands.
+ */
+static void render_loop() {
+    while (true) {
+        if (frame_queue.pop(&current_frame)) {
+            Gfx::prepare_frame(current_frame, &current_job);
+            frames_prepared.store(frames_prepared.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            __sev();
+
+            Gfx::draw_bands(current_job, 0);
+            frames_rendered.store(frames_rendered.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            __sev();
+        } else {
+            __wfe();
+        }
+    }
+}
+
+
+}   // namespace Pipeline
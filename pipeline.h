@@ -0,0 +1,64 @@
+/*
+ * Phantom Slayer
+ * Core 0 to core 1 render pipeline
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _RENDER_PIPELINE_HEADER_
+#define _RENDER_PIPELINE_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+#define PIPELINE_DEPTH          2
+
+
+/*
+ *      CLASSES
+ */
+/*
+    A lock-free single-producer, single-consumer ring of `N` items.
+    Only the producer writes `head`; only the consumer writes `tail`.
+ */
+template <typename T, uint32_t N>
+class Queue {
+    public:
+        bool push(const T& item) {
+            uint32_t head = head_index.load(std::memory_order_relaxed);
+            if (head - tail_index.load(std::memory_order_acquire) == N) return false;
+            items[head % N] = item;
+            head_index.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool pop(T* item) {
+            uint32_t tail = tail_index.load(std::memory_order_relaxed);
+            if (tail == head_index.load(std::memory_order_acquire)) return false;
+            *item = items[tail % N];
+            tail_index.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        T                       items[N];
+        std::atomic<uint32_t>   head_index {0};
+        std::atomic<uint32_t>   tail_index {0};
+};
+
+
+/*
+ *      PROTOTYPES
+ */
+namespace Pipeline {
+    void        start();
+    void        submit(const Frame& frame);
+    void        wait();
+}
+
+
+#endif  // _RENDER_PIPELINE_HEADER_
@@ -0,0 +1,372 @@
+/*
+ * Phantom Slayer
+ * Phantom pursuit
+ *
+ * Phantoms find their way to the player from a distance field: every
+ * square's distance from the player's square, found by a breadth-first
+ * search of the map. One search serves every Phantom. It's taken on a
+ * fixed number of squares a tick, however large the map, and started
+ * again when it's over if the player has moved. Until it reaches a
+ * Phantom's square, that Phantom follows the last search completed:
+ * it steps to a neighbour one square nearer the player, or to where
+ * the player was when that search started
+ *
+ * On the stock maps, Phantoms may instead look up their next step in
+ * the route tables that tools/route-compiler builds for the map pack,
+ * with no search at all
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+
+
+/*
+ *      EXTERNALLY-DEFINED GLOBALS
+ */
+extern Game         game;
+
+
+/*
+ *      GLOBALS
+ */
+uint8_t         pursuit_mode = PURSUIT_DEFAULT_MODE;
+
+// Two distance fields, each a two-bit code per square split across
+// two bitboards, by row, like the map's occupancy bitboard. Code 0
+// means the search hasn't reached the square yet; otherwise it's
+// the square's distance from the player modulo 3, plus 1. Squares
+// side by side are always one step apart in distance, so this is
+// enough to tell a square's nearer neighbours from its further ones.
+// One field is being searched, a slice a tick; the other is the last
+// search completed, which the Phantoms follow until the new one
+// reaches them. Each field's search started at (source_x, source_y),
+// or `NOT_ON_BOARD` if it has no search
+uint32_t        field_low[2][MAP_SIZE_MAX * MAP_SIZE_MAX / 32];
+uint32_t        field_high[2][MAP_SIZE_MAX * MAP_SIZE_MAX / 32];
+uint16_t        source_x[2] = {NOT_ON_BOARD, NOT_ON_BOARD};
+uint16_t        source_y[2] = {NOT_ON_BOARD, NOT_ON_BOARD};
+uint8_t         building = 0;
+
+// The search's queue of reached squares still to be expanded,
+// as `y * MAP_SIZE_MAX + x`
+uint16_t        search_queue[PURSUIT_QUEUE_SIZE];
+uint32_t        search_head = 0;
+uint32_t        search_tail = 0;
+uint32_t        overflows = 0;
+
+// Whether the route tables were built from this build's stock maps:
+// checked the first time they're wanted
+bool            routes_checked = false;
+bool            routes_match = false;
+static_assert(MAP_SIZE_MAX * MAP_SIZE_MAX <= 0x10000, "Squares must fit the search queue");
+
+
+namespace Pursuit {
+
+
+/*
+ *      STATIC PROTOTYPES
+ */
+static bool     is_searching();
+static void     restart();
+static bool     expand();
+static void     complete();
+static uint8_t  field_exits(uint8_t field, uint16_t x, uint16_t y);
+static uint8_t  get_code(uint8_t field, uint16_t x, uint16_t y);
+static void     set_code(uint8_t field, uint16_t x, uint16_t y, uint8_t code);
+static bool     has_routes();
+static uint8_t  route_exit(uint16_t x, uint16_t y);
+
+
+/**
+    Choose how Phantoms find their way to the player.
+
+    - Parameters:
+        - mode: A `PURSUIT_*` value.
+ */
+void set_mode(uint8_t mode) {
+    pursuit_mode = mode;
+    reset();
+}
+
+
+/**
+    Return how Phantoms find their way to the player, as a `PURSUIT_*` value.
+ */
+uint8_t get_mode() {
+    return pursuit_mode;
+}
+
+
+/**
+    Drop both distance fields, eg. because the map has changed.
+    The next update starts a new search.
+ */
+void reset() {
+    for (uint8_t i = 0 ; i < 2 ; ++i) {
+        source_x[i] = NOT_ON_BOARD;
+        source_y[i] = NOT_ON_BOARD;
+    }
+
+    search_head = 0;
+    search_tail = 0;
+}
+
+
+/**
+    Take the search on by up to `PURSUIT_BUDGET` squares, whatever
+    the map's size, so that its cost per tick is bounded. When the
+    search is over, the Phantoms follow its field, and a new one is
+    started if the player has moved since. Call once a tick.
+ */
+void update() {
+    if (!is_searching()) return;
+
+    uint8_t ready = building ^ 1;
+    for (uint32_t budget = PURSUIT_BUDGET ; budget > 0 ; --budget) {
+        if (search_tail == search_head) {
+            if (source_x[building] != NOT_ON_BOARD) {
+                complete();
+                ready = building ^ 1;
+            }
+
+            if (game.player.x == source_x[ready] && game.player.y == source_y[ready]) return;
+            restart();
+        }
+
+        expand();
+    }
+}
+
+
+/**
+    Find the exits from a square that lead one square nearer the
+    player: from the field being searched, if it has reached the
+    square yet, otherwise from the last field completed, which may
+    lead to where the player was a few moves ago. In `PURSUIT_TABLE`
+    mode on a stock map, this is just the route table's exit.
+
+    - Parameters:
+        - x: The square's x co-ordinate.
+        - y: The square's y co-ordinate.
+
+    - Returns: The nearer exits, as `PHANTOM_*` bits, or 0 if
+               neither field has reached the square.
+ */
+uint8_t closer_exits(uint16_t x, uint16_t y) {
+    if (pursuit_mode == PURSUIT_GREEDY || x >= Map::width() || y >= Map::height()) return 0;
+    if (pursuit_mode == PURSUIT_TABLE && has_routes()) return route_exit(x, y);
+
+    uint8_t closer = field_exits(building, x, y);
+    if (closer == 0) closer = field_exits(building ^ 1, x, y);
+    return closer;
+}
+
+
+/**
+    Search the whole map from the player's square at once, whatever
+    the budget: the search's worst case. The Phantoms then follow
+    the new field.
+
+    - Returns: The number of squares expanded.
+ */
+uint32_t fill() {
+    restart();
+
+    uint32_t count = 0;
+    while (expand()) ++count;
+    complete();
+    return count;
+}
+
+
+/**
+    Return the number of searches cut short by a full queue.
+ */
+uint32_t get_overflows() {
+    return overflows;
+}
+
+
+/*
+    Check whether the Phantoms need the distance fields
+    in the current mode, on the current map.
+ */
+static bool is_searching() {
+    return pursuit_mode == PURSUIT_FIELD || (pursuit_mode == PURSUIT_TABLE && !has_routes());
+}
+
+
+/*
+    Start a new search at the player's square.
+ */
+static void restart() {
+    // Only rows of the map need clearing
+    memset(field_low[building], 0, Map::height() * (MAP_SIZE_MAX / 8));
+    memset(field_high[building], 0, Map::height() * (MAP_SIZE_MAX / 8));
+
+    source_x[building] = game.player.x;
+    source_y[building] = game.player.y;
+    search_head = 0;
+    search_tail = 0;
+    if (game.player.x < Map::width() && game.player.y < Map::height()) {
+        set_code(building, game.player.x, game.player.y, 1);
+        search_queue[search_head++ % PURSUIT_QUEUE_SIZE] = game.player.y * MAP_SIZE_MAX + game.player.x;
+    }
+}
+
+
+/*
+    Expand the next square in the search's queue: give its open
+    neighbours that the search has yet to reach their distances,
+    and queue them up in turn.
+
+    - Returns: `false` if the search is over, otherwise `true`.
+ */
+static bool expand() {
+    if (search_tail == search_head) return false;
+
+    uint16_t square = search_queue[search_tail++ % PURSUIT_QUEUE_SIZE];
+    uint16_t x = square % MAP_SIZE_MAX;
+    uint16_t y = square / MAP_SIZE_MAX;
+    uint8_t code = (get_code(building, x, y) % 3) + 1;
+    uint8_t exits = Map::get_exits(x, y);
+
+    for (uint8_t i = 0 ; i < 4 ; ++i) {
+        uint8_t exit = (1 << i);
+        if ((exits & exit) == 0) continue;
+
+        uint16_t nx = x + (exit == PHANTOM_EAST ? 1 : (exit == PHANTOM_WEST ? -1 : 0));
+        uint16_t ny = y + (exit == PHANTOM_SOUTH ? 1 : (exit == PHANTOM_NORTH ? -1 : 0));
+        if (get_code(building, nx, ny) != 0) continue;
+
+        // If the queue is full, end the search here. Every square it
+        // has reached has the right distance, but no more will be
+        if (search_head - search_tail == PURSUIT_QUEUE_SIZE) {
+            #ifdef DEBUG
+            printf("PURSUIT QUEUE FULL\n");
+            #endif
+
+            ++overflows;
+            search_tail = search_head;
+            return false;
+        }
+
+        set_code(building, nx, ny, code);
+        search_queue[search_head++ % PURSUIT_QUEUE_SIZE] = ny * MAP_SIZE_MAX + nx;
+    }
+
+    return true;
+}
+
+
+/*
+    Hand the Phantoms the field just searched, and
+    free the one they were following for the next search.
+ */
+static void complete() {
+    building ^= 1;
+    source_x[building] = NOT_ON_BOARD;
+    source_y[building] = NOT_ON_BOARD;
+}
+
+
+/*
+    Find a square's exits that lead one square nearer
+    the source of one of the fields.
+
+    - Returns: The nearer exits, as `PHANTOM_*` bits, or 0 if
+               the field has not reached the square.
+ */
+static uint8_t field_exits(uint8_t field, uint16_t x, uint16_t y) {
+    if (source_x[field] == NOT_ON_BOARD) return 0;
+
+    uint8_t code = get_code(field, x, y);
+    if (code == 0) return 0;
+
+    uint8_t nearer = (code == 1 ? 3 : code - 1);
+    uint8_t exits = Map::get_exits(x, y);
+    uint8_t closer = 0;
+    if ((exits & PHANTOM_NORTH) && get_code(field, x, y - 1) == nearer) closer |= PHANTOM_NORTH;
+    if ((exits & PHANTOM_EAST) && get_code(field, x + 1, y) == nearer) closer |= PHANTOM_EAST;
+    if ((exits & PHANTOM_SOUTH) && get_code(field, x, y + 1) == nearer) closer |= PHANTOM_SOUTH;
+    if ((exits & PHANTOM_WEST) && get_code(field, x - 1, y) == nearer) closer |= PHANTOM_WEST;
+    return closer;
+}
+
+
+/*
+    Read a square's distance code from one of the fields.
+ */
+static uint8_t get_code(uint8_t field, uint16_t x, uint16_t y) {
+    uint32_t square = (uint32_t)y * MAP_SIZE_MAX + x;
+    uint32_t bit = (square & 31);
+    return ((field_low[field][square >> 5] >> bit) & 1) | (((field_high[field][square >> 5] >> bit) & 1) << 1);
+}
+
+
+/*
+    Write a distance code to a square of one of the fields
+    that the search hasn't reached yet.
+ */
+static void set_code(uint8_t field, uint16_t x, uint16_t y, uint8_t code) {
+    uint32_t square = (uint32_t)y * MAP_SIZE_MAX + x;
+    uint32_t bit = (square & 31);
+    field_low[field][square >> 5] |= ((uint32_t)(code & 1) << bit);
+    field_high[field][square >> 5] |= ((uint32_t)(code >> 1) << bit);
+}
+
+
+/*
+    Check that there are route tables for the current map.
+ */
+static bool has_routes() {
+    if (Map::get_stock_map() >= ROUTE_MAPS) return false;
+
+    if (!routes_checked) {
+        // FNV-1a, as the route compiler uses
+        uint32_t hash = 0x811C9DC5;
+        for (uint32_t i = 0 ; i < MAP_PACK_BYTES ; ++i) {
+            hash ^= map_pack[i];
+            hash *= 0x01000193;
+        }
+
+        routes_match = (MAP_PACK_BYTES == ROUTE_PACK_BYTES && hash == ROUTE_PACK_CHECKSUM);
+        routes_checked = true;
+
+        #ifdef DEBUG
+        if (!routes_match) printf("ROUTE TABLES DON'T MATCH THE MAPS\n");
+        #endif
+    }
+
+    return routes_match;
+}
+
+
+/*
+    Look up the exit from a square that starts a shortest path to
+    the player's square in the current map's route table.
+
+    - Returns: The exit, as a `PHANTOM_*` value, or 0 if there is
+               none, eg. because the square is the player's.
+ */
+static uint8_t route_exit(uint16_t x, uint16_t y) {
+    if (game.player.x >= Map::width() || game.player.y >= Map::height()) return 0;
+
+    uint8_t map = Map::get_stock_map();
+    const uint16_t* ranks = &route_ranks[map * (ROUTE_WIDTH * ROUTE_HEIGHT)];
+    uint16_t from = ranks[y * ROUTE_WIDTH + x];
+    uint16_t to = ranks[game.player.y * ROUTE_WIDTH + game.player.x];
+    if (from == ROUTE_NO_SQUARE || to == ROUTE_NO_SQUARE || from == to) return 0;
+
+    // Four two-bit steps to a byte
+    uint32_t entry = (uint32_t)to * route_counts[map] + from;
+    return 1 << ((route_hops[route_offsets[map] + (entry >> 2)] >> ((entry & 3) << 1)) & 0x03);
+}
+
+
+}   // namespace Pursuit
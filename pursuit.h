@@ -0,0 +1,53 @@
+/*
+ * Phantom Slayer
+ * Phantom pursuit
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _PURSUIT_HEADER_
+#define _PURSUIT_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+// How Phantoms choose their way towards the player
+#define PURSUIT_GREEDY              0       // Head the player's way, and back off when stuck
+#define PURSUIT_FIELD               1       // Follow a distance field from the player's square
+#define PURSUIT_TABLE               2       // Look up the step in the stock maps' route tables,
+                                            // or follow the field on other maps
+
+#ifndef PURSUIT_DEFAULT_MODE
+#define PURSUIT_DEFAULT_MODE        PURSUIT_TABLE
+#endif
+
+// The most squares the distance field's search may have waiting
+// to be expanded. Squares beyond a full queue are left unreached
+#define PURSUIT_QUEUE_SIZE          1024
+
+// The most squares the search expands a tick: enough for a stock
+// map's whole search, so larger maps' take more than one tick
+#ifndef PURSUIT_BUDGET
+#define PURSUIT_BUDGET              512
+#endif
+
+
+/*
+ *      PROTOTYPES
+ */
+namespace Pursuit {
+    void            set_mode(uint8_t mode);
+    uint8_t         get_mode();
+    void            reset();
+    void            update();
+    uint8_t         closer_exits(uint16_t x, uint16_t y);
+    uint32_t        fill();
+    uint32_t        get_overflows();
+}
+
+
+#endif  // _PURSUIT_HEADER_
@@ -0,0 +1,5489 @@
+/*
+ * Phantom Slayer
+ * Route tables file
+ *
+ * GENERATED by tools/route-compiler from the map pack -- do not edit
+ *
+ * ROUTES: 6 maps, 20x20 squares, 89544 bytes
+ * MAP    SQUARES    BYTES  LONGEST
+ * 0          237    14043       41
+ * 1          241    14521       43
+ * 2          247    15253       58
+ * 3          226    12769       41
+ * 4          249    15501       41
+ * 5          225    12657       42
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+
+
+/*
+ *      ROUTE TABLES
+ */
+const uint16_t route_counts[] = {
+    237, 241, 247, 226, 249, 225
+};
+
+const uint32_t route_offsets[] = {
+    0, 14043, 28564, 43817, 56586, 72087
+};
+
+const uint16_t route_ranks[] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0xffff, 0xffff, 0x0015, 0xffff, 0xffff, 0x0016, 0xffff, 0xffff, 0xffff, 0xffff, 0x0017,
+    0xffff, 0xffff, 0x0018, 0xffff, 0xffff, 0x0019, 0xffff, 0xffff, 0x001a, 0xffff, 0xffff, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+    0x0020, 0x0021, 0x0022, 0x0023, 0xffff, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0xffff, 0x002a, 0x002b, 0x002c, 0xffff,
+    0x002d, 0xffff, 0x002e, 0xffff, 0x002f, 0xffff, 0xffff, 0x0030, 0x0031, 0x0032, 0xffff, 0xffff, 0xffff, 0x0033, 0xffff, 0x0034,
+    0xffff, 0xffff, 0x0035, 0xffff, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0xffff, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0xffff, 0xffff, 0x0046, 0xffff, 0xffff, 0x0047, 0xffff,
+    0xffff, 0xffff, 0x0048, 0x0049, 0x004a, 0x004b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0xffff, 0xffff, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x005d, 0xffff, 0x005e, 0xffff, 0x005f, 0xffff, 0xffff, 0x0060, 0x0061, 0x0062, 0x0063, 0xffff, 0xffff,
+    0x0064, 0xffff, 0x0065, 0x0066, 0x0067, 0xffff, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0xffff,
+    0xffff, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0xffff, 0x0077, 0x0078, 0x0079, 0xffff, 0xffff, 0xffff, 0x007a, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x007b, 0xffff, 0xffff, 0xffff, 0x007c, 0x007d, 0xffff, 0x007e, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0xffff,
+    0x0087, 0x0088, 0x0089, 0x008a, 0xffff, 0x008b, 0xffff, 0xffff, 0x008c, 0x008d, 0x008e, 0x008f, 0xffff, 0x0090, 0xffff, 0xffff,
+    0x0091, 0xffff, 0x0092, 0x0093, 0x0094, 0xffff, 0xffff, 0x0095, 0x0096, 0x0097, 0x0098, 0xffff, 0xffff, 0xffff, 0x0099, 0xffff,
+    0xffff, 0x009a, 0x009b, 0x009c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x009d, 0x009e, 0xffff, 0xffff, 0x009f, 0x00a0,
+    0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0xffff, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0xffff, 0xffff, 0x00ac, 0xffff,
+    0xffff, 0xffff, 0x00ad, 0xffff, 0xffff, 0xffff, 0x00ae, 0xffff, 0xffff, 0x00af, 0x00b0, 0x00b1, 0xffff, 0x00b2, 0xffff, 0x00b3,
+    0x00b4, 0xffff, 0x00b5, 0xffff, 0xffff, 0xffff, 0x00b6, 0xffff, 0xffff, 0xffff, 0x00b7, 0x00b8, 0x00b9, 0xffff, 0xffff, 0xffff,
+    0x00ba, 0xffff, 0xffff, 0x00bb, 0xffff, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0xffff, 0xffff, 0x00c3, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00ca,
+    0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0xffff, 0x00d3, 0xffff, 0x00d4, 0xffff, 0x00d5, 0xffff, 0x00d6,
+    0xffff, 0xffff, 0xffff, 0x00d7, 0xffff, 0xffff, 0x00d8, 0xffff, 0x00d9, 0xffff, 0x00da, 0xffff, 0xffff, 0x00db, 0x00dc, 0x00dd,
+    0x00de, 0x00df, 0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0xffff,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+    0x0010, 0x0011, 0x0012, 0x0013, 0xffff, 0xffff, 0xffff, 0x0014, 0xffff, 0xffff, 0xffff, 0x0015, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0016, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e,
+    0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0024,
+    0xffff, 0xffff, 0xffff, 0x0025, 0xffff, 0xffff, 0xffff, 0xffff, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d,
+    0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0xffff, 0xffff, 0xffff, 0xffff, 0x0038, 0xffff,
+    0xffff, 0xffff, 0x0039, 0xffff, 0xffff, 0x003a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x003b, 0xffff, 0x003c, 0x003d, 0x003e,
+    0x003f, 0xffff, 0x0040, 0xffff, 0xffff, 0xffff, 0x0041, 0x0042, 0x0043, 0x0044, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0045,
+    0xffff, 0xffff, 0x0046, 0xffff, 0x0047, 0x0048, 0x0049, 0x004a, 0xffff, 0x004b, 0xffff, 0x004c, 0xffff, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0xffff, 0x0052, 0x0053, 0xffff, 0x0054, 0x0055, 0x0056, 0xffff, 0xffff, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b,
+    0xffff, 0x005c, 0xffff, 0x005d, 0xffff, 0x005e, 0x005f, 0xffff, 0x0060, 0x0061, 0x0062, 0xffff, 0x0063, 0x0064, 0x0065, 0x0066,
+    0xffff, 0xffff, 0x0067, 0xffff, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0xffff, 0x006d, 0xffff, 0x006e, 0xffff, 0x006f, 0x0070,
+    0x0071, 0xffff, 0xffff, 0xffff, 0xffff, 0x0072, 0x0073, 0x0074, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0xffff, 0x0076, 0x0077,
+    0x0078, 0x0079, 0xffff, 0xffff, 0xffff, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0xffff, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0xffff, 0xffff, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b, 0xffff, 0xffff, 0xffff, 0x008c, 0xffff, 0x008d,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x008e, 0xffff, 0xffff, 0xffff, 0xffff, 0x008f, 0xffff, 0x0090, 0xffff, 0xffff,
+    0xffff, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+    0xffff, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0xffff, 0x00a4, 0xffff, 0x00a5, 0xffff, 0xffff, 0x00a6, 0xffff, 0xffff, 0x00a7, 0xffff,
+    0x00a8, 0xffff, 0xffff, 0x00a9, 0x00aa, 0xffff, 0xffff, 0xffff, 0x00ab, 0xffff, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0xffff, 0x00b0,
+    0xffff, 0xffff, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0xffff, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0xffff, 0x00bc,
+    0xffff, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00c3, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x00c4, 0xffff, 0x00c5, 0x00c6, 0xffff, 0x00c7, 0xffff, 0xffff, 0xffff, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd,
+    0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0xffff, 0x00d5, 0xffff, 0x00d6, 0xffff, 0xffff, 0xffff, 0x00d7, 0xffff,
+    0x00d8, 0xffff, 0x00d9, 0xffff, 0xffff, 0x00da, 0xffff, 0xffff, 0x00db, 0xffff, 0x00dc, 0xffff, 0x00dd, 0x00de, 0x00df, 0x00e0,
+    0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+    0x0010, 0x0011, 0x0012, 0x0013, 0xffff, 0x0014, 0xffff, 0x0015, 0xffff, 0x0016, 0xffff, 0x0017, 0xffff, 0x0018, 0xffff, 0xffff,
+    0xffff, 0x0019, 0xffff, 0xffff, 0x001a, 0xffff, 0x001b, 0xffff, 0xffff, 0x001c, 0xffff, 0x001d, 0xffff, 0x001e, 0xffff, 0x001f,
+    0x0020, 0x0021, 0x0022, 0xffff, 0x0023, 0x0024, 0xffff, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d,
+    0x002e, 0x002f, 0x0030, 0x0031, 0xffff, 0xffff, 0x0032, 0x0033, 0xffff, 0x0034, 0x0035, 0x0036, 0xffff, 0x0037, 0xffff, 0x0038,
+    0xffff, 0xffff, 0x0039, 0xffff, 0xffff, 0x003a, 0xffff, 0x003b, 0xffff, 0x003c, 0xffff, 0xffff, 0x003d, 0x003e, 0xffff, 0x003f,
+    0x0040, 0xffff, 0x0041, 0x0042, 0x0043, 0x0044, 0xffff, 0x0045, 0xffff, 0xffff, 0x0046, 0x0047, 0x0048, 0x0049, 0xffff, 0x004a,
+    0xffff, 0x004b, 0xffff, 0x004c, 0xffff, 0xffff, 0xffff, 0x004d, 0xffff, 0x004e, 0xffff, 0x004f, 0x0050, 0x0051, 0xffff, 0xffff,
+    0x0052, 0xffff, 0x0053, 0x0054, 0x0055, 0x0056, 0xffff, 0xffff, 0x0057, 0xffff, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d,
+    0xffff, 0x005e, 0x005f, 0x0060, 0x0061, 0xffff, 0xffff, 0x0062, 0xffff, 0x0063, 0x0064, 0xffff, 0x0065, 0x0066, 0xffff, 0x0067,
+    0x0068, 0xffff, 0xffff, 0x0069, 0xffff, 0x006a, 0xffff, 0xffff, 0x006b, 0x006c, 0x006d, 0x006e, 0xffff, 0xffff, 0x006f, 0x0070,
+    0x0071, 0xffff, 0x0072, 0x0073, 0xffff, 0x0074, 0xffff, 0x0075, 0xffff, 0x0076, 0x0077, 0xffff, 0x0078, 0xffff, 0x0079, 0xffff,
+    0x007a, 0x007b, 0xffff, 0xffff, 0x007c, 0x007d, 0xffff, 0xffff, 0xffff, 0x007e, 0x007f, 0xffff, 0x0080, 0xffff, 0x0081, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0082, 0xffff, 0x0083, 0x0084, 0xffff, 0xffff, 0x0085, 0x0086, 0x0087, 0xffff, 0x0088, 0xffff,
+    0x0089, 0xffff, 0x008a, 0x008b, 0x008c, 0xffff, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0xffff, 0xffff, 0x0092, 0xffff, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0xffff, 0x009b, 0xffff, 0x009c, 0xffff, 0xffff, 0x009d, 0xffff, 0x009e,
+    0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0xffff, 0x00a4, 0xffff, 0xffff, 0x00a5, 0xffff, 0xffff, 0x00a6, 0x00a7, 0x00a8, 0x00a9,
+    0x00aa, 0xffff, 0xffff, 0x00ab, 0xffff, 0xffff, 0xffff, 0x00ac, 0x00ad, 0x00ae, 0xffff, 0xffff, 0xffff, 0x00af, 0xffff, 0x00b0,
+    0x00b1, 0xffff, 0x00b2, 0xffff, 0x00b3, 0xffff, 0x00b4, 0x00b5, 0xffff, 0x00b6, 0xffff, 0xffff, 0xffff, 0x00b7, 0x00b8, 0xffff,
+    0x00b9, 0x00ba, 0x00bb, 0xffff, 0x00bc, 0xffff, 0x00bd, 0xffff, 0xffff, 0x00be, 0xffff, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3,
+    0x00c4, 0x00c5, 0xffff, 0x00c6, 0x00c7, 0xffff, 0x00c8, 0x00c9, 0xffff, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0,
+    0xffff, 0x00d1, 0xffff, 0xffff, 0x00d2, 0xffff, 0xffff, 0xffff, 0x00d3, 0xffff, 0x00d4, 0xffff, 0x00d5, 0xffff, 0x00d6, 0xffff,
+    0x00d7, 0xffff, 0xffff, 0x00d8, 0xffff, 0x00d9, 0x00da, 0x00db, 0x00dc, 0xffff, 0xffff, 0xffff, 0x00dd, 0xffff, 0x00de, 0xffff,
+    0x00df, 0xffff, 0x00e0, 0xffff, 0xffff, 0xffff, 0xffff, 0x00e1, 0xffff, 0xffff, 0xffff, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6,
+    0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+    0x0010, 0x0011, 0x0012, 0x0013, 0xffff, 0x0014, 0xffff, 0xffff, 0xffff, 0x0015, 0xffff, 0xffff, 0xffff, 0xffff, 0x0016, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0017, 0xffff, 0x0018, 0xffff, 0xffff, 0xffff, 0x0019, 0xffff, 0xffff, 0xffff, 0x001a, 0x001b, 0x001c,
+    0x001d, 0x001e, 0x001f, 0xffff, 0xffff, 0xffff, 0xffff, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0xffff,
+    0xffff, 0x0028, 0xffff, 0xffff, 0xffff, 0xffff, 0x0029, 0x002a, 0xffff, 0xffff, 0xffff, 0x002b, 0xffff, 0xffff, 0x002c, 0xffff,
+    0x002d, 0xffff, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0xffff, 0xffff, 0xffff, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+    0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0xffff, 0xffff, 0x0040, 0xffff, 0x0041, 0x0042, 0xffff, 0xffff, 0x0043,
+    0xffff, 0xffff, 0x0044, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0045, 0x0046, 0xffff,
+    0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0xffff, 0x004f, 0x0050, 0x0051, 0xffff, 0x0052, 0x0053, 0x0054,
+    0xffff, 0x0055, 0xffff, 0xffff, 0xffff, 0xffff, 0x0056, 0xffff, 0xffff, 0xffff, 0xffff, 0x0057, 0x0058, 0x0059, 0xffff, 0xffff,
+    0x005a, 0x005b, 0xffff, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0xffff, 0xffff, 0x0061, 0x0062, 0x0063, 0xffff, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0064, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0065, 0x0066, 0x0067, 0x0068, 0xffff,
+    0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0xffff, 0xffff, 0xffff, 0xffff, 0x0074,
+    0xffff, 0xffff, 0xffff, 0xffff, 0x0075, 0xffff, 0x0076, 0xffff, 0xffff, 0xffff, 0x0077, 0xffff, 0x0078, 0xffff, 0x0079, 0x007a,
+    0x007b, 0xffff, 0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0xffff, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088,
+    0x0089, 0x008a, 0x008b, 0xffff, 0x008c, 0x008d, 0x008e, 0xffff, 0xffff, 0x008f, 0xffff, 0xffff, 0x0090, 0x0091, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x0092, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0093, 0x0094, 0x0095,
+    0x0096, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0097, 0x0098, 0xffff, 0x0099, 0x009a, 0x009b, 0xffff, 0xffff, 0xffff,
+    0xffff, 0x009c, 0xffff, 0xffff, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0xffff, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0xffff,
+    0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0xffff, 0x00af, 0xffff, 0xffff, 0xffff, 0x00b0, 0x00b1, 0x00b2,
+    0xffff, 0x00b3, 0xffff, 0x00b4, 0x00b5, 0xffff, 0xffff, 0xffff, 0xffff, 0x00b6, 0xffff, 0xffff, 0xffff, 0x00b7, 0x00b8, 0xffff,
+    0xffff, 0xffff, 0xffff, 0x00b9, 0xffff, 0x00ba, 0x00bb, 0x00bc, 0xffff, 0xffff, 0xffff, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1,
+    0x00c2, 0xffff, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0xffff, 0xffff, 0x00c8, 0xffff, 0x00c9, 0xffff, 0xffff, 0xffff, 0x00ca,
+    0xffff, 0x00cb, 0xffff, 0x00cc, 0xffff, 0xffff, 0x00cd, 0xffff, 0x00ce, 0xffff, 0x00cf, 0xffff, 0xffff, 0x00d0, 0x00d1, 0x00d2,
+    0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0xffff,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0xffff, 0xffff, 0xffff, 0x0015, 0xffff, 0xffff, 0xffff, 0xffff, 0x0016, 0xffff, 0xffff,
+    0x0017, 0xffff, 0xffff, 0xffff, 0x0018, 0xffff, 0x0019, 0xffff, 0x001a, 0x001b, 0xffff, 0xffff, 0x001c, 0xffff, 0xffff, 0x001d,
+    0x001e, 0x001f, 0xffff, 0xffff, 0x0020, 0xffff, 0xffff, 0x0021, 0x0022, 0xffff, 0x0023, 0x0024, 0xffff, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002a, 0x002b, 0xffff, 0x002c, 0xffff, 0x002d, 0x002e, 0x002f, 0xffff, 0x0030, 0xffff, 0x0031, 0xffff, 0x0032,
+    0xffff, 0x0033, 0xffff, 0x0034, 0xffff, 0x0035, 0xffff, 0xffff, 0xffff, 0x0036, 0x0037, 0x0038, 0xffff, 0x0039, 0x003a, 0x003b,
+    0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0xffff, 0x0042, 0xffff, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0xffff, 0x0048,
+    0xffff, 0x0049, 0xffff, 0x004a, 0xffff, 0x004b, 0xffff, 0x004c, 0x004d, 0xffff, 0xffff, 0x004e, 0xffff, 0x004f, 0xffff, 0xffff,
+    0x0050, 0xffff, 0x0051, 0x0052, 0xffff, 0x0053, 0xffff, 0x0054, 0x0055, 0x0056, 0xffff, 0x0057, 0xffff, 0x0058, 0x0059, 0x005a,
+    0x005b, 0x005c, 0xffff, 0xffff, 0xffff, 0x005d, 0xffff, 0x005e, 0x005f, 0xffff, 0x0060, 0x0061, 0xffff, 0x0062, 0x0063, 0x0064,
+    0x0065, 0x0066, 0xffff, 0x0067, 0xffff, 0x0068, 0x0069, 0xffff, 0x006a, 0x006b, 0xffff, 0xffff, 0x006c, 0x006d, 0xffff, 0xffff,
+    0xffff, 0x006e, 0xffff, 0x006f, 0xffff, 0xffff, 0x0070, 0x0071, 0xffff, 0xffff, 0x0072, 0xffff, 0x0073, 0xffff, 0x0074, 0xffff,
+    0xffff, 0x0075, 0xffff, 0x0076, 0xffff, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0xffff, 0x007d, 0x007e, 0x007f, 0xffff,
+    0x0080, 0xffff, 0x0081, 0x0082, 0xffff, 0xffff, 0x0083, 0x0084, 0xffff, 0xffff, 0xffff, 0x0085, 0x0086, 0xffff, 0xffff, 0x0087,
+    0x0088, 0xffff, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0xffff, 0x008e, 0x008f, 0x0090, 0xffff, 0x0091, 0xffff, 0x0092, 0x0093,
+    0x0094, 0xffff, 0x0095, 0xffff, 0xffff, 0x0096, 0xffff, 0xffff, 0x0097, 0xffff, 0x0098, 0xffff, 0x0099, 0xffff, 0xffff, 0x009a,
+    0x009b, 0x009c, 0x009d, 0xffff, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0xffff, 0xffff, 0xffff, 0x00a5, 0x00a6,
+    0x00a7, 0x00a8, 0x00a9, 0x00aa, 0xffff, 0xffff, 0xffff, 0x00ab, 0x00ac, 0xffff, 0x00ad, 0xffff, 0x00ae, 0xffff, 0x00af, 0xffff,
+    0x00b0, 0xffff, 0x00b1, 0xffff, 0xffff, 0x00b2, 0xffff, 0x00b3, 0xffff, 0x00b4, 0xffff, 0x00b5, 0xffff, 0x00b6, 0x00b7, 0x00b8,
+    0xffff, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0xffff, 0x00c0, 0xffff, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5,
+    0x00c6, 0x00c7, 0xffff, 0x00c8, 0x00c9, 0xffff, 0x00ca, 0xffff, 0xffff, 0xffff, 0x00cb, 0xffff, 0x00cc, 0xffff, 0x00cd, 0x00ce,
+    0xffff, 0x00cf, 0xffff, 0x00d0, 0x00d1, 0xffff, 0x00d2, 0x00d3, 0xffff, 0xffff, 0x00d4, 0x00d5, 0x00d6, 0xffff, 0x00d7, 0x00d8,
+    0x00d9, 0xffff, 0x00da, 0xffff, 0xffff, 0x00db, 0x00dc, 0x00dd, 0x00de, 0xffff, 0xffff, 0x00df, 0xffff, 0xffff, 0x00e0, 0xffff,
+    0xffff, 0xffff, 0x00e1, 0xffff, 0x00e2, 0xffff, 0xffff, 0x00e3, 0xffff, 0xffff, 0xffff, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8,
+    0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7, 0x00f8,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+    0x0010, 0x0011, 0x0012, 0x0013, 0xffff, 0xffff, 0x0014, 0xffff, 0xffff, 0xffff, 0xffff, 0x0015, 0xffff, 0xffff, 0x0016, 0xffff,
+    0x0017, 0xffff, 0xffff, 0x0018, 0xffff, 0x0019, 0xffff, 0x001a, 0xffff, 0xffff, 0x001b, 0xffff, 0xffff, 0xffff, 0xffff, 0x001c,
+    0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0xffff, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+    0x002c, 0x002d, 0xffff, 0xffff, 0xffff, 0xffff, 0x002e, 0xffff, 0x002f, 0x0030, 0x0031, 0xffff, 0xffff, 0xffff, 0x0032, 0xffff,
+    0xffff, 0xffff, 0x0033, 0xffff, 0xffff, 0x0034, 0x0035, 0xffff, 0xffff, 0x0036, 0x0037, 0x0038, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0039, 0x003a, 0x003b, 0x003c, 0xffff, 0x003d, 0x003e, 0x003f, 0x0040, 0xffff, 0x0041, 0x0042, 0xffff, 0x0043, 0xffff, 0xffff,
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0044, 0xffff, 0x0045, 0x0046, 0xffff, 0xffff, 0xffff, 0xffff, 0x0047, 0xffff,
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0xffff, 0xffff, 0x0053, 0x0054, 0x0055,
+    0xffff, 0x0056, 0x0057, 0x0058, 0x0059, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x005a, 0x005b,
+    0x005c, 0x005d, 0xffff, 0xffff, 0x005e, 0x005f, 0xffff, 0xffff, 0x0060, 0x0061, 0x0062, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0063, 0xffff, 0x0064, 0xffff, 0xffff, 0x0065, 0x0066, 0x0067, 0x0068, 0xffff, 0xffff, 0xffff, 0x0069, 0xffff, 0x006a, 0x006b,
+    0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+    0x0075, 0x0076, 0x0077, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0078, 0x0079, 0x007a, 0x007b, 0xffff,
+    0xffff, 0x007c, 0x007d, 0x007e, 0xffff, 0xffff, 0x007f, 0x0080, 0x0081, 0x0082, 0xffff, 0x0083, 0x0084, 0x0085, 0xffff, 0x0086,
+    0xffff, 0xffff, 0x0087, 0x0088, 0x0089, 0x008a, 0xffff, 0x008b, 0xffff, 0xffff, 0xffff, 0x008c, 0xffff, 0xffff, 0x008d, 0x008e,
+    0xffff, 0x008f, 0x0090, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0091, 0x0092, 0x0093, 0xffff, 0x0094,
+    0x0095, 0x0096, 0x0097, 0xffff, 0xffff, 0xffff, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0xffff, 0xffff, 0x009e, 0x009f,
+    0xffff, 0x00a0, 0x00a1, 0x00a2, 0xffff, 0xffff, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0xffff, 0x00a8, 0xffff, 0xffff, 0x00a9,
+    0x00aa, 0x00ab, 0x00ac, 0xffff, 0xffff, 0xffff, 0xffff, 0x00ad, 0x00ae, 0x00af, 0xffff, 0xffff, 0xffff, 0xffff, 0x00b0, 0x00b1,
+    0x00b2, 0x00b3, 0x00b4, 0x00b5, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x00b6, 0xffff, 0xffff, 0xffff, 0x00b7,
+    0xffff, 0xffff, 0x00b8, 0xffff, 0xffff, 0xffff, 0xffff, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1,
+    0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0xffff, 0xffff, 0xffff, 0x00ca, 0xffff, 0xffff, 0xffff, 0x00cb,
+    0xffff, 0x00cc, 0xffff, 0x00cd, 0xffff, 0x00ce, 0xffff, 0x00cf, 0xffff, 0xffff, 0x00d0, 0xffff, 0xffff, 0xffff, 0xffff, 0x00d1,
+    0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0xffff
+};
+
+const uint8_t route_hops[] = {
+    0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xcf, 0x3f, 0xf1, 0xcc, 0x03, 0x3c, 0xc2, 0xcc, 0xc3,
+    0x17, 0x03, 0x1e, 0x3c, 0xcf, 0x3f, 0x5f, 0x02, 0x3c, 0x94, 0x31, 0xf3, 0xf0, 0x45, 0x01, 0x4c,
+    0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xcb, 0x07, 0xff, 0x07, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1,
+    0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0xc4, 0xff, 0xff, 0xff, 0xff,
+    0x03, 0x00, 0x3c, 0xff, 0xc4, 0x33, 0x0f, 0xf0, 0x08, 0x33, 0x0f, 0x5f, 0x04, 0x78, 0xf0, 0x3c,
+    0xff, 0x7c, 0x09, 0xf0, 0x50, 0xc6, 0xcc, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40,
+    0xc1, 0x2f, 0x1f, 0xfc, 0x1f, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff,
+    0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0xfc, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xf0, 0xfc, 0x13,
+    0xcf, 0x3c, 0xc0, 0x23, 0xcc, 0x3c, 0x7c, 0x11, 0xe0, 0xc1, 0xf3, 0xfc, 0xf3, 0x25, 0xc0, 0x43,
+    0x19, 0x33, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f,
+    0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17,
+    0xcf, 0x4c, 0xc5, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xc0, 0xf3, 0x4f, 0x3c, 0xf3, 0x00, 0x8f, 0x30,
+    0xf3, 0xf0, 0x55, 0x80, 0x07, 0xcf, 0xf3, 0xcf, 0x97, 0x00, 0x0f, 0x65, 0xcc, 0x3c, 0x7c, 0x51,
+    0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf2, 0xc1, 0xff, 0x41, 0x25, 0xc0, 0xe0, 0xc0,
+    0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55, 0xfc, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0xc7, 0x3f, 0xf1, 0xcc, 0x03, 0x3c, 0x42, 0xcc, 0xc3, 0x57, 0x01, 0x1e,
+    0x1c, 0xcf, 0x3f, 0x5f, 0x02, 0x3c, 0x94, 0x31, 0xf3, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc,
+    0x15, 0x50, 0xf0, 0xcb, 0x07, 0xff, 0x07, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1,
+    0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0xc5, 0xff, 0xff, 0xff, 0x03, 0x00, 0x14,
+    0xff, 0xc4, 0x33, 0x0f, 0xf0, 0x08, 0x31, 0x0f, 0x5f, 0x05, 0x78, 0x50, 0x3c, 0xff, 0x7c, 0x09,
+    0xf0, 0x50, 0xc6, 0xcc, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x2f, 0x1f,
+    0xfc, 0x1f, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44,
+    0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x50, 0xfc, 0x13, 0xcf, 0x2c, 0xc0,
+    0xa3, 0xc4, 0x3c, 0x7c, 0x15, 0xe0, 0x41, 0xf1, 0xfc, 0xf3, 0x25, 0xc0, 0x43, 0x19, 0x33, 0x0f,
+    0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f, 0x50, 0x09, 0x30,
+    0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55,
+    0xc5, 0xff, 0xff, 0x3f, 0x00, 0x40, 0xf1, 0x47, 0x3c, 0xb3, 0x00, 0x8f, 0x12, 0x73, 0xf0, 0x55,
+    0x80, 0x05, 0xc5, 0xf3, 0xcf, 0x97, 0x00, 0x07, 0x65, 0xcc, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71,
+    0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf0, 0xc1, 0x7f, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c,
+    0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55, 0x55, 0xfc, 0xff, 0xff, 0x00,
+    0x00, 0xc5, 0x17, 0xf1, 0xcc, 0x02, 0x3c, 0x4a, 0x4c, 0xc1, 0x57, 0x01, 0x16, 0x14, 0xc7, 0x3f,
+    0x5f, 0x02, 0x1c, 0x94, 0x31, 0xf1, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0,
+    0xc3, 0x07, 0x3f, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20,
+    0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x55, 0xc5, 0xff, 0xff, 0x03, 0x00, 0x14, 0x57, 0xc4, 0x33,
+    0x0b, 0xf0, 0x28, 0x31, 0x05, 0x5f, 0x05, 0x58, 0x50, 0x14, 0xff, 0x7c, 0x09, 0x70, 0x50, 0x46,
+    0xc4, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x0f, 0x1f, 0x7c, 0x14, 0x54,
+    0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xc7, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x31,
+    0x53, 0x55, 0x55, 0xfc, 0xff, 0x0f, 0x00, 0x50, 0x54, 0x11, 0xcf, 0x2c, 0xc0, 0xa3, 0x44, 0x14,
+    0x7c, 0x15, 0x60, 0x41, 0x51, 0xfc, 0xf3, 0x25, 0xc0, 0x41, 0x19, 0x11, 0x0f, 0x5f, 0x14, 0xc0,
+    0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0x3f, 0x7c, 0x70, 0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a,
+    0x1f, 0x53, 0x15, 0x14, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xc5, 0x4c, 0x55, 0x55, 0xc5, 0xff,
+    0x3f, 0x00, 0x40, 0x51, 0x45, 0x3c, 0xb3, 0x00, 0x8f, 0x12, 0x51, 0xf0, 0x55, 0x80, 0x05, 0x45,
+    0xf1, 0xcf, 0x97, 0x00, 0x07, 0x65, 0x44, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05,
+    0x14, 0xfc, 0xf0, 0xc1, 0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0x50, 0xfc,
+    0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x14, 0x33, 0x55, 0x55, 0x55, 0xfc, 0xff, 0x00, 0x00, 0x45, 0x15,
+    0xf1, 0xcc, 0x02, 0x0c, 0x4a, 0x44, 0xc1, 0x57, 0x01, 0x15, 0x14, 0xc5, 0x3f, 0x5f, 0x02, 0x14,
+    0x94, 0x11, 0xf1, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xc3, 0x07, 0x15,
+    0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0x41, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x7f,
+    0x51, 0xcc, 0x54, 0x55, 0x55, 0xc5, 0xff, 0x03, 0x00, 0x14, 0x55, 0xc4, 0x33, 0x0b, 0x10, 0x28,
+    0x11, 0x05, 0x5f, 0x05, 0x54, 0x50, 0x14, 0x3f, 0x7c, 0x09, 0x50, 0x50, 0x46, 0xc4, 0xc3, 0x17,
+    0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x0f, 0x1f, 0x54, 0x14, 0x54, 0x02, 0x0c, 0x0e,
+    0xbc, 0xc6, 0x87, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x7c, 0x45, 0x31, 0x53, 0x55, 0x55,
+    0x55, 0xfc, 0x0f, 0x00, 0x50, 0x54, 0x11, 0xcf, 0x2c, 0x40, 0xa0, 0x44, 0x14, 0x7c, 0x15, 0x50,
+    0x41, 0x51, 0x7c, 0xf0, 0x25, 0x40, 0x41, 0x19, 0x11, 0x07, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4,
+    0x5b, 0x01, 0x05, 0x2f, 0x7c, 0x54, 0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x17, 0x52, 0x15,
+    0x15, 0xff, 0x03, 0x02, 0x10, 0x71, 0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0xc5, 0x3f, 0x00, 0x40,
+    0x51, 0x45, 0x1c, 0xb3, 0x00, 0x81, 0x12, 0x51, 0xf0, 0x55, 0x40, 0x05, 0x45, 0x71, 0xc1, 0x97,
+    0x00, 0x05, 0x65, 0x44, 0x14, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0x9c, 0xf0,
+    0x51, 0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x54, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40,
+    0x44, 0x55, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xfc, 0x00, 0x00, 0x45, 0x15, 0x51, 0xcc, 0x02,
+    0x04, 0x4a, 0x44, 0xc1, 0x57, 0x01, 0x15, 0x14, 0x45, 0x05, 0x5f, 0x02, 0x14, 0x94, 0x11, 0x51,
+    0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0x50, 0xc2, 0x47, 0x15, 0x05, 0x95, 0x00,
+    0x83, 0x03, 0xaf, 0x51, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x55, 0x51, 0xcc, 0x54,
+    0x55, 0x55, 0x55, 0xc5, 0x03, 0x00, 0x14, 0x55, 0x44, 0x31, 0x0b, 0x10, 0x28, 0x11, 0x05, 0x5f,
+    0x05, 0x54, 0x50, 0x14, 0x15, 0x7c, 0x09, 0x50, 0x50, 0x46, 0x44, 0xc1, 0x17, 0x05, 0x30, 0x15,
+    0x17, 0xf1, 0x56, 0x40, 0x41, 0x09, 0x1f, 0x55, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0x56, 0x85,
+    0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x54, 0x45, 0x31, 0x53, 0x55, 0x55, 0x55, 0x55, 0x0c,
+    0x00, 0x50, 0x54, 0x11, 0xc5, 0x2c, 0x40, 0xa0, 0x44, 0x14, 0x7c, 0x15, 0x50, 0x41, 0x51, 0x54,
+    0xf0, 0x25, 0x40, 0x41, 0x19, 0x11, 0x05, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05,
+    0x25, 0x7c, 0x54, 0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x5a, 0x15, 0x52, 0x15, 0x15, 0xff, 0x03,
+    0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40, 0x51, 0x45, 0x14,
+    0xb3, 0x00, 0x81, 0x12, 0x51, 0xf0, 0x55, 0x40, 0x05, 0x45, 0x51, 0xc1, 0x97, 0x00, 0x05, 0x65,
+    0x44, 0x14, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0x94, 0xf0, 0x51, 0x45, 0x41,
+    0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14,
+    0x33, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xcf, 0x3f, 0xf1, 0xcc, 0x03, 0x3c, 0xc2, 0xcc,
+    0xc3, 0x17, 0x0f, 0x3e, 0xfc, 0xff, 0x3f, 0x5f, 0x02, 0xfc, 0x94, 0x31, 0xf3, 0xf0, 0x45, 0x01,
+    0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xcb, 0x07, 0xff, 0x07, 0x95, 0x00, 0x83, 0x03, 0xaf,
+    0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0xfe, 0xff, 0xff,
+    0xff, 0x03, 0x00, 0xfc, 0xff, 0xcb, 0x33, 0x0b, 0xf0, 0x28, 0x33, 0x0f, 0x5f, 0x05, 0xf8, 0xf0,
+    0x3c, 0xff, 0x7c, 0x09, 0xf0, 0x53, 0xc6, 0xcc, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56,
+    0x40, 0xc1, 0x2f, 0x1f, 0xfc, 0x1f, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf,
+    0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x54, 0xfc,
+    0x2f, 0xcf, 0x24, 0xc0, 0xa3, 0xc4, 0x3c, 0x7c, 0x15, 0xe0, 0x43, 0xf1, 0xfc, 0xf3, 0x25, 0xc0,
+    0x4f, 0x19, 0x33, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0,
+    0x7f, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1,
+    0x17, 0xcf, 0x4c, 0x55, 0x55, 0xe5, 0xff, 0x3f, 0x00, 0x50, 0x55, 0x85, 0x3c, 0x93, 0x00, 0x8f,
+    0x12, 0x51, 0xf0, 0x55, 0x80, 0x07, 0x45, 0xf1, 0xcf, 0x97, 0x00, 0x0f, 0x65, 0x44, 0x3c, 0x7c,
+    0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf0, 0xc1, 0x47, 0x41, 0x25, 0xc0, 0xe0,
+    0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0x70, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x1c, 0x33, 0x55, 0x55,
+    0x55, 0xe5, 0xff, 0x00, 0x00, 0x45, 0x15, 0xf1, 0x4f, 0x02, 0x05, 0x5a, 0x55, 0xc1, 0x57, 0x01,
+    0x15, 0x14, 0xc5, 0x07, 0x5f, 0x02, 0x14, 0x94, 0x11, 0x71, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45,
+    0xbc, 0x15, 0x50, 0xf0, 0xc2, 0x47, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0x71, 0x21, 0x55,
+    0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x57, 0x51, 0xcc, 0x54, 0x55, 0x55, 0x55, 0xe5, 0x03, 0x00,
+    0x14, 0x55, 0x54, 0x31, 0x09, 0x14, 0x68, 0x55, 0x05, 0x5f, 0x05, 0x54, 0x50, 0x14, 0x15, 0x7c,
+    0x09, 0x50, 0x50, 0x46, 0x44, 0xc1, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0x41, 0x09,
+    0x1f, 0x55, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0x56, 0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00,
+    0x44, 0x54, 0x45, 0x31, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf0, 0xfc, 0x13, 0xcf, 0x3c,
+    0xc0, 0x23, 0xfe, 0xff, 0x7c, 0xf1, 0xe0, 0xcf, 0xff, 0xff, 0xf3, 0x25, 0xc0, 0x4f, 0x19, 0x33,
+    0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f, 0x50, 0x09,
+    0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c,
+    0xe5, 0xfb, 0xef, 0xff, 0x3f, 0x2a, 0xc0, 0xff, 0xbf, 0xff, 0x93, 0x00, 0x8f, 0x32, 0xf3, 0xf0,
+    0x55, 0x80, 0x0f, 0xcf, 0xf3, 0xcf, 0x97, 0x00, 0x3f, 0x65, 0xcc, 0x3c, 0x7c, 0x51, 0x00, 0x53,
+    0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf2, 0xc1, 0xff, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c,
+    0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x95, 0xe7, 0xbf, 0xff, 0xff,
+    0xa8, 0x40, 0xfc, 0xff, 0xfe, 0x4f, 0x02, 0x3c, 0xca, 0xcc, 0xc3, 0x57, 0x01, 0x3e, 0x3c, 0xcf,
+    0x3f, 0x5f, 0x02, 0xfc, 0x94, 0x31, 0xf3, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50,
+    0xf0, 0xcb, 0x07, 0xff, 0x07, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f,
+    0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x96, 0xff, 0xfe, 0xff, 0xa3, 0x02, 0xc5, 0xff, 0xfb,
+    0x3f, 0x09, 0xf0, 0x28, 0x31, 0x0f, 0x5f, 0x05, 0xf8, 0x70, 0x3c, 0xff, 0x7c, 0x09, 0xf0, 0x53,
+    0xc6, 0xcc, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x2f, 0x1f, 0xfc, 0x1f,
+    0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5,
+    0x33, 0x53, 0x55, 0xfe, 0xfb, 0xff, 0x8f, 0x0a, 0x54, 0xfc, 0xef, 0xff, 0x24, 0xc0, 0xa3, 0xc4,
+    0x3c, 0x7c, 0x15, 0xe0, 0x43, 0xf1, 0xfc, 0xf3, 0x25, 0xc0, 0x4f, 0x19, 0x33, 0x0f, 0x5f, 0x14,
+    0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f, 0x50, 0x09, 0x30, 0x38, 0xf0,
+    0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0xf9, 0xe7,
+    0xff, 0x3f, 0x2a, 0x50, 0xc5, 0xbf, 0xff, 0x93, 0x00, 0x8f, 0x12, 0xf1, 0xf0, 0x55, 0x80, 0x0f,
+    0xc5, 0xf1, 0xcf, 0x97, 0x00, 0x3f, 0x65, 0x4c, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f,
+    0x05, 0x14, 0xfc, 0xf0, 0xc1, 0x7f, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0,
+    0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55, 0xe5, 0x97, 0xff, 0xff, 0xa8, 0x40, 0x55,
+    0xfc, 0xfe, 0x4f, 0x02, 0x3c, 0x4a, 0xc4, 0xc3, 0x57, 0x01, 0x3e, 0x14, 0xc7, 0x3f, 0x5f, 0x02,
+    0xfc, 0x94, 0x31, 0xf1, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xc3, 0x07,
+    0xff, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11,
+    0x7f, 0xf1, 0xcc, 0x54, 0x95, 0x57, 0xfe, 0xff, 0xa3, 0x02, 0x55, 0xc5, 0xfb, 0x3f, 0x09, 0xf0,
+    0x28, 0x11, 0x07, 0x5f, 0x05, 0x78, 0x50, 0x1c, 0xff, 0x7c, 0x09, 0xf0, 0x50, 0xc6, 0xc4, 0xc3,
+    0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x0f, 0x1f, 0xfc, 0x17, 0x54, 0x02, 0x0c,
+    0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55,
+    0x56, 0xf9, 0xff, 0x8f, 0x0a, 0x54, 0x55, 0xec, 0xff, 0x24, 0xc0, 0xa3, 0x44, 0x14, 0x7c, 0x15,
+    0xe0, 0x41, 0x51, 0xfc, 0xf3, 0x25, 0xc0, 0x43, 0x19, 0x11, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c,
+    0xc4, 0x5b, 0x01, 0x05, 0x3f, 0x7c, 0xf0, 0x53, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53,
+    0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0x55, 0xe5, 0xff, 0x3f, 0x2a,
+    0x50, 0x55, 0x85, 0xff, 0x93, 0x00, 0x8f, 0x12, 0x51, 0xf0, 0x55, 0x80, 0x07, 0x45, 0xf1, 0xcf,
+    0x97, 0x00, 0x0f, 0x65, 0x44, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc,
+    0xf0, 0xc1, 0x47, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0x70, 0xfc, 0x0f, 0x08,
+    0x40, 0xc4, 0x5f, 0x1c, 0x33, 0x55, 0x55, 0x55, 0xe5, 0xfb, 0xa8, 0x4a, 0x55, 0x95, 0xfc, 0x5f,
+    0x02, 0x05, 0x5a, 0x55, 0xc1, 0x57, 0x01, 0x15, 0x14, 0xc5, 0x0f, 0x5f, 0x02, 0x14, 0x94, 0x11,
+    0xf1, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xc3, 0x07, 0x15, 0x05, 0x95,
+    0x00, 0x83, 0x03, 0xaf, 0xf1, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x5f, 0x51, 0xcc,
+    0x54, 0x55, 0x55, 0x95, 0xef, 0x03, 0x28, 0x55, 0x55, 0xc6, 0x3f, 0x09, 0x14, 0x68, 0x55, 0x05,
+    0x5f, 0x05, 0x54, 0x50, 0x14, 0x1f, 0x7c, 0x09, 0x50, 0x50, 0x46, 0xc4, 0xc1, 0x17, 0x05, 0x30,
+    0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x0b, 0x1f, 0x55, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6,
+    0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x5c, 0x45, 0x31, 0x53, 0x55, 0x55, 0x55, 0x9e,
+    0x0f, 0xa0, 0x54, 0x55, 0x59, 0xfc, 0x24, 0x50, 0xa0, 0x55, 0x15, 0x7c, 0x15, 0x50, 0x41, 0x51,
+    0x5c, 0xf0, 0x25, 0x40, 0x41, 0x19, 0x11, 0x05, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01,
+    0x05, 0x27, 0x7c, 0x54, 0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x15, 0x52, 0x15, 0x15, 0xff,
+    0x03, 0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0x59, 0x3e, 0x80, 0x52, 0x55, 0x65,
+    0xc5, 0x93, 0x40, 0x81, 0x56, 0x55, 0xf0, 0x55, 0x40, 0x05, 0x45, 0x51, 0xc1, 0x97, 0x00, 0x05,
+    0x65, 0x44, 0x14, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0x94, 0xf0, 0x51, 0x45,
+    0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x54, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55,
+    0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9, 0x00, 0x4a, 0x55, 0x95, 0x55, 0x4c, 0x02, 0x05, 0x5a,
+    0x55, 0xc1, 0x57, 0x01, 0x15, 0x14, 0x45, 0x05, 0x5f, 0x02, 0x14, 0x94, 0x11, 0x51, 0xf0, 0x45,
+    0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0x50, 0xc2, 0x47, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03,
+    0xaf, 0x55, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x55, 0x51, 0xcc, 0x54, 0x55, 0x55,
+    0x55, 0xe5, 0x03, 0x28, 0x55, 0x55, 0x56, 0x05, 0x09, 0x14, 0x68, 0x55, 0x05, 0x5f, 0x05, 0x54,
+    0x50, 0x14, 0x15, 0x7c, 0x09, 0x50, 0x50, 0x46, 0x44, 0xc1, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1,
+    0x56, 0x40, 0x41, 0x09, 0x1f, 0x55, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0x56, 0x85, 0x54, 0x45,
+    0xc5, 0xff, 0x80, 0x00, 0x44, 0x54, 0x45, 0x31, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xe2,
+    0xec, 0x23, 0xcf, 0xbc, 0xea, 0x23, 0xfe, 0xff, 0x7e, 0xf1, 0xe0, 0xcf, 0xff, 0xff, 0xf3, 0x25,
+    0xc0, 0x4f, 0x19, 0x33, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c,
+    0xf0, 0x7f, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10,
+    0xf1, 0x17, 0xcf, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x88, 0xbb, 0xaf, 0xff, 0xc7, 0xaa,
+    0x8f, 0xf8, 0xff, 0xfb, 0xc5, 0x83, 0x3f, 0xff, 0xff, 0xcf, 0x97, 0x00, 0x3f, 0x65, 0xcc, 0x3c,
+    0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf2, 0xc1, 0xff, 0x41, 0x25, 0xc0,
+    0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0xfe,
+    0xef, 0xbf, 0xef, 0xfb, 0xa2, 0x6a, 0xee, 0xbe, 0xfe, 0x5f, 0xa8, 0x3e, 0xe2, 0xff, 0xef, 0x17,
+    0x0f, 0xfe, 0xfc, 0xff, 0x3f, 0x5f, 0x02, 0xfc, 0x94, 0x31, 0xf3, 0xf0, 0x45, 0x01, 0x4c, 0xc5,
+    0x45, 0xbc, 0x15, 0x50, 0xf0, 0xcb, 0x07, 0xff, 0x07, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31,
+    0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x9e, 0xff, 0xfe, 0xff, 0xa3,
+    0x02, 0xf9, 0xff, 0xfb, 0x7f, 0x09, 0xf0, 0x28, 0xff, 0x3f, 0x5f, 0x05, 0xf8, 0xf3, 0x3c, 0xff,
+    0x7c, 0x09, 0xf0, 0x53, 0xc6, 0xcc, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1,
+    0x2f, 0x1f, 0xfc, 0x1f, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80,
+    0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0xfb, 0xff, 0x8f, 0x0a, 0x54, 0xfe, 0xef, 0xff,
+    0x25, 0xc0, 0xa3, 0xc5, 0xff, 0x7c, 0x15, 0xe0, 0x4f, 0xf1, 0xfc, 0xf3, 0x25, 0xc0, 0x4f, 0x19,
+    0x33, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f, 0x50,
+    0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf,
+    0x4c, 0x55, 0xf9, 0xe5, 0xff, 0x3f, 0x2a, 0x50, 0x95, 0xbf, 0xff, 0x97, 0x00, 0x8f, 0x56, 0xf1,
+    0xf3, 0x55, 0x80, 0x3f, 0xc5, 0xf1, 0xcf, 0x97, 0x00, 0x3f, 0x65, 0x4c, 0x3c, 0x7c, 0x51, 0x00,
+    0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf0, 0xc1, 0x7f, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b,
+    0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55, 0x55, 0x95, 0xef,
+    0xfb, 0xa8, 0x4a, 0x55, 0x95, 0xfe, 0x5f, 0x02, 0x3c, 0x5a, 0x55, 0xc1, 0x57, 0x01, 0x1e, 0x14,
+    0xc5, 0x3f, 0x5f, 0x02, 0x3c, 0x94, 0x11, 0xf1, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15,
+    0x50, 0xf0, 0xc3, 0x07, 0x1f, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf1,
+    0x3f, 0x20, 0x00, 0x11, 0x7f, 0x71, 0xcc, 0x54, 0x55, 0x55, 0x9e, 0xef, 0xa3, 0x2a, 0x55, 0x55,
+    0xfa, 0x7f, 0x09, 0xc4, 0x68, 0x55, 0x05, 0x5f, 0x05, 0x58, 0x50, 0x14, 0xff, 0x7c, 0x09, 0x70,
+    0x50, 0x46, 0xc4, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x0f, 0x1f, 0x5c,
+    0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xc5, 0xff, 0x80, 0x00, 0x44, 0xfc,
+    0x45, 0x31, 0x53, 0x55, 0x55, 0x59, 0xbe, 0x8f, 0xaa, 0x54, 0x55, 0xe9, 0xff, 0x25, 0x50, 0xa0,
+    0x55, 0x15, 0x7c, 0x15, 0x50, 0x41, 0x51, 0xfc, 0xf3, 0x25, 0x40, 0x41, 0x19, 0x11, 0x0f, 0x5f,
+    0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0x3f, 0x7c, 0x50, 0x51, 0x50, 0x09, 0x30, 0x38,
+    0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x14, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xc5, 0x4c, 0x55, 0x55,
+    0x55, 0x55, 0x3e, 0x80, 0x52, 0x55, 0x65, 0x95, 0x93, 0x40, 0x81, 0x56, 0x55, 0xf0, 0x55, 0x40,
+    0x45, 0x55, 0x55, 0xc1, 0x97, 0x00, 0x05, 0x65, 0x44, 0x14, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11,
+    0x6f, 0x05, 0x14, 0x94, 0xf0, 0x51, 0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55,
+    0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9, 0x00, 0x4a,
+    0x55, 0x95, 0x55, 0x5e, 0x02, 0x85, 0x58, 0x55, 0x51, 0x54, 0xa9, 0x15, 0x55, 0x55, 0x05, 0x5f,
+    0x02, 0x14, 0x94, 0x11, 0x51, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0x50, 0xc2,
+    0x47, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0x55, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00,
+    0x11, 0x55, 0x51, 0xcc, 0xf8, 0x9e, 0xff, 0xbe, 0xef, 0xab, 0xaa, 0xb9, 0xfb, 0xfa, 0x7f, 0xa9,
+    0xfa, 0x88, 0xff, 0xbf, 0x5f, 0x3c, 0xf8, 0xf3, 0xff, 0xff, 0x7c, 0x09, 0xf0, 0x53, 0xc6, 0xcc,
+    0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x2f, 0x1f, 0xfc, 0x1f, 0x54, 0x02,
+    0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53,
+    0x79, 0xfe, 0xfb, 0xbe, 0x8f, 0xaa, 0xe6, 0xee, 0xeb, 0xff, 0xa5, 0xea, 0xa3, 0xfc, 0xff, 0x7c,
+    0x15, 0xe0, 0xcf, 0xf3, 0xfc, 0xf3, 0x25, 0xc0, 0x4f, 0x19, 0x33, 0x0f, 0x5f, 0x14, 0xc0, 0x54,
+    0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f,
+    0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x65, 0xf9, 0xef, 0xfb, 0x3e,
+    0xaa, 0x9a, 0xb9, 0xaf, 0xff, 0x97, 0xaa, 0x8f, 0xc6, 0xff, 0xf3, 0x55, 0x80, 0x3f, 0xc7, 0xf3,
+    0xcf, 0x97, 0x00, 0x3f, 0x65, 0xcc, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14,
+    0xfc, 0xf2, 0xc1, 0xff, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f,
+    0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55, 0xe5, 0xbf, 0xef, 0xfb, 0xa8, 0x6a, 0xe5, 0xbe, 0xfe,
+    0x5f, 0xaa, 0x3e, 0x5a, 0xfc, 0xcf, 0x57, 0x01, 0xfe, 0x14, 0xcf, 0x3f, 0x5f, 0x02, 0xfc, 0x94,
+    0x31, 0xf3, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xcb, 0x07, 0xff, 0x07,
+    0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1,
+    0xcc, 0x54, 0x95, 0x7f, 0xbe, 0xef, 0xa3, 0xaa, 0x95, 0xf9, 0xfa, 0x7f, 0xa9, 0xfa, 0x68, 0xc5,
+    0x3f, 0x5f, 0x05, 0xf8, 0x53, 0x3c, 0xff, 0x7c, 0x09, 0xf0, 0x53, 0xc6, 0xcc, 0xc3, 0x17, 0x05,
+    0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x2f, 0x1f, 0xfc, 0x1f, 0x54, 0x02, 0x0c, 0x0e, 0xbc,
+    0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0x7e, 0xf9,
+    0xbe, 0x8f, 0xaa, 0x56, 0xe5, 0xeb, 0xff, 0xa5, 0xea, 0xa3, 0x55, 0xfc, 0x7c, 0x15, 0xe0, 0x4f,
+    0x71, 0xfc, 0xf3, 0x25, 0xc0, 0x4f, 0x19, 0x13, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b,
+    0x01, 0x05, 0x3f, 0x7c, 0xf0, 0x5f, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c,
+    0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0x79, 0xe5, 0xfb, 0x3e, 0xaa, 0x5a, 0x95,
+    0xa7, 0xff, 0x97, 0xaa, 0x8f, 0x56, 0xc5, 0xf3, 0x55, 0x80, 0x3f, 0x45, 0xf1, 0xcf, 0x97, 0x00,
+    0x3f, 0x65, 0x44, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf0, 0xc1,
+    0x4f, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4,
+    0x5f, 0x3c, 0x33, 0x55, 0x65, 0x95, 0xef, 0xfb, 0xa8, 0x6a, 0x55, 0x96, 0xfe, 0x5f, 0xaa, 0x3e,
+    0x5a, 0x55, 0xcc, 0x57, 0x01, 0xfe, 0x14, 0xc5, 0x3f, 0x5f, 0x02, 0xfc, 0x94, 0x11, 0xf1, 0xf0,
+    0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xc3, 0x07, 0x1f, 0x05, 0x95, 0x00, 0x83,
+    0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0x71, 0xcc, 0x54, 0x55,
+    0x55, 0xbe, 0xef, 0xa3, 0xaa, 0x55, 0x55, 0xfa, 0x7f, 0xa9, 0xfa, 0x68, 0x55, 0x05, 0x5f, 0x05,
+    0xf8, 0x50, 0x14, 0xff, 0x7c, 0x09, 0xf0, 0x53, 0x46, 0xc4, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17,
+    0xf1, 0x56, 0x40, 0xc1, 0x0f, 0x1f, 0x7c, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54,
+    0x05, 0xc7, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x31, 0x53, 0x55, 0x55, 0x55, 0x95, 0x0f, 0xa0,
+    0x54, 0x55, 0x59, 0xe5, 0x25, 0x50, 0xa8, 0x55, 0x15, 0x7c, 0x95, 0x5a, 0x51, 0x55, 0x55, 0xf0,
+    0x25, 0x40, 0x41, 0x19, 0x11, 0x05, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0x25,
+    0x7c, 0x54, 0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x5a, 0x15, 0x52, 0x15, 0x15, 0xff, 0x03, 0x02,
+    0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0x55, 0x3e, 0x80, 0x52, 0x55, 0x65, 0x95, 0x97,
+    0x40, 0xa1, 0x56, 0x55, 0xc4, 0x55, 0x6a, 0x45, 0x55, 0x55, 0xc1, 0x97, 0x00, 0x05, 0x65, 0x44,
+    0x14, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0x94, 0xf0, 0x51, 0x45, 0x41, 0x25,
+    0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0xf9, 0x00, 0x4a, 0x55, 0x95, 0x55, 0x5e, 0x02, 0x85, 0x5a, 0x55, 0x51,
+    0x54, 0xa9, 0x15, 0x55, 0x55, 0x05, 0x5f, 0x02, 0x14, 0x94, 0x11, 0x51, 0xf0, 0x45, 0x01, 0x4c,
+    0xc5, 0x45, 0xbc, 0x15, 0x50, 0x50, 0xc2, 0x47, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0x55,
+    0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x55, 0x51, 0xcc, 0x78, 0x9e, 0xff, 0xbe, 0xef,
+    0xab, 0xaa, 0xb9, 0xfb, 0xfa, 0x7f, 0xa9, 0xfa, 0xa8, 0xff, 0xbf, 0xcf, 0x3f, 0xf8, 0xf3, 0xff,
+    0xff, 0x7c, 0x09, 0xf0, 0x53, 0xc6, 0xcc, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40,
+    0xc1, 0x2f, 0x1f, 0xfc, 0x1f, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff,
+    0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0xe3, 0x79, 0xfe, 0xfb, 0xbe, 0xaf, 0xaa, 0xe6, 0xee, 0xeb,
+    0xff, 0xa5, 0xea, 0xa3, 0xfe, 0xff, 0x7e, 0xfc, 0xe0, 0xcf, 0xff, 0xff, 0xf3, 0x25, 0xc0, 0x4f,
+    0x19, 0x33, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f,
+    0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17,
+    0xcf, 0x8c, 0xe7, 0xf9, 0xef, 0xfb, 0xbe, 0xaa, 0x9a, 0xbb, 0xaf, 0xff, 0x97, 0xaa, 0x8f, 0xfa,
+    0xff, 0xfb, 0xc5, 0x83, 0x3f, 0xff, 0xff, 0xcf, 0x97, 0x00, 0x3f, 0x65, 0xcc, 0x3c, 0x7c, 0x51,
+    0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf2, 0xc1, 0xff, 0x41, 0x25, 0xc0, 0xe0, 0xc0,
+    0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x96, 0xe7, 0xbf,
+    0xef, 0xfb, 0xaa, 0x6a, 0xee, 0xbe, 0xfe, 0x5f, 0xaa, 0x3e, 0xea, 0xff, 0xef, 0x57, 0x0c, 0xfe,
+    0xfc, 0xff, 0x3f, 0x5f, 0x02, 0xfc, 0x94, 0x31, 0xf3, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc,
+    0x15, 0x50, 0xf0, 0xcb, 0x07, 0xff, 0x07, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1,
+    0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x9e, 0xff, 0xbe, 0xef, 0xab, 0xaa, 0xb9,
+    0xfb, 0xfa, 0x7f, 0xa9, 0xfa, 0xa8, 0xff, 0xbf, 0x5f, 0x05, 0xf8, 0xf3, 0xff, 0xff, 0x7c, 0x09,
+    0xf0, 0x53, 0xc6, 0xcc, 0xc3, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x2f, 0x1f,
+    0xfc, 0x1f, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44,
+    0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0xf9, 0xbe, 0x8f, 0xaa, 0x56, 0xe6, 0xeb, 0xff, 0xa5, 0xea,
+    0xa3, 0x95, 0xff, 0x7e, 0x15, 0xe0, 0x5f, 0xf1, 0xff, 0xf3, 0x25, 0xc0, 0x4f, 0x19, 0x33, 0x0f,
+    0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f, 0x50, 0x09, 0x30,
+    0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55,
+    0x59, 0xe5, 0xfb, 0x3e, 0xaa, 0x5a, 0x95, 0xa5, 0xff, 0x97, 0xaa, 0x8f, 0x56, 0x95, 0xfb, 0x55,
+    0x80, 0x7f, 0x55, 0xf1, 0xcf, 0x97, 0x00, 0x3f, 0x65, 0x44, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71,
+    0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf0, 0xc1, 0x47, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c,
+    0x55, 0x70, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x1c, 0x33, 0x55, 0x65, 0x95, 0x55, 0xf9, 0xaa,
+    0x6a, 0x55, 0x96, 0x55, 0x5e, 0xaa, 0x8e, 0x5a, 0x55, 0xee, 0x57, 0xa9, 0xfc, 0x55, 0x55, 0x05,
+    0x5f, 0x02, 0x3c, 0x94, 0x11, 0x51, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0,
+    0xc2, 0x47, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0x71, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20,
+    0x00, 0x11, 0x57, 0x51, 0xcc, 0x54, 0x95, 0x55, 0x55, 0xe5, 0xab, 0xaa, 0x55, 0x59, 0x56, 0x79,
+    0xa9, 0x1a, 0x6a, 0x55, 0xb9, 0x5f, 0xa5, 0xc6, 0x57, 0x55, 0x15, 0x7c, 0x09, 0x70, 0x50, 0x46,
+    0x44, 0xc1, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x09, 0x1f, 0x55, 0x14, 0x54,
+    0x02, 0x0c, 0x0e, 0xbc, 0x46, 0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x54, 0x45, 0x31,
+    0x53, 0x55, 0x55, 0x55, 0x95, 0xaf, 0xa2, 0x56, 0x65, 0x59, 0xe5, 0xa5, 0x5a, 0xa8, 0x55, 0xe5,
+    0x7e, 0x95, 0x5a, 0x5c, 0x55, 0x55, 0xf0, 0x25, 0x40, 0x41, 0x19, 0x11, 0x05, 0x5f, 0x14, 0xc0,
+    0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0x25, 0x7c, 0x54, 0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a,
+    0x15, 0x52, 0x15, 0x15, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0x55,
+    0x3e, 0x80, 0x5a, 0x55, 0x65, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x95, 0xf8, 0x55, 0x6a, 0x45, 0x55,
+    0x55, 0xc1, 0x97, 0x00, 0x05, 0x65, 0x44, 0x14, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05,
+    0x14, 0x94, 0xf0, 0x51, 0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc,
+    0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33, 0x95, 0xe7, 0xbf, 0xef, 0xfb, 0xaa, 0x6a, 0xee, 0xbe,
+    0xfe, 0x5e, 0xaa, 0xbe, 0xea, 0xfb, 0xee, 0x57, 0xa9, 0xfe, 0xfc, 0xff, 0x3f, 0x5f, 0x02, 0xfc,
+    0x94, 0x31, 0xf3, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xcb, 0x07, 0xff,
+    0x07, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f,
+    0xf1, 0xcc, 0x54, 0x9e, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0xb9, 0xf9, 0xfa, 0x7b, 0xa9, 0xfa, 0xaa,
+    0xe7, 0xbb, 0x5f, 0xa5, 0xfa, 0xc7, 0xff, 0xff, 0x7c, 0x09, 0xf0, 0x53, 0xc6, 0xcc, 0xc3, 0x17,
+    0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x2f, 0x1f, 0xfc, 0x1f, 0x54, 0x02, 0x0c, 0x0e,
+    0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x59, 0xfe,
+    0xf9, 0xbe, 0xaf, 0xaa, 0x66, 0xe6, 0xeb, 0xef, 0xa5, 0xea, 0xab, 0x96, 0xef, 0x7e, 0x95, 0xea,
+    0x5f, 0xfc, 0xff, 0xf3, 0x25, 0xc0, 0x4f, 0x19, 0x33, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4,
+    0x5b, 0x01, 0x05, 0xbf, 0x7c, 0xf0, 0x7f, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15,
+    0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0xf9, 0xe7, 0xfb, 0xbe, 0xaa, 0x5a,
+    0x99, 0xaf, 0xbf, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x7f, 0xc5, 0xff, 0xcf, 0x97,
+    0x00, 0x3f, 0x65, 0xcc, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf2,
+    0xc1, 0xff, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40,
+    0xc4, 0x5f, 0x3c, 0x33, 0x55, 0xe5, 0x97, 0xef, 0xfb, 0xaa, 0x6a, 0x65, 0x9e, 0xfe, 0x5e, 0xaa,
+    0xbe, 0x5a, 0x79, 0xee, 0x57, 0xa9, 0xfe, 0x55, 0xfc, 0x3f, 0x5f, 0x02, 0xfc, 0x94, 0x11, 0xf3,
+    0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xc3, 0x07, 0xff, 0x05, 0x95, 0x00,
+    0x83, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54,
+    0x95, 0x57, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0x59, 0xfa, 0x7b, 0xa9, 0xfa, 0x6a, 0x65, 0xb9, 0x5f,
+    0xa5, 0xfa, 0x57, 0xc5, 0xff, 0x7c, 0x09, 0xf0, 0x53, 0x46, 0xcc, 0xc3, 0x17, 0x05, 0x30, 0x15,
+    0x17, 0xf1, 0x56, 0x40, 0xc1, 0x0f, 0x1f, 0xfc, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7,
+    0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0x56, 0xf9, 0xbe, 0xaf,
+    0xaa, 0x56, 0x65, 0xe9, 0xef, 0xa5, 0xea, 0xab, 0x55, 0xe5, 0x7e, 0x95, 0xea, 0x5f, 0x55, 0xfc,
+    0xf3, 0x25, 0xc0, 0x4f, 0x19, 0x11, 0x0f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05,
+    0x3f, 0x7c, 0xf0, 0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x1c, 0xff, 0x03,
+    0x02, 0x10, 0xf1, 0x17, 0xc7, 0x4c, 0x55, 0x59, 0xe5, 0x7b, 0xbe, 0xaa, 0x5a, 0x95, 0xa5, 0x9f,
+    0x97, 0xaa, 0xaf, 0x56, 0x95, 0xfb, 0x55, 0xaa, 0x7f, 0x55, 0xc5, 0xcf, 0x97, 0x00, 0x3f, 0x65,
+    0x44, 0x3c, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf0, 0xc1, 0x45, 0x41,
+    0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0x50, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x14,
+    0x33, 0x55, 0x65, 0x95, 0x6f, 0xf9, 0xaa, 0x6a, 0x55, 0x96, 0x5e, 0x5e, 0xaa, 0xbe, 0x5a, 0x55,
+    0xee, 0x57, 0xa9, 0xfe, 0x55, 0x55, 0x3c, 0x5f, 0x02, 0xfc, 0x94, 0x11, 0x71, 0xf0, 0x45, 0x01,
+    0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xc3, 0x07, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf,
+    0xf1, 0x31, 0x55, 0x41, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0x51, 0xcc, 0x54, 0x95, 0x55, 0x7e,
+    0xe5, 0xab, 0xaa, 0x55, 0x59, 0x5a, 0x79, 0xa9, 0xfa, 0x6a, 0x55, 0xb9, 0x5f, 0xa5, 0xfa, 0x57,
+    0x55, 0xc5, 0x7c, 0x09, 0xf0, 0x53, 0x46, 0x44, 0xc1, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56,
+    0x40, 0xc1, 0x0f, 0x1f, 0x54, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0x87, 0x54, 0x45, 0xc5,
+    0xff, 0x80, 0x00, 0x44, 0x7c, 0x45, 0x31, 0x53, 0x55, 0x56, 0x79, 0x95, 0xaf, 0xaa, 0x56, 0x65,
+    0x59, 0xe5, 0xa5, 0xea, 0xab, 0x55, 0xe5, 0x7e, 0x95, 0xea, 0x5f, 0x55, 0x55, 0xf0, 0x25, 0xc0,
+    0x4f, 0x19, 0x11, 0x05, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0x2f, 0x7c, 0x54,
+    0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x17, 0x52, 0x15, 0x15, 0xff, 0x03, 0x02, 0x10, 0x71,
+    0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0x55, 0x3e, 0x80, 0x5a, 0x55, 0x65, 0x95, 0x97, 0x6a, 0xa1,
+    0x56, 0x95, 0xf8, 0x55, 0x6a, 0x65, 0x55, 0x55, 0xc1, 0x97, 0x40, 0x05, 0x65, 0x55, 0x15, 0x7c,
+    0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0x94, 0xf0, 0x51, 0x45, 0x41, 0x25, 0xc0, 0xe0,
+    0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33, 0x55, 0x55,
+    0x55, 0x55, 0xf9, 0x00, 0x6a, 0x55, 0x95, 0x55, 0x5e, 0xaa, 0x85, 0x5a, 0x55, 0xe2, 0x57, 0xa9,
+    0x95, 0x55, 0x55, 0x45, 0x5c, 0x02, 0x15, 0x94, 0x55, 0x55, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45,
+    0xbc, 0x15, 0x50, 0x50, 0xc2, 0x47, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0x55, 0x21, 0x55,
+    0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x55, 0x51, 0xcc, 0x54, 0x55, 0x55, 0x55, 0xe5, 0x03, 0xa8,
+    0x55, 0x55, 0x56, 0x79, 0xa9, 0x16, 0x6a, 0x55, 0x89, 0x5f, 0xa5, 0x56, 0x56, 0x55, 0x15, 0x45,
+    0x09, 0x54, 0x50, 0x56, 0x55, 0xc1, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0x41, 0x09,
+    0x1f, 0x55, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0x56, 0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00,
+    0x44, 0x54, 0x45, 0x31, 0x53, 0x55, 0xfe, 0xf9, 0xbe, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xef, 0xa5,
+    0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x5b, 0xb9, 0xfb, 0xfa, 0xbc, 0xea, 0x0f, 0xef, 0xff,
+    0x3f, 0xcf, 0xf0, 0xc0, 0x78, 0x5c, 0xc4, 0x5b, 0x2e, 0x3c, 0xbf, 0x7e, 0xf0, 0xff, 0x53, 0x09,
+    0xf0, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c,
+    0x55, 0xf9, 0xe7, 0xfb, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0xbf, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb,
+    0x55, 0xaa, 0x6f, 0xe5, 0xee, 0xeb, 0xc7, 0xaa, 0x3f, 0xbc, 0xff, 0xff, 0x3c, 0xc1, 0x03, 0xe3,
+    0x71, 0x11, 0x6f, 0xb9, 0xf0, 0xfc, 0xfa, 0xc1, 0xff, 0x4f, 0x25, 0xc0, 0xe3, 0xc0, 0x6b, 0x7c,
+    0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55, 0xe5, 0x9f, 0xef, 0xfb,
+    0xaa, 0x6a, 0x65, 0xbe, 0xfe, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0xbe, 0x95, 0xbb,
+    0xaf, 0x5f, 0xa8, 0xfe, 0xf0, 0xfe, 0xff, 0xf3, 0x04, 0x0f, 0x8c, 0xc7, 0x45, 0xbc, 0xe5, 0xc2,
+    0xf3, 0xeb, 0x07, 0xff, 0x3f, 0x95, 0x00, 0x8f, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f,
+    0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa,
+    0x7b, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0xfa, 0x57, 0xfe, 0xff, 0x7c, 0x09, 0xf0, 0x53,
+    0xc6, 0xff, 0xcf, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x96, 0x40, 0xc1, 0x2f, 0x1f, 0xfc, 0x3f,
+    0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5,
+    0x33, 0x53, 0x55, 0x5e, 0xf9, 0xbe, 0xaf, 0xaa, 0x56, 0x66, 0xe9, 0xef, 0xa5, 0xea, 0xab, 0x95,
+    0xe5, 0x7e, 0x95, 0xea, 0x5f, 0x95, 0xff, 0xf3, 0x25, 0xc0, 0x4f, 0x59, 0xf1, 0x3f, 0x5f, 0x14,
+    0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0x3f, 0x7c, 0xf0, 0x5f, 0x50, 0x09, 0x30, 0x38, 0xf0,
+    0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0x59, 0xe5,
+    0x7b, 0xbe, 0xaa, 0x5a, 0x95, 0xa5, 0x9f, 0x97, 0xaa, 0xaf, 0x56, 0x95, 0xfb, 0x55, 0xaa, 0x7f,
+    0x55, 0xe5, 0xcf, 0x97, 0x00, 0x3f, 0x65, 0x55, 0xfc, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f,
+    0x05, 0x14, 0xfc, 0xf0, 0xc1, 0x47, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0x70,
+    0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x1c, 0x33, 0x55, 0x65, 0x95, 0x57, 0xf9, 0xaa, 0x6a, 0x55,
+    0x96, 0x55, 0x5e, 0xaa, 0xbe, 0x5a, 0x55, 0xee, 0x57, 0xa9, 0xbe, 0x55, 0x55, 0xa5, 0x5f, 0x02,
+    0xfc, 0x94, 0x55, 0x55, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15, 0x50, 0xf0, 0xc2, 0x47,
+    0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0x71, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11,
+    0x57, 0x51, 0xcc, 0x54, 0x95, 0x55, 0x56, 0xe5, 0xab, 0xaa, 0x55, 0x59, 0x56, 0x79, 0xa9, 0x3a,
+    0x6a, 0x55, 0xb9, 0x5f, 0xa5, 0x7a, 0x56, 0x55, 0x95, 0x7e, 0x09, 0xc4, 0x53, 0x56, 0x55, 0xc1,
+    0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1, 0x09, 0x1f, 0x55, 0x14, 0x54, 0x02, 0x0c,
+    0x0e, 0xbc, 0x46, 0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x54, 0x45, 0x31, 0x53, 0x55,
+    0x56, 0x55, 0x95, 0xaf, 0xaa, 0x56, 0x65, 0x59, 0xe5, 0xa5, 0x6a, 0xa8, 0x55, 0xe5, 0x7e, 0x95,
+    0x6a, 0x59, 0x55, 0x55, 0xfa, 0x25, 0x50, 0x4c, 0x59, 0x55, 0x05, 0x5f, 0x14, 0xc0, 0x54, 0x5c,
+    0xc4, 0x5b, 0x01, 0x05, 0x25, 0x7c, 0x54, 0x51, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x15, 0x52,
+    0x15, 0x15, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0x55, 0xbe, 0x8a,
+    0x5a, 0x95, 0x65, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x95, 0xfb, 0x55, 0x6a, 0x65, 0x55, 0x55, 0xe9,
+    0x97, 0x40, 0x05, 0x65, 0x55, 0x15, 0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0x94,
+    0xf0, 0x51, 0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08,
+    0x40, 0x44, 0x55, 0x14, 0x33, 0x55, 0xe5, 0x9f, 0xef, 0xfb, 0xaa, 0x6a, 0x65, 0xbe, 0xfe, 0x5e,
+    0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0xbe, 0x95, 0xbb, 0xaf, 0xef, 0xab, 0xfe, 0xf0, 0xfe,
+    0xff, 0xf3, 0x3c, 0x0f, 0x8c, 0xc7, 0x85, 0xbc, 0xe5, 0xc2, 0xf3, 0xeb, 0x07, 0xff, 0x3f, 0x95,
+    0x00, 0x8f, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc,
+    0x54, 0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb,
+    0x5f, 0xa5, 0xfa, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0xc3, 0xfb, 0xff, 0xcf, 0x17, 0x3c, 0x30,
+    0x1e, 0x17, 0xf1, 0x96, 0x0b, 0xcf, 0xaf, 0x1f, 0xfc, 0xff, 0x54, 0x02, 0x3c, 0x0e, 0xbc, 0xc6,
+    0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0xf9, 0xbe,
+    0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xef, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x5b, 0xb9,
+    0xfb, 0xfa, 0xa5, 0xea, 0x4f, 0xec, 0xff, 0x3f, 0x5f, 0xf0, 0xc0, 0x78, 0x5c, 0xc4, 0x5b, 0x2e,
+    0x0c, 0xbf, 0x7e, 0xf0, 0xff, 0x53, 0x09, 0xf0, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff,
+    0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0xf9, 0xe7, 0xfb, 0xbe, 0xaa, 0x5a, 0x99, 0xaf,
+    0xbf, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x6f, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0x3f,
+    0x85, 0xff, 0xff, 0x7c, 0xc1, 0x03, 0xe3, 0x71, 0x11, 0x6f, 0xb9, 0x10, 0xfc, 0xfa, 0xc1, 0xff,
+    0x4f, 0x25, 0xc0, 0xe3, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f,
+    0x3c, 0x33, 0x55, 0xe5, 0x9f, 0xef, 0xfb, 0xaa, 0x6a, 0x65, 0xbe, 0xfe, 0x5e, 0xaa, 0xbe, 0x5a,
+    0xf9, 0xee, 0x57, 0xa9, 0xbe, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0xfe, 0x94, 0xfc, 0xff, 0xf3, 0x45,
+    0x01, 0x4c, 0xc5, 0x45, 0xbc, 0xe5, 0x50, 0xf0, 0xcb, 0x07, 0xff, 0x3f, 0x95, 0x00, 0x8f, 0x03,
+    0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x95, 0x7f,
+    0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0xfa,
+    0x56, 0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0x53, 0xc6, 0xff, 0xcf, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1,
+    0x96, 0x40, 0xc1, 0x2f, 0x1f, 0xfc, 0x3f, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05,
+    0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0x7e, 0xf9, 0xbe, 0xaf, 0xaa, 0x56,
+    0xe6, 0xe9, 0xef, 0xa5, 0xea, 0xab, 0x95, 0xe7, 0x7e, 0x95, 0xea, 0x5b, 0x99, 0xfb, 0xfa, 0xa5,
+    0xea, 0x4f, 0x59, 0xfc, 0x3f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0xbf, 0x7c,
+    0xf0, 0x7f, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10,
+    0xf1, 0x17, 0xcf, 0x4c, 0x55, 0x79, 0xe5, 0xfb, 0xbe, 0xaa, 0x5a, 0x99, 0xa5, 0xbf, 0x97, 0xaa,
+    0xaf, 0x56, 0x96, 0xfb, 0x55, 0xaa, 0x6f, 0x55, 0xee, 0xeb, 0x97, 0xaa, 0x3f, 0x65, 0xc5, 0xff,
+    0x7c, 0x51, 0x00, 0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf0, 0xc1, 0x7f, 0x41, 0x25, 0xc0,
+    0xe0, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55,
+    0xe5, 0x95, 0xef, 0xf9, 0xaa, 0x6a, 0x65, 0x96, 0x7e, 0x5e, 0xaa, 0xbe, 0x5a, 0x59, 0xee, 0x57,
+    0xa9, 0xbe, 0x55, 0x99, 0xaf, 0x5f, 0xaa, 0xfe, 0x94, 0x55, 0xfc, 0xf3, 0x45, 0x01, 0x4c, 0xc5,
+    0x45, 0xbc, 0x15, 0x50, 0xf0, 0xc3, 0x07, 0x3f, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x31,
+    0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x95, 0x55, 0xbe, 0xe7, 0xab,
+    0xaa, 0x55, 0x59, 0xfa, 0x79, 0xa9, 0xfa, 0x6a, 0x55, 0xb9, 0x5f, 0xa5, 0xfa, 0x56, 0x55, 0xbe,
+    0x7e, 0xa9, 0xfa, 0x53, 0x56, 0xc5, 0xcf, 0x17, 0x05, 0x30, 0x15, 0x17, 0xf1, 0x56, 0x40, 0xc1,
+    0x0f, 0x1f, 0x7c, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xc7, 0xff, 0x80,
+    0x00, 0x44, 0xfc, 0xc5, 0x31, 0x53, 0x55, 0x56, 0xf9, 0x96, 0xaf, 0xaa, 0x56, 0x65, 0xe9, 0xe5,
+    0xa5, 0xea, 0xab, 0x55, 0xe5, 0x7e, 0x95, 0xea, 0x5b, 0x55, 0x79, 0xfa, 0xa5, 0xea, 0x4f, 0x59,
+    0x55, 0x3c, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b, 0x01, 0x05, 0x3f, 0x7c, 0x70, 0x51, 0x50,
+    0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x14, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xc5,
+    0x4c, 0x55, 0x59, 0xe5, 0x57, 0xbe, 0xaa, 0x5a, 0x95, 0xa5, 0x95, 0x97, 0xaa, 0xaf, 0x56, 0x95,
+    0xfb, 0x55, 0xaa, 0x6f, 0x55, 0x65, 0xe9, 0x97, 0xaa, 0x3f, 0x65, 0x55, 0xc5, 0x7c, 0x51, 0x00,
+    0x53, 0x71, 0x11, 0x6f, 0x05, 0x14, 0xfc, 0xf0, 0x41, 0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b,
+    0x7c, 0x4c, 0x55, 0x50, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x14, 0x33, 0x55, 0x65, 0x95, 0x57,
+    0xf9, 0xaa, 0x6a, 0x55, 0x96, 0x55, 0x5e, 0xaa, 0xbe, 0x5a, 0x55, 0xee, 0x57, 0xa9, 0xbe, 0x55,
+    0x55, 0xa5, 0x5f, 0xaa, 0xfe, 0x94, 0x55, 0x55, 0xf0, 0x45, 0x01, 0x4c, 0xc5, 0x45, 0xbc, 0x15,
+    0x50, 0xf0, 0xc3, 0x07, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0xf1, 0x21, 0x55, 0x51, 0xf1,
+    0x3f, 0x20, 0x00, 0x11, 0x5f, 0x51, 0xcc, 0x54, 0x55, 0x55, 0x55, 0xe5, 0xab, 0xa8, 0x55, 0x59,
+    0x56, 0x79, 0xa9, 0x16, 0x6a, 0x55, 0xb9, 0x5f, 0xa5, 0x56, 0x56, 0x55, 0x95, 0x7e, 0x09, 0x54,
+    0x52, 0x56, 0x55, 0xc1, 0x17, 0x05, 0x30, 0x15, 0x17, 0xb1, 0x56, 0x40, 0x51, 0x09, 0x1f, 0x55,
+    0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0x56, 0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x54,
+    0x45, 0x31, 0x53, 0x55, 0x55, 0x55, 0x95, 0xaf, 0xa2, 0x56, 0x65, 0x59, 0xe5, 0xa5, 0x5a, 0xa8,
+    0x55, 0xe5, 0x7e, 0x95, 0x5a, 0x59, 0x55, 0x55, 0xfa, 0x25, 0x50, 0x49, 0x59, 0x55, 0x45, 0x5c,
+    0x14, 0xc0, 0x54, 0x5c, 0x44, 0x5a, 0x01, 0x45, 0x25, 0x7c, 0x54, 0x51, 0x50, 0x09, 0x30, 0x38,
+    0xf0, 0x5a, 0x15, 0x52, 0x15, 0x15, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x55,
+    0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x95, 0x65, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x95, 0xfb, 0x55, 0x6a,
+    0x65, 0x55, 0x55, 0xe9, 0x97, 0x40, 0x25, 0x65, 0x55, 0x15, 0x45, 0x51, 0x00, 0x53, 0x71, 0x11,
+    0x69, 0x05, 0x14, 0x95, 0xf0, 0x51, 0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55,
+    0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33, 0x55, 0xe5, 0x9f, 0xef, 0xfb, 0xaa, 0x6a,
+    0x65, 0xbe, 0xfe, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0xbe, 0x95, 0xbb, 0xaf, 0xef,
+    0xaa, 0xfe, 0xfa, 0xfe, 0xff, 0xf3, 0x3c, 0x0f, 0x8c, 0xc7, 0x85, 0xbc, 0xe5, 0xc2, 0xf3, 0xeb,
+    0x07, 0xff, 0x3f, 0x95, 0x00, 0x8f, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00,
+    0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b, 0xa9,
+    0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0xfa, 0x56, 0xee, 0xbe, 0xbe, 0xa9, 0xfa, 0xeb, 0xfb, 0xff,
+    0xcf, 0xc7, 0x3c, 0x30, 0x1e, 0x17, 0xf2, 0x96, 0x0b, 0xcf, 0xaf, 0x1f, 0xfc, 0xff, 0x54, 0x02,
+    0x3c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53,
+    0x55, 0xfe, 0xf9, 0xbe, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xef, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e,
+    0x95, 0xea, 0x5b, 0xb9, 0xfb, 0xfa, 0xa5, 0xea, 0xaf, 0xef, 0xff, 0x3f, 0x5f, 0xf0, 0xc0, 0x78,
+    0x5c, 0xc8, 0x5b, 0x2e, 0x3c, 0xbf, 0x7e, 0xf0, 0xff, 0x53, 0x09, 0xf0, 0x38, 0xf0, 0x1a, 0x1f,
+    0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0xf9, 0xe7, 0xfb, 0xbe,
+    0xaa, 0x5a, 0x99, 0xaf, 0xbf, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x6f, 0xe5, 0xee,
+    0xeb, 0x97, 0xaa, 0x3f, 0xa5, 0xff, 0xff, 0x7c, 0xc1, 0x03, 0xe3, 0x71, 0x11, 0x6f, 0xb9, 0x10,
+    0xfc, 0xfa, 0xc1, 0xff, 0x4f, 0x25, 0xc0, 0xe3, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f,
+    0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55, 0xe5, 0x9f, 0xef, 0xfb, 0xaa, 0x6a, 0x65, 0xbe, 0xfe,
+    0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0xbe, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0xfe, 0x94,
+    0xfe, 0xff, 0xf3, 0x45, 0x0c, 0x8c, 0xc7, 0x45, 0xbc, 0xe5, 0x52, 0xf0, 0xeb, 0x07, 0xff, 0x3f,
+    0x95, 0x00, 0x8f, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1,
+    0xcc, 0x54, 0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b, 0xa9, 0xfa, 0x6a, 0xe5,
+    0xbb, 0x5f, 0xa5, 0xfa, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0x53, 0xfa, 0xff, 0xcf, 0x17, 0x05,
+    0x30, 0x16, 0x17, 0xf1, 0x96, 0x43, 0xc1, 0xaf, 0x1f, 0xfc, 0xff, 0x54, 0x02, 0x3c, 0x0e, 0xbc,
+    0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0x5e, 0xf9,
+    0x9e, 0xaf, 0xaa, 0x56, 0x66, 0xe9, 0xe7, 0xa5, 0xea, 0xab, 0x95, 0xe5, 0x7e, 0x95, 0xea, 0x5b,
+    0x95, 0xf9, 0xfa, 0xa5, 0xea, 0x4f, 0x59, 0xe5, 0x3f, 0x5f, 0x14, 0xc0, 0x54, 0x5c, 0xc4, 0x5b,
+    0x01, 0x05, 0x3f, 0x7c, 0xf0, 0x53, 0x50, 0x09, 0x30, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c,
+    0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0x55, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x95,
+    0x65, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x95, 0xfb, 0x55, 0x6a, 0x65, 0x55, 0x55, 0xe9, 0x97, 0x40,
+    0x25, 0x65, 0x55, 0x15, 0x79, 0x51, 0x00, 0x53, 0x71, 0x11, 0x69, 0x05, 0x14, 0x95, 0xf0, 0x51,
+    0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44,
+    0x55, 0x14, 0x33, 0x55, 0xe5, 0x9f, 0xef, 0xfb, 0xaa, 0x6a, 0x65, 0xbe, 0xfe, 0x5e, 0xaa, 0xbe,
+    0x5a, 0xf9, 0xee, 0x57, 0xa9, 0xbe, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0xfe, 0xfa, 0xfe, 0xff, 0xf3,
+    0x25, 0x0f, 0x8c, 0xcb, 0x85, 0xbf, 0xe5, 0xc2, 0xf3, 0xeb, 0x07, 0xff, 0x3f, 0x95, 0x00, 0x8f,
+    0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x95,
+    0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5,
+    0xfa, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0xeb, 0xfb, 0xff, 0xcf, 0x97, 0x3c, 0x04, 0x2e, 0x17,
+    0xfe, 0x96, 0x0b, 0xcf, 0xaf, 0x1f, 0xfc, 0xff, 0x54, 0x02, 0x3c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54,
+    0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0xf9, 0xbe, 0xaf, 0xaa,
+    0x56, 0xe6, 0xeb, 0xef, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x5b, 0xb9, 0xfb, 0xfa,
+    0xa5, 0xea, 0x4f, 0xe9, 0xff, 0x3f, 0x5f, 0xe4, 0xc0, 0xb8, 0x5c, 0xc6, 0x5b, 0x2e, 0x05, 0xbf,
+    0x7e, 0xf0, 0xff, 0x53, 0x09, 0xf0, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02,
+    0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0x55, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x95, 0x65, 0x95, 0x97,
+    0x6a, 0xa1, 0x56, 0x95, 0xfb, 0x55, 0x6a, 0x65, 0x55, 0x55, 0xe9, 0x97, 0x40, 0x25, 0x65, 0x55,
+    0x15, 0x79, 0x91, 0xa3, 0xcb, 0x7f, 0x59, 0x69, 0x05, 0x14, 0x95, 0xf0, 0x51, 0xc5, 0x41, 0x25,
+    0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33,
+    0x55, 0x55, 0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x55, 0x96, 0x55, 0x5e, 0xaa, 0x85, 0x5a, 0x55, 0xee,
+    0x57, 0xa9, 0x95, 0x55, 0x55, 0xa5, 0x5f, 0x02, 0x95, 0x94, 0x55, 0x55, 0xe4, 0x45, 0x82, 0x6e,
+    0xfc, 0x65, 0xa5, 0x15, 0x50, 0x54, 0xc2, 0x47, 0x15, 0x05, 0x95, 0x00, 0x83, 0x03, 0xaf, 0x55,
+    0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x55, 0x51, 0xcc, 0x54, 0x55, 0x55, 0x55, 0xe5,
+    0xab, 0xa8, 0x55, 0x59, 0x56, 0x79, 0xa9, 0x16, 0x6a, 0x55, 0xb9, 0x5f, 0xa5, 0x56, 0x56, 0x55,
+    0x95, 0x7e, 0x09, 0x54, 0x52, 0x56, 0x55, 0x91, 0x17, 0x05, 0xba, 0xc5, 0x97, 0x95, 0x56, 0x40,
+    0x51, 0x09, 0x1f, 0x55, 0x14, 0x54, 0x02, 0x0c, 0x0e, 0xbc, 0x56, 0x85, 0x54, 0x45, 0xc5, 0xff,
+    0x80, 0x00, 0x44, 0x54, 0x45, 0x31, 0x53, 0x55, 0x55, 0x55, 0x95, 0xaf, 0xa2, 0x56, 0x65, 0x59,
+    0xe5, 0xa5, 0x5a, 0xa8, 0x55, 0xe5, 0x7e, 0x95, 0x5a, 0x59, 0x55, 0x55, 0xfa, 0x25, 0x50, 0x49,
+    0x59, 0x55, 0x45, 0x5e, 0x14, 0xc8, 0x54, 0x5c, 0x56, 0x5a, 0x01, 0x45, 0x25, 0x7c, 0x54, 0x51,
+    0x50, 0x09, 0x30, 0x38, 0xf0, 0x5a, 0x15, 0x52, 0x15, 0x15, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15,
+    0xc5, 0x4c, 0x55, 0x55, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x95, 0x65, 0x95, 0x97, 0x6a, 0xa1, 0x56,
+    0x95, 0xfb, 0x55, 0x6a, 0x65, 0x55, 0x55, 0xe9, 0x97, 0x40, 0x25, 0x65, 0x55, 0x15, 0x79, 0x51,
+    0x20, 0x53, 0x45, 0x59, 0x69, 0x05, 0x14, 0x95, 0xf0, 0x51, 0x45, 0x41, 0x25, 0xc0, 0xe0, 0xc0,
+    0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33, 0x55, 0xe5, 0x9f,
+    0xef, 0xfb, 0xaa, 0x6a, 0x65, 0xbe, 0xfe, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0xbe,
+    0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0xfe, 0xfa, 0xfe, 0xff, 0xf3, 0x25, 0x0e, 0xae, 0xfb, 0xbc, 0xbf,
+    0xe5, 0xc2, 0xf3, 0xeb, 0x07, 0xff, 0x3f, 0x95, 0x00, 0x8f, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1,
+    0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95,
+    0xf9, 0xfa, 0x7b, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0xfa, 0x56, 0xee, 0xbe, 0x7e, 0xa9,
+    0xfa, 0xeb, 0xfb, 0xff, 0xcf, 0x97, 0x38, 0xb8, 0xee, 0xc7, 0xfe, 0x96, 0x0b, 0xcf, 0xaf, 0x1f,
+    0xfc, 0xff, 0x54, 0x02, 0x3c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44,
+    0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0xf9, 0xbe, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xef, 0xa5, 0xea,
+    0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x5b, 0xb9, 0xfb, 0xfa, 0xa5, 0xea, 0xaf, 0xef, 0xff, 0x3f,
+    0x5f, 0xe2, 0xe0, 0xba, 0x5f, 0xf8, 0x5b, 0x2e, 0x3c, 0xbf, 0x7e, 0xf0, 0xff, 0x53, 0x09, 0xf0,
+    0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55,
+    0xf9, 0xe7, 0xfb, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0xbf, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55,
+    0xaa, 0x6f, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0xbf, 0xa5, 0xff, 0xff, 0x7c, 0x99, 0x83, 0xeb, 0x7e,
+    0xc9, 0x6f, 0xb9, 0x14, 0xfc, 0xfa, 0xc1, 0xff, 0x4f, 0x25, 0xc0, 0xe3, 0xc0, 0x6b, 0x7c, 0x4c,
+    0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c, 0x33, 0x55, 0xe5, 0x9f, 0xef, 0xfb, 0xaa,
+    0x6a, 0x65, 0xbe, 0xfe, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0xbe, 0x95, 0xbb, 0xaf,
+    0x5f, 0xaa, 0xfe, 0x94, 0xfe, 0xff, 0xf3, 0x45, 0x0e, 0xae, 0xfb, 0x65, 0xbc, 0xe5, 0x52, 0xf0,
+    0xeb, 0x07, 0xff, 0x3f, 0x95, 0x00, 0x8f, 0x03, 0xaf, 0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20,
+    0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b,
+    0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0xfa, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0x53, 0xfa,
+    0xff, 0x8f, 0x17, 0x39, 0xba, 0xee, 0x97, 0xc5, 0x96, 0x4b, 0xc1, 0xaf, 0x1f, 0xfc, 0xff, 0x54,
+    0x02, 0x3c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33,
+    0x53, 0x55, 0xfe, 0xf9, 0xbe, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xef, 0xa5, 0xea, 0xab, 0x95, 0xef,
+    0x7e, 0x95, 0xea, 0x5b, 0xb9, 0xfb, 0xfa, 0xa5, 0xea, 0x4f, 0xe9, 0xff, 0x3f, 0x5e, 0xe4, 0xe8,
+    0xba, 0x5f, 0x56, 0x58, 0x2e, 0x05, 0xbf, 0x7e, 0xf0, 0xff, 0x53, 0x09, 0xf0, 0x38, 0xf0, 0x1a,
+    0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0xf9, 0xe7, 0x5b,
+    0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x97, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x65, 0xe5,
+    0xee, 0xeb, 0x97, 0xaa, 0x25, 0xa5, 0xff, 0xff, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x49, 0xb9,
+    0x14, 0xc5, 0xfa, 0xc1, 0xff, 0x4f, 0x25, 0xc0, 0xe3, 0xc0, 0x6b, 0x54, 0x4c, 0x55, 0xf0, 0xfc,
+    0x0f, 0x08, 0x40, 0xc4, 0x55, 0x3c, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x55, 0x96,
+    0x55, 0x5e, 0xaa, 0x85, 0x5a, 0x55, 0xee, 0x57, 0xa9, 0x95, 0x55, 0x55, 0xa5, 0x5f, 0x0a, 0x95,
+    0x94, 0x5e, 0x55, 0xe4, 0x45, 0x8e, 0xae, 0xff, 0x65, 0xa5, 0xfc, 0x50, 0x54, 0xc2, 0x47, 0x15,
+    0x3f, 0x95, 0x00, 0x8f, 0x03, 0xaf, 0x55, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x55,
+    0x51, 0xcc, 0x54, 0x55, 0x55, 0x55, 0xe5, 0xab, 0xa8, 0x55, 0x59, 0x56, 0x79, 0xa9, 0x16, 0x6a,
+    0x55, 0xb9, 0x5f, 0xa5, 0x56, 0x56, 0x55, 0x95, 0x7e, 0x29, 0x54, 0x52, 0x7a, 0x55, 0x91, 0x17,
+    0x39, 0xba, 0xfe, 0x97, 0x95, 0xc6, 0x43, 0x51, 0x09, 0x1f, 0x55, 0xfc, 0x54, 0x02, 0x3c, 0x0e,
+    0xbc, 0x56, 0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x54, 0x45, 0x31, 0x53, 0x55, 0x55,
+    0x55, 0x95, 0xaf, 0xa2, 0x56, 0x65, 0x59, 0xe5, 0xa5, 0x5a, 0xa8, 0x55, 0xe5, 0x7e, 0x95, 0x5a,
+    0x59, 0x55, 0x55, 0xfa, 0xa5, 0x50, 0x49, 0xe9, 0x55, 0x45, 0x5e, 0xe4, 0xe8, 0xfa, 0x5f, 0x56,
+    0x5a, 0x0c, 0x45, 0x25, 0x7c, 0x54, 0xf1, 0x53, 0x09, 0xf0, 0x38, 0xf0, 0x5a, 0x15, 0x52, 0x15,
+    0x15, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0x55, 0xbe, 0x8a, 0x5a,
+    0x95, 0x65, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x95, 0xfb, 0x55, 0x6a, 0x65, 0x55, 0x55, 0xe9, 0x97,
+    0x40, 0x25, 0xa5, 0x55, 0x15, 0x79, 0x91, 0xa3, 0xeb, 0x7f, 0x59, 0x69, 0x05, 0x14, 0x95, 0xf0,
+    0x51, 0xc5, 0x43, 0x25, 0xc0, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40,
+    0x44, 0x55, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x55, 0x96, 0x55, 0x5e, 0xaa,
+    0x85, 0x5a, 0x55, 0xee, 0x57, 0xa9, 0x95, 0x55, 0x55, 0xa5, 0x5f, 0x02, 0x95, 0x94, 0x55, 0x55,
+    0xe4, 0x45, 0x82, 0x6e, 0xf9, 0x65, 0xa5, 0x15, 0x50, 0x54, 0xc2, 0x47, 0x55, 0x05, 0x95, 0x00,
+    0x83, 0x03, 0xaf, 0x55, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x55, 0x51, 0xcc, 0x54,
+    0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f,
+    0xa5, 0xfa, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0xeb, 0xfb, 0xff, 0xcf, 0x97, 0x38, 0xb8, 0xee,
+    0xfb, 0xfe, 0x96, 0x0b, 0xcf, 0xaf, 0x1f, 0xfc, 0xff, 0x54, 0x02, 0x3c, 0x0e, 0xbc, 0xc6, 0xc7,
+    0x54, 0x05, 0xcf, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0xf9, 0xbe, 0xaf,
+    0xaa, 0x56, 0xe6, 0xeb, 0xef, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x5b, 0xb9, 0xfb,
+    0xfa, 0xa5, 0xea, 0xaf, 0xef, 0xff, 0x3f, 0x5f, 0xe2, 0xe0, 0xba, 0x5f, 0xfa, 0x5b, 0x2e, 0x3c,
+    0xbf, 0x7e, 0xf0, 0xff, 0x53, 0x09, 0xf0, 0x38, 0xf0, 0x1a, 0x1f, 0x53, 0x15, 0x3c, 0xff, 0x03,
+    0x02, 0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0xf9, 0xe7, 0xfb, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0xbf,
+    0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x6f, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0xbf, 0xae,
+    0xff, 0xff, 0x7c, 0x99, 0x83, 0xeb, 0x7e, 0xe9, 0x6f, 0xb9, 0xc4, 0xfc, 0xfa, 0xc1, 0xff, 0x4f,
+    0x25, 0xc0, 0xe3, 0xc0, 0x6b, 0x7c, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x5f, 0x3c,
+    0x33, 0x55, 0xe5, 0x9f, 0xef, 0xfb, 0xaa, 0x6a, 0x65, 0xbe, 0xfe, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9,
+    0xee, 0x57, 0xa9, 0xbe, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0xfe, 0x9a, 0xfe, 0xff, 0xf3, 0x65, 0x0e,
+    0xae, 0xfb, 0xa5, 0xbf, 0xe5, 0x52, 0xf0, 0xeb, 0x07, 0xff, 0x3f, 0x95, 0x00, 0x8f, 0x03, 0xaf,
+    0xf1, 0x31, 0x55, 0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x7f, 0xf1, 0xcc, 0x54, 0x95, 0x7f, 0xbe,
+    0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0xfa, 0x56,
+    0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0x52, 0xfa, 0xff, 0x9f, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96,
+    0x4b, 0xc1, 0xaf, 0x1f, 0xfc, 0xff, 0x54, 0x02, 0x3c, 0x0e, 0xbc, 0xc6, 0xc7, 0x54, 0x05, 0xcf,
+    0xff, 0x80, 0x00, 0x44, 0xfc, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0xf9, 0x9e, 0xaf, 0xaa, 0x56, 0xe6,
+    0xeb, 0xe7, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x59, 0xb9, 0xfb, 0xfa, 0xa5, 0xea,
+    0x49, 0xe9, 0xff, 0x7f, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x45, 0xbc, 0x7e, 0xf0,
+    0xff, 0x53, 0x09, 0xf0, 0x38, 0xf0, 0x1a, 0x17, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1,
+    0x15, 0xcf, 0x4c, 0x55, 0xf9, 0xe7, 0x5b, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x97, 0x97, 0xaa, 0xaf,
+    0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x65, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0x25, 0xa5, 0xff, 0xff, 0x79,
+    0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0xc5, 0xfa, 0xc1, 0xff, 0x4f, 0x25, 0xc0, 0xe3,
+    0xc0, 0x6b, 0x54, 0x4c, 0x55, 0xf0, 0xfc, 0x0f, 0x08, 0x40, 0xc4, 0x55, 0x3c, 0x33, 0x55, 0xe5,
+    0x9f, 0x5f, 0xf9, 0xaa, 0x6a, 0x65, 0xbe, 0x56, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9,
+    0x95, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0x95, 0x94, 0xfe, 0xff, 0xe7, 0x45, 0x8e, 0xae, 0xfb, 0x65,
+    0xa5, 0xe5, 0x52, 0x54, 0xe8, 0x07, 0xff, 0x3f, 0x95, 0x00, 0x8f, 0x03, 0xaf, 0x51, 0x31, 0x55,
+    0xc1, 0xf3, 0x3f, 0x20, 0x00, 0x11, 0x55, 0xf1, 0xcc, 0x54, 0x95, 0x55, 0x55, 0xe5, 0xab, 0xa8,
+    0x95, 0x59, 0x56, 0x79, 0xa9, 0x16, 0x6a, 0x65, 0xb9, 0x5f, 0xa5, 0x56, 0x56, 0x56, 0x95, 0x7e,
+    0x29, 0x54, 0x52, 0xfa, 0x55, 0x91, 0x17, 0x39, 0xba, 0xfe, 0x97, 0x95, 0x96, 0x43, 0x51, 0x89,
+    0x1f, 0x55, 0xfc, 0x54, 0x02, 0x3c, 0x0e, 0xbc, 0x56, 0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00,
+    0x44, 0x54, 0x45, 0x31, 0x53, 0x55, 0x55, 0x55, 0x95, 0xaf, 0xa2, 0x56, 0x65, 0x59, 0xe5, 0xa5,
+    0x5a, 0xa8, 0x55, 0xe5, 0x7e, 0x95, 0x5a, 0x59, 0x55, 0x55, 0xfa, 0x25, 0x50, 0x49, 0x59, 0x55,
+    0x45, 0x5e, 0xe4, 0xe8, 0x96, 0x5f, 0x56, 0x5a, 0x21, 0x45, 0xa5, 0x7c, 0x54, 0x55, 0x50, 0x09,
+    0x30, 0x38, 0xf0, 0x5a, 0x15, 0x52, 0x15, 0x15, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c,
+    0x55, 0x55, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x95, 0x65, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x95, 0xfb,
+    0x55, 0x6a, 0x65, 0x55, 0x55, 0xe9, 0x97, 0x40, 0x25, 0x65, 0x55, 0x15, 0x79, 0x91, 0xa3, 0x5b,
+    0x7e, 0x59, 0x69, 0x85, 0x14, 0x95, 0xc6, 0x51, 0x55, 0x41, 0x25, 0x40, 0xe0, 0xc0, 0x6b, 0x55,
+    0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9,
+    0x2a, 0x6a, 0x55, 0x96, 0x55, 0x5e, 0xaa, 0x85, 0x5a, 0x55, 0xee, 0x57, 0xa9, 0x95, 0x55, 0x55,
+    0xa5, 0x5f, 0x02, 0x95, 0x94, 0x55, 0x55, 0xe4, 0x45, 0x8e, 0x6e, 0xf9, 0x65, 0xa5, 0x15, 0x52,
+    0x54, 0x5a, 0x44, 0x55, 0x05, 0x95, 0x00, 0x81, 0x03, 0xaf, 0x55, 0x21, 0x55, 0x51, 0xf1, 0x3f,
+    0x20, 0x00, 0x11, 0x55, 0x51, 0xcc, 0x54, 0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa,
+    0x7b, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0xfa, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0x52,
+    0xfa, 0xff, 0x9f, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0xe1, 0xaf, 0xcf, 0xfc, 0xff,
+    0x54, 0x02, 0x3c, 0x0e, 0xbc, 0xc6, 0xff, 0x54, 0x05, 0xff, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc7,
+    0x33, 0x53, 0x55, 0xfe, 0xf9, 0xbe, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xef, 0xa5, 0xea, 0xab, 0x95,
+    0xef, 0x7e, 0x95, 0xea, 0x5b, 0xb9, 0xfb, 0xfa, 0xa5, 0xea, 0x4b, 0xe9, 0xff, 0x7f, 0x5e, 0xe4,
+    0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x85, 0xbf, 0x7e, 0xf0, 0xff, 0x53, 0x09, 0xf0, 0x38, 0xf0,
+    0x1a, 0x3f, 0x53, 0x15, 0x3c, 0xff, 0x03, 0x02, 0x10, 0xf1, 0x1f, 0xcf, 0x4c, 0x55, 0xf9, 0xe7,
+    0x55, 0xbe, 0xaa, 0x5a, 0x99, 0x6f, 0x95, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0x6a, 0x65,
+    0xe5, 0xee, 0xe9, 0x97, 0x6a, 0x25, 0xa5, 0xff, 0x3f, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69,
+    0xb9, 0x14, 0x95, 0xfa, 0xc1, 0xff, 0x4f, 0x25, 0xc0, 0xe3, 0xc0, 0x6b, 0x55, 0x4c, 0x55, 0xf0,
+    0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x3c, 0x33, 0x55, 0xe5, 0x9f, 0x55, 0xf9, 0xaa, 0x6a, 0x65,
+    0xbe, 0x55, 0x5e, 0xaa, 0x8e, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x95, 0x95, 0xbb, 0xa5, 0x5f, 0xaa,
+    0x95, 0x94, 0xfe, 0x7f, 0xe4, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0x47,
+    0xfc, 0x3f, 0x95, 0x00, 0x8f, 0x03, 0xaf, 0x55, 0x31, 0x55, 0xc1, 0xf1, 0x3f, 0x20, 0x00, 0x11,
+    0x55, 0x71, 0xcc, 0x54, 0x95, 0x7f, 0x55, 0xe5, 0xab, 0xaa, 0x95, 0xf9, 0x56, 0x79, 0xa9, 0x1a,
+    0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x56, 0x56, 0xee, 0x95, 0x7e, 0xa9, 0x56, 0x52, 0xfa, 0x7f, 0x91,
+    0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0x51, 0xa9, 0x1f, 0xc5, 0xff, 0x54, 0x02, 0x3c,
+    0x0e, 0xbc, 0x56, 0xc5, 0x54, 0x05, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x54, 0x45, 0x31, 0x53, 0x55,
+    0x7e, 0x55, 0x95, 0xaf, 0xa2, 0x56, 0xe6, 0x5b, 0xe5, 0xa5, 0x5a, 0xa8, 0x95, 0xef, 0x7e, 0x95,
+    0x5a, 0x59, 0xb9, 0x55, 0xfa, 0xa5, 0x52, 0x49, 0xe9, 0x7f, 0x45, 0x5e, 0xe4, 0xe8, 0xba, 0x5f,
+    0x56, 0x5a, 0x2e, 0x45, 0xa5, 0x7e, 0x54, 0xfc, 0x53, 0x09, 0xf0, 0x38, 0xf0, 0x5a, 0x15, 0x53,
+    0x15, 0x14, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x79, 0x55, 0x55, 0xbe, 0x8a,
+    0x5a, 0x99, 0x67, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x9e, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0x55, 0xe9,
+    0x97, 0x4a, 0x25, 0xa5, 0x7f, 0x15, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0x95,
+    0xfa, 0x51, 0xc5, 0x4f, 0x25, 0xc0, 0xe3, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08,
+    0x40, 0x44, 0x55, 0x14, 0x33, 0x55, 0x65, 0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x65, 0x96, 0x55, 0x5e,
+    0xaa, 0x85, 0x5a, 0x59, 0xee, 0x57, 0xa9, 0x95, 0x95, 0x55, 0xa5, 0x5f, 0x0a, 0x95, 0x94, 0x7e,
+    0x55, 0xe4, 0x45, 0x8e, 0xae, 0xf9, 0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0x47, 0x55, 0x3c, 0x95,
+    0x00, 0x8f, 0x03, 0xaf, 0x55, 0x21, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x00, 0x11, 0x55, 0x51, 0xcc,
+    0x54, 0x55, 0x55, 0x55, 0xe5, 0xab, 0xa8, 0x55, 0x59, 0x56, 0x79, 0xa9, 0x16, 0x6a, 0x55, 0xb9,
+    0x5f, 0xa5, 0x56, 0x56, 0x55, 0x95, 0x7e, 0x29, 0x54, 0x52, 0x7a, 0x55, 0x91, 0x17, 0x39, 0xba,
+    0xe5, 0x97, 0x95, 0x96, 0x4b, 0x51, 0xa9, 0x1f, 0x55, 0xc5, 0x54, 0x02, 0x3c, 0x0e, 0xbc, 0x56,
+    0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x54, 0x45, 0x31, 0x53, 0x55, 0x55, 0x55, 0x95,
+    0xaf, 0xa2, 0x56, 0x65, 0x59, 0xe5, 0xa5, 0x5a, 0xa8, 0x55, 0xe5, 0x7e, 0x95, 0x5a, 0x59, 0x55,
+    0x55, 0xfa, 0x25, 0x50, 0x49, 0x69, 0x55, 0x45, 0x5e, 0xe4, 0xe8, 0x96, 0x5f, 0x56, 0x5a, 0x22,
+    0x45, 0xa5, 0x7e, 0x54, 0x55, 0x50, 0x09, 0xf0, 0x38, 0xf0, 0x5a, 0x15, 0x52, 0x15, 0x15, 0xff,
+    0x03, 0x02, 0x10, 0x51, 0x15, 0xc5, 0x4c, 0x55, 0x55, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x95, 0x65,
+    0x95, 0x97, 0x6a, 0xa1, 0x56, 0x95, 0xfb, 0x55, 0x6a, 0x65, 0x55, 0x55, 0xe9, 0x97, 0x40, 0x25,
+    0x65, 0x55, 0x15, 0x79, 0x91, 0xa3, 0x5b, 0x7e, 0x59, 0x69, 0x85, 0x14, 0x95, 0x96, 0x51, 0x55,
+    0x41, 0x25, 0x50, 0xe0, 0xc0, 0x6b, 0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55,
+    0x14, 0x33, 0x55, 0xe5, 0x9f, 0xef, 0xf9, 0xaa, 0x6a, 0x65, 0xbe, 0x7e, 0x5e, 0xaa, 0xbe, 0x5a,
+    0xf9, 0xee, 0x57, 0xa9, 0x9e, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0x9e, 0x94, 0xfe, 0xff, 0xe7, 0x45,
+    0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0xf8, 0xea, 0xbb, 0xff, 0x3f, 0xfc, 0x0a, 0x0f, 0xab,
+    0x2f, 0xfe, 0xbf, 0x15, 0xcf, 0xff, 0x3f, 0x20, 0x00, 0x31, 0xff, 0xff, 0xff, 0x57, 0x95, 0x7f,
+    0xbe, 0xe7, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x79, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x7a,
+    0x56, 0xee, 0xbe, 0x7e, 0xa9, 0x7a, 0x52, 0xfa, 0xff, 0x9f, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95,
+    0x96, 0x4b, 0xe1, 0xab, 0xef, 0xfe, 0xff, 0xc4, 0x2b, 0x3c, 0xac, 0xbe, 0xf8, 0xff, 0x56, 0x3c,
+    0xff, 0xff, 0x80, 0x00, 0xc4, 0xfc, 0xff, 0xff, 0x5f, 0x55, 0xfe, 0xf9, 0x9e, 0xaf, 0xaa, 0x56,
+    0xe6, 0xeb, 0xe7, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x59, 0xb9, 0xfb, 0xfa, 0xa5,
+    0xea, 0x49, 0xe9, 0xff, 0x7f, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x85, 0xaf, 0xbe,
+    0xfb, 0xff, 0x53, 0xac, 0xf0, 0xb0, 0xfa, 0xe2, 0xff, 0x5b, 0xf1, 0xfc, 0xff, 0x03, 0x02, 0x10,
+    0xf3, 0xff, 0xff, 0x7f, 0x55, 0xf9, 0xe7, 0x7b, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x9f, 0x97, 0xaa,
+    0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x67, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0x27, 0xa5, 0xff, 0xff,
+    0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0xbe, 0xfa, 0xee, 0xff, 0x4f, 0x85, 0xc2,
+    0xc3, 0xea, 0x8b, 0xff, 0x6f, 0xc5, 0xf3, 0xff, 0x0f, 0x08, 0x40, 0xcc, 0xff, 0xff, 0xff, 0x55,
+    0xe5, 0x9f, 0xef, 0xfb, 0xaa, 0x6a, 0x65, 0xbe, 0xfe, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57,
+    0xa9, 0xbe, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0xbe, 0x94, 0xfe, 0xff, 0xe7, 0x45, 0x8e, 0xae, 0xfb,
+    0x65, 0xa5, 0xe5, 0x52, 0xf8, 0xeb, 0x3b, 0xff, 0x3f, 0x95, 0x00, 0x8f, 0x23, 0xaf, 0xf1, 0xbf,
+    0x55, 0xc1, 0xff, 0x3f, 0x20, 0x00, 0x11, 0xff, 0xf1, 0xcc, 0x54, 0x95, 0x7f, 0x5e, 0xe5, 0xab,
+    0xaa, 0x95, 0xf9, 0x56, 0x79, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x56, 0x56, 0xee, 0x9e,
+    0x7e, 0xa9, 0x56, 0x52, 0xfa, 0xff, 0x93, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0x51,
+    0xa9, 0x1f, 0xfe, 0xff, 0x54, 0x02, 0x3c, 0x2e, 0xbc, 0x56, 0xc5, 0x54, 0x05, 0xff, 0xff, 0x80,
+    0x00, 0x44, 0x54, 0xc5, 0x33, 0x53, 0x55, 0x5e, 0x55, 0x95, 0xaf, 0xa2, 0x56, 0xe6, 0x59, 0xe5,
+    0xa5, 0x5a, 0xa8, 0x95, 0xe7, 0x7e, 0x95, 0x5a, 0x59, 0x79, 0x55, 0xfa, 0xa5, 0x52, 0x49, 0xe9,
+    0x5f, 0x45, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x45, 0xa5, 0x7e, 0x54, 0xf9, 0x53,
+    0x09, 0xf0, 0x38, 0xf0, 0x5a, 0x15, 0x52, 0x15, 0x15, 0xff, 0x03, 0x02, 0x54, 0x55, 0x15, 0xc5,
+    0x4c, 0x55, 0x55, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x95, 0x65, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x95,
+    0xfb, 0x55, 0x6a, 0x65, 0x55, 0x55, 0xe9, 0x97, 0x40, 0x25, 0xa5, 0x55, 0x15, 0x79, 0x91, 0xa3,
+    0x5b, 0x7e, 0x59, 0x69, 0x89, 0x14, 0x95, 0xba, 0x51, 0x55, 0x69, 0x25, 0xc0, 0xe3, 0xc0, 0x6b,
+    0x55, 0x48, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x40, 0x44, 0x55, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55,
+    0xf9, 0x2a, 0x6a, 0x55, 0x96, 0x55, 0x5e, 0xaa, 0x85, 0x5a, 0x55, 0xee, 0x57, 0xa9, 0x95, 0x55,
+    0x55, 0xa5, 0x5f, 0x02, 0x95, 0x94, 0x56, 0x55, 0xe4, 0x45, 0x8e, 0x6e, 0xf9, 0x65, 0xa5, 0x25,
+    0x52, 0x54, 0x6a, 0x46, 0x55, 0xa5, 0x95, 0x40, 0x8c, 0x03, 0xaf, 0x55, 0x21, 0x55, 0x51, 0xf1,
+    0x3f, 0x20, 0x00, 0x11, 0x55, 0x51, 0xcc, 0x54, 0x55, 0x55, 0x55, 0xe5, 0xab, 0xa8, 0x55, 0x59,
+    0x56, 0x79, 0xa9, 0x16, 0x6a, 0x55, 0xb9, 0x5f, 0xa5, 0x56, 0x56, 0x55, 0x95, 0x7e, 0x09, 0x54,
+    0x52, 0x5a, 0x55, 0x91, 0x17, 0x39, 0xba, 0xe5, 0x97, 0x95, 0x96, 0x48, 0x51, 0x69, 0x19, 0x55,
+    0x95, 0x56, 0x02, 0x05, 0x0e, 0xbc, 0x56, 0x85, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x44, 0x54,
+    0x45, 0x31, 0x53, 0x55, 0xfe, 0xf9, 0x9e, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xe7, 0xa5, 0xea, 0xab,
+    0x95, 0xef, 0x7e, 0x95, 0xea, 0x59, 0xb9, 0xfb, 0xfa, 0xa5, 0xea, 0x49, 0xe9, 0xff, 0x7f, 0x5e,
+    0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x85, 0xaf, 0xbe, 0xfb, 0xff, 0x93, 0xaf, 0xf0, 0xb0,
+    0xfa, 0xe2, 0xff, 0x5b, 0xf1, 0xfc, 0xff, 0x03, 0x02, 0x10, 0xf3, 0xff, 0xff, 0x7f, 0x55, 0xf9,
+    0xe7, 0x7b, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x9f, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa,
+    0x67, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0x27, 0xa5, 0xff, 0xff, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59,
+    0x69, 0xb9, 0x14, 0xbe, 0xfa, 0xee, 0xff, 0x4f, 0xa5, 0xc2, 0xc3, 0xea, 0x8b, 0xff, 0x6f, 0xc5,
+    0xf3, 0xff, 0x0f, 0x08, 0x40, 0xcc, 0xff, 0xff, 0xff, 0x55, 0xe5, 0x9f, 0xef, 0xf9, 0xaa, 0x6a,
+    0x65, 0xbe, 0x7e, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x9e, 0x95, 0xbb, 0xaf, 0x5f,
+    0xaa, 0x9e, 0x94, 0xfe, 0xff, 0xe7, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0xf8, 0xea,
+    0xbb, 0xff, 0x3f, 0x95, 0x0a, 0x4f, 0xa8, 0x2f, 0xfe, 0xbf, 0x15, 0xcf, 0xff, 0x3f, 0x20, 0x00,
+    0x31, 0xff, 0xff, 0xff, 0x57, 0x95, 0x7f, 0xbe, 0xef, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x7b, 0xa9,
+    0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0xfa, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0xfa, 0x52, 0xfa, 0xff,
+    0x9f, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0xe1, 0xaf, 0xef, 0xfc, 0xff, 0x54, 0x2a,
+    0x3c, 0x8e, 0xbe, 0xc6, 0xff, 0x56, 0x05, 0xff, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc7, 0x33, 0x53,
+    0x55, 0xfe, 0x79, 0x95, 0xaf, 0xaa, 0x56, 0xe6, 0x5b, 0xe5, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e,
+    0x95, 0x5a, 0x59, 0xb9, 0x7b, 0xfa, 0xa5, 0x5a, 0x49, 0xe9, 0xff, 0x4f, 0x5e, 0xe4, 0xe8, 0xba,
+    0x5f, 0x56, 0x5a, 0x2e, 0x45, 0xa5, 0x7e, 0xf8, 0xff, 0x53, 0xa9, 0xf0, 0xb8, 0xf0, 0x5a, 0x15,
+    0x5b, 0x15, 0xfc, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15, 0xcf, 0x4c, 0x55, 0x79, 0x55, 0x55, 0xbe,
+    0x8a, 0x5a, 0x99, 0x67, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x9e, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0x55,
+    0xe9, 0x97, 0x4a, 0x25, 0xa5, 0x7f, 0x15, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14,
+    0x95, 0xfa, 0x51, 0xe5, 0x4f, 0x25, 0xc8, 0xe3, 0xc2, 0x6b, 0x55, 0x49, 0x55, 0x54, 0xfc, 0x0f,
+    0x08, 0x50, 0x55, 0x55, 0x14, 0x33, 0x55, 0xe5, 0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x65, 0x9e, 0x55,
+    0x5e, 0xaa, 0x85, 0x5a, 0x79, 0xee, 0x57, 0xa9, 0x95, 0x95, 0x57, 0xa5, 0x5f, 0x2a, 0x95, 0x94,
+    0xfe, 0x55, 0xe4, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0x47, 0x95, 0x3f,
+    0x95, 0x20, 0x8f, 0x4b, 0xac, 0x55, 0x25, 0x55, 0x51, 0xf1, 0x3f, 0x20, 0x40, 0x55, 0x55, 0x51,
+    0xcc, 0x54, 0x95, 0x57, 0x55, 0xe5, 0xab, 0xa8, 0x95, 0x79, 0x56, 0x79, 0xa9, 0x16, 0x6a, 0xe5,
+    0xb9, 0x5f, 0xa5, 0x56, 0x56, 0x5e, 0x95, 0x7e, 0xa9, 0x54, 0x52, 0xfa, 0x57, 0x91, 0x17, 0x39,
+    0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0x51, 0xa9, 0x1f, 0x55, 0xfe, 0x54, 0x82, 0x3c, 0x2e, 0x85,
+    0x56, 0x95, 0x54, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x55, 0x55, 0x45, 0x31, 0x53, 0x55, 0xfe, 0xf9,
+    0x9e, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xe7, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x59,
+    0xb9, 0xfb, 0xfa, 0xa5, 0xea, 0x49, 0xe9, 0xff, 0x7f, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a,
+    0x2e, 0x85, 0xaf, 0xbe, 0xfb, 0xff, 0x53, 0xa9, 0xf0, 0xb8, 0xfa, 0xe8, 0xff, 0xcb, 0xff, 0xfc,
+    0xff, 0x03, 0x02, 0x30, 0xf3, 0xff, 0xff, 0x7f, 0x55, 0xf9, 0xe7, 0x7b, 0xbe, 0xaa, 0x5a, 0x99,
+    0xaf, 0x9f, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x67, 0xe5, 0xee, 0xeb, 0x97, 0xaa,
+    0x27, 0xa5, 0xff, 0xff, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0xbe, 0xfa, 0xee,
+    0xff, 0x4f, 0xa5, 0xc2, 0xe3, 0xea, 0x8b, 0xff, 0x6f, 0xc5, 0xf3, 0xff, 0x0f, 0x08, 0x40, 0xcc,
+    0xff, 0xff, 0xff, 0x55, 0xe5, 0x9f, 0xef, 0xf9, 0xaa, 0x6a, 0x65, 0xbe, 0x7e, 0x5e, 0xaa, 0xbe,
+    0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x9e, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0x9e, 0x94, 0xfe, 0xff, 0xe7,
+    0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0xf8, 0xea, 0xbb, 0xff, 0x3f, 0x95, 0x0a, 0x8f,
+    0xab, 0xaf, 0xfc, 0xbf, 0x55, 0xc1, 0xff, 0x3f, 0x20, 0x00, 0x11, 0xff, 0xf3, 0xcc, 0x54, 0x95,
+    0x7f, 0xbe, 0xe7, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x79, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5,
+    0x7a, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0x7a, 0x52, 0xfa, 0xff, 0x9f, 0x17, 0x39, 0xba, 0xee, 0x97,
+    0x95, 0x96, 0x4b, 0xe1, 0xab, 0xef, 0xfe, 0xff, 0x54, 0x2a, 0x3c, 0xae, 0xbe, 0xc6, 0xff, 0x56,
+    0x05, 0xff, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xc7, 0x33, 0x53, 0x55, 0xfe, 0xf9, 0x96, 0xaf, 0xaa,
+    0x56, 0xe6, 0xeb, 0xe5, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0x6a, 0x59, 0xb9, 0xfb, 0xfa,
+    0xa5, 0x6a, 0x49, 0xe9, 0xff, 0x7f, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x85, 0xa7,
+    0xbe, 0xfb, 0xff, 0x53, 0xa9, 0xf0, 0xb8, 0xfa, 0x5a, 0xfc, 0x5b, 0x15, 0xfc, 0xff, 0x03, 0x02,
+    0x10, 0xf1, 0x17, 0xcf, 0x4c, 0x55, 0xf9, 0xe7, 0x57, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x95, 0x97,
+    0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0xee, 0xeb, 0x97, 0x6a, 0x25, 0xa5, 0xff,
+    0xff, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0x96, 0xfa, 0xee, 0xff, 0x4f, 0xa5,
+    0xc2, 0xe3, 0xea, 0x6b, 0xc5, 0x6f, 0x55, 0xf0, 0xff, 0x0f, 0x08, 0x40, 0xc4, 0x57, 0x3c, 0x33,
+    0x55, 0xe5, 0x9f, 0x57, 0xf9, 0xaa, 0x6a, 0x65, 0xbe, 0x55, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee,
+    0x57, 0xa9, 0x95, 0x95, 0xbb, 0xa7, 0x5f, 0xaa, 0x95, 0x94, 0xfe, 0xff, 0xe4, 0x45, 0x8e, 0xae,
+    0xfb, 0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0xbb, 0xff, 0x3f, 0x95, 0x0a, 0x8f, 0xab, 0xaf, 0x55,
+    0xbc, 0x55, 0xc1, 0xff, 0x3f, 0x20, 0x00, 0x11, 0x57, 0xf1, 0xcc, 0x54, 0x95, 0x7f, 0x5e, 0xe5,
+    0xab, 0xaa, 0x95, 0xf9, 0x56, 0x79, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x56, 0x56, 0xee,
+    0x9e, 0x7e, 0xa9, 0x56, 0x52, 0xfa, 0xff, 0x93, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b,
+    0x51, 0xa9, 0x2f, 0xfe, 0xff, 0x54, 0x2a, 0x3c, 0xae, 0xbe, 0x56, 0xc5, 0x56, 0x05, 0xff, 0xff,
+    0x80, 0x00, 0x44, 0x54, 0xc5, 0x33, 0x53, 0x55, 0xfe, 0x79, 0x95, 0xaf, 0xaa, 0x56, 0xe6, 0x5b,
+    0xe5, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0x5a, 0x59, 0xb9, 0x7b, 0xfa, 0xa5, 0x5a, 0x49,
+    0xe9, 0xff, 0x4f, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x45, 0xa5, 0xbe, 0xf8, 0xfb,
+    0x53, 0xa9, 0xf2, 0xb8, 0xfa, 0x5a, 0x55, 0x58, 0x15, 0xfc, 0xff, 0x03, 0x02, 0x10, 0x51, 0x15,
+    0xcf, 0x4c, 0x55, 0x79, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x99, 0x67, 0x95, 0x97, 0x6a, 0xa1, 0x56,
+    0x9e, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0x55, 0xe9, 0x97, 0x4a, 0x25, 0xa5, 0x7f, 0x15, 0x79, 0x91,
+    0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0x95, 0xfa, 0x51, 0xe5, 0x4f, 0xa5, 0xc8, 0xe3, 0xea,
+    0x6b, 0x55, 0x49, 0x55, 0x54, 0xfc, 0x0f, 0x08, 0x50, 0x55, 0x55, 0x14, 0x33, 0x55, 0xe5, 0x9f,
+    0xef, 0xf9, 0xaa, 0x6a, 0x65, 0xbe, 0x7e, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x9e,
+    0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0x9e, 0x94, 0xfe, 0xff, 0xe7, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5,
+    0xe5, 0x52, 0xf8, 0xea, 0xbb, 0xff, 0x3f, 0x95, 0x0a, 0x8f, 0xab, 0xaf, 0xfe, 0xbf, 0xfc, 0xcf,
+    0xff, 0x3f, 0x20, 0x00, 0x33, 0xff, 0xff, 0xff, 0x57, 0x95, 0x7f, 0xbe, 0xe7, 0xab, 0xaa, 0x95,
+    0xf9, 0xfa, 0x79, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x7a, 0x56, 0xee, 0xbe, 0x7e, 0xa9,
+    0x7a, 0x52, 0xfa, 0xff, 0x9f, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0xe1, 0xab, 0xef,
+    0xfe, 0xff, 0x54, 0x2a, 0x3c, 0xae, 0xbe, 0xfa, 0xff, 0xc6, 0x3f, 0xff, 0xff, 0x80, 0x00, 0xcc,
+    0xfc, 0xff, 0xff, 0x5f, 0x55, 0xfe, 0xf9, 0x9e, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xe7, 0xa5, 0xea,
+    0xab, 0x95, 0xef, 0x7e, 0x95, 0xea, 0x59, 0xb9, 0xfb, 0xfa, 0xa5, 0xea, 0x49, 0xe9, 0xff, 0x7f,
+    0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x85, 0xaf, 0xbe, 0xfb, 0xff, 0x53, 0xa9, 0xf0,
+    0xb8, 0xfa, 0xea, 0xff, 0x5b, 0xfc, 0xfc, 0xff, 0x03, 0x02, 0x10, 0xf3, 0xff, 0xff, 0x7f, 0x55,
+    0xf9, 0xe7, 0x7b, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x9f, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55,
+    0xaa, 0x67, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0x27, 0xa5, 0xff, 0xff, 0x79, 0x91, 0xa3, 0xeb, 0x7e,
+    0x59, 0x69, 0xb9, 0x14, 0xbe, 0xfa, 0xee, 0xff, 0x4f, 0xa5, 0xc2, 0xe3, 0xea, 0xab, 0xff, 0x6f,
+    0xc5, 0xf3, 0xff, 0x0f, 0x08, 0x40, 0xcc, 0xff, 0xff, 0xff, 0x55, 0xe5, 0x9f, 0xef, 0xf9, 0xaa,
+    0x6a, 0x65, 0xbe, 0x7e, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x9e, 0x95, 0xbb, 0xaf,
+    0x5f, 0xaa, 0x9e, 0x94, 0xfe, 0xff, 0xe7, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0xf8,
+    0xea, 0xbb, 0xff, 0x3f, 0x95, 0x0a, 0x8f, 0xab, 0xaf, 0xfe, 0xbf, 0x55, 0xcc, 0xff, 0x3f, 0x20,
+    0x00, 0x11, 0xff, 0xff, 0xff, 0x57, 0x95, 0x7f, 0xbe, 0xe7, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x79,
+    0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x7a, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0x7a, 0x52, 0xfa,
+    0xff, 0x9f, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0xe1, 0xab, 0xef, 0xfe, 0xff, 0x54,
+    0x2a, 0x3c, 0xae, 0xbe, 0xfa, 0xff, 0x56, 0x05, 0xff, 0xff, 0x80, 0x00, 0x44, 0xfc, 0xff, 0xff,
+    0x5f, 0x55, 0xfe, 0x59, 0x95, 0xaf, 0xaa, 0x56, 0xe6, 0x5b, 0xe5, 0xa5, 0xea, 0xa8, 0x95, 0xef,
+    0x7e, 0x95, 0x5a, 0x59, 0xb9, 0x5b, 0xfa, 0xa5, 0x5a, 0x49, 0xe9, 0xff, 0x47, 0x5e, 0xe4, 0xe8,
+    0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x45, 0xa5, 0xbe, 0xf8, 0xf9, 0x53, 0xa9, 0xf2, 0xb8, 0xfa, 0x5a,
+    0x55, 0x5a, 0x15, 0xfc, 0xff, 0x03, 0x02, 0x54, 0x55, 0x15, 0xcf, 0x4c, 0x55, 0xf9, 0x57, 0x55,
+    0xbe, 0xaa, 0x5a, 0x99, 0x6f, 0x95, 0x97, 0xaa, 0xa1, 0x56, 0xbe, 0xfb, 0x55, 0x6a, 0x65, 0xe5,
+    0x5e, 0xe9, 0x97, 0x6a, 0x25, 0xa5, 0xff, 0x17, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9,
+    0x14, 0x95, 0xfa, 0xe2, 0xe5, 0x4f, 0xa5, 0xca, 0xe3, 0xea, 0x6b, 0x55, 0x69, 0x55, 0xc4, 0xff,
+    0x0f, 0x08, 0x50, 0x55, 0x55, 0x1c, 0x33, 0x55, 0xe5, 0x57, 0x55, 0xf9, 0x2a, 0x6a, 0x65, 0xbe,
+    0x55, 0x5e, 0xaa, 0x85, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x95, 0x95, 0x5b, 0xa5, 0x5f, 0x2a, 0x95,
+    0x94, 0xfe, 0x57, 0xe4, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0x8b, 0x95,
+    0x3f, 0x95, 0x2a, 0x8f, 0xab, 0xaf, 0x55, 0xa5, 0x55, 0x51, 0xfc, 0x3f, 0x20, 0x40, 0x55, 0x55,
+    0x51, 0xcc, 0x54, 0x95, 0x57, 0x55, 0xe5, 0xab, 0xa8, 0x95, 0x79, 0x56, 0x79, 0xa9, 0x16, 0x6a,
+    0xe5, 0xb9, 0x5f, 0xa5, 0x56, 0x56, 0x5e, 0x95, 0x7e, 0xa9, 0x54, 0x52, 0xfa, 0x57, 0x91, 0x17,
+    0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0x51, 0xa9, 0x2f, 0x55, 0xfe, 0x54, 0xaa, 0x3c, 0xae,
+    0xbe, 0x56, 0x95, 0x56, 0x45, 0xc5, 0xff, 0x80, 0x00, 0x55, 0x55, 0x45, 0x31, 0x53, 0x55, 0x5e,
+    0x55, 0x95, 0xaf, 0xa2, 0x56, 0xe6, 0x59, 0xe5, 0xa5, 0x5a, 0xa8, 0x95, 0xe7, 0x7e, 0x95, 0x5a,
+    0x59, 0x79, 0x55, 0xfa, 0xa5, 0x52, 0x49, 0xe9, 0x5f, 0x45, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56,
+    0x5a, 0x2e, 0x45, 0xa5, 0xbe, 0x54, 0xf9, 0x53, 0xa9, 0xf2, 0xb8, 0xfa, 0x5a, 0x55, 0x5a, 0x15,
+    0x55, 0xfc, 0x03, 0x02, 0x54, 0x55, 0x15, 0x45, 0x4c, 0x55, 0x79, 0x55, 0x55, 0xbe, 0x8a, 0x5a,
+    0x99, 0x67, 0x95, 0x97, 0x6a, 0xa1, 0x56, 0x9e, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0x55, 0xe9, 0x97,
+    0x4a, 0x25, 0xa5, 0x7f, 0x15, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0x95, 0xfa,
+    0x52, 0xe5, 0x4f, 0xa5, 0xca, 0xe3, 0xea, 0x6b, 0x55, 0x69, 0x55, 0x54, 0xc5, 0x0f, 0x08, 0x50,
+    0x55, 0x55, 0x14, 0x31, 0x55, 0xe5, 0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x65, 0x9e, 0x55, 0x5e, 0xaa,
+    0x85, 0x5a, 0x79, 0xee, 0x57, 0xa9, 0x95, 0x95, 0x57, 0xa5, 0x5f, 0x2a, 0x95, 0x94, 0xfe, 0x55,
+    0xe4, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0x4b, 0x95, 0x3f, 0x95, 0x2a,
+    0x8f, 0xab, 0xaf, 0x55, 0xa5, 0x55, 0x51, 0x55, 0x3c, 0x20, 0x40, 0x55, 0x55, 0x51, 0x44, 0x54,
+    0x95, 0x57, 0x55, 0xe5, 0xab, 0xa8, 0x95, 0x79, 0x56, 0x79, 0xa9, 0x16, 0x6a, 0xe5, 0xb9, 0x5f,
+    0xa5, 0x56, 0x56, 0x5e, 0x95, 0x7e, 0xa9, 0x54, 0x52, 0xfa, 0x57, 0x91, 0x17, 0x39, 0xba, 0xee,
+    0x97, 0x95, 0x96, 0x4b, 0x51, 0xa9, 0x2f, 0x55, 0xfe, 0x54, 0xaa, 0x3c, 0xae, 0xbe, 0x56, 0x95,
+    0x56, 0x45, 0x55, 0xc5, 0x80, 0x00, 0x55, 0x55, 0x45, 0x11, 0x51, 0x55, 0x5e, 0x55, 0x95, 0xaf,
+    0xa2, 0x56, 0xe6, 0x59, 0xe5, 0xa5, 0x5a, 0xa8, 0x95, 0xe7, 0x7e, 0x95, 0x5a, 0x59, 0x79, 0x55,
+    0xfa, 0xa5, 0x52, 0x49, 0xe9, 0x5f, 0x45, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x45,
+    0xa5, 0xbe, 0x54, 0xf9, 0x53, 0xa9, 0xf2, 0xb8, 0xfa, 0x5a, 0x55, 0x5a, 0x15, 0x55, 0x55, 0x00,
+    0x02, 0x54, 0x55, 0x15, 0x45, 0x44, 0x55, 0xf9, 0xe7, 0x7b, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x9f,
+    0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x67, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0x27, 0xa5,
+    0xff, 0xff, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0xbe, 0xfa, 0xee, 0xff, 0x4f,
+    0xa5, 0xc2, 0xe3, 0xea, 0xab, 0xff, 0x6f, 0xfe, 0xf3, 0xee, 0x0e, 0xa8, 0xca, 0xff, 0xff, 0xff,
+    0xff, 0x55, 0xe5, 0x9f, 0xef, 0xf9, 0xaa, 0x6a, 0x65, 0xbe, 0x7e, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9,
+    0xee, 0x57, 0xa9, 0x9e, 0x95, 0xbb, 0xaf, 0x5f, 0xaa, 0x9e, 0x94, 0xfe, 0xff, 0xe7, 0x45, 0x8e,
+    0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0xf8, 0xea, 0xbb, 0xff, 0x3f, 0x95, 0x0a, 0x8f, 0xab, 0xaf,
+    0xfe, 0xbf, 0x95, 0xcf, 0xbb, 0x3b, 0xa0, 0x6a, 0xf1, 0xff, 0xff, 0xff, 0x57, 0x95, 0x7f, 0xbe,
+    0xe7, 0xab, 0xaa, 0x95, 0xf9, 0xfa, 0x79, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x7a, 0x56,
+    0xee, 0xbe, 0x7e, 0xa9, 0x7a, 0x52, 0xfa, 0xff, 0x9f, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96,
+    0x4b, 0xe1, 0xab, 0xef, 0xfe, 0xff, 0x54, 0x2a, 0x3c, 0xae, 0xbe, 0xfa, 0xff, 0x56, 0x25, 0xef,
+    0xee, 0x80, 0xaa, 0x55, 0xfc, 0xff, 0xff, 0x5f, 0x55, 0xfe, 0xf9, 0x95, 0xaf, 0xaa, 0x56, 0xe6,
+    0x6b, 0xe5, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95, 0x5a, 0x59, 0xb9, 0xfb, 0xfa, 0xa5, 0x5a,
+    0x49, 0xe9, 0xff, 0x7f, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x85, 0xa7, 0xbe, 0xfb,
+    0xf9, 0x53, 0xa9, 0xf2, 0xb8, 0xfa, 0xea, 0x5f, 0x5a, 0x95, 0xbe, 0xbb, 0xab, 0xa8, 0x56, 0x15,
+    0xff, 0xff, 0x7f, 0x55, 0xf9, 0x67, 0x55, 0xbe, 0xaa, 0x5a, 0x99, 0x6f, 0x95, 0x97, 0xaa, 0xa3,
+    0x56, 0xbe, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0x6e, 0xe9, 0x97, 0x6a, 0x25, 0xa5, 0xff, 0x1f, 0x79,
+    0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0x95, 0xfa, 0xe2, 0xe7, 0x4f, 0xa5, 0xca, 0xe3,
+    0xea, 0x6b, 0x55, 0x69, 0x55, 0xf8, 0xff, 0xaf, 0x0a, 0x50, 0x55, 0x55, 0xfc, 0xff, 0x55, 0xe5,
+    0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x65, 0x9e, 0x55, 0x5e, 0xaa, 0x85, 0x5a, 0x79, 0xee, 0x57, 0xa9,
+    0x95, 0x95, 0x57, 0xa5, 0x5f, 0x2a, 0x95, 0x94, 0xfe, 0x55, 0xe4, 0x45, 0x8e, 0xae, 0xfb, 0x65,
+    0xa5, 0xe5, 0x52, 0x54, 0xea, 0x4b, 0x95, 0x3f, 0x95, 0x2a, 0x8f, 0xab, 0xaf, 0x55, 0xa5, 0x55,
+    0x51, 0xf9, 0xbf, 0x2a, 0x40, 0x55, 0x55, 0x55, 0xfc, 0x57, 0x95, 0x57, 0x55, 0xe5, 0xab, 0xa8,
+    0x95, 0x79, 0x56, 0x79, 0xa9, 0x16, 0x6a, 0xe5, 0xb9, 0x5f, 0xa5, 0x56, 0x56, 0x5e, 0x95, 0x7e,
+    0xa9, 0x54, 0x52, 0xfa, 0x57, 0x91, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0x51, 0xa9,
+    0x2f, 0x55, 0xfe, 0x54, 0xaa, 0x3c, 0xae, 0xbe, 0x56, 0x95, 0x56, 0x45, 0x55, 0xfe, 0xaa, 0x00,
+    0x55, 0x55, 0x55, 0x15, 0x5f, 0x55, 0x5e, 0x55, 0x95, 0xaf, 0xa2, 0x56, 0xe6, 0x59, 0xe5, 0xa5,
+    0x5a, 0xa8, 0x95, 0xe7, 0x7e, 0x95, 0x5a, 0x59, 0x79, 0x55, 0xfa, 0xa5, 0x52, 0x49, 0xe9, 0x5f,
+    0x45, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x45, 0xa5, 0xbe, 0x54, 0xf9, 0x53, 0xa9,
+    0xf2, 0xb8, 0xfa, 0x5a, 0x55, 0x5a, 0x15, 0x55, 0x95, 0xab, 0x02, 0x54, 0x55, 0x55, 0x55, 0x45,
+    0x55, 0xf9, 0xe7, 0x7b, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x9f, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb,
+    0x55, 0xaa, 0x67, 0xe5, 0xee, 0xeb, 0x97, 0xaa, 0x27, 0xa5, 0xff, 0xff, 0x79, 0x91, 0xa3, 0xeb,
+    0x7e, 0x59, 0x69, 0xb9, 0x14, 0xbe, 0xfa, 0xee, 0xef, 0x4f, 0xa5, 0xca, 0xe3, 0xea, 0xab, 0xff,
+    0x6b, 0xee, 0xfa, 0xee, 0xae, 0xaa, 0xca, 0xff, 0xff, 0xff, 0xff, 0x55, 0xe5, 0x9f, 0xef, 0xf9,
+    0xaa, 0x6a, 0x65, 0xbe, 0x7e, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x9e, 0x95, 0xbb,
+    0xaf, 0x5f, 0xaa, 0x9e, 0x94, 0xfe, 0xff, 0xe7, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52,
+    0xf8, 0xea, 0xbb, 0xbf, 0x3f, 0x95, 0x2a, 0x8f, 0xab, 0xaf, 0xfe, 0xaf, 0x99, 0xeb, 0xbb, 0xbb,
+    0xaa, 0x6a, 0xfc, 0xff, 0xff, 0xff, 0x57, 0x95, 0x7f, 0xbe, 0xe7, 0xab, 0xaa, 0x95, 0xf9, 0xfa,
+    0x79, 0xa9, 0xfa, 0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x7a, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0x7a, 0x52,
+    0xfa, 0xff, 0x9f, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0xe1, 0xab, 0xef, 0xfe, 0xfe,
+    0x54, 0xaa, 0x3c, 0xae, 0xbe, 0xfa, 0xbf, 0x56, 0xae, 0xef, 0xee, 0xaa, 0xaa, 0xc5, 0xff, 0xff,
+    0xff, 0x5f, 0x55, 0xfe, 0xf9, 0x9e, 0xaf, 0xaa, 0x56, 0xe6, 0xeb, 0xe7, 0xa5, 0xea, 0xab, 0x95,
+    0xef, 0x7e, 0x95, 0xea, 0x59, 0xb9, 0xfb, 0xfa, 0xa5, 0xea, 0x49, 0xe9, 0xff, 0x7f, 0x5e, 0xe4,
+    0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x85, 0xaf, 0xbe, 0xfb, 0xfb, 0x53, 0xa9, 0xf2, 0xb8, 0xfa,
+    0xea, 0xff, 0x5a, 0x99, 0xbe, 0xbb, 0xab, 0xaa, 0x56, 0xfc, 0xff, 0xff, 0x7f, 0x55, 0xf9, 0xe7,
+    0x7b, 0xbe, 0xaa, 0x5a, 0x99, 0xaf, 0x9f, 0x97, 0xaa, 0xaf, 0x56, 0xbe, 0xfb, 0x55, 0xaa, 0x67,
+    0xe5, 0xee, 0xeb, 0x97, 0xaa, 0x27, 0xa5, 0xff, 0xff, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69,
+    0xb9, 0x14, 0xbe, 0xfa, 0xee, 0xef, 0x4f, 0xa5, 0xca, 0xe3, 0xea, 0xab, 0xff, 0x6b, 0x55, 0xfa,
+    0xee, 0xae, 0xaa, 0x5a, 0xc5, 0xff, 0xff, 0xff, 0x55, 0xe5, 0x9f, 0x6f, 0xf9, 0xaa, 0x6a, 0x65,
+    0xbe, 0x5e, 0x5e, 0xaa, 0xbe, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x96, 0x95, 0xbb, 0xaf, 0x5f, 0xaa,
+    0x96, 0x94, 0xfe, 0xff, 0xe7, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0xf8, 0xea, 0xbb,
+    0x9f, 0x3f, 0x95, 0x2a, 0x8f, 0xab, 0xaf, 0xfe, 0xa7, 0x55, 0xe9, 0xbb, 0xbb, 0xaa, 0x6a, 0x55,
+    0xfc, 0xff, 0xff, 0x57, 0x95, 0x7f, 0x7e, 0xe5, 0xab, 0xaa, 0x95, 0xf9, 0x5a, 0x79, 0xa9, 0xfa,
+    0x6a, 0xe5, 0xbb, 0x5f, 0xa5, 0x56, 0x56, 0xee, 0xbe, 0x7e, 0xa9, 0x56, 0x52, 0xfa, 0xff, 0x9f,
+    0x17, 0x39, 0xba, 0xee, 0x97, 0x95, 0x96, 0x4b, 0xe1, 0xa9, 0xef, 0x7e, 0xfe, 0x54, 0xaa, 0x3c,
+    0xae, 0xbe, 0xfa, 0x97, 0x56, 0xa5, 0xef, 0xee, 0xaa, 0xaa, 0x55, 0xc5, 0xff, 0xff, 0x5f, 0x55,
+    0xfe, 0x79, 0x95, 0xaf, 0xaa, 0x56, 0xe6, 0x5b, 0xe5, 0xa5, 0xea, 0xab, 0x95, 0xef, 0x7e, 0x95,
+    0x5a, 0x59, 0xb9, 0x7b, 0xfa, 0xa5, 0x5a, 0x49, 0xe9, 0xff, 0x4f, 0x5e, 0xe4, 0xe8, 0xba, 0x5f,
+    0x56, 0x5a, 0x2e, 0x85, 0xa5, 0xbe, 0xfb, 0xf9, 0x53, 0xa9, 0xf2, 0xb8, 0xfa, 0xea, 0x57, 0x5a,
+    0x95, 0xbe, 0xbb, 0xab, 0xaa, 0x56, 0x55, 0xfc, 0xff, 0x7f, 0x55, 0xf9, 0x67, 0x55, 0xbe, 0xaa,
+    0x5a, 0x99, 0x6f, 0x95, 0x97, 0xaa, 0xa3, 0x56, 0xbe, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0x6e, 0xe9,
+    0x97, 0x6a, 0x25, 0xa5, 0xff, 0x1f, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0x95,
+    0xfa, 0xee, 0xe7, 0x4f, 0xa5, 0xca, 0xe3, 0xea, 0xab, 0x57, 0x69, 0x55, 0xfa, 0xee, 0xae, 0xaa,
+    0x5a, 0x55, 0xc5, 0xff, 0xff, 0x55, 0xe5, 0x9f, 0x55, 0xf9, 0xaa, 0x6a, 0x65, 0xbe, 0x55, 0x5e,
+    0xaa, 0x8e, 0x5a, 0xf9, 0xee, 0x57, 0xa9, 0x95, 0x95, 0xbb, 0xa5, 0x5f, 0xaa, 0x95, 0x94, 0xfe,
+    0x7f, 0xe4, 0x45, 0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0x8b, 0x9f, 0x3f, 0x95,
+    0x2a, 0x8f, 0xab, 0xaf, 0x56, 0xa5, 0x55, 0xe9, 0xbb, 0xbb, 0xaa, 0x6a, 0x55, 0x55, 0xfc, 0xff,
+    0x57, 0x95, 0x7f, 0x56, 0xe5, 0xab, 0xaa, 0x95, 0xf9, 0x56, 0x79, 0xa9, 0x3a, 0x6a, 0xe5, 0xbb,
+    0x5f, 0xa5, 0x56, 0x56, 0xee, 0x96, 0x7e, 0xa9, 0x56, 0x52, 0xfa, 0xff, 0x91, 0x17, 0x39, 0xba,
+    0xee, 0x97, 0x95, 0x96, 0x4b, 0x51, 0xa9, 0x2f, 0x7e, 0xfe, 0x54, 0xaa, 0x3c, 0xae, 0xbe, 0x56,
+    0x95, 0x56, 0xa5, 0xef, 0xee, 0xaa, 0xaa, 0x55, 0x55, 0xc5, 0xff, 0x5f, 0x55, 0xfe, 0x55, 0x95,
+    0xaf, 0xaa, 0x56, 0xe6, 0x5b, 0xe5, 0xa5, 0x6a, 0xa8, 0x95, 0xef, 0x7e, 0x95, 0x5a, 0x59, 0xb9,
+    0x57, 0xfa, 0xa5, 0x5a, 0x49, 0xe9, 0xff, 0x45, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e,
+    0x45, 0xa5, 0xbe, 0x78, 0xf9, 0x53, 0xa9, 0xf2, 0xb8, 0xfa, 0x5a, 0x55, 0x5a, 0x95, 0x9e, 0xbb,
+    0xab, 0xaa, 0x56, 0x55, 0x55, 0xfc, 0x7f, 0x55, 0xf9, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x99, 0x6f,
+    0x95, 0x97, 0x6a, 0xa1, 0x56, 0xbe, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0x56, 0xe9, 0x97, 0x4a, 0x25,
+    0xa5, 0xff, 0x15, 0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0x95, 0xfa, 0x62, 0xe5,
+    0x4f, 0xa5, 0xca, 0xe3, 0xea, 0x6b, 0x55, 0x69, 0x55, 0x5a, 0xee, 0xae, 0xaa, 0x5a, 0x55, 0x55,
+    0xc5, 0xff, 0x55, 0xe5, 0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x65, 0x9e, 0x55, 0x5e, 0xaa, 0x85, 0x5a,
+    0x79, 0xee, 0x57, 0xa9, 0x95, 0x95, 0x57, 0xa5, 0x5f, 0x2a, 0x95, 0x94, 0xfe, 0x55, 0xe4, 0x45,
+    0x8e, 0xae, 0xfb, 0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0x4b, 0x95, 0x3f, 0x95, 0x2a, 0x8f, 0xab,
+    0xaf, 0x55, 0xa5, 0x55, 0x59, 0xb9, 0xbb, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0xfc, 0x57, 0x95, 0x57,
+    0x55, 0xe5, 0xab, 0xa8, 0x95, 0x79, 0x56, 0x79, 0xa9, 0x16, 0x6a, 0xe5, 0xb9, 0x5f, 0xa5, 0x56,
+    0x56, 0x5e, 0x95, 0x7e, 0xa9, 0x54, 0x52, 0xfa, 0x57, 0x91, 0x17, 0x39, 0xba, 0xee, 0x97, 0x95,
+    0x96, 0x4b, 0x51, 0xa9, 0x2f, 0x55, 0xfe, 0x54, 0xaa, 0x3c, 0xae, 0xbe, 0x56, 0x95, 0x56, 0x65,
+    0x65, 0xee, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xc5, 0x5f, 0x55, 0x5e, 0x55, 0x95, 0xaf, 0xa2, 0x56,
+    0xe6, 0x59, 0xe5, 0xa5, 0x5a, 0xa8, 0x95, 0xe7, 0x7e, 0x95, 0x5a, 0x59, 0x79, 0x55, 0xfa, 0xa5,
+    0x52, 0x49, 0xe9, 0x5f, 0x45, 0x5e, 0xe4, 0xe8, 0xba, 0x5f, 0x56, 0x5a, 0x2e, 0x45, 0xa5, 0xbe,
+    0x54, 0xf9, 0x53, 0xa9, 0xf2, 0xb8, 0xfa, 0x5a, 0x55, 0x5a, 0x95, 0x55, 0xb9, 0xab, 0xaa, 0x56,
+    0x55, 0x55, 0x55, 0x7c, 0x55, 0x79, 0x55, 0x55, 0xbe, 0x8a, 0x5a, 0x99, 0x67, 0x95, 0x97, 0x6a,
+    0xa1, 0x56, 0x9e, 0xfb, 0x55, 0x6a, 0x65, 0xe5, 0x55, 0xe9, 0x97, 0x4a, 0x25, 0xa5, 0x7f, 0x15,
+    0x79, 0x91, 0xa3, 0xeb, 0x7e, 0x59, 0x69, 0xb9, 0x14, 0x95, 0xfa, 0x52, 0xe5, 0x4f, 0xa5, 0xca,
+    0xe3, 0xea, 0x6b, 0x55, 0x69, 0x55, 0x56, 0x65, 0xae, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0xc5, 0x55,
+    0xe5, 0x55, 0x55, 0xf9, 0x2a, 0x6a, 0x65, 0x9e, 0x55, 0x5e, 0xaa, 0x85, 0x5a, 0x79, 0xee, 0x57,
+    0xa9, 0x95, 0x95, 0x57, 0xa5, 0x5f, 0x2a, 0x95, 0x94, 0xfe, 0x55, 0xe4, 0x45, 0x8e, 0xae, 0xfb,
+    0x65, 0xa5, 0xe5, 0x52, 0x54, 0xea, 0x4b, 0x95, 0x3f, 0x95, 0x2a, 0x8f, 0xab, 0xaf, 0x55, 0xa5,
+    0x55, 0x59, 0x55, 0xb9, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0xc5, 0xcf, 0x3f, 0xc0, 0xff, 0x5f, 0xf1, 0xf3, 0x00, 0xfc, 0x70, 0x00, 0xb3, 0xf0, 0xcf,
+    0x0c, 0x3f, 0xc0, 0x0c, 0x0f, 0x31, 0x03, 0x13, 0x43, 0xec, 0x0f, 0x15, 0x0f, 0xff, 0x00, 0x10,
+    0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f,
+    0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0xc7, 0xff, 0xff, 0xff, 0xff, 0x03, 0x15, 0x3f, 0xff,
+    0x00, 0xff, 0x7f, 0xc5, 0xcf, 0x03, 0xf0, 0xc3, 0x01, 0xcc, 0xc2, 0x3f, 0x33, 0xfc, 0x00, 0x33,
+    0x3c, 0xc4, 0x0c, 0x4c, 0x0c, 0xb1, 0x3f, 0x54, 0x3c, 0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0,
+    0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54,
+    0xcc, 0x14, 0xcf, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0x0f, 0x54, 0xfc, 0xfc, 0x03, 0xfc, 0xff, 0x15,
+    0x3f, 0x0f, 0xc0, 0x0f, 0x07, 0x30, 0x0b, 0xff, 0xcc, 0xf0, 0x03, 0xcc, 0xf0, 0x10, 0x33, 0x30,
+    0x31, 0xc4, 0xfe, 0x50, 0xf1, 0xf0, 0x0f, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08,
+    0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x73,
+    0xc5, 0xff, 0xff, 0xff, 0x3f, 0x50, 0xf1, 0xf3, 0x0f, 0xf0, 0xff, 0x57, 0xfc, 0x3c, 0x00, 0x3f,
+    0x1c, 0xc0, 0x2c, 0xfc, 0x33, 0xc3, 0x0f, 0x30, 0xc3, 0x43, 0xcc, 0xc0, 0xc4, 0x10, 0xfb, 0x43,
+    0xc5, 0xc3, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45,
+    0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0xfc, 0xff, 0xff,
+    0xff, 0x40, 0xc5, 0xc7, 0x3f, 0xc0, 0xff, 0x5f, 0xf1, 0xf1, 0x00, 0xfc, 0x70, 0x00, 0xb3, 0xf0,
+    0xcf, 0x0c, 0x3f, 0xc0, 0x0c, 0x0f, 0x31, 0x03, 0x13, 0x53, 0xec, 0x0f, 0x15, 0x07, 0xff, 0x00,
+    0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5,
+    0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0xc5, 0xff, 0xff, 0xff, 0x03, 0x15, 0x17,
+    0xff, 0x00, 0xff, 0x7f, 0xc5, 0xc5, 0x03, 0xf0, 0xc3, 0x01, 0xcc, 0xc2, 0x3f, 0x33, 0xfc, 0x00,
+    0x32, 0x3c, 0xc4, 0x2c, 0x4c, 0x4c, 0xb1, 0x3f, 0x54, 0x14, 0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f,
+    0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50,
+    0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0xfc, 0xff, 0xff, 0x0f, 0x54, 0x54, 0xfc, 0x03, 0xfc, 0xff,
+    0x15, 0x15, 0x0f, 0xc0, 0x0f, 0x07, 0x30, 0x0b, 0xff, 0xcc, 0xf0, 0x03, 0xc8, 0xf0, 0x10, 0xb3,
+    0x30, 0x31, 0xc5, 0xfe, 0x50, 0x51, 0xf0, 0x0f, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3,
+    0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c,
+    0x73, 0x55, 0xc5, 0xff, 0xff, 0x3f, 0x50, 0x51, 0xf1, 0x0f, 0xf0, 0xff, 0x57, 0x54, 0x3c, 0x00,
+    0x3f, 0x1c, 0xc0, 0x2c, 0xfc, 0x32, 0xc3, 0x0f, 0x24, 0xc3, 0x43, 0xcc, 0xc2, 0xc4, 0x14, 0xfb,
+    0x43, 0x55, 0xc1, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33,
+    0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0x55, 0xfc,
+    0xff, 0xff, 0x40, 0x45, 0xc5, 0x1f, 0xc0, 0xff, 0x5f, 0x51, 0xf1, 0x00, 0xfc, 0x70, 0x00, 0xb1,
+    0xf0, 0xcb, 0x0c, 0x3f, 0x90, 0x0c, 0x07, 0x31, 0x0b, 0x13, 0x53, 0xec, 0x07, 0x55, 0x05, 0xff,
+    0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc,
+    0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0xc5, 0xff, 0xff, 0x03, 0x15,
+    0x15, 0x5f, 0x00, 0xff, 0x7f, 0x45, 0xc5, 0x03, 0xf0, 0xc3, 0x01, 0xc4, 0xc2, 0x2f, 0x33, 0xfc,
+    0x40, 0x32, 0x14, 0xc4, 0x2c, 0x4c, 0x4c, 0xb1, 0x17, 0x54, 0x15, 0xfc, 0x03, 0x40, 0x54, 0x15,
+    0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00,
+    0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0x55, 0xfc, 0xff, 0x0f, 0x54, 0x54, 0x5c, 0x01, 0xfc,
+    0xff, 0x15, 0x15, 0x0f, 0xc0, 0x0b, 0x07, 0x14, 0x0b, 0xbf, 0x4c, 0xf0, 0x03, 0xc9, 0x50, 0x10,
+    0xb3, 0x10, 0x31, 0xc5, 0x56, 0x50, 0x55, 0xf0, 0x0f, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00,
+    0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0x53,
+    0x3c, 0x73, 0x55, 0x55, 0xc5, 0xff, 0x3f, 0x50, 0x51, 0x51, 0x05, 0xf0, 0xff, 0x57, 0x54, 0x3c,
+    0x00, 0x27, 0x1c, 0x50, 0x2c, 0xfc, 0x32, 0xc1, 0x0f, 0x24, 0x43, 0x41, 0xcc, 0x42, 0xc4, 0x14,
+    0x57, 0x41, 0x55, 0xc1, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3,
+    0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0x55,
+    0x55, 0xfc, 0xff, 0x40, 0x45, 0x45, 0x15, 0xc0, 0xff, 0x5f, 0x51, 0xf1, 0x00, 0x94, 0x70, 0x40,
+    0xb1, 0xf0, 0xcb, 0x05, 0x3f, 0x90, 0x04, 0x05, 0x31, 0x0b, 0x11, 0x53, 0x5c, 0x05, 0x55, 0x05,
+    0x3f, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20,
+    0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0x55, 0xc5, 0xff, 0x03,
+    0x15, 0x15, 0x55, 0x00, 0xff, 0x7f, 0x45, 0xc5, 0x03, 0x50, 0xc2, 0x01, 0xc5, 0xc2, 0x2f, 0x17,
+    0xfc, 0x40, 0x12, 0x14, 0xc4, 0x2c, 0x44, 0x4c, 0x71, 0x15, 0x54, 0x15, 0xfc, 0x00, 0x40, 0x54,
+    0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c,
+    0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0x55, 0x55, 0xfc, 0x0f, 0x54, 0x54, 0x54, 0x01,
+    0xfc, 0xff, 0x15, 0x15, 0x0f, 0x40, 0x09, 0x07, 0x14, 0x0b, 0xbf, 0x5c, 0xf0, 0x03, 0x49, 0x50,
+    0x10, 0xb3, 0x10, 0x31, 0xc5, 0x55, 0x50, 0x55, 0xf0, 0x03, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f,
+    0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31,
+    0x53, 0x3c, 0x73, 0x55, 0x55, 0x55, 0xc5, 0x3f, 0x50, 0x51, 0x51, 0x05, 0xf0, 0xff, 0x57, 0x54,
+    0x3c, 0x00, 0x25, 0x1c, 0x50, 0x2c, 0xfc, 0x72, 0xc1, 0x0f, 0x24, 0x41, 0x41, 0xcc, 0x42, 0xc4,
+    0x14, 0x57, 0x41, 0x55, 0xc1, 0x0f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc,
+    0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55,
+    0x55, 0x55, 0x55, 0xfc, 0x40, 0x45, 0x45, 0x15, 0xc0, 0xff, 0x5f, 0x51, 0xf1, 0x00, 0x94, 0x70,
+    0x40, 0xb1, 0xf0, 0xcb, 0x05, 0x3f, 0x90, 0x04, 0x05, 0x31, 0x0b, 0x11, 0x53, 0x5c, 0x05, 0x55,
+    0x05, 0x3f, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05,
+    0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0x55, 0x55, 0xc5,
+    0x03, 0x15, 0x15, 0x55, 0x00, 0xff, 0x7f, 0x45, 0xc5, 0x03, 0x50, 0xc2, 0x01, 0xc5, 0xc2, 0x2f,
+    0x17, 0xfc, 0x40, 0x12, 0x14, 0xc4, 0x2c, 0x44, 0x4c, 0x71, 0x15, 0x54, 0x15, 0xfc, 0x00, 0x40,
+    0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff,
+    0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0x55, 0x55, 0x55, 0x0c, 0x54, 0x54, 0x54,
+    0x01, 0xfc, 0xff, 0x15, 0x15, 0x0f, 0x40, 0x09, 0x07, 0x14, 0x0b, 0xbf, 0x5c, 0xf0, 0x03, 0x49,
+    0x50, 0x10, 0xb3, 0x10, 0x31, 0xc5, 0x55, 0x50, 0x55, 0xf0, 0x03, 0x00, 0x51, 0x55, 0x7c, 0xc1,
+    0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51,
+    0x31, 0x53, 0x3c, 0x73, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x51, 0x51, 0x05, 0xf0, 0xff, 0x57,
+    0x54, 0x3c, 0x00, 0x25, 0x1c, 0x50, 0x2c, 0xfc, 0x72, 0xc1, 0x0f, 0x24, 0x41, 0x41, 0xcc, 0x42,
+    0xc4, 0x14, 0x57, 0x41, 0x55, 0xc1, 0x0f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23,
+    0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc,
+    0x95, 0xff, 0xff, 0xff, 0xff, 0x40, 0xc5, 0xff, 0xff, 0xc0, 0xff, 0x5f, 0xf1, 0xf3, 0x00, 0xfc,
+    0x70, 0x00, 0xb3, 0xf0, 0xcf, 0x0c, 0x3f, 0xc0, 0x0c, 0x0f, 0x31, 0x03, 0x13, 0x43, 0xec, 0x0f,
+    0x15, 0x0f, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14,
+    0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0xfe, 0xff,
+    0xff, 0x03, 0x55, 0x15, 0xff, 0x03, 0xff, 0x7f, 0x45, 0xc5, 0x03, 0xf0, 0xc3, 0x01, 0xcc, 0xc2,
+    0x2f, 0x33, 0xfc, 0x40, 0x32, 0x3c, 0xc4, 0x2c, 0x4c, 0x4c, 0xb1, 0x3f, 0x54, 0x15, 0xfc, 0x03,
+    0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17,
+    0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0x55, 0xe5, 0xff, 0x0f, 0x54, 0x55,
+    0x55, 0x01, 0xfc, 0xff, 0x15, 0x15, 0x0f, 0x40, 0x09, 0x07, 0x14, 0x0b, 0xbf, 0x5c, 0xf0, 0x03,
+    0x49, 0x50, 0x10, 0xb3, 0x10, 0x31, 0xc5, 0x55, 0x50, 0x55, 0xf0, 0x03, 0x00, 0x51, 0x55, 0x7c,
+    0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40,
+    0x51, 0x31, 0x53, 0x3c, 0x73, 0xe5, 0xef, 0xbf, 0xff, 0xbf, 0xca, 0xff, 0xff, 0x3f, 0xf0, 0xff,
+    0x57, 0xfc, 0x3c, 0x00, 0x3f, 0x1c, 0xc0, 0x2c, 0xfc, 0x33, 0xc3, 0x0f, 0x30, 0xc3, 0x43, 0xcc,
+    0xc0, 0xc4, 0x10, 0xfb, 0x43, 0xc5, 0xc3, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c,
+    0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1,
+    0xcc, 0x95, 0xbf, 0xff, 0xfe, 0xff, 0x6a, 0xfc, 0xff, 0xff, 0xc0, 0xff, 0x5f, 0xf1, 0xf3, 0x00,
+    0xfc, 0x70, 0x00, 0xb3, 0xf0, 0xcf, 0x0c, 0x3f, 0xc0, 0x0c, 0x0f, 0x31, 0x03, 0x13, 0x43, 0xec,
+    0x0f, 0x15, 0x0f, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf,
+    0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0xfe, 0xfe,
+    0xfb, 0xff, 0xab, 0xc5, 0xff, 0xff, 0x03, 0xff, 0x7f, 0xc5, 0xcf, 0x03, 0xf0, 0xc3, 0x01, 0xcc,
+    0xc2, 0x3f, 0x33, 0xfc, 0x00, 0x33, 0x3c, 0xc4, 0x0c, 0x4c, 0x0c, 0xb1, 0x3f, 0x54, 0x3c, 0xfc,
+    0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0,
+    0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0xf9, 0xfb, 0xef, 0xff, 0xaf, 0x56,
+    0xfc, 0xff, 0x0f, 0xfc, 0xff, 0x15, 0x3f, 0x0f, 0xc0, 0x0f, 0x07, 0x30, 0x0b, 0xff, 0xcc, 0xf0,
+    0x03, 0xcc, 0xf0, 0x10, 0x33, 0x30, 0x31, 0xc4, 0xfe, 0x50, 0xf1, 0xf0, 0x0f, 0x00, 0x51, 0x55,
+    0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00,
+    0x40, 0x51, 0x31, 0x53, 0x3c, 0x73, 0xe5, 0xe7, 0xbf, 0xff, 0xbf, 0x5a, 0xc5, 0xff, 0x3f, 0xf0,
+    0xff, 0x57, 0x7c, 0x3c, 0x00, 0x3f, 0x1c, 0xc0, 0x2c, 0xfc, 0x33, 0xc3, 0x0f, 0x30, 0xc3, 0x43,
+    0xcc, 0xc0, 0xc4, 0x14, 0xfb, 0x43, 0xc5, 0xc1, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00,
+    0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c,
+    0xf1, 0xcc, 0x95, 0x97, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xfc, 0xff, 0xc0, 0xff, 0x5f, 0x71, 0xf1,
+    0x00, 0xfc, 0x70, 0x00, 0xb3, 0xf0, 0xcf, 0x0c, 0x3f, 0x80, 0x0c, 0x0f, 0x31, 0x0b, 0x13, 0x53,
+    0xec, 0x0f, 0x15, 0x05, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf,
+    0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x56,
+    0xfe, 0xfb, 0xff, 0xab, 0x55, 0xc5, 0xff, 0x03, 0xff, 0x7f, 0x45, 0xc5, 0x03, 0xf0, 0xc3, 0x01,
+    0xcc, 0xc2, 0x3f, 0x33, 0xfc, 0x00, 0x32, 0x3c, 0xc4, 0x2c, 0x4c, 0x4c, 0xb1, 0x3f, 0x54, 0x14,
+    0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80,
+    0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf,
+    0x56, 0x55, 0xfc, 0x0f, 0xfc, 0xff, 0x15, 0x15, 0x0f, 0xc0, 0x0f, 0x07, 0x30, 0x0b, 0xbf, 0xcc,
+    0xf0, 0x03, 0xc9, 0xf0, 0x10, 0xb3, 0x30, 0x31, 0xc5, 0xfe, 0x50, 0x55, 0xf0, 0x0f, 0x00, 0x51,
+    0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3,
+    0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x73, 0x55, 0xe5, 0x9f, 0xff, 0xbf, 0x5a, 0x55, 0xc5, 0x3f,
+    0xf0, 0xff, 0x57, 0x54, 0x3c, 0x00, 0x3f, 0x1c, 0x40, 0x2c, 0xfc, 0x32, 0xc3, 0x0f, 0x24, 0xc3,
+    0x41, 0xcc, 0xc2, 0xc4, 0x14, 0xfb, 0x41, 0x55, 0xc1, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f,
+    0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5,
+    0x4c, 0xf1, 0xcc, 0x55, 0x95, 0x5f, 0xfe, 0xff, 0x6a, 0x55, 0x55, 0xfc, 0xc0, 0xff, 0x5f, 0x51,
+    0xf1, 0x00, 0xfc, 0x70, 0x00, 0xb1, 0xf0, 0xcb, 0x0c, 0x3f, 0x90, 0x0c, 0x05, 0x31, 0x0b, 0x13,
+    0x53, 0xec, 0x05, 0x55, 0x05, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30,
+    0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57,
+    0x55, 0x5e, 0xf9, 0xff, 0xab, 0x55, 0x55, 0xc5, 0x03, 0xff, 0x7f, 0x45, 0xc5, 0x03, 0xf0, 0xc2,
+    0x01, 0xc5, 0xc2, 0x2f, 0x13, 0xfc, 0x40, 0x32, 0x14, 0xc4, 0x2c, 0x44, 0x4c, 0xb1, 0x15, 0x54,
+    0x15, 0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14,
+    0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0x59, 0xe5, 0xff,
+    0xaf, 0x56, 0x55, 0x55, 0x0c, 0xfc, 0xff, 0x15, 0x15, 0x0f, 0xc0, 0x09, 0x07, 0x14, 0x0b, 0xbf,
+    0x4c, 0xf0, 0x03, 0xc9, 0x50, 0x10, 0xb3, 0x10, 0x31, 0xc5, 0x55, 0x50, 0x55, 0xf0, 0x0f, 0x00,
+    0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc,
+    0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x73, 0x55, 0x55, 0x95, 0xff, 0xbf, 0x5a, 0x55, 0x55,
+    0x05, 0xf0, 0xff, 0x57, 0x54, 0x3c, 0x00, 0x25, 0x1c, 0x50, 0x2c, 0xfc, 0x72, 0xc1, 0x0f, 0x24,
+    0x41, 0x41, 0xcc, 0x42, 0xc4, 0x14, 0x57, 0x41, 0x55, 0xc1, 0x0f, 0x00, 0x44, 0x55, 0xf1, 0x05,
+    0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45,
+    0xc5, 0x4c, 0xf1, 0xcc, 0x95, 0xbf, 0xff, 0xfe, 0xff, 0x6a, 0xe5, 0xff, 0xff, 0xc0, 0xff, 0x5f,
+    0xf1, 0xff, 0x00, 0xfc, 0x70, 0x00, 0xbf, 0xf0, 0xcf, 0x0c, 0xff, 0xc0, 0x0c, 0x0f, 0x31, 0x03,
+    0x13, 0x43, 0xec, 0x0f, 0x15, 0x0f, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c,
+    0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33,
+    0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x03, 0xff, 0x7f, 0x55, 0xc5, 0x03, 0xf0,
+    0xc3, 0x01, 0xfc, 0xc2, 0x2f, 0x33, 0xfc, 0x43, 0x32, 0x3c, 0xc4, 0x2c, 0x4c, 0x4c, 0xb1, 0x3f,
+    0x54, 0x15, 0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53,
+    0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0x55, 0xe5,
+    0xff, 0xaf, 0x56, 0x55, 0x55, 0x09, 0xfc, 0xff, 0x15, 0x15, 0x0f, 0x40, 0x09, 0x07, 0x14, 0x0b,
+    0xbf, 0x5c, 0xf0, 0x03, 0x49, 0x50, 0x10, 0xb3, 0x10, 0x31, 0xc5, 0x55, 0x50, 0x55, 0xf0, 0x01,
+    0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0x7c, 0x4c, 0x51, 0x00, 0xc2, 0x5f,
+    0xfc, 0xb1, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x71, 0x55, 0x55, 0x95, 0xff, 0xbf, 0x5a, 0x55,
+    0x55, 0x25, 0xc4, 0xff, 0x57, 0x54, 0x2c, 0x40, 0x25, 0x1c, 0x50, 0x2c, 0x7c, 0x62, 0xc1, 0x0f,
+    0x64, 0x41, 0x41, 0xcc, 0x42, 0xc4, 0x16, 0x57, 0x41, 0x55, 0xc1, 0x07, 0x00, 0x44, 0x55, 0xf1,
+    0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x31, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xc7, 0x02, 0x00,
+    0x45, 0xc5, 0x4c, 0xf1, 0xc4, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x6a, 0x55, 0x55, 0x95, 0x50, 0xfc,
+    0x5f, 0x51, 0x91, 0x00, 0x95, 0x70, 0x40, 0xb1, 0x70, 0x89, 0x05, 0x3f, 0x90, 0x05, 0x05, 0x91,
+    0x0b, 0x11, 0x5b, 0x5c, 0x05, 0x55, 0x05, 0x1f, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30,
+    0x8c, 0x30, 0xcf, 0xc7, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x1f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5,
+    0x13, 0x57, 0x55, 0x55, 0xf9, 0xff, 0xab, 0x55, 0x55, 0x55, 0x42, 0xc5, 0x7f, 0x45, 0x45, 0x02,
+    0x54, 0xc2, 0x01, 0xc5, 0xc2, 0x25, 0x16, 0x7c, 0x40, 0x16, 0x14, 0x44, 0x2e, 0x44, 0x6c, 0x71,
+    0x15, 0x54, 0x15, 0x7c, 0x00, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x1f,
+    0x53, 0x14, 0x80, 0xf0, 0x17, 0x7f, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0x4f, 0x5c, 0x55, 0x55,
+    0xe5, 0xff, 0xaf, 0x56, 0x55, 0x55, 0x09, 0x55, 0xfc, 0x15, 0x15, 0x09, 0x50, 0x09, 0x07, 0x14,
+    0x0b, 0x97, 0x58, 0x70, 0x01, 0x59, 0x50, 0x10, 0xb9, 0x10, 0xb1, 0xc5, 0x55, 0x50, 0x55, 0x70,
+    0x01, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0x5c, 0x4c, 0x51, 0x00, 0xc2,
+    0x5f, 0x7c, 0xb1, 0x00, 0x40, 0x51, 0x31, 0x53, 0x1c, 0x71, 0x55, 0x55, 0x95, 0xff, 0xbf, 0x5a,
+    0x55, 0x55, 0x25, 0x54, 0xc5, 0x57, 0x54, 0x24, 0x40, 0x25, 0x1c, 0x50, 0x2c, 0x5c, 0x62, 0x41,
+    0x05, 0x64, 0x41, 0x41, 0xe4, 0x42, 0xc4, 0x16, 0x57, 0x41, 0x55, 0x41, 0x05, 0x00, 0x44, 0x55,
+    0x71, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0x73, 0x31, 0x45, 0x01, 0x08, 0x5f, 0xf1, 0xc5, 0x02,
+    0x00, 0x45, 0xc5, 0x44, 0x71, 0xc4, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x6a, 0x55, 0x55, 0x95, 0x50,
+    0x55, 0x5c, 0x51, 0x91, 0x00, 0x95, 0x70, 0x40, 0xb1, 0x70, 0x89, 0x05, 0x15, 0x90, 0x05, 0x05,
+    0x91, 0x0b, 0x11, 0x5b, 0x5c, 0x05, 0x55, 0x05, 0x15, 0x00, 0x10, 0x55, 0x45, 0x15, 0xfc, 0x00,
+    0x30, 0x8c, 0x10, 0xcf, 0xc5, 0x14, 0x05, 0x20, 0x5c, 0xc5, 0x17, 0x0b, 0x00, 0x14, 0x15, 0x13,
+    0xc5, 0x11, 0x57, 0x55, 0x55, 0xf9, 0xff, 0xab, 0x55, 0x55, 0x55, 0x42, 0x55, 0x45, 0x45, 0x45,
+    0x02, 0x54, 0xc2, 0x01, 0xc5, 0xc2, 0x25, 0x16, 0x54, 0x40, 0x16, 0x14, 0x44, 0x2e, 0x44, 0x6c,
+    0x71, 0x15, 0x54, 0x15, 0x54, 0x00, 0x40, 0x54, 0x15, 0x55, 0xf0, 0x03, 0xc0, 0x30, 0x42, 0x3c,
+    0x17, 0x53, 0x14, 0x80, 0x70, 0x15, 0x5f, 0x2c, 0x00, 0x50, 0x54, 0x4c, 0x14, 0x47, 0x5c, 0xf9,
+    0xfb, 0xef, 0xff, 0xaf, 0x56, 0xfe, 0xfe, 0xaf, 0xfc, 0xff, 0xfc, 0xff, 0x0f, 0xc0, 0x2f, 0x06,
+    0xf0, 0x2b, 0xff, 0xcc, 0xf0, 0x0f, 0xcc, 0xf0, 0x10, 0x33, 0x30, 0x31, 0xcc, 0xfe, 0x50, 0xf1,
+    0xf0, 0x0f, 0x00, 0x51, 0x55, 0xfc, 0xc3, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00,
+    0xc2, 0xff, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73, 0xe5, 0xef, 0xbf, 0xff, 0xbf,
+    0x5a, 0xf9, 0xfb, 0xbf, 0xf2, 0xff, 0xc7, 0xff, 0x3f, 0x00, 0xbf, 0x18, 0xc0, 0xaf, 0xfc, 0x33,
+    0xc3, 0x3f, 0x30, 0xc3, 0x43, 0xcc, 0xc0, 0xc4, 0x30, 0xfb, 0x43, 0xc5, 0xc3, 0x3f, 0x00, 0x44,
+    0x55, 0xf1, 0x0f, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0xff, 0xf3, 0xcf,
+    0x02, 0x00, 0x45, 0xc5, 0xcc, 0xf3, 0xcc, 0x95, 0xbf, 0xff, 0xfe, 0xff, 0x6a, 0xe5, 0xef, 0xff,
+    0xca, 0xff, 0x5f, 0xfc, 0xff, 0x00, 0xfc, 0x62, 0x00, 0xbf, 0xf2, 0xcf, 0x0c, 0xff, 0xc0, 0x0c,
+    0x0f, 0x31, 0x03, 0x13, 0x43, 0xec, 0x0f, 0x15, 0x0f, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x1f, 0xfc,
+    0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc7, 0x3f, 0x0b, 0x00, 0x14, 0x15,
+    0x33, 0xc7, 0x33, 0x57, 0xfe, 0xfe, 0xfb, 0xff, 0xab, 0x95, 0xbf, 0xff, 0x2b, 0xff, 0x7f, 0xc5,
+    0xff, 0x03, 0xf0, 0x8b, 0x01, 0xfc, 0xca, 0x3f, 0x33, 0xfc, 0x03, 0x33, 0x3c, 0xc4, 0x0c, 0x4c,
+    0x0c, 0xb1, 0x3f, 0x54, 0x3c, 0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2,
+    0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c,
+    0xf9, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x7e, 0xfe, 0xaf, 0xfc, 0xff, 0x55, 0xfc, 0x0f, 0xc0, 0x2f,
+    0x06, 0xf0, 0x2b, 0xff, 0xcc, 0xf0, 0x0f, 0xcc, 0xf0, 0x10, 0x33, 0x30, 0x31, 0xc5, 0xfe, 0x50,
+    0x71, 0xf0, 0x0f, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51,
+    0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x73, 0xe5, 0xe5, 0xbf, 0xff,
+    0xbf, 0x5a, 0x79, 0xf9, 0xbf, 0xf2, 0xff, 0x57, 0xc5, 0x3f, 0x00, 0xbf, 0x18, 0xc0, 0xaf, 0xfc,
+    0x33, 0xc3, 0x3f, 0x20, 0xc3, 0x43, 0xcc, 0xc2, 0xc4, 0x14, 0xfb, 0x43, 0x45, 0xc1, 0x3f, 0x00,
+    0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1,
+    0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x95, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x65, 0xe5,
+    0xff, 0xca, 0xff, 0x5f, 0x55, 0xfc, 0x00, 0xfc, 0x62, 0x00, 0xbf, 0xf2, 0xcf, 0x0c, 0xff, 0x80,
+    0x0c, 0x0f, 0x31, 0x0b, 0x13, 0x53, 0xec, 0x0f, 0x15, 0x05, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x17,
+    0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14,
+    0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xff, 0x7f,
+    0x55, 0xc5, 0x03, 0xf0, 0x8b, 0x01, 0xfc, 0xca, 0x2f, 0x33, 0xfc, 0x43, 0x32, 0x3c, 0xc4, 0x2c,
+    0x4c, 0x4c, 0xb1, 0x3f, 0x54, 0x15, 0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30,
+    0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf,
+    0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xec, 0xff, 0x55, 0x55, 0x2c, 0xc0,
+    0x2f, 0x06, 0xf0, 0x2b, 0xbf, 0xcc, 0xf0, 0x0f, 0x49, 0xf0, 0x10, 0xb3, 0x30, 0x31, 0xc5, 0x7e,
+    0x50, 0x55, 0xf0, 0x0f, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c,
+    0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x73, 0x55, 0xe5, 0xbf,
+    0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xff, 0x57, 0x55, 0x85, 0x00, 0xbf, 0x18, 0xc0, 0xaf,
+    0xfc, 0x32, 0xc3, 0x3f, 0x24, 0xc1, 0x43, 0xcc, 0xc2, 0xc4, 0x14, 0x7b, 0x41, 0x55, 0xc1, 0x3f,
+    0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f,
+    0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x6a, 0x55,
+    0x55, 0x95, 0x50, 0xfe, 0x5f, 0x51, 0x91, 0x00, 0x95, 0x70, 0x40, 0xb1, 0x50, 0x99, 0x05, 0xff,
+    0x90, 0x05, 0x05, 0x91, 0x0b, 0x11, 0x5b, 0x5c, 0x05, 0x55, 0x05, 0x1f, 0x00, 0x10, 0x55, 0xc5,
+    0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xc7, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x1f, 0x0b, 0x00,
+    0x14, 0x15, 0x33, 0xc5, 0x13, 0x57, 0x55, 0x55, 0xf9, 0xff, 0xab, 0x55, 0x55, 0x55, 0x42, 0x55,
+    0x79, 0x45, 0x45, 0x02, 0x54, 0xc2, 0x01, 0x85, 0xc2, 0x25, 0x16, 0x55, 0x40, 0x16, 0x14, 0x44,
+    0x2e, 0x44, 0x6c, 0x61, 0x15, 0x54, 0x15, 0x55, 0x00, 0x40, 0x54, 0x15, 0x55, 0xf0, 0x03, 0xc0,
+    0x30, 0x42, 0x3c, 0x17, 0x53, 0x14, 0x80, 0x50, 0x15, 0x5f, 0x2c, 0x00, 0x50, 0x54, 0x44, 0x14,
+    0x47, 0x5c, 0xf9, 0xfb, 0xef, 0xff, 0xaf, 0x56, 0xfe, 0xfe, 0xaf, 0xfc, 0xff, 0xf9, 0xff, 0x0f,
+    0xc0, 0x2f, 0x06, 0xf0, 0x2b, 0xff, 0xcc, 0xf0, 0x0f, 0xcc, 0xf0, 0x10, 0x33, 0x30, 0x31, 0xfc,
+    0xfe, 0x53, 0xf1, 0xf0, 0x0f, 0x00, 0x53, 0x55, 0xfc, 0xc3, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc,
+    0x4c, 0x51, 0x00, 0xc2, 0xff, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73, 0x55, 0xe5,
+    0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0xf2, 0xff, 0x57, 0x55, 0x3e, 0x00, 0xbf, 0x18, 0xc0,
+    0xaf, 0x7c, 0x32, 0xc3, 0x3f, 0x24, 0xcf, 0x43, 0xcc, 0xc2, 0xc7, 0x16, 0xfb, 0x4f, 0x55, 0xc1,
+    0x3f, 0x00, 0x4c, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08,
+    0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a,
+    0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x5f, 0x55, 0x95, 0x02, 0xfc, 0x62, 0x00, 0xbf, 0xf2, 0x89, 0x0c,
+    0xff, 0x90, 0x05, 0x0f, 0x31, 0x0b, 0x13, 0x5b, 0xec, 0x05, 0x55, 0x05, 0xff, 0x00, 0x10, 0x55,
+    0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b,
+    0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x6a,
+    0xf9, 0x7f, 0x55, 0x55, 0x0a, 0xc4, 0x8b, 0x01, 0xfc, 0xca, 0x25, 0x32, 0xfc, 0x43, 0x16, 0x3c,
+    0x44, 0x2e, 0x4c, 0x6c, 0xb1, 0x17, 0x54, 0x15, 0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03,
+    0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc,
+    0x14, 0xcf, 0x5c, 0x55, 0xf9, 0xe7, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xa9, 0xe5, 0xff, 0x55, 0x55,
+    0x29, 0x50, 0x2c, 0x06, 0xf0, 0x2b, 0x97, 0x48, 0xf0, 0x0f, 0x59, 0xf0, 0x10, 0xb9, 0x10, 0xb1,
+    0xc5, 0x56, 0x50, 0x55, 0xf0, 0x0f, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3,
+    0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x73, 0x55,
+    0xe5, 0x97, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xa5, 0x96, 0xff, 0x57, 0x55, 0xa5, 0x40, 0x85, 0x18,
+    0xc0, 0xaf, 0x5c, 0x22, 0xc1, 0x3f, 0x64, 0xc1, 0x43, 0xe4, 0x42, 0xc4, 0x16, 0x57, 0x41, 0x55,
+    0xc1, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01,
+    0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0x55, 0x55, 0xfe, 0xff,
+    0x6a, 0x55, 0x55, 0x95, 0x50, 0xfe, 0x5f, 0x55, 0x95, 0x02, 0x95, 0x60, 0x40, 0xb1, 0x52, 0x99,
+    0x05, 0xff, 0x90, 0x05, 0x05, 0x91, 0x0b, 0x11, 0x5b, 0x5c, 0x05, 0x55, 0x05, 0x1f, 0x00, 0x10,
+    0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xc7, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x1f,
+    0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x13, 0x57, 0x55, 0x55, 0xf9, 0xff, 0xab, 0x55, 0x55, 0x55,
+    0x42, 0x55, 0x79, 0x45, 0x45, 0x22, 0x54, 0xc2, 0x01, 0x85, 0xc2, 0x25, 0x16, 0x55, 0x40, 0x16,
+    0x15, 0x44, 0x2e, 0x45, 0x6c, 0x61, 0x15, 0x54, 0x15, 0x55, 0x00, 0x40, 0x54, 0x55, 0x55, 0xf0,
+    0x03, 0xc0, 0x30, 0x42, 0x3c, 0x17, 0x53, 0x14, 0x80, 0x50, 0x15, 0x5f, 0x2c, 0x00, 0x50, 0x54,
+    0x44, 0x14, 0x47, 0x5c, 0x55, 0x55, 0xe5, 0xff, 0xaf, 0x56, 0x55, 0x55, 0x09, 0x55, 0xe5, 0x15,
+    0x15, 0x89, 0x50, 0x49, 0x04, 0x54, 0x0a, 0x95, 0x59, 0x54, 0x01, 0x59, 0x54, 0x10, 0xb9, 0x14,
+    0xb1, 0x85, 0x55, 0x50, 0x55, 0x54, 0x01, 0x00, 0x51, 0x55, 0x55, 0xc1, 0x0f, 0x00, 0xc3, 0x08,
+    0xf1, 0x5c, 0x4c, 0x51, 0x00, 0x42, 0x55, 0x7c, 0xb1, 0x00, 0x40, 0x51, 0x11, 0x51, 0x1c, 0x71,
+    0xe5, 0xef, 0xbf, 0xff, 0xbf, 0x5a, 0xf9, 0xfb, 0xbf, 0xf2, 0xff, 0xe7, 0xff, 0x3f, 0x08, 0xbf,
+    0xc8, 0xc0, 0xaf, 0xfc, 0x33, 0xc3, 0x3f, 0x30, 0xc3, 0x43, 0xcc, 0xc8, 0xc8, 0xf0, 0xfb, 0x4f,
+    0xc5, 0xc3, 0x3f, 0x00, 0x7c, 0x55, 0xf1, 0x0f, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45,
+    0x01, 0x08, 0xff, 0xf3, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0xcc, 0xf3, 0xcc, 0x95, 0xbf, 0xff, 0xfe,
+    0xff, 0x6a, 0xe5, 0xef, 0xff, 0xca, 0xff, 0x9f, 0xff, 0xff, 0x20, 0xfc, 0x62, 0x00, 0xbf, 0xf2,
+    0xcf, 0x0c, 0xff, 0xc0, 0x0c, 0x0f, 0x31, 0x23, 0x23, 0xc3, 0xef, 0x3f, 0x15, 0x0f, 0xff, 0x00,
+    0xf0, 0x55, 0xc5, 0x3f, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xcf,
+    0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xcf, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95,
+    0xff, 0x2b, 0xff, 0x7f, 0x55, 0xe5, 0x03, 0xf2, 0x8b, 0x01, 0xfc, 0xca, 0x25, 0xfb, 0xfc, 0x43,
+    0xf2, 0xfc, 0x44, 0x2e, 0xbc, 0x6c, 0xb1, 0xff, 0x54, 0x15, 0xfc, 0x03, 0xc0, 0x57, 0x15, 0x5f,
+    0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50,
+    0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xab, 0xe5, 0xff,
+    0x55, 0x55, 0x29, 0x90, 0x2f, 0x06, 0xf0, 0x2b, 0x95, 0xc9, 0xf3, 0x0f, 0x59, 0xf0, 0x13, 0xb9,
+    0x30, 0xb1, 0xc5, 0x7e, 0x50, 0x55, 0xf0, 0x0f, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3,
+    0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c,
+    0x73, 0x55, 0xe5, 0x95, 0xff, 0xbf, 0x5a, 0x55, 0x79, 0xa5, 0x96, 0xff, 0x57, 0x55, 0xa5, 0x40,
+    0xa5, 0x18, 0xc0, 0xaf, 0x54, 0x66, 0xc1, 0x3f, 0x64, 0xc1, 0x43, 0xe4, 0x42, 0xc4, 0x16, 0x57,
+    0x41, 0x55, 0xc1, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33,
+    0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0x95, 0x55,
+    0xfe, 0xff, 0x6a, 0x55, 0x65, 0x95, 0x5a, 0xfe, 0x5f, 0x55, 0x95, 0x02, 0x95, 0x62, 0x40, 0xbc,
+    0x52, 0x99, 0x05, 0xff, 0x90, 0x05, 0x07, 0x91, 0x0b, 0x11, 0x5b, 0x5c, 0x05, 0x55, 0x05, 0x3f,
+    0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc,
+    0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0x55, 0xf9, 0xff, 0xab, 0x55,
+    0x55, 0x55, 0x6a, 0xf9, 0x7f, 0x55, 0x55, 0x0a, 0x54, 0x8a, 0x01, 0xc5, 0x4a, 0x65, 0x16, 0xfc,
+    0x43, 0x16, 0x14, 0x44, 0x2e, 0x44, 0x6c, 0x71, 0x15, 0x54, 0x15, 0x7c, 0x00, 0x40, 0x54, 0x15,
+    0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x1f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0x7f, 0x2c, 0x00,
+    0x50, 0x54, 0xcc, 0x14, 0x4f, 0x5c, 0x55, 0x55, 0xe5, 0xff, 0xaf, 0x56, 0x55, 0x55, 0xa9, 0xe5,
+    0xff, 0x55, 0x55, 0x29, 0x50, 0x69, 0x06, 0x54, 0x28, 0x95, 0x59, 0xf0, 0x0f, 0x59, 0x50, 0x10,
+    0xb9, 0x10, 0xb1, 0xc5, 0x55, 0x50, 0x55, 0x70, 0x01, 0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00,
+    0xc3, 0x08, 0xf3, 0x5c, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0x7c, 0xb1, 0x00, 0x40, 0x51, 0x31, 0x53,
+    0x1c, 0x71, 0x55, 0x55, 0x95, 0xff, 0xbf, 0x5a, 0x55, 0x55, 0xa5, 0x96, 0x97, 0x57, 0x55, 0xa5,
+    0x42, 0xa5, 0x19, 0x50, 0x89, 0x54, 0x66, 0x51, 0x3c, 0x64, 0x51, 0x41, 0xe4, 0x52, 0xc4, 0x16,
+    0x56, 0x41, 0x55, 0x51, 0x05, 0x00, 0x44, 0x55, 0x51, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xc4, 0x73,
+    0x31, 0x45, 0x01, 0x08, 0x55, 0xf1, 0xc5, 0x02, 0x00, 0x45, 0x45, 0x44, 0x71, 0xc4, 0x55, 0x55,
+    0x55, 0xfe, 0xff, 0x6a, 0x55, 0x55, 0x95, 0x50, 0x55, 0x5e, 0x55, 0x95, 0x08, 0x95, 0x66, 0x40,
+    0xa5, 0x50, 0x99, 0x45, 0x15, 0x90, 0x45, 0x05, 0x91, 0x4b, 0x11, 0x5b, 0x58, 0x05, 0x55, 0x45,
+    0x15, 0x00, 0x10, 0x55, 0x55, 0x15, 0xfc, 0x00, 0x30, 0x8c, 0x10, 0xcf, 0xc5, 0x14, 0x05, 0x20,
+    0x54, 0xc5, 0x17, 0x0b, 0x00, 0x14, 0x15, 0x11, 0xc5, 0x11, 0x57, 0xfe, 0xfe, 0xfb, 0xff, 0xab,
+    0x95, 0xbf, 0xff, 0x2b, 0xff, 0x7f, 0xfe, 0xff, 0x83, 0xf0, 0x8b, 0x09, 0xfc, 0xca, 0x3f, 0x32,
+    0xfc, 0x03, 0xfb, 0x3c, 0xc4, 0x8c, 0xbc, 0x0f, 0xbf, 0xff, 0x54, 0x3c, 0xfc, 0x03, 0xc0, 0x57,
+    0x15, 0xff, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x3f, 0xff, 0x2c,
+    0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf, 0x5c, 0xf9, 0xfb, 0xef, 0xff, 0xaf, 0x56, 0xfe, 0xfe, 0xaf,
+    0xfc, 0xff, 0xf9, 0xff, 0x0f, 0xc2, 0x2f, 0x26, 0xf0, 0x6b, 0xfc, 0xe8, 0xf3, 0x0e, 0xec, 0xf3,
+    0x1b, 0x31, 0xf2, 0x3e, 0xfc, 0xfe, 0x53, 0xf1, 0xf0, 0x0f, 0x00, 0x5f, 0x55, 0xfc, 0xc3, 0x0f,
+    0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0xff, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31,
+    0xf3, 0x3c, 0x73, 0xe5, 0xef, 0xbf, 0xff, 0xbf, 0x5a, 0xf9, 0xfb, 0xbf, 0xb2, 0xff, 0xe7, 0xff,
+    0xbf, 0x08, 0xae, 0x98, 0xe8, 0xaf, 0xc5, 0xa7, 0xcf, 0x3b, 0xb0, 0xcf, 0x6f, 0xc4, 0xc8, 0xfb,
+    0xf0, 0xfb, 0x4f, 0xc5, 0xc3, 0x3f, 0x00, 0x7c, 0x55, 0xf1, 0x0f, 0x3f, 0x00, 0x0c, 0x23, 0xcc,
+    0xf3, 0x33, 0x45, 0x01, 0x08, 0xff, 0xf3, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0xcc, 0xf3, 0xcc, 0x95,
+    0xbf, 0xff, 0xfe, 0xff, 0x6a, 0xe5, 0xef, 0xff, 0x4a, 0xfe, 0x9f, 0xff, 0xff, 0x22, 0xb8, 0x62,
+    0xaa, 0xbf, 0x56, 0x9c, 0x3e, 0xef, 0xc0, 0x3e, 0xbf, 0x11, 0x23, 0xef, 0xc3, 0xef, 0x3f, 0x15,
+    0x07, 0xff, 0x00, 0xf0, 0x55, 0xc5, 0x3f, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05,
+    0x20, 0xfc, 0xcf, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xcf, 0x33, 0x57, 0xfe, 0xfe, 0xfb, 0xff,
+    0xab, 0x95, 0xbf, 0xff, 0x2b, 0xf9, 0x7f, 0xfe, 0xef, 0x8a, 0xe6, 0x8a, 0xa9, 0xfe, 0x5a, 0x45,
+    0xfa, 0xbc, 0x03, 0xfb, 0xfc, 0x46, 0x8c, 0xbc, 0x0f, 0xbf, 0xff, 0x54, 0x14, 0xfc, 0x03, 0xc0,
+    0x57, 0x15, 0xff, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x3f, 0xff,
+    0x2c, 0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe,
+    0xaf, 0xec, 0xff, 0x55, 0x95, 0x2f, 0x88, 0x2b, 0x86, 0xfa, 0x2b, 0x95, 0xec, 0xf3, 0x0f, 0xc9,
+    0xf3, 0x13, 0xb9, 0xf0, 0xb2, 0xc5, 0xfe, 0x53, 0x55, 0xf0, 0x0f, 0x00, 0x5f, 0x55, 0x7c, 0xc1,
+    0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51,
+    0x31, 0x53, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xff, 0x57,
+    0x55, 0xbe, 0x20, 0xae, 0x18, 0xea, 0xaf, 0x54, 0x86, 0xcf, 0x3f, 0x24, 0xcf, 0x4f, 0xe5, 0xc2,
+    0xcb, 0x16, 0xfb, 0x4f, 0x55, 0xc1, 0x3f, 0x00, 0x7c, 0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23,
+    0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc,
+    0x55, 0x95, 0x7f, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0x9f, 0x5a, 0xfe, 0x5f, 0x55, 0x95, 0x02, 0xb9,
+    0x62, 0xa8, 0xbf, 0x52, 0x99, 0x3c, 0xff, 0x90, 0x05, 0x3f, 0x95, 0x0b, 0x13, 0x5b, 0xec, 0x07,
+    0x55, 0x05, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14,
+    0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0x7e, 0xf9,
+    0xff, 0xab, 0x55, 0x95, 0x5f, 0x6a, 0xf9, 0x7f, 0x55, 0x55, 0x0a, 0x64, 0x8a, 0xa1, 0xfe, 0x4a,
+    0x65, 0xc6, 0xfc, 0x43, 0x16, 0xfc, 0x54, 0x2e, 0x44, 0x6c, 0xb1, 0x17, 0x54, 0x15, 0xfc, 0x03,
+    0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17,
+    0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0x79, 0xe5, 0xff, 0xaf, 0x56, 0x55,
+    0x5e, 0xa9, 0xe5, 0xff, 0x55, 0x55, 0x29, 0x50, 0x29, 0x86, 0xfa, 0x2b, 0x95, 0x59, 0xf0, 0x0f,
+    0x59, 0xf0, 0x53, 0xb9, 0x10, 0xb1, 0xc5, 0x56, 0x50, 0x55, 0xf0, 0x0f, 0x00, 0x51, 0x55, 0x7c,
+    0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40,
+    0x51, 0x31, 0x53, 0x3c, 0x73, 0x55, 0x55, 0x95, 0xff, 0xbf, 0x5a, 0x55, 0x55, 0xa5, 0x96, 0xbf,
+    0x57, 0x55, 0xa5, 0x42, 0xa5, 0x19, 0x50, 0xa9, 0x54, 0x66, 0xc1, 0x3f, 0x64, 0x51, 0x41, 0xe4,
+    0x52, 0xc4, 0x16, 0x57, 0x41, 0x55, 0x41, 0x05, 0x00, 0x44, 0x55, 0x71, 0x05, 0x3f, 0x00, 0x0c,
+    0x23, 0xcc, 0x73, 0x31, 0x45, 0x01, 0x08, 0x5f, 0xf1, 0xc5, 0x02, 0x00, 0x45, 0xc5, 0x44, 0x71,
+    0xc4, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x6a, 0x55, 0x55, 0x95, 0x5a, 0x7e, 0x5e, 0x55, 0x95, 0x0a,
+    0x95, 0x66, 0x40, 0xa5, 0x52, 0x99, 0x45, 0xfc, 0x90, 0x45, 0x05, 0x91, 0x4b, 0x11, 0x5b, 0x5c,
+    0x05, 0x55, 0x05, 0x15, 0x00, 0x10, 0x55, 0x45, 0x15, 0xfc, 0x00, 0x30, 0x8c, 0x10, 0xcf, 0xc5,
+    0x14, 0x05, 0x20, 0x5c, 0xc5, 0x17, 0x0b, 0x00, 0x14, 0x15, 0x13, 0xc5, 0x11, 0x57, 0x55, 0x55,
+    0xf9, 0xff, 0xab, 0x55, 0x55, 0x55, 0x6a, 0x79, 0x79, 0x55, 0x55, 0x2a, 0x54, 0x9a, 0x01, 0x95,
+    0x4a, 0x65, 0x16, 0xc5, 0x43, 0x16, 0x15, 0x44, 0x2e, 0x45, 0x6c, 0x61, 0x15, 0x54, 0x15, 0x55,
+    0x00, 0x40, 0x54, 0x15, 0x55, 0xf0, 0x03, 0xc0, 0x30, 0x42, 0x3c, 0x17, 0x53, 0x14, 0x80, 0x50,
+    0x15, 0x5f, 0x2c, 0x00, 0x50, 0x54, 0x44, 0x14, 0x47, 0x5c, 0x55, 0x55, 0xe5, 0xff, 0xaf, 0x56,
+    0x55, 0x55, 0xa9, 0x65, 0xe5, 0x55, 0x55, 0xa9, 0x50, 0x69, 0x06, 0x54, 0x2a, 0x95, 0x59, 0x54,
+    0x0c, 0x59, 0x54, 0x10, 0xb9, 0x14, 0xb1, 0x85, 0x55, 0x50, 0x55, 0x54, 0x01, 0x00, 0x51, 0x55,
+    0x55, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf1, 0x5c, 0x4c, 0x51, 0x00, 0x42, 0x55, 0x7c, 0xb1, 0x00,
+    0x40, 0x51, 0x11, 0x51, 0x1c, 0x71, 0x55, 0x55, 0x95, 0xff, 0xbf, 0x5a, 0x55, 0x55, 0xa5, 0x56,
+    0x95, 0x57, 0x55, 0xa5, 0x42, 0xa5, 0x19, 0x50, 0xa9, 0x54, 0x66, 0x51, 0x05, 0x64, 0x51, 0x41,
+    0xe4, 0x52, 0xc4, 0x16, 0x56, 0x41, 0x55, 0x51, 0x05, 0x00, 0x44, 0x55, 0x55, 0x05, 0x3f, 0x00,
+    0x0c, 0x23, 0xc4, 0x73, 0x31, 0x45, 0x01, 0x08, 0x55, 0xf1, 0xc5, 0x02, 0x00, 0x45, 0x45, 0x44,
+    0x71, 0xc4, 0x95, 0xbf, 0xff, 0xfe, 0xff, 0x6a, 0xe5, 0xef, 0xff, 0xca, 0xff, 0x9f, 0xff, 0xff,
+    0x20, 0xfc, 0x62, 0x02, 0xbf, 0xfa, 0x8f, 0x0c, 0xff, 0xc0, 0x3e, 0x0f, 0xf1, 0x23, 0xef, 0xc3,
+    0xef, 0x3f, 0x15, 0x3f, 0xff, 0x00, 0xf0, 0x55, 0xc5, 0xff, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf,
+    0xff, 0x14, 0x05, 0x20, 0xfc, 0xcf, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xcf, 0x33, 0x57, 0xfe,
+    0xfe, 0xfb, 0xff, 0xab, 0x95, 0xbf, 0xff, 0x2b, 0xfb, 0x7f, 0xfe, 0xff, 0x8b, 0xe0, 0x8a, 0x89,
+    0xfe, 0x5a, 0x7e, 0xfa, 0xbc, 0x03, 0xfb, 0xfc, 0x56, 0x8c, 0xbc, 0x0f, 0xbf, 0xff, 0x54, 0xfc,
+    0xfc, 0x03, 0xc0, 0x57, 0x15, 0xff, 0xf3, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0xff, 0x53, 0x14, 0x80,
+    0xf0, 0x3f, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf, 0x5c, 0xf9, 0xf9, 0xef, 0xff, 0xaf,
+    0x56, 0x7e, 0xfe, 0xaf, 0xe4, 0xff, 0xf9, 0x9f, 0x2b, 0x9a, 0x2b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9,
+    0xf3, 0x0e, 0xec, 0xf3, 0x1b, 0x31, 0xf2, 0x3e, 0xfc, 0xfe, 0x53, 0x51, 0xf0, 0x0f, 0x00, 0x5f,
+    0x55, 0xfc, 0xc3, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0xff, 0xfc, 0xb3,
+    0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73, 0xe5, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x79, 0xf9, 0xbf,
+    0x92, 0xff, 0xe7, 0x5f, 0xae, 0x68, 0xae, 0x98, 0xea, 0xaf, 0x55, 0xa6, 0xcf, 0x3b, 0x84, 0xcf,
+    0x6f, 0xc4, 0xc8, 0xfb, 0xf0, 0xfb, 0x4f, 0x55, 0xc1, 0x3f, 0x00, 0x7c, 0x55, 0xf1, 0x0f, 0x3f,
+    0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0xff, 0xf3, 0xcf, 0x02, 0x00, 0x45, 0xc5,
+    0xcc, 0xf3, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x5f, 0x55,
+    0xb9, 0x82, 0xb9, 0x62, 0xa8, 0xbf, 0x56, 0x99, 0x3e, 0xff, 0x90, 0x3c, 0x3f, 0x95, 0x0b, 0x2f,
+    0x5b, 0xec, 0x3f, 0x55, 0x05, 0xff, 0x00, 0xf0, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30,
+    0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57,
+    0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x6a, 0xf9, 0x7f, 0x55, 0x65, 0x0a, 0xe6, 0x8a,
+    0xa1, 0xfe, 0x5a, 0x65, 0xfa, 0xfc, 0x43, 0xc6, 0xfc, 0x54, 0x2e, 0x7c, 0x6c, 0xb1, 0xff, 0x54,
+    0x15, 0xfc, 0x03, 0xc0, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14,
+    0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c, 0x55, 0xf9, 0xe7, 0xff,
+    0xaf, 0x56, 0x55, 0xfe, 0xa9, 0xe5, 0xff, 0x55, 0x55, 0x29, 0x98, 0x2b, 0x86, 0xfa, 0x6b, 0x95,
+    0xe9, 0xf3, 0x0f, 0x59, 0xf0, 0x53, 0xb9, 0xf0, 0xb1, 0xc5, 0xfe, 0x50, 0x55, 0xf0, 0x0f, 0x00,
+    0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00, 0xc2, 0x5f, 0xfc,
+    0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x73, 0x55, 0xe5, 0x95, 0xff, 0xbf, 0x5a, 0x55, 0x79,
+    0xa5, 0x96, 0xff, 0x57, 0x55, 0xa5, 0x40, 0xa5, 0x19, 0xea, 0xab, 0x54, 0x66, 0xe9, 0x3f, 0x64,
+    0xc1, 0x4f, 0xe5, 0x52, 0xc4, 0x16, 0x57, 0x41, 0x55, 0xc1, 0x3f, 0x00, 0x44, 0x55, 0xf1, 0x05,
+    0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf, 0x02, 0x00, 0x45,
+    0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0x95, 0x57, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0x95, 0x5a, 0xfe, 0x5e,
+    0x55, 0x95, 0x0a, 0x95, 0x66, 0xa8, 0xa7, 0x52, 0x99, 0xa5, 0xff, 0x90, 0x45, 0x3c, 0x95, 0x4b,
+    0x11, 0x5b, 0x5c, 0x05, 0x55, 0x05, 0x3f, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc, 0x00, 0x30, 0x8c,
+    0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33,
+    0x57, 0x55, 0x56, 0xf9, 0xff, 0xab, 0x55, 0x95, 0x55, 0x6a, 0xf9, 0x7b, 0x55, 0x55, 0x2a, 0x54,
+    0x9a, 0xa1, 0x96, 0x4a, 0x65, 0x96, 0xfe, 0x43, 0x16, 0xc5, 0x54, 0x2e, 0x45, 0x6c, 0x71, 0x15,
+    0x54, 0x15, 0x7c, 0x00, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0x1f, 0x53,
+    0x14, 0x80, 0xf0, 0x17, 0x7f, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0x4f, 0x5c, 0x55, 0x55, 0xe5,
+    0xff, 0xaf, 0x56, 0x55, 0x55, 0xa9, 0xe5, 0xef, 0x55, 0x55, 0xa9, 0x50, 0x69, 0x86, 0x56, 0x2a,
+    0x95, 0x59, 0xfa, 0x0f, 0x59, 0x54, 0x50, 0xb9, 0x14, 0xb1, 0xc5, 0x55, 0x50, 0x55, 0x70, 0x01,
+    0x00, 0x51, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0x5c, 0x4c, 0x51, 0x00, 0xc2, 0x5f,
+    0x7c, 0xb1, 0x00, 0x40, 0x51, 0x31, 0x53, 0x1c, 0x71, 0x55, 0x55, 0x95, 0xff, 0xbf, 0x5a, 0x55,
+    0x55, 0xa5, 0x96, 0x95, 0x57, 0x55, 0xa5, 0x42, 0xa5, 0x19, 0x50, 0xa9, 0x54, 0x66, 0x51, 0x39,
+    0x64, 0x51, 0x41, 0xe5, 0x52, 0xc4, 0x56, 0x56, 0x41, 0x55, 0x51, 0x05, 0x00, 0x44, 0x55, 0x55,
+    0x05, 0x3f, 0x00, 0x0c, 0x23, 0xc4, 0x73, 0x31, 0x45, 0x01, 0x08, 0x55, 0xf1, 0xc5, 0x02, 0x00,
+    0x45, 0x45, 0x44, 0x71, 0xc4, 0x95, 0xbf, 0xff, 0xfe, 0xff, 0x6a, 0xe5, 0xef, 0xff, 0xca, 0xff,
+    0x9f, 0xff, 0xff, 0x20, 0xfc, 0x62, 0x02, 0xbf, 0xba, 0x8f, 0x3e, 0xef, 0xca, 0x3e, 0xbf, 0xfc,
+    0x23, 0xef, 0xe3, 0xef, 0x3f, 0x15, 0x3f, 0xff, 0x00, 0xf0, 0x55, 0xc5, 0xff, 0xfc, 0x00, 0x30,
+    0x8c, 0x30, 0xcf, 0xff, 0x14, 0x05, 0x20, 0xfc, 0xcf, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xcf,
+    0x33, 0x57, 0xfe, 0xfe, 0xfb, 0xff, 0xab, 0x95, 0xbf, 0xff, 0x2b, 0xff, 0x7f, 0xfe, 0xff, 0x83,
+    0xf0, 0x8b, 0x09, 0xfc, 0xea, 0x3e, 0xfa, 0xbc, 0x2b, 0xfb, 0xfc, 0xc6, 0x8f, 0xbc, 0x8f, 0xbf,
+    0xff, 0x54, 0xfc, 0xfc, 0x03, 0xc0, 0x57, 0x15, 0xff, 0xf3, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0xff,
+    0x53, 0x14, 0x80, 0xf0, 0x3f, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf, 0x5c, 0xf9, 0xfb,
+    0xef, 0xff, 0xaf, 0x56, 0xfe, 0xfe, 0xaf, 0xec, 0xff, 0xf9, 0xff, 0x2f, 0x82, 0x2b, 0x26, 0xfa,
+    0xab, 0xf9, 0xe9, 0xf3, 0xae, 0xec, 0xf3, 0x5b, 0x3c, 0xf2, 0x3e, 0xfe, 0xfe, 0x53, 0xf1, 0xf3,
+    0x0f, 0x00, 0x5f, 0x55, 0xfc, 0xcf, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4f, 0x51, 0x00, 0xc2,
+    0xff, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73, 0xe5, 0xef, 0xbf, 0xff, 0xbf, 0x5a,
+    0xf9, 0xfb, 0xbf, 0x92, 0xff, 0xe7, 0xff, 0xbf, 0x08, 0xae, 0x98, 0xea, 0xaf, 0xe5, 0xa7, 0xcf,
+    0xbb, 0xb2, 0xcf, 0x6f, 0xc5, 0xc8, 0xfb, 0xf8, 0xfb, 0x4f, 0xc5, 0xcf, 0x3f, 0x00, 0x7c, 0x55,
+    0xf1, 0x3f, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x3f, 0x45, 0x01, 0x08, 0xff, 0xf3, 0xcf, 0x02,
+    0x00, 0x45, 0xc5, 0xcc, 0xf3, 0xcc, 0x95, 0xbf, 0xff, 0xfe, 0xff, 0x6a, 0xe5, 0xef, 0xff, 0x4a,
+    0xfe, 0x9f, 0xff, 0xff, 0x22, 0xb8, 0x62, 0xaa, 0xbf, 0x96, 0x9f, 0x3e, 0xef, 0xca, 0x3e, 0xbf,
+    0x55, 0x20, 0xef, 0xe3, 0xef, 0x3f, 0x15, 0x3f, 0xff, 0x00, 0xf0, 0x55, 0xc5, 0xff, 0xfc, 0x00,
+    0x30, 0x8c, 0x30, 0xcf, 0xff, 0x14, 0x05, 0x20, 0xfc, 0xcf, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33,
+    0xcf, 0x33, 0x57, 0x56, 0xfe, 0xfb, 0xff, 0xab, 0x95, 0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x7e, 0xe5,
+    0x8a, 0xe6, 0x8a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0xbc, 0x43, 0xfa, 0xfc, 0x46, 0x8c, 0xbc, 0x2f,
+    0xbf, 0xff, 0x54, 0x15, 0xfc, 0x03, 0xc0, 0x57, 0x15, 0xff, 0xf0, 0x03, 0xc0, 0x30, 0xc2, 0x3c,
+    0x3f, 0x53, 0x14, 0x80, 0xf0, 0x3f, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf, 0x5c, 0x55,
+    0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x55, 0x95, 0x2b, 0x98, 0x2b, 0xa6,
+    0xfa, 0x6b, 0x95, 0xe9, 0xf3, 0x0f, 0xe9, 0xf3, 0x53, 0xb9, 0xf0, 0xbe, 0xc5, 0xfe, 0x53, 0x55,
+    0xf0, 0x0f, 0x00, 0x5f, 0x55, 0x7c, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c, 0x51, 0x00,
+    0xc2, 0x5f, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0x53, 0x3c, 0x73, 0x55, 0xe5, 0x9f, 0xff, 0xbf,
+    0x5a, 0x55, 0xf9, 0xa7, 0x96, 0xff, 0x57, 0x55, 0xa5, 0x60, 0xae, 0x19, 0xea, 0xab, 0x55, 0xa6,
+    0xeb, 0x3f, 0x64, 0xe9, 0x4f, 0xe5, 0xc2, 0xc7, 0x16, 0xfb, 0x41, 0x55, 0xc1, 0x3f, 0x00, 0x44,
+    0x55, 0xf1, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0x7f, 0xf1, 0xcf,
+    0x02, 0x00, 0x45, 0xc5, 0x4c, 0xf1, 0xcc, 0x55, 0x95, 0x5f, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0x97,
+    0x5a, 0xfe, 0x5f, 0x55, 0x95, 0x82, 0x99, 0x66, 0xa8, 0xaf, 0x56, 0x99, 0xa6, 0xff, 0x90, 0xa5,
+    0x3f, 0x95, 0x4b, 0x1c, 0x5b, 0xec, 0x05, 0x55, 0x05, 0xff, 0x00, 0x10, 0x55, 0xc5, 0x17, 0xfc,
+    0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15,
+    0x33, 0xc5, 0x33, 0x57, 0x55, 0x5e, 0xf9, 0xff, 0xab, 0x55, 0x95, 0x57, 0x6a, 0xf9, 0x7f, 0x55,
+    0x55, 0x0a, 0x56, 0x9a, 0xa1, 0xbe, 0x5a, 0x65, 0x96, 0xfe, 0x43, 0x96, 0xfe, 0x54, 0x2e, 0x45,
+    0x6c, 0xb1, 0x15, 0x54, 0x15, 0xfc, 0x03, 0x40, 0x54, 0x15, 0x5f, 0xf0, 0x03, 0xc0, 0x30, 0xc2,
+    0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x17, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x14, 0xcf, 0x5c,
+    0x55, 0x55, 0xe5, 0xff, 0xaf, 0x56, 0x55, 0x55, 0xa9, 0x65, 0xe5, 0x55, 0x55, 0xa9, 0x50, 0x69,
+    0xa6, 0x54, 0x6a, 0x95, 0x59, 0x54, 0x0e, 0x69, 0x54, 0x58, 0xb9, 0x16, 0xbc, 0x95, 0x55, 0x50,
+    0x55, 0x54, 0x01, 0x00, 0x53, 0x55, 0x55, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf1, 0x5c, 0x4c, 0x51,
+    0x00, 0x42, 0x55, 0x7c, 0xb1, 0x00, 0x40, 0x51, 0x11, 0x51, 0x1c, 0x71, 0x55, 0x55, 0x95, 0xff,
+    0xbf, 0x5a, 0x55, 0x55, 0xa5, 0x96, 0x95, 0x57, 0x55, 0xa5, 0x42, 0xa5, 0x19, 0x50, 0xa9, 0x55,
+    0x66, 0x51, 0x39, 0x64, 0x51, 0x61, 0xe5, 0x5a, 0xc4, 0x56, 0x56, 0x41, 0x55, 0x51, 0x05, 0x00,
+    0x44, 0x55, 0x55, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xc4, 0x73, 0x31, 0x45, 0x01, 0x08, 0x55, 0xf1,
+    0xc5, 0x02, 0x00, 0x45, 0x45, 0x44, 0x71, 0xc4, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x6a, 0x55, 0x55,
+    0x95, 0x5a, 0x56, 0x5e, 0x55, 0x95, 0x0a, 0x95, 0x66, 0x40, 0xa5, 0x56, 0x99, 0x45, 0xe5, 0x90,
+    0x45, 0x85, 0x95, 0x6b, 0x51, 0x58, 0x59, 0x05, 0x55, 0x45, 0x15, 0x00, 0x10, 0x55, 0x55, 0x15,
+    0xfc, 0x00, 0x30, 0x8c, 0x10, 0xcf, 0xc5, 0x14, 0x05, 0x20, 0x54, 0xc5, 0x17, 0x0b, 0x00, 0x14,
+    0x15, 0x11, 0xc5, 0x11, 0x57, 0xfe, 0xfe, 0xfb, 0xff, 0xab, 0x95, 0xbf, 0xff, 0x2b, 0xf9, 0x7f,
+    0xfe, 0xef, 0x8a, 0xe6, 0x8a, 0xa9, 0xfe, 0x5a, 0x7e, 0xfa, 0xbc, 0x2b, 0xfa, 0xfc, 0x56, 0xae,
+    0xbc, 0x8f, 0xbf, 0xff, 0x54, 0xfc, 0xfc, 0x03, 0xc0, 0x57, 0x15, 0xff, 0xf3, 0x03, 0xc0, 0x30,
+    0xc2, 0x3c, 0xff, 0x53, 0x14, 0x80, 0xf0, 0x3f, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf,
+    0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a,
+    0x2b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0xf3, 0x0e, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfc, 0xfe,
+    0x53, 0x55, 0xf0, 0x0f, 0x00, 0x5f, 0x55, 0xfc, 0xc3, 0x0f, 0x00, 0xc3, 0x08, 0xf3, 0xfc, 0x4c,
+    0x51, 0x00, 0xc2, 0xff, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73, 0x55, 0xe5, 0xbf,
+    0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xff, 0x67, 0x55, 0xae, 0x68, 0xae, 0x98, 0xea, 0xaf,
+    0x55, 0xa6, 0xcf, 0x3b, 0xa4, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xc6, 0xfb, 0x4f, 0x55, 0xc1, 0x3f,
+    0x00, 0x7c, 0x55, 0xf1, 0x07, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x33, 0x45, 0x01, 0x08, 0xff,
+    0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0xcc, 0xf1, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55,
+    0xe5, 0xff, 0x4a, 0xfe, 0x5f, 0x55, 0xb9, 0xa2, 0xb9, 0x62, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xef,
+    0x90, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0x5b, 0xec, 0x3f, 0x55, 0x05, 0xff, 0x00, 0xf0, 0x55, 0xc5,
+    0x17, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00,
+    0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9,
+    0x7f, 0x55, 0xe5, 0x8a, 0xe6, 0x9a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x9c, 0x43, 0xfa, 0xfc, 0x56,
+    0xae, 0xbc, 0x6f, 0x85, 0xff, 0x54, 0x15, 0xfc, 0x03, 0xc0, 0x57, 0x15, 0x57, 0xf0, 0x03, 0xc0,
+    0x30, 0xc2, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0xf0, 0x15, 0xff, 0x2c, 0x00, 0x50, 0x54, 0x4c, 0x14,
+    0xcf, 0x5c, 0x55, 0xf9, 0xe7, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xa9, 0x65, 0xe5, 0x55, 0x95, 0xab,
+    0x9a, 0x6b, 0xa6, 0x56, 0x6a, 0x95, 0xe9, 0x57, 0x0e, 0xe9, 0x53, 0x58, 0xb9, 0xf2, 0xbe, 0x95,
+    0xfc, 0x53, 0x55, 0x54, 0x01, 0x00, 0x5f, 0x55, 0x55, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf1, 0x5c,
+    0x4c, 0x51, 0x00, 0x42, 0x55, 0x7c, 0xb1, 0x00, 0x40, 0x51, 0x11, 0x51, 0x1c, 0x71, 0x55, 0xe5,
+    0x97, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xa5, 0x96, 0x95, 0x57, 0x55, 0xae, 0x6a, 0xa6, 0x99, 0x5a,
+    0xa9, 0x55, 0xa6, 0x53, 0x39, 0xa4, 0x5f, 0x61, 0xe5, 0xca, 0xf8, 0x56, 0xc6, 0x4f, 0x55, 0x51,
+    0x05, 0x00, 0x7c, 0x55, 0x55, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xc4, 0x73, 0x31, 0x45, 0x01, 0x08,
+    0x55, 0xf1, 0xc5, 0x02, 0x00, 0x45, 0x45, 0x44, 0x71, 0xc4, 0x55, 0x95, 0x57, 0xfe, 0xff, 0x6a,
+    0x55, 0xe5, 0x95, 0x5a, 0x56, 0x5e, 0x55, 0xb9, 0xaa, 0x95, 0x66, 0x6a, 0xa5, 0x56, 0x99, 0x46,
+    0xe5, 0x90, 0x7e, 0x85, 0x95, 0x2b, 0xe1, 0x5b, 0x59, 0x3c, 0x55, 0x45, 0x15, 0x00, 0xf0, 0x55,
+    0x55, 0x15, 0xfc, 0x00, 0x30, 0x8c, 0x10, 0xcf, 0xc5, 0x14, 0x05, 0x20, 0x54, 0xc5, 0x17, 0x0b,
+    0x00, 0x14, 0x15, 0x11, 0xc5, 0x11, 0x57, 0x55, 0x56, 0xf9, 0xff, 0xab, 0x55, 0x95, 0x55, 0x6a,
+    0x59, 0x79, 0x55, 0x65, 0xaa, 0x56, 0x9a, 0x29, 0x95, 0x5a, 0x65, 0x16, 0x95, 0x43, 0xfa, 0x15,
+    0x56, 0xae, 0x84, 0x6f, 0x65, 0xc5, 0x54, 0x15, 0x55, 0x00, 0xc0, 0x57, 0x55, 0x55, 0xf0, 0x03,
+    0xc0, 0x30, 0x42, 0x3c, 0x17, 0x53, 0x14, 0x80, 0x50, 0x15, 0x5f, 0x2c, 0x00, 0x50, 0x54, 0x44,
+    0x14, 0x47, 0x5c, 0x55, 0x55, 0xe5, 0xff, 0xaf, 0x56, 0x55, 0x55, 0xa9, 0x65, 0xe5, 0x55, 0x55,
+    0xa9, 0x5a, 0x69, 0xa6, 0x54, 0x6a, 0x95, 0x59, 0x54, 0x0e, 0xe9, 0x54, 0x58, 0xb9, 0x16, 0xbe,
+    0x95, 0x55, 0x50, 0x55, 0x54, 0x01, 0x00, 0x5f, 0x55, 0x55, 0xc1, 0x0f, 0x00, 0xc3, 0x08, 0xf1,
+    0x5c, 0x4c, 0x51, 0x00, 0x42, 0x55, 0x7c, 0xb1, 0x00, 0x40, 0x51, 0x11, 0x51, 0x1c, 0x71, 0x55,
+    0x55, 0x95, 0xff, 0xbf, 0x5a, 0x55, 0x55, 0xa5, 0x96, 0x95, 0x57, 0x55, 0xa5, 0x42, 0xa5, 0x19,
+    0x50, 0xa9, 0x55, 0x66, 0x51, 0x39, 0x64, 0x51, 0x61, 0xe5, 0x5a, 0x94, 0x56, 0x56, 0x41, 0x55,
+    0x51, 0x05, 0x00, 0x45, 0x55, 0x55, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xc4, 0x73, 0x31, 0x45, 0x01,
+    0x08, 0x55, 0xf1, 0xc5, 0x02, 0x00, 0x45, 0x45, 0x44, 0x71, 0xc4, 0x95, 0x9f, 0xff, 0xfe, 0xff,
+    0x6a, 0xe5, 0xe7, 0xff, 0x4a, 0xfe, 0x9f, 0xff, 0xb9, 0xa2, 0xb9, 0x62, 0xaa, 0xbf, 0x96, 0x9f,
+    0x3e, 0xef, 0x8a, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xef, 0x3f, 0xfc, 0x3f, 0xff, 0x00, 0xf0,
+    0x55, 0xc5, 0xff, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xff, 0x14, 0x05, 0x20, 0xfc, 0xcf, 0x3f,
+    0x0b, 0x00, 0x14, 0x15, 0x33, 0xcf, 0x33, 0x57, 0x7e, 0xfe, 0xfb, 0xff, 0xab, 0x95, 0x9f, 0xff,
+    0x2b, 0xf9, 0x7f, 0xfe, 0xe7, 0x8a, 0xe6, 0x8a, 0xa9, 0xfe, 0x5a, 0x7e, 0xfa, 0xbc, 0x2b, 0xfa,
+    0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0xc4, 0xff, 0xfc, 0x03, 0xc0, 0x57, 0x15, 0xff, 0xf3,
+    0x03, 0xc0, 0x30, 0xc2, 0x3c, 0xff, 0x53, 0x14, 0x80, 0xf0, 0x3f, 0xff, 0x2c, 0x00, 0x50, 0x54,
+    0xcc, 0x3c, 0xcf, 0x5c, 0xf9, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x7e, 0xfe, 0xaf, 0xe4, 0xff, 0xf9,
+    0x9f, 0x2b, 0x9a, 0x2b, 0xa6, 0xfa, 0x6b, 0xf9, 0xe9, 0xf3, 0xae, 0xe8, 0xf3, 0x5b, 0xb9, 0xf2,
+    0xbe, 0xfe, 0xfe, 0x53, 0xfc, 0xf3, 0x0f, 0x00, 0x5f, 0x55, 0xfc, 0xcf, 0x0f, 0x00, 0xc3, 0x08,
+    0xf3, 0xfc, 0x4f, 0x51, 0x00, 0xc2, 0xff, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73,
+    0xe5, 0xe7, 0xbf, 0xff, 0xbf, 0x5a, 0xf9, 0xf9, 0xbf, 0x92, 0xff, 0xe7, 0x7f, 0xae, 0x68, 0xae,
+    0x98, 0xea, 0xaf, 0xe5, 0xa7, 0xcf, 0xbb, 0xa2, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xfa, 0xfb, 0x4f,
+    0xc5, 0xcf, 0x3f, 0x00, 0x7c, 0x55, 0xf1, 0x3f, 0x3f, 0x00, 0x0c, 0x23, 0xcc, 0xf3, 0x3f, 0x45,
+    0x01, 0x08, 0xff, 0xf3, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0xcc, 0xf3, 0xcc, 0x95, 0x97, 0xff, 0xfe,
+    0xff, 0x6a, 0xe5, 0xe5, 0xff, 0x4a, 0xfe, 0x9f, 0x7f, 0xb9, 0xa2, 0xb9, 0x62, 0xaa, 0xbf, 0x96,
+    0x9b, 0x3e, 0xef, 0x9a, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xef, 0x3f, 0x55, 0x3c, 0xff, 0x00,
+    0xf0, 0x55, 0xc5, 0xff, 0xfc, 0x00, 0x30, 0x8c, 0x30, 0xcf, 0xff, 0x14, 0x05, 0x20, 0xfc, 0xcf,
+    0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xcf, 0x33, 0x57, 0x56, 0xfe, 0xfb, 0xff, 0xab, 0x95, 0x95,
+    0xff, 0x2b, 0xf9, 0x7f, 0x7e, 0xe5, 0x8a, 0xe6, 0x8a, 0xa9, 0xfe, 0x5a, 0x66, 0xfa, 0xbc, 0x6b,
+    0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54, 0xc5, 0xfc, 0x03, 0xc0, 0x57, 0x15, 0xff,
+    0xf3, 0x03, 0xc0, 0x30, 0xc2, 0x3c, 0xff, 0x53, 0x14, 0x80, 0xf0, 0x3f, 0xff, 0x2c, 0x00, 0x50,
+    0x54, 0xcc, 0x3c, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff,
+    0x79, 0x95, 0x2b, 0x9a, 0x2b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0xf3, 0xae, 0xe9, 0xf3, 0x5b, 0xb9,
+    0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0xf0, 0x0f, 0x00, 0x5f, 0x55, 0xfc, 0xcf, 0x0f, 0x00, 0xc3,
+    0x08, 0xf3, 0xfc, 0x4f, 0x51, 0x00, 0xc2, 0xff, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c,
+    0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xbf, 0x57, 0x55, 0xae, 0x6a,
+    0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0x4f, 0x39, 0xa4, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0x56, 0xfa,
+    0x4f, 0x55, 0xc1, 0x3f, 0x00, 0x7c, 0x55, 0x51, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xc4, 0xf3, 0x33,
+    0x45, 0x01, 0x08, 0x57, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0x44, 0xf1, 0xcc, 0x55, 0x95, 0xff,
+    0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0x7e, 0x5e, 0x55, 0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xbf,
+    0x56, 0x99, 0x3e, 0xe5, 0x90, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0x5b, 0xe9, 0x3f, 0x55, 0x45, 0xfc,
+    0x00, 0xf0, 0x55, 0x45, 0x15, 0xfc, 0x00, 0x30, 0x8c, 0x10, 0xcf, 0xcf, 0x14, 0x05, 0x20, 0x54,
+    0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x11, 0xc5, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55,
+    0x95, 0xff, 0x2b, 0x79, 0x79, 0x55, 0xe5, 0xaa, 0xe6, 0x9a, 0xa9, 0xbe, 0x5a, 0x65, 0xfa, 0x95,
+    0x43, 0xfa, 0x3c, 0x56, 0xae, 0xbc, 0x6f, 0xa5, 0xff, 0x54, 0x15, 0xc5, 0x03, 0xc0, 0x57, 0x55,
+    0x55, 0xf0, 0x03, 0xc0, 0x30, 0x42, 0x3c, 0x3f, 0x53, 0x14, 0x80, 0x50, 0x15, 0xff, 0x2c, 0x00,
+    0x50, 0x54, 0x44, 0x14, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0x64,
+    0xe5, 0x55, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0x7a, 0x6a, 0x95, 0xe9, 0x57, 0x0e, 0xe9, 0x73, 0x58,
+    0xb9, 0xf2, 0xbe, 0x95, 0xfe, 0x53, 0x55, 0x54, 0x0c, 0x00, 0x5f, 0x55, 0x55, 0xc1, 0x0f, 0x00,
+    0xc3, 0x08, 0xf1, 0x7c, 0x4c, 0x51, 0x00, 0x42, 0x55, 0xfc, 0xb1, 0x00, 0x40, 0x51, 0x11, 0x51,
+    0x3c, 0x71, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xaf, 0x96, 0x95, 0x57, 0x55, 0xae,
+    0x6a, 0xae, 0x99, 0x6a, 0xa9, 0x55, 0xa6, 0x5f, 0x39, 0xa4, 0x4f, 0x61, 0xe5, 0xca, 0xfb, 0x56,
+    0xfa, 0x4f, 0x55, 0x51, 0x05, 0x00, 0x7c, 0x55, 0x55, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xc4, 0x73,
+    0x31, 0x45, 0x01, 0x08, 0x55, 0xf1, 0xc5, 0x02, 0x00, 0x45, 0x45, 0x44, 0x71, 0xc4, 0x55, 0x55,
+    0x55, 0xfe, 0xff, 0x6a, 0x55, 0x55, 0x95, 0x5a, 0x56, 0x5e, 0x55, 0x95, 0xaa, 0x95, 0x66, 0x4a,
+    0xa5, 0x56, 0x99, 0x45, 0xe5, 0x90, 0x4e, 0x85, 0x95, 0x6b, 0xe1, 0x5b, 0x59, 0x25, 0x55, 0x45,
+    0x15, 0x08, 0xf0, 0x55, 0x55, 0x15, 0xfc, 0x00, 0x30, 0x8c, 0x10, 0xcf, 0xc5, 0x14, 0x05, 0x20,
+    0x54, 0xc5, 0x17, 0x0b, 0x00, 0x14, 0x15, 0x11, 0xc5, 0x11, 0x57, 0x55, 0x55, 0xf9, 0xff, 0xab,
+    0x55, 0x55, 0x55, 0x6a, 0x59, 0x79, 0x55, 0x55, 0x2a, 0x54, 0x9a, 0x01, 0x95, 0x5a, 0x65, 0x16,
+    0x95, 0x43, 0x16, 0x15, 0x56, 0xae, 0x45, 0x69, 0x65, 0x15, 0x56, 0x15, 0x55, 0x08, 0x50, 0x54,
+    0x55, 0x55, 0xf0, 0x03, 0xc0, 0x30, 0x42, 0x3c, 0x17, 0x53, 0x14, 0x80, 0x50, 0x15, 0x5f, 0x2c,
+    0x00, 0x50, 0x54, 0x44, 0x14, 0x47, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf,
+    0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a, 0x2b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0xf3, 0xae, 0xe9, 0xf3,
+    0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0xb2, 0x0f, 0x08, 0x5f, 0x55, 0xfc, 0xcf, 0x0b,
+    0x00, 0xcb, 0x08, 0xf3, 0xfc, 0x4f, 0x51, 0x00, 0xc2, 0xff, 0xfc, 0xb3, 0x00, 0x40, 0x51, 0x31,
+    0xf3, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0x97, 0x57, 0x55,
+    0xae, 0x6a, 0xae, 0x99, 0xea, 0xab, 0x55, 0xa6, 0x5f, 0x39, 0xa4, 0xcf, 0x63, 0xe5, 0xca, 0xfb,
+    0x56, 0xfa, 0x4f, 0x55, 0x51, 0x3e, 0x08, 0x7c, 0x55, 0x55, 0x05, 0x3f, 0x00, 0x0c, 0x23, 0xc4,
+    0xf3, 0x3f, 0x45, 0x01, 0x08, 0x55, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0x45, 0x44, 0xf1, 0xcc, 0x55,
+    0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xbf, 0x5a, 0x56, 0x5e, 0x55, 0xb9, 0xaa, 0xb9, 0x66,
+    0xaa, 0xa5, 0x56, 0x99, 0x7e, 0xe5, 0x90, 0x3e, 0x85, 0x95, 0x2b, 0xef, 0x5b, 0xe9, 0x3f, 0x55,
+    0x45, 0x95, 0x00, 0xf0, 0x55, 0x55, 0x15, 0xfc, 0x00, 0x30, 0x8c, 0x10, 0x4f, 0xc5, 0x14, 0x05,
+    0x20, 0x54, 0xc5, 0x15, 0x0b, 0x00, 0x14, 0x15, 0x11, 0x45, 0x11, 0x57, 0x55, 0x55, 0xf9, 0xff,
+    0xab, 0x55, 0x55, 0x55, 0x6a, 0x59, 0x79, 0x55, 0x55, 0xaa, 0x56, 0x9a, 0x29, 0x95, 0x5a, 0x65,
+    0x16, 0x95, 0x43, 0x3a, 0x15, 0x56, 0xae, 0x85, 0x6b, 0x65, 0x95, 0x56, 0x15, 0x55, 0x28, 0xc0,
+    0x57, 0x55, 0x55, 0xf0, 0x03, 0xc0, 0x30, 0x42, 0x3c, 0x17, 0x53, 0x14, 0x80, 0x50, 0x15, 0x5f,
+    0x2c, 0x00, 0x50, 0x54, 0x44, 0x14, 0x47, 0x5c, 0x55, 0x55, 0xe5, 0xff, 0xaf, 0x56, 0x55, 0x55,
+    0xa9, 0x65, 0xe5, 0x55, 0x55, 0xa9, 0x5a, 0x69, 0xa6, 0x54, 0x6a, 0x95, 0x59, 0x54, 0x0e, 0xe9,
+    0x54, 0x58, 0xb9, 0x16, 0xa6, 0x95, 0x55, 0x5a, 0x55, 0x54, 0xa1, 0x40, 0x5c, 0x55, 0x55, 0xc1,
+    0x0f, 0x00, 0xc3, 0x08, 0xf1, 0x5c, 0x4c, 0x51, 0x00, 0x42, 0x55, 0x7c, 0xb1, 0x00, 0x40, 0x51,
+    0x11, 0x51, 0x1c, 0x71, 0x55, 0x55, 0x95, 0xff, 0xbf, 0x5a, 0x55, 0x55, 0xa5, 0x96, 0x95, 0x57,
+    0x55, 0xa5, 0x42, 0xa5, 0x99, 0x52, 0xa9, 0x55, 0x66, 0x51, 0x39, 0xa4, 0x51, 0x61, 0xe5, 0x5a,
+    0x94, 0x56, 0x56, 0x69, 0x55, 0x51, 0x85, 0x02, 0x45, 0x55, 0x55, 0x05, 0x3f, 0x00, 0x0c, 0x23,
+    0xc4, 0x73, 0x31, 0x45, 0x01, 0x08, 0x55, 0xf1, 0xc5, 0x02, 0x00, 0x45, 0x45, 0x44, 0x71, 0xc4,
+    0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x9f, 0x57, 0xb9, 0xa2, 0xb9,
+    0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe7, 0x9a, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xef, 0x3f,
+    0x55, 0x25, 0xf9, 0xa0, 0xf0, 0xfc, 0xff, 0xff, 0xbc, 0x00, 0xb0, 0xcc, 0x30, 0xcf, 0xff, 0x30,
+    0x0f, 0x20, 0xfc, 0xcf, 0x3f, 0x0b, 0x00, 0x14, 0x3f, 0x33, 0xcf, 0x33, 0x57, 0x55, 0xfe, 0xfb,
+    0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6, 0x9a, 0xa9, 0xfe, 0x5a,
+    0x65, 0xfa, 0x9c, 0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54, 0x95, 0xe4, 0x83,
+    0xc2, 0xc7, 0xff, 0xff, 0xf3, 0x02, 0xc0, 0x32, 0xc3, 0x3c, 0xff, 0x43, 0x3c, 0x80, 0xf0, 0x3f,
+    0xff, 0x2c, 0x00, 0x50, 0x7c, 0xcc, 0x3c, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55,
+    0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0x73, 0xae,
+    0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a, 0x5f, 0xfc, 0xff,
+    0xcf, 0x0b, 0x00, 0xcb, 0x0c, 0xf3, 0xfc, 0x0f, 0xf1, 0x00, 0xc2, 0xff, 0xfc, 0xb3, 0x00, 0x40,
+    0xf1, 0x31, 0xf3, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xff,
+    0xe7, 0x55, 0xae, 0x68, 0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0xcf, 0xb9, 0xa6, 0xcf, 0x6f, 0xe5,
+    0xca, 0xfb, 0xfa, 0xfb, 0x4f, 0x55, 0x49, 0x3e, 0x28, 0x7c, 0xc5, 0xff, 0x3f, 0x2f, 0x00, 0x2c,
+    0x23, 0xcc, 0xf3, 0x3f, 0xc5, 0x03, 0x08, 0xff, 0xf3, 0xcf, 0x02, 0x00, 0xc5, 0xc7, 0xcc, 0xf3,
+    0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x9f, 0x57, 0xb9, 0xa2,
+    0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe7, 0x9a, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xef,
+    0x3f, 0x55, 0x25, 0xf9, 0xa0, 0xf0, 0x55, 0xfc, 0xff, 0xbc, 0x00, 0xb0, 0x8c, 0x30, 0xcf, 0xff,
+    0x14, 0x07, 0x20, 0xfc, 0xcf, 0x3f, 0x0b, 0x00, 0x14, 0x17, 0x33, 0xcf, 0x33, 0x57, 0x55, 0xfe,
+    0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6, 0x9a, 0xa9, 0xfe,
+    0x5a, 0x65, 0xfa, 0x9c, 0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54, 0x95, 0xe4,
+    0x83, 0xc2, 0x57, 0xc5, 0xff, 0xf3, 0x02, 0xc0, 0x32, 0xc2, 0x3c, 0xff, 0x53, 0x14, 0x80, 0xf0,
+    0x3f, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56,
+    0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0x73,
+    0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a, 0x5f, 0x55,
+    0xfc, 0xcf, 0x0b, 0x00, 0xcb, 0x08, 0xf3, 0xfc, 0x4f, 0x51, 0x00, 0xc2, 0xff, 0xfc, 0xb3, 0x00,
+    0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92,
+    0xbf, 0xe7, 0x55, 0xae, 0x6a, 0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0x4f, 0xb9, 0xa6, 0xcf, 0x6f,
+    0xe5, 0xca, 0xfb, 0xfa, 0xfb, 0x4f, 0x55, 0x49, 0x3e, 0x28, 0x7c, 0x55, 0xc5, 0x3f, 0x2f, 0x00,
+    0x2c, 0x23, 0xc4, 0xf3, 0x3f, 0x45, 0x01, 0x08, 0xff, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0xc5, 0xcc,
+    0xf1, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0x7e, 0x9e, 0x57, 0xb9,
+    0xaa, 0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe5, 0x9a, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb,
+    0xeb, 0x3f, 0x55, 0x65, 0xf9, 0xa0, 0xf0, 0x55, 0x55, 0xfc, 0xbc, 0x00, 0xb0, 0x8c, 0x10, 0xcf,
+    0xff, 0x14, 0x05, 0x20, 0xfc, 0xc5, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc5, 0x33, 0x57, 0x55,
+    0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0x79, 0x79, 0x5e, 0xe5, 0xaa, 0xe6, 0x9a, 0xa9,
+    0xbe, 0x5a, 0x65, 0xfa, 0x95, 0x6b, 0xfa, 0x3c, 0x56, 0xae, 0xbc, 0xaf, 0xa7, 0xff, 0x54, 0x95,
+    0xe5, 0x83, 0xc2, 0x57, 0x55, 0xc5, 0xf3, 0x02, 0xc0, 0x32, 0x42, 0x3c, 0xff, 0x53, 0x14, 0x80,
+    0xf0, 0x15, 0xff, 0x2c, 0x00, 0x50, 0x54, 0x4c, 0x14, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf,
+    0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xe5, 0x59, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0xfa, 0x6a, 0x95, 0xe9,
+    0x57, 0xae, 0xe9, 0xf3, 0x58, 0xb9, 0xf2, 0xbe, 0x96, 0xfe, 0x53, 0x55, 0x96, 0x0f, 0x0a, 0x5f,
+    0x55, 0x55, 0xcc, 0x0b, 0x00, 0xcb, 0x08, 0xf1, 0xfc, 0x4f, 0x51, 0x00, 0xc2, 0x55, 0xfc, 0xb3,
+    0x00, 0x40, 0x51, 0x31, 0x51, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf,
+    0x92, 0x97, 0x57, 0x55, 0xae, 0x6a, 0xae, 0x99, 0xea, 0xab, 0x55, 0xa6, 0x5f, 0xb9, 0xa6, 0xcf,
+    0x63, 0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x59, 0x3e, 0x28, 0x7c, 0x55, 0x55, 0x05, 0x2f,
+    0x00, 0x2c, 0x23, 0xc4, 0xf3, 0x3f, 0x45, 0x01, 0x08, 0x55, 0xf1, 0xcf, 0x02, 0x00, 0x45, 0x45,
+    0x44, 0xf1, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xbf, 0x5a, 0x56, 0x5e, 0x55,
+    0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xa5, 0x56, 0x99, 0x7e, 0xe5, 0x90, 0x3e, 0x85, 0x95, 0x2b, 0xef,
+    0x5b, 0xe9, 0x3f, 0x55, 0x45, 0x95, 0x00, 0xf2, 0x55, 0x55, 0x15, 0xfc, 0x00, 0x30, 0x8c, 0x10,
+    0x4f, 0xc5, 0x14, 0x05, 0x20, 0x54, 0x45, 0x15, 0x0b, 0x00, 0x14, 0x15, 0x11, 0x45, 0x11, 0x57,
+    0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x6a, 0x59, 0x79, 0x55, 0xe5, 0xaa, 0xe6, 0x9a,
+    0xa9, 0x96, 0x5a, 0x65, 0xfa, 0x95, 0x43, 0xfa, 0x14, 0x56, 0xae, 0xbc, 0x6f, 0xa5, 0xff, 0x54,
+    0x15, 0x55, 0x02, 0xc8, 0x57, 0x55, 0x55, 0xc4, 0x03, 0x80, 0x30, 0x42, 0x7c, 0x15, 0x53, 0x14,
+    0x80, 0x50, 0x15, 0x55, 0x2c, 0x00, 0x50, 0x54, 0x44, 0x14, 0x45, 0x5c, 0x55, 0xf9, 0xef, 0xff,
+    0xaf, 0x56, 0x55, 0xfe, 0xab, 0x65, 0xe5, 0x55, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0x5a, 0x6a, 0x95,
+    0xe9, 0x57, 0x0e, 0xe9, 0x53, 0x58, 0xb9, 0xf2, 0xbe, 0x95, 0xfe, 0x53, 0x55, 0x54, 0x09, 0x20,
+    0x5f, 0x55, 0x55, 0x51, 0x0c, 0x00, 0xc2, 0x08, 0xf1, 0x55, 0x4c, 0x51, 0x00, 0x52, 0x55, 0x54,
+    0xb1, 0x00, 0x40, 0x55, 0x11, 0x51, 0x14, 0x71, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9,
+    0xaf, 0x96, 0x95, 0x57, 0x55, 0xae, 0x6a, 0xae, 0x99, 0x6a, 0xa9, 0x55, 0xa6, 0x5f, 0x39, 0xa4,
+    0x4f, 0x61, 0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x51, 0x25, 0x80, 0x7c, 0x55, 0x55, 0x45,
+    0x05, 0x00, 0x09, 0x23, 0xc4, 0x57, 0x31, 0x55, 0x09, 0x48, 0x55, 0x51, 0xc5, 0x02, 0x00, 0x55,
+    0x45, 0x44, 0x51, 0xc4, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x6a, 0x55, 0x55, 0x95, 0x5a, 0x56, 0x5e,
+    0x55, 0x95, 0xaa, 0x95, 0x66, 0x4a, 0xa5, 0x56, 0x99, 0x45, 0xe5, 0x90, 0x4e, 0x85, 0x95, 0x6b,
+    0x61, 0x5a, 0x59, 0xa5, 0x55, 0x45, 0x15, 0x0a, 0xe4, 0x55, 0x55, 0x15, 0xfc, 0x00, 0x30, 0x8c,
+    0x10, 0xcf, 0xc5, 0x14, 0x05, 0x20, 0x54, 0xc5, 0x17, 0x0b, 0x00, 0x14, 0x15, 0x11, 0xc5, 0x11,
+    0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6,
+    0x9a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x9c, 0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff,
+    0x54, 0x95, 0xe4, 0x83, 0xc2, 0xfb, 0xff, 0xff, 0xf3, 0x02, 0xc0, 0x32, 0xc3, 0x3c, 0xff, 0xc3,
+    0xff, 0x80, 0xf0, 0xff, 0xff, 0x2f, 0x00, 0x50, 0xfc, 0xcc, 0x3c, 0xcf, 0x5c, 0x55, 0xf9, 0xef,
+    0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b,
+    0x95, 0xe9, 0x73, 0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f,
+    0x0a, 0x5f, 0xf9, 0xff, 0xcf, 0x0b, 0x00, 0xcb, 0x08, 0xf3, 0xfc, 0x4f, 0xf1, 0x03, 0xc2, 0xff,
+    0xff, 0xbf, 0x00, 0x40, 0xf1, 0x31, 0xf3, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55,
+    0xf9, 0xbf, 0x92, 0xff, 0xe7, 0x55, 0xae, 0x68, 0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0xcf, 0xb9,
+    0xa6, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xfa, 0xfb, 0x4f, 0x55, 0x49, 0x3e, 0x28, 0x7c, 0x55, 0xf9,
+    0x3f, 0x2f, 0x00, 0x2c, 0x23, 0xfc, 0xf3, 0x3f, 0x55, 0x01, 0x08, 0xff, 0xff, 0xff, 0x02, 0x00,
+    0x45, 0xc5, 0xcc, 0xf3, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0x7e,
+    0x9e, 0x57, 0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe5, 0x9a, 0x3e, 0xbf, 0x95,
+    0x2b, 0xef, 0xeb, 0xeb, 0x3f, 0x55, 0x65, 0xf9, 0xa0, 0xf0, 0x55, 0x55, 0xfe, 0xbc, 0x00, 0xb0,
+    0x8c, 0x14, 0xcf, 0xff, 0x54, 0x05, 0x20, 0xfc, 0xc7, 0x3f, 0x0b, 0x00, 0x14, 0x15, 0x33, 0xc7,
+    0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0x79, 0x79, 0x55, 0xe5, 0xaa,
+    0xe6, 0x9a, 0xa9, 0xbe, 0x5a, 0x65, 0xfa, 0x95, 0x6b, 0xfa, 0x3c, 0x56, 0xae, 0xbc, 0x6f, 0xa5,
+    0xff, 0x54, 0x95, 0xe5, 0x83, 0xc2, 0x57, 0x55, 0x55, 0x72, 0x02, 0xc0, 0x32, 0x42, 0x3c, 0xff,
+    0x53, 0x14, 0x80, 0x50, 0x15, 0xff, 0x2c, 0x00, 0x50, 0x54, 0x44, 0x14, 0xcf, 0x5c, 0x55, 0xf9,
+    0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xe5, 0x55, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0xfa,
+    0x6a, 0x95, 0xe9, 0x57, 0xae, 0xe9, 0xf3, 0x58, 0xb9, 0xf2, 0xbe, 0x95, 0xfe, 0x53, 0x55, 0x96,
+    0x0f, 0x0a, 0x5f, 0x55, 0x55, 0x49, 0x09, 0x40, 0xc8, 0x08, 0xf1, 0xfc, 0x4f, 0x51, 0x00, 0x52,
+    0x55, 0xfc, 0xb3, 0x00, 0x40, 0x55, 0x11, 0x51, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a,
+    0x55, 0xf9, 0xaf, 0x96, 0x95, 0x57, 0x55, 0xae, 0x6a, 0xae, 0x99, 0x6a, 0xa9, 0x55, 0xa6, 0x5f,
+    0x39, 0xa4, 0x4f, 0x61, 0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x51, 0x25, 0x88, 0x7c, 0x55,
+    0x55, 0x65, 0x25, 0x00, 0x09, 0x23, 0xc4, 0x57, 0x31, 0x55, 0x09, 0x48, 0x55, 0x51, 0xc5, 0x02,
+    0x00, 0x55, 0x45, 0x44, 0x51, 0xc4, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x6a, 0x55, 0x55, 0x95, 0x5a,
+    0x56, 0x5e, 0x55, 0x95, 0xaa, 0x95, 0x66, 0x4a, 0xa5, 0x56, 0x99, 0x45, 0xe5, 0x90, 0x4e, 0x85,
+    0x95, 0x6b, 0x61, 0x5a, 0x59, 0xa5, 0x55, 0x45, 0x15, 0x0a, 0xe4, 0x55, 0x55, 0x15, 0xfc, 0x02,
+    0x30, 0x8c, 0x10, 0xcf, 0xc5, 0x14, 0x05, 0x20, 0x54, 0xc5, 0x17, 0x0b, 0x00, 0x14, 0x15, 0x11,
+    0xc5, 0x11, 0x57, 0x55, 0x55, 0xf9, 0xff, 0xab, 0x55, 0x55, 0x55, 0x6a, 0x59, 0x79, 0x55, 0x55,
+    0xaa, 0x56, 0x9a, 0x29, 0x95, 0x5a, 0x65, 0x16, 0x95, 0x43, 0x3a, 0x15, 0x56, 0xae, 0x85, 0x69,
+    0x65, 0x95, 0x56, 0x15, 0x55, 0x28, 0x90, 0x57, 0x55, 0x55, 0xf0, 0x0b, 0xc0, 0x04, 0x42, 0x3c,
+    0x17, 0x53, 0x14, 0x80, 0x50, 0x15, 0x5f, 0x2c, 0x00, 0x50, 0x54, 0x44, 0x14, 0x47, 0x5c, 0x55,
+    0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a, 0x6b, 0xa6,
+    0xfa, 0x6b, 0x95, 0xe9, 0x73, 0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55,
+    0x92, 0x0f, 0x0a, 0xef, 0xff, 0xff, 0xcf, 0x8b, 0x00, 0xcb, 0xac, 0xff, 0xfc, 0x0b, 0xff, 0x2b,
+    0xc2, 0xff, 0xff, 0xbf, 0x00, 0x40, 0xf1, 0x33, 0xf3, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf,
+    0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xff, 0xe7, 0x55, 0xae, 0x68, 0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6,
+    0xcf, 0xb9, 0xa6, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xfa, 0xfb, 0x4f, 0x55, 0x49, 0x3e, 0x28, 0xbc,
+    0xef, 0xbb, 0x3f, 0x27, 0xaa, 0x28, 0x87, 0xfe, 0xfb, 0x2f, 0xfc, 0xaf, 0x08, 0xff, 0xff, 0xff,
+    0x02, 0x00, 0xc5, 0xcf, 0xcc, 0xf3, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff,
+    0x4a, 0xfe, 0x9f, 0x57, 0xb9, 0xa2, 0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe7, 0x9a, 0x3e,
+    0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xef, 0x3f, 0x55, 0x25, 0xf9, 0xa0, 0xf0, 0x95, 0xff, 0xff, 0xbc,
+    0x20, 0xb0, 0x9c, 0xf8, 0xcf, 0xbf, 0x14, 0xbf, 0x22, 0xfc, 0xff, 0xff, 0x0b, 0x00, 0x14, 0x1f,
+    0x33, 0xcf, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x5e,
+    0xe5, 0x8a, 0xe6, 0x9a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x9c, 0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc,
+    0xaf, 0xbf, 0xff, 0x54, 0x95, 0xe4, 0x83, 0xc2, 0x57, 0x95, 0xfb, 0xf3, 0x02, 0xca, 0x72, 0xca,
+    0x3f, 0xff, 0x52, 0x15, 0x8a, 0xf0, 0xff, 0xff, 0x2f, 0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf, 0x5c,
+    0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xef, 0x79, 0x95, 0xab, 0x9a, 0x6b,
+    0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0x53, 0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53,
+    0x55, 0x92, 0x0f, 0x0a, 0x5f, 0x55, 0xe6, 0xcf, 0x0b, 0x28, 0xcb, 0x69, 0xfc, 0xfc, 0x4f, 0x55,
+    0x00, 0xc2, 0xff, 0xff, 0xbf, 0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff,
+    0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0x9f, 0xe7, 0x55, 0xae, 0x6a, 0xae, 0x99, 0xea, 0xaf, 0x55,
+    0xa6, 0x4f, 0xb9, 0xa6, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xfa, 0xfa, 0x4f, 0x55, 0x59, 0x3e, 0x28,
+    0x7c, 0x55, 0x95, 0x3f, 0x2f, 0xa0, 0x2c, 0xa7, 0xc5, 0xf3, 0x3f, 0x55, 0x01, 0x08, 0xff, 0xf3,
+    0xcf, 0x02, 0x00, 0x45, 0xc5, 0xcc, 0xf3, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5,
+    0xff, 0x4a, 0x7e, 0x9e, 0x57, 0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe5, 0x9a,
+    0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xeb, 0x3f, 0x55, 0x65, 0xf9, 0xa0, 0xf0, 0x55, 0x55, 0xfe,
+    0xbc, 0x80, 0xb2, 0x9c, 0x56, 0xcc, 0xff, 0x54, 0x05, 0x20, 0xfc, 0xcf, 0x3f, 0x0b, 0x00, 0x14,
+    0x15, 0x33, 0xcf, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x79,
+    0x5e, 0xe5, 0xaa, 0xe6, 0x9a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x94, 0x6b, 0xfa, 0xfc, 0x56, 0xae,
+    0xbc, 0xaf, 0xaf, 0xff, 0x54, 0x95, 0xe5, 0x83, 0xc2, 0x57, 0x55, 0xf9, 0xf3, 0x02, 0xca, 0x72,
+    0x5a, 0x05, 0xff, 0x53, 0x15, 0x80, 0xf0, 0x3f, 0xff, 0x2c, 0x00, 0x50, 0x54, 0xcc, 0x3c, 0xcf,
+    0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xe5, 0x55, 0x95, 0xab, 0x9a,
+    0x6b, 0xa6, 0xfa, 0x6a, 0x95, 0xe9, 0x57, 0xae, 0xe9, 0xf3, 0x58, 0xb9, 0xf2, 0xbe, 0x95, 0xfe,
+    0x53, 0x55, 0x96, 0x0f, 0x0a, 0x5f, 0x55, 0x55, 0x49, 0x09, 0x40, 0xca, 0x08, 0xf1, 0xfc, 0x4f,
+    0x55, 0x02, 0x52, 0x55, 0xfc, 0xb3, 0x00, 0x40, 0x55, 0x11, 0x51, 0x3c, 0x73, 0x55, 0xe5, 0xbf,
+    0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0x97, 0x57, 0x55, 0xae, 0x6a, 0xae, 0x99, 0xea, 0xab,
+    0x55, 0xa6, 0x5f, 0xb9, 0xa6, 0xcf, 0x63, 0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x59, 0x3e,
+    0x28, 0x7c, 0x55, 0x55, 0x65, 0x25, 0x00, 0x29, 0x23, 0xc4, 0xc7, 0x3f, 0x55, 0x09, 0x48, 0x55,
+    0xf1, 0xc7, 0x02, 0x00, 0x55, 0x45, 0x44, 0xf1, 0xc4, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55,
+    0xe5, 0xff, 0x4a, 0x5e, 0x5e, 0x55, 0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xaf, 0x56, 0x99, 0x7e, 0xe5,
+    0x9a, 0x3e, 0x8f, 0x95, 0x2b, 0xef, 0x5b, 0xe9, 0x3f, 0x55, 0x65, 0xb9, 0xa0, 0xf2, 0x55, 0x55,
+    0x95, 0x95, 0x00, 0xa4, 0x8c, 0x10, 0x5f, 0xfc, 0x54, 0x25, 0x20, 0x55, 0xc5, 0x17, 0x0b, 0x00,
+    0x54, 0x15, 0x11, 0xc5, 0x11, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0x59,
+    0x79, 0x55, 0xe5, 0xaa, 0xe6, 0x9a, 0xa9, 0x9e, 0x5a, 0x65, 0xfa, 0x95, 0x6b, 0xfa, 0x1c, 0x56,
+    0xae, 0xbc, 0x6f, 0xa5, 0xff, 0x54, 0x95, 0x65, 0x82, 0xca, 0x57, 0x55, 0x55, 0x56, 0x02, 0x90,
+    0x32, 0x42, 0x7c, 0xc5, 0x53, 0x95, 0x80, 0x54, 0x15, 0x57, 0x2c, 0x00, 0x50, 0x55, 0x44, 0x14,
+    0x45, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xab, 0x65, 0xe5, 0x55, 0x95, 0xab,
+    0x9a, 0x6b, 0xa6, 0x5a, 0x6a, 0x95, 0xe9, 0x57, 0xae, 0xe9, 0x53, 0x58, 0xb9, 0xf2, 0xbe, 0x95,
+    0xfe, 0x53, 0x55, 0x56, 0x09, 0x2a, 0x5f, 0x55, 0x55, 0x59, 0x09, 0x40, 0xca, 0x08, 0xf1, 0x55,
+    0x4c, 0x55, 0x02, 0x52, 0x55, 0x54, 0xb1, 0x00, 0x40, 0x55, 0x11, 0x51, 0x14, 0x71, 0x55, 0xe5,
+    0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xaf, 0x96, 0x95, 0x57, 0x55, 0xae, 0x6a, 0xae, 0x99, 0x6a,
+    0xa9, 0x55, 0xa6, 0x5f, 0xb9, 0xa6, 0x4f, 0x61, 0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x59,
+    0x25, 0xa8, 0x7c, 0x55, 0x55, 0x65, 0x25, 0x00, 0x29, 0x23, 0xc4, 0x57, 0x05, 0x55, 0x09, 0x48,
+    0x55, 0x51, 0xc5, 0x02, 0x00, 0x55, 0x45, 0x44, 0x51, 0xc4, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x6a,
+    0x55, 0x55, 0x95, 0x5a, 0x56, 0x5e, 0x55, 0x95, 0xaa, 0x95, 0x66, 0x4a, 0xa5, 0x56, 0x99, 0x45,
+    0xe5, 0x90, 0x4e, 0x85, 0x95, 0x6b, 0x61, 0x5a, 0x59, 0xa5, 0x55, 0x45, 0x15, 0x0a, 0xe4, 0x55,
+    0x55, 0x15, 0xfc, 0x02, 0x30, 0x89, 0x10, 0xcf, 0xc5, 0x14, 0x05, 0x20, 0x54, 0xc5, 0x17, 0x0b,
+    0x00, 0x14, 0x15, 0x11, 0xc5, 0x11, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b,
+    0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6, 0x9a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x9c, 0x6b, 0xfa, 0xfc,
+    0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54, 0x95, 0xe4, 0x83, 0xc2, 0x7b, 0xbe, 0xfb, 0x73, 0xa2,
+    0x8a, 0x72, 0xea, 0xbf, 0xff, 0xc2, 0xff, 0x8a, 0xf0, 0xff, 0xff, 0x2f, 0x00, 0x50, 0xfc, 0xcc,
+    0x3c, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95,
+    0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0x73, 0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe,
+    0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a, 0x6f, 0xf9, 0xee, 0xcf, 0x89, 0x2a, 0xca, 0xa9, 0xff,
+    0xfe, 0x4b, 0xfc, 0x2b, 0xc2, 0xff, 0xff, 0xbf, 0x00, 0x40, 0xf1, 0x33, 0xf3, 0x3c, 0x73, 0x55,
+    0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xff, 0xe7, 0x55, 0xae, 0x68, 0xae, 0x99,
+    0xea, 0xaf, 0x55, 0xa6, 0xcf, 0xb9, 0xa6, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xfa, 0xfb, 0x4f, 0x55,
+    0x49, 0x3e, 0x28, 0x7c, 0xe5, 0xbb, 0x3f, 0x27, 0xaa, 0x28, 0xa7, 0xfe, 0xfb, 0x2f, 0xc5, 0xaf,
+    0x08, 0xff, 0xff, 0xff, 0x02, 0x00, 0xc5, 0xc7, 0xcc, 0xf3, 0xcc, 0x55, 0x95, 0xff, 0xfe, 0xff,
+    0x6a, 0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x9f, 0x57, 0xb9, 0xa2, 0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99,
+    0x3e, 0xe7, 0x9a, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xef, 0x3f, 0x55, 0x25, 0xf9, 0xa0, 0xf0,
+    0x95, 0xe7, 0xfe, 0x9c, 0xa8, 0xa2, 0x9c, 0xfa, 0xef, 0xbf, 0x54, 0xbc, 0x22, 0xfc, 0xff, 0xff,
+    0x0b, 0x00, 0x14, 0x17, 0x33, 0xcf, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff,
+    0x2b, 0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6, 0x9a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x9c, 0x6b, 0xfa,
+    0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54, 0x95, 0xe4, 0x83, 0xc2, 0x57, 0x96, 0xfb, 0x73,
+    0xa2, 0x8a, 0x72, 0xea, 0xbf, 0xff, 0x52, 0xc5, 0x8a, 0xf0, 0xff, 0xff, 0x2f, 0x00, 0x50, 0x54,
+    0xcc, 0x3c, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x79,
+    0x95, 0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0x73, 0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2,
+    0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a, 0x5f, 0x55, 0xee, 0xcf, 0x89, 0x2a, 0xca, 0xa9,
+    0xff, 0xfe, 0x4b, 0x55, 0x28, 0xc2, 0xff, 0xff, 0xbf, 0x00, 0x40, 0x51, 0x31, 0xf3, 0x3c, 0x73,
+    0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0x97, 0x57, 0x55, 0xae, 0x6a, 0xae,
+    0x99, 0xea, 0xab, 0x55, 0xa6, 0x5f, 0xb9, 0xa6, 0xcf, 0x63, 0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f,
+    0x55, 0x59, 0x3e, 0x28, 0x7c, 0x55, 0x55, 0x25, 0x25, 0x00, 0x29, 0xa7, 0xc6, 0xfb, 0x3f, 0x55,
+    0x09, 0x48, 0x55, 0xf1, 0xff, 0x02, 0x00, 0x55, 0x45, 0x44, 0xf1, 0xcc, 0x55, 0x95, 0xff, 0xfe,
+    0xff, 0x6a, 0x55, 0xe5, 0xbf, 0x5a, 0x56, 0x5e, 0x55, 0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xa5, 0x56,
+    0x99, 0x7e, 0xe5, 0x9a, 0x3e, 0x85, 0x95, 0x2b, 0xef, 0x5b, 0xe9, 0x3f, 0x55, 0x65, 0x95, 0xa0,
+    0xf2, 0x55, 0x55, 0x95, 0x95, 0x00, 0xa4, 0x9c, 0x1a, 0x5f, 0x95, 0x54, 0x25, 0x20, 0x55, 0x55,
+    0x15, 0x0b, 0x00, 0x54, 0x15, 0x11, 0x45, 0x11, 0x57, 0x55, 0x55, 0xf9, 0xff, 0xab, 0x55, 0x55,
+    0x55, 0x6a, 0x59, 0x79, 0x55, 0x55, 0xaa, 0x56, 0x9a, 0x29, 0x95, 0x5a, 0x65, 0x16, 0x95, 0x43,
+    0x3a, 0x15, 0x56, 0xae, 0x85, 0x69, 0x65, 0x95, 0x56, 0x15, 0x55, 0x28, 0x90, 0x57, 0x55, 0x55,
+    0xf0, 0x0b, 0xc0, 0x24, 0x42, 0x3c, 0x17, 0x5b, 0x14, 0x80, 0x50, 0x15, 0x5f, 0x2c, 0x00, 0x50,
+    0x54, 0x44, 0x14, 0x47, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff,
+    0x79, 0x95, 0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0x73, 0xae, 0xe9, 0xf3, 0x5b, 0xb9,
+    0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a, 0x6f, 0xf9, 0xee, 0x4f, 0x89, 0x2a, 0xca,
+    0xa9, 0xff, 0xfe, 0x4b, 0xfe, 0x2a, 0xe8, 0xee, 0xfb, 0x2e, 0xaa, 0x2a, 0xff, 0xff, 0xff, 0xff,
+    0x7f, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xff, 0xe7, 0x55, 0xae, 0x68,
+    0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0xcf, 0xb9, 0xa6, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xfa, 0xfb,
+    0x4f, 0x55, 0x49, 0x3e, 0x28, 0xbc, 0xe5, 0xbb, 0x3f, 0x27, 0xaa, 0x28, 0xa7, 0xfe, 0xfb, 0x2f,
+    0xf9, 0xaf, 0x08, 0xff, 0xff, 0xff, 0x02, 0x00, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x55, 0x95, 0xff,
+    0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x9f, 0x57, 0xb9, 0xa2, 0xb9, 0x66, 0xaa, 0xbf,
+    0x56, 0x99, 0x3e, 0xe7, 0x9a, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xef, 0x3f, 0x55, 0x25, 0xf9,
+    0xa0, 0xf0, 0x55, 0xe5, 0xfe, 0x94, 0xa8, 0xa2, 0x9c, 0xfa, 0xef, 0xbf, 0x54, 0xa5, 0x22, 0xfc,
+    0xff, 0xff, 0x0b, 0x00, 0x54, 0x15, 0x33, 0xcf, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55,
+    0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6, 0x9a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x9c,
+    0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54, 0x95, 0xe4, 0x83, 0xc2, 0x57, 0x95,
+    0xfb, 0x52, 0xa2, 0x9a, 0x72, 0xea, 0xbf, 0xff, 0x52, 0x95, 0x8a, 0xc4, 0xff, 0xff, 0x2f, 0x00,
+    0x50, 0x55, 0xc4, 0x3c, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4,
+    0xef, 0x79, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0x53, 0xae, 0xe9, 0xf3, 0x5b,
+    0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a, 0x5f, 0x55, 0xee, 0x49, 0x89, 0x6a,
+    0xca, 0xa9, 0xff, 0xfe, 0x4b, 0x55, 0x2a, 0x52, 0xfc, 0xff, 0xbf, 0x00, 0x40, 0x55, 0x11, 0xf3,
+    0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0x9f, 0xe7, 0x55, 0xae,
+    0x6a, 0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0x4f, 0xb9, 0xa6, 0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xfa,
+    0xfa, 0x4f, 0x55, 0x59, 0x3e, 0x28, 0x7c, 0x55, 0xb9, 0x25, 0x25, 0xaa, 0x29, 0xa7, 0xfe, 0xfb,
+    0x2f, 0x55, 0xa9, 0x48, 0xc5, 0xff, 0xff, 0x02, 0x00, 0x55, 0x45, 0xc4, 0xf3, 0xcc, 0x55, 0x95,
+    0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0x5e, 0x9e, 0x57, 0xb9, 0xaa, 0xb9, 0x66, 0xaa,
+    0xaf, 0x56, 0x99, 0x7e, 0xe5, 0x9a, 0x3e, 0x8f, 0x95, 0x2b, 0xef, 0xeb, 0xe9, 0x3f, 0x55, 0x65,
+    0xf9, 0xa0, 0xf0, 0x55, 0xe5, 0x95, 0x94, 0xa8, 0xa6, 0x9c, 0xfa, 0xef, 0xbf, 0x54, 0xa5, 0x22,
+    0x55, 0xfc, 0xff, 0x0b, 0x00, 0x54, 0x15, 0x11, 0xcf, 0x33, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab,
+    0x55, 0x95, 0xff, 0x2b, 0x79, 0x79, 0x56, 0xe5, 0xaa, 0xe6, 0x9a, 0xa9, 0xbe, 0x5a, 0x65, 0xfa,
+    0x95, 0x6b, 0xfa, 0x3c, 0x56, 0xae, 0xbc, 0xaf, 0xa5, 0xff, 0x54, 0x95, 0xe5, 0x83, 0xc2, 0x57,
+    0x95, 0x55, 0x52, 0xa2, 0x92, 0x72, 0xea, 0xbf, 0xff, 0x52, 0x95, 0x8a, 0x54, 0xc5, 0xff, 0x2f,
+    0x00, 0x50, 0x55, 0x44, 0x1c, 0xcf, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf,
+    0xe4, 0xe5, 0x55, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0xfa, 0x6a, 0x95, 0xe9, 0x57, 0xae, 0xe9, 0xf3,
+    0x58, 0xb9, 0xf2, 0xbe, 0x95, 0xfe, 0x53, 0x55, 0x96, 0x0f, 0x0a, 0x5f, 0x55, 0x55, 0x49, 0x89,
+    0x4a, 0xca, 0xa9, 0xf3, 0xfe, 0x4b, 0x55, 0x2a, 0x52, 0x55, 0xfc, 0xbf, 0x00, 0x40, 0x55, 0x11,
+    0x51, 0x3c, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0x97, 0x57, 0x55,
+    0xae, 0x6a, 0xae, 0x99, 0xea, 0xab, 0x55, 0xa6, 0x5f, 0xb9, 0xa6, 0xcf, 0x63, 0xe5, 0xca, 0xfb,
+    0x56, 0xfa, 0x4f, 0x55, 0x59, 0x3e, 0x28, 0x7c, 0x55, 0x55, 0x25, 0x25, 0x2a, 0x29, 0xa7, 0xce,
+    0xfb, 0x27, 0x55, 0xa9, 0x48, 0x55, 0xc5, 0xff, 0x02, 0x00, 0x55, 0x45, 0x44, 0xf1, 0xcc, 0x55,
+    0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0x5e, 0x5e, 0x55, 0xb9, 0xaa, 0xb9, 0x66,
+    0xaa, 0xaf, 0x56, 0x99, 0x7e, 0xe5, 0x9a, 0x3e, 0x8f, 0x95, 0x2b, 0xef, 0x5b, 0xe9, 0x3f, 0x55,
+    0x65, 0xf9, 0xa0, 0xf0, 0x55, 0x55, 0x95, 0x95, 0xa8, 0xa4, 0x9c, 0x3a, 0xef, 0x97, 0x54, 0xa5,
+    0x22, 0x55, 0x55, 0xfc, 0x0b, 0x00, 0x54, 0x15, 0x11, 0xc5, 0x31, 0x57, 0x55, 0xfe, 0xfb, 0xff,
+    0xab, 0x55, 0x95, 0xff, 0x2b, 0x79, 0x79, 0x55, 0xe5, 0xaa, 0xe6, 0x9a, 0xa9, 0xbe, 0x5a, 0x65,
+    0xfa, 0x95, 0x6b, 0xfa, 0x3c, 0x56, 0xae, 0xbc, 0x6f, 0xa5, 0xff, 0x54, 0x95, 0xe5, 0x82, 0xca,
+    0x57, 0x55, 0x55, 0x56, 0xa2, 0x92, 0x72, 0xea, 0xbc, 0x57, 0x52, 0x95, 0x8a, 0x54, 0x55, 0xc5,
+    0x2f, 0x00, 0x50, 0x55, 0x44, 0x14, 0xc5, 0x5c, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe,
+    0xaf, 0x64, 0xe5, 0x55, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0x7a, 0x6a, 0x95, 0xe9, 0x57, 0xae, 0xe9,
+    0x73, 0x58, 0xb9, 0xf2, 0xbe, 0x95, 0xfe, 0x53, 0x55, 0x96, 0x09, 0x2a, 0x5f, 0x55, 0x55, 0x59,
+    0x89, 0x4a, 0xca, 0xa9, 0xf3, 0x56, 0x49, 0x55, 0x2a, 0x52, 0x55, 0x55, 0xbc, 0x00, 0x40, 0x55,
+    0x11, 0x51, 0x14, 0x73, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xaf, 0x96, 0x95, 0x57,
+    0x55, 0xae, 0x6a, 0xae, 0x99, 0x6a, 0xa9, 0x55, 0xa6, 0x5f, 0xb9, 0xa6, 0x4f, 0x61, 0xe5, 0xca,
+    0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x59, 0x25, 0xa8, 0x7c, 0x55, 0x55, 0x65, 0x25, 0x2a, 0x29, 0xa7,
+    0xce, 0x57, 0x25, 0x55, 0xa9, 0x48, 0x55, 0x55, 0xc5, 0x02, 0x00, 0x55, 0x45, 0x44, 0x51, 0xc4,
+    0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xbf, 0x5a, 0x56, 0x5e, 0x55, 0xb9, 0xaa, 0xb9,
+    0x66, 0xaa, 0xa5, 0x56, 0x99, 0x7e, 0xe5, 0x9a, 0x3e, 0x85, 0x95, 0x2b, 0xef, 0x5b, 0xe9, 0x3f,
+    0x55, 0x65, 0x95, 0xa0, 0xf2, 0x55, 0x55, 0x95, 0x95, 0xa8, 0xa4, 0x9c, 0x3a, 0x5f, 0x95, 0x54,
+    0xa5, 0x22, 0x55, 0x55, 0x55, 0x08, 0x00, 0x54, 0x15, 0x11, 0x45, 0x11, 0x57, 0x55, 0xfe, 0xfb,
+    0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6, 0x9a, 0xa9, 0xfe, 0x5a,
+    0x65, 0xfa, 0x9c, 0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54, 0x95, 0xe4, 0x83,
+    0xc2, 0x5b, 0xbe, 0xfb, 0x53, 0xa2, 0x8a, 0x72, 0xea, 0xbf, 0xff, 0x92, 0xbf, 0x8a, 0xba, 0xfb,
+    0xbe, 0x8b, 0xaa, 0xca, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55,
+    0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9, 0x73, 0xae,
+    0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a, 0x6f, 0xf9, 0xee,
+    0xcf, 0x89, 0x2a, 0xca, 0xa9, 0xff, 0xfe, 0x4b, 0xfe, 0x2b, 0xca, 0xee, 0xfb, 0xae, 0xa8, 0x6a,
+    0xf1, 0xff, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92, 0xff,
+    0xe7, 0x55, 0xae, 0x68, 0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0xcf, 0xb9, 0xa6, 0xcf, 0x6f, 0xe5,
+    0xca, 0xfb, 0xfa, 0xfb, 0x4f, 0x55, 0x49, 0x3e, 0x28, 0x7c, 0x55, 0xb9, 0x3f, 0x25, 0xaa, 0x28,
+    0xa7, 0xfe, 0xfb, 0x2f, 0x55, 0xa9, 0x88, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x55, 0xc5, 0xff, 0xff,
+    0xff, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x9e, 0x57, 0xb9, 0xaa,
+    0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe5, 0x9a, 0x3e, 0xbf, 0x95, 0x2b, 0xef, 0xeb, 0xef,
+    0x3f, 0x55, 0x25, 0xf9, 0xa0, 0xf0, 0x55, 0xe5, 0x9e, 0x94, 0xa8, 0xa6, 0x9c, 0xfa, 0xef, 0xbf,
+    0x54, 0xa5, 0x22, 0xe5, 0xff, 0xff, 0x2b, 0x00, 0x54, 0x55, 0xf1, 0xff, 0xff, 0x57, 0x55, 0xfe,
+    0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0x79, 0x79, 0x5e, 0xe5, 0xaa, 0xe6, 0x9a, 0xa9, 0xbe,
+    0x5a, 0x65, 0xfa, 0x95, 0x6b, 0xfa, 0x3c, 0x56, 0xae, 0xbc, 0xaf, 0xa7, 0xff, 0x54, 0x95, 0xe5,
+    0x83, 0xc2, 0x57, 0x95, 0x57, 0x52, 0xa2, 0x9a, 0x72, 0xea, 0xbf, 0xff, 0x52, 0x95, 0x8a, 0x54,
+    0xf9, 0xff, 0xaf, 0x00, 0x50, 0x55, 0x55, 0xfc, 0xff, 0x5f, 0x55, 0xf9, 0xef, 0xff, 0xaf, 0x56,
+    0x55, 0xfe, 0xaf, 0xe4, 0xe5, 0x55, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0xfa, 0x6a, 0x95, 0xe9, 0x57,
+    0xae, 0xe9, 0xf3, 0x58, 0xb9, 0xf2, 0xbe, 0x95, 0xfe, 0x53, 0x55, 0x96, 0x0f, 0x0a, 0x5f, 0x55,
+    0x55, 0x49, 0x89, 0x4a, 0xca, 0xa9, 0xf3, 0xfe, 0x49, 0x55, 0x2a, 0x52, 0x55, 0xf9, 0xbf, 0x02,
+    0x40, 0x55, 0x55, 0x55, 0xfc, 0x7f, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf, 0x92,
+    0x95, 0x57, 0x55, 0xae, 0x6a, 0xae, 0x99, 0xea, 0xa9, 0x55, 0xa6, 0x5f, 0xb9, 0xa6, 0xcf, 0x61,
+    0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x59, 0x26, 0xa8, 0x7c, 0x55, 0x55, 0x65, 0x25, 0x2a,
+    0x29, 0xa7, 0xce, 0x5b, 0x25, 0x55, 0xa9, 0x48, 0x55, 0x55, 0xf9, 0x0a, 0x00, 0x55, 0x55, 0x55,
+    0x55, 0xfc, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xbf, 0x5a, 0x56, 0x5e, 0x55, 0xb9,
+    0xaa, 0xb9, 0x66, 0xaa, 0xa5, 0x56, 0x99, 0x7e, 0xe5, 0x9a, 0x3e, 0x85, 0x95, 0x2b, 0xef, 0x5b,
+    0xe9, 0x3f, 0x55, 0x65, 0x95, 0xa0, 0xf2, 0x55, 0x55, 0x95, 0x95, 0xa8, 0xa4, 0x9c, 0x3a, 0x5f,
+    0x95, 0x54, 0xa5, 0x22, 0x55, 0x55, 0x55, 0x2a, 0x00, 0x54, 0x55, 0x55, 0x55, 0x15, 0x57, 0x55,
+    0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6, 0x9a, 0xa9,
+    0xfe, 0x5a, 0x65, 0xfa, 0x9c, 0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54, 0x95,
+    0xe4, 0x83, 0xc2, 0x5b, 0xbe, 0xfb, 0x53, 0xa2, 0x8a, 0x72, 0xea, 0xbf, 0xff, 0x92, 0xbf, 0x8a,
+    0xba, 0xfb, 0xbe, 0xab, 0xaa, 0xca, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x55, 0xf9, 0xef, 0xff, 0xaf,
+    0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95, 0xe9,
+    0x73, 0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a, 0x6f,
+    0xf9, 0xee, 0x4f, 0x89, 0x2a, 0xca, 0xa9, 0xff, 0xfe, 0x4b, 0xfe, 0x2a, 0xea, 0xee, 0xfb, 0xae,
+    0xaa, 0x6a, 0xfc, 0xff, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9, 0xbf,
+    0x92, 0xff, 0xe7, 0x55, 0xae, 0x68, 0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0xcf, 0xb9, 0xa6, 0xcf,
+    0x6f, 0xe5, 0xca, 0xfb, 0xfa, 0xfb, 0x4f, 0x55, 0x49, 0x3e, 0x28, 0xbc, 0xe5, 0xbb, 0x3f, 0x25,
+    0xaa, 0x28, 0xa7, 0xfe, 0xfb, 0x2f, 0xf9, 0xab, 0xa8, 0xbb, 0xef, 0xbb, 0xaa, 0xaa, 0xc5, 0xff,
+    0xff, 0xff, 0xff, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x9f, 0x57,
+    0xb9, 0xa2, 0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe7, 0x9a, 0x3e, 0xbf, 0x95, 0x2b, 0xef,
+    0xeb, 0xef, 0x3f, 0x55, 0x25, 0xf9, 0xa0, 0xf0, 0x96, 0xe7, 0xfe, 0x94, 0xa8, 0xa2, 0x9c, 0xfa,
+    0xef, 0xbf, 0xe4, 0xa7, 0xa2, 0xee, 0xbe, 0xef, 0xaa, 0xaa, 0x56, 0xfc, 0xff, 0xff, 0xff, 0x57,
+    0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x7f, 0x5e, 0xe5, 0x8a, 0xe6, 0x9a,
+    0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x9c, 0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff, 0x54,
+    0x95, 0xe4, 0x83, 0xc2, 0x5b, 0x96, 0xfb, 0x53, 0xa2, 0x8a, 0x72, 0xea, 0xbf, 0xff, 0x92, 0x97,
+    0x8a, 0xba, 0xfb, 0xbe, 0xab, 0xaa, 0x5a, 0xc5, 0xff, 0xff, 0xff, 0x5f, 0x55, 0xf9, 0xef, 0xff,
+    0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xff, 0x79, 0x95, 0x2b, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b, 0x95,
+    0xe9, 0x73, 0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xfe, 0xfe, 0x53, 0x55, 0x92, 0x0f, 0x0a,
+    0x6f, 0x55, 0xee, 0x4f, 0x89, 0x2a, 0xca, 0xa9, 0xff, 0xfe, 0x4b, 0x56, 0x2a, 0xea, 0xee, 0xfb,
+    0xae, 0xaa, 0x6a, 0x55, 0xfc, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55, 0xf9,
+    0xbf, 0x92, 0xff, 0xe7, 0x55, 0xae, 0x68, 0xae, 0x99, 0xea, 0xaf, 0x55, 0xa6, 0xcf, 0xb9, 0xa6,
+    0xcf, 0x6f, 0xe5, 0xca, 0xfb, 0xfa, 0xfb, 0x4f, 0x55, 0x49, 0x3e, 0x28, 0x7c, 0x55, 0xb9, 0x3f,
+    0x25, 0xaa, 0x28, 0xa7, 0xfe, 0xfb, 0x2f, 0x55, 0xa9, 0xa8, 0xbb, 0xef, 0xbb, 0xaa, 0xaa, 0x55,
+    0xc5, 0xff, 0xff, 0xff, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0xfe, 0x9f,
+    0x57, 0xb9, 0xa2, 0xb9, 0x66, 0xaa, 0xbf, 0x56, 0x99, 0x3e, 0xe7, 0x9a, 0x3e, 0xbf, 0x95, 0x2b,
+    0xef, 0xeb, 0xef, 0x3f, 0x55, 0x25, 0xf9, 0xa0, 0xf0, 0x55, 0xe5, 0xbe, 0x94, 0xa8, 0xa6, 0x9c,
+    0xfa, 0xef, 0xbf, 0x54, 0xa5, 0xa2, 0xe6, 0xbe, 0xef, 0xaa, 0xaa, 0x56, 0x55, 0xfc, 0xff, 0xff,
+    0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0xf9, 0x7b, 0x5e, 0xe5, 0xaa, 0xe6,
+    0x9a, 0xa9, 0xfe, 0x5a, 0x65, 0xfa, 0x94, 0x6b, 0xfa, 0xfc, 0x56, 0xae, 0xbc, 0xaf, 0xbf, 0xff,
+    0x54, 0x95, 0xe4, 0x83, 0xc2, 0x57, 0x95, 0x7b, 0x52, 0xa2, 0x9a, 0x72, 0xea, 0xbf, 0xff, 0x52,
+    0x95, 0x8a, 0x96, 0xfb, 0xbe, 0xab, 0xaa, 0x5a, 0x55, 0xc5, 0xff, 0xff, 0x5f, 0x55, 0xf9, 0xef,
+    0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xe7, 0x79, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0xfa, 0x6b,
+    0x95, 0xe9, 0x53, 0xae, 0xe9, 0xf3, 0x5b, 0xb9, 0xf2, 0xbe, 0xbe, 0xfe, 0x53, 0x55, 0x96, 0x0f,
+    0x0a, 0x5f, 0x55, 0x6e, 0x49, 0x89, 0x6a, 0xca, 0xa9, 0xff, 0xfe, 0x4b, 0x55, 0x2a, 0x5a, 0xe6,
+    0xfb, 0xae, 0xaa, 0x6a, 0x55, 0x55, 0xfc, 0xff, 0x7f, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a, 0x55,
+    0xf9, 0xbf, 0x92, 0x97, 0xe7, 0x55, 0xae, 0x6a, 0xae, 0x99, 0xea, 0xab, 0x55, 0xa6, 0x5f, 0xb9,
+    0xa6, 0xcf, 0x63, 0xe5, 0xca, 0xfb, 0x7a, 0xfa, 0x4f, 0x55, 0x59, 0x3e, 0x28, 0x7c, 0x55, 0x79,
+    0x25, 0x25, 0xaa, 0x29, 0xa7, 0xfe, 0xfb, 0x2f, 0x55, 0xa9, 0x68, 0x95, 0xef, 0xbb, 0xaa, 0xaa,
+    0x55, 0x55, 0xc5, 0xff, 0xff, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a, 0x5e,
+    0x9e, 0x57, 0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xaf, 0x56, 0x99, 0x7e, 0xe5, 0x9a, 0x3e, 0x8f, 0x95,
+    0x2b, 0xef, 0xeb, 0xe9, 0x3f, 0x55, 0x65, 0xf9, 0xa0, 0xf0, 0x55, 0xe5, 0x95, 0x94, 0xa8, 0xa6,
+    0x9c, 0xfa, 0xef, 0x9f, 0x54, 0xa5, 0xa2, 0x55, 0x9e, 0xef, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xfc,
+    0xff, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0x79, 0x79, 0x56, 0xe5, 0xaa,
+    0xe6, 0x9a, 0xa9, 0xbe, 0x5a, 0x65, 0xfa, 0x95, 0x6b, 0xfa, 0x3c, 0x56, 0xae, 0xbc, 0xaf, 0xa5,
+    0xff, 0x54, 0x95, 0xe5, 0x83, 0xc2, 0x57, 0x95, 0x55, 0x52, 0xa2, 0x92, 0x72, 0xea, 0xbf, 0x7f,
+    0x52, 0x95, 0x8a, 0x56, 0x59, 0xbe, 0xab, 0xaa, 0x5a, 0x55, 0x55, 0xc5, 0xff, 0x5f, 0x55, 0xf9,
+    0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0xe4, 0xe5, 0x55, 0x95, 0xab, 0x9a, 0x6b, 0xa6, 0xfa,
+    0x6a, 0x95, 0xe9, 0x57, 0xae, 0xe9, 0xf3, 0x58, 0xb9, 0xf2, 0xbe, 0x95, 0xfe, 0x53, 0x55, 0x96,
+    0x0f, 0x0a, 0x5f, 0x55, 0x55, 0x49, 0x89, 0x4a, 0xca, 0xa9, 0xf3, 0xfe, 0x49, 0x55, 0x2a, 0x5a,
+    0x55, 0xf9, 0xae, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0xfc, 0x7f, 0x55, 0xe5, 0xbf, 0xff, 0xbf, 0x5a,
+    0x55, 0xf9, 0xbf, 0x92, 0x97, 0x57, 0x55, 0xae, 0x6a, 0xae, 0x99, 0xea, 0xab, 0x55, 0xa6, 0x5f,
+    0xb9, 0xa6, 0xcf, 0x63, 0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x59, 0x3e, 0x28, 0x7c, 0x55,
+    0x55, 0x65, 0x25, 0x2a, 0x29, 0xa7, 0xce, 0xfb, 0x25, 0x55, 0xa9, 0x68, 0x55, 0xe5, 0xb9, 0xaa,
+    0xaa, 0x55, 0x55, 0x55, 0xc5, 0xff, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xff, 0x4a,
+    0x5e, 0x5e, 0x55, 0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xaf, 0x56, 0x99, 0x7e, 0xe5, 0x9a, 0x3e, 0x8f,
+    0x95, 0x2b, 0xef, 0x5b, 0xe9, 0x3f, 0x55, 0x65, 0xb9, 0xa0, 0xf2, 0x55, 0x55, 0x95, 0x95, 0xa8,
+    0xa4, 0x9c, 0x3a, 0xef, 0x95, 0x54, 0xa5, 0xa2, 0x55, 0x95, 0xe5, 0xaa, 0xaa, 0x56, 0x55, 0x55,
+    0x55, 0xfc, 0x57, 0x55, 0xfe, 0xfb, 0xff, 0xab, 0x55, 0x95, 0xff, 0x2b, 0x59, 0x79, 0x55, 0xe5,
+    0xaa, 0xe6, 0x9a, 0xa9, 0x9e, 0x5a, 0x65, 0xfa, 0x95, 0x6b, 0xfa, 0x1c, 0x56, 0xae, 0xbc, 0x6f,
+    0xa5, 0xff, 0x54, 0x95, 0x65, 0x82, 0xca, 0x57, 0x55, 0x55, 0x56, 0xa2, 0x92, 0x72, 0xea, 0xbc,
+    0x55, 0x52, 0x95, 0x8a, 0x56, 0x55, 0x95, 0xab, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0xc5, 0x5f, 0x55,
+    0xf9, 0xef, 0xff, 0xaf, 0x56, 0x55, 0xfe, 0xaf, 0x64, 0xe5, 0x55, 0x95, 0xab, 0x9a, 0x6b, 0xa6,
+    0x7a, 0x6a, 0x95, 0xe9, 0x57, 0xae, 0xe9, 0x73, 0x58, 0xb9, 0xf2, 0xbe, 0x95, 0xfe, 0x53, 0x55,
+    0x96, 0x09, 0x2a, 0x5f, 0x55, 0x55, 0x59, 0x89, 0x4a, 0xca, 0xa9, 0xf3, 0x56, 0x49, 0x55, 0x2a,
+    0x5a, 0x55, 0x55, 0xa6, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x7c, 0x55, 0xe5, 0xbf, 0xff, 0xbf,
+    0x5a, 0x55, 0xf9, 0xaf, 0x96, 0x95, 0x57, 0x55, 0xae, 0x6a, 0xae, 0x99, 0x6a, 0xa9, 0x55, 0xa6,
+    0x5f, 0xb9, 0xa6, 0x4f, 0x61, 0xe5, 0xca, 0xfb, 0x56, 0xfa, 0x4f, 0x55, 0x59, 0x25, 0xa8, 0x7c,
+    0x55, 0x55, 0x65, 0x25, 0x2a, 0x29, 0xa7, 0xce, 0x57, 0x25, 0x55, 0xa9, 0x68, 0x55, 0x55, 0x95,
+    0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xc5, 0x55, 0x95, 0xff, 0xfe, 0xff, 0x6a, 0x55, 0xe5, 0xbf,
+    0x5a, 0x56, 0x5e, 0x55, 0xb9, 0xaa, 0xb9, 0x66, 0xaa, 0xa5, 0x56, 0x99, 0x7e, 0xe5, 0x9a, 0x3e,
+    0x85, 0x95, 0x2b, 0xef, 0x5b, 0xe9, 0x3f, 0x55, 0x65, 0x95, 0xa0, 0xf2, 0x55, 0x55, 0x95, 0x95,
+    0xa8, 0xa4, 0x9c, 0x3a, 0x5f, 0x95, 0x54, 0xa5, 0xa2, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x56, 0x55,
+    0x55, 0x55, 0x55, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x73, 0xc4, 0x1c, 0x33,
+    0xc3, 0x3c, 0x00, 0x06, 0x47, 0x1a, 0x2f, 0x60, 0x49, 0x85, 0x51, 0x51, 0x21, 0x3b, 0x00, 0x3f,
+    0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30,
+    0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1,
+    0xcf, 0x7f, 0xfc, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xc0, 0x1c, 0x31, 0xc7, 0xcc, 0x30, 0x0f,
+    0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58, 0x52, 0x61, 0x54, 0x54, 0xc8, 0x0e, 0xc0, 0xcf, 0x87, 0x30,
+    0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca,
+    0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f,
+    0xfc, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0x47, 0xcc, 0x11, 0x33, 0xcc, 0x03, 0x60, 0x70,
+    0xa4, 0xf1, 0x02, 0x96, 0x54, 0x18, 0x15, 0x15, 0xb2, 0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29,
+    0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa,
+    0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0xfc, 0xff,
+    0xff, 0xff, 0x03, 0x00, 0x00, 0xcc, 0x11, 0x73, 0xc4, 0x0c, 0xf3, 0x00, 0x18, 0x1c, 0x69, 0xbc,
+    0x80, 0x25, 0x15, 0x46, 0x45, 0x85, 0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a,
+    0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70,
+    0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0xfc, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x73, 0xc4, 0x1c, 0x11, 0xc3, 0x3c, 0x00, 0x06, 0x47, 0x1a, 0x2f, 0x60, 0x49,
+    0x85, 0x51, 0x51, 0x21, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf,
+    0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03,
+    0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0xfc, 0xff, 0xff, 0x3f, 0x00, 0x00,
+    0xc0, 0x1c, 0x31, 0x47, 0xc4, 0x30, 0x0f, 0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58, 0x52, 0x61, 0x54,
+    0x54, 0xc8, 0x0e, 0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81,
+    0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c,
+    0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0x47,
+    0xcc, 0x11, 0x11, 0xcc, 0x03, 0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96, 0x54, 0x18, 0x15, 0x15, 0xb2,
+    0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03,
+    0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54,
+    0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0xfc, 0xff, 0xff, 0x03, 0x00, 0x00, 0xcc, 0x11, 0x73, 0x44,
+    0x04, 0xf3, 0x00, 0x18, 0x1c, 0x69, 0xbc, 0x80, 0x25, 0x15, 0x46, 0x45, 0x85, 0xec, 0x00, 0xfc,
+    0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2,
+    0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7,
+    0x3f, 0xff, 0x55, 0x55, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x71, 0xc4, 0x1c, 0x11, 0xc1, 0x3c,
+    0x00, 0x06, 0x47, 0x1a, 0x2f, 0x60, 0x49, 0x85, 0x51, 0x51, 0x01, 0x3b, 0x00, 0x3f, 0x1f, 0xc2,
+    0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29,
+    0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f,
+    0x55, 0x55, 0xfc, 0xff, 0x3f, 0x00, 0x00, 0x40, 0x1c, 0x31, 0x47, 0x44, 0x30, 0x0f, 0x80, 0xc1,
+    0x91, 0xc6, 0x0b, 0x58, 0x52, 0x61, 0x54, 0x54, 0xc0, 0x0e, 0xc0, 0xc3, 0x87, 0x30, 0x38, 0xa7,
+    0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8,
+    0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x55,
+    0xfc, 0xff, 0x0f, 0x00, 0x00, 0x10, 0x47, 0xcc, 0x11, 0x11, 0xcc, 0x03, 0x60, 0x70, 0xa4, 0xf1,
+    0x02, 0x96, 0x54, 0x18, 0x15, 0x15, 0xb0, 0x03, 0x70, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa,
+    0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1,
+    0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0xfc, 0xff,
+    0x03, 0x00, 0x00, 0xc4, 0x11, 0x73, 0x44, 0x04, 0xf3, 0x00, 0x18, 0x1c, 0x69, 0xbc, 0x80, 0x25,
+    0x15, 0x46, 0x45, 0x05, 0xec, 0x00, 0x14, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf,
+    0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f,
+    0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0xfc, 0xff, 0x00, 0x00,
+    0x00, 0x71, 0xc4, 0x1c, 0x11, 0xc1, 0x3c, 0x00, 0x06, 0x47, 0x1a, 0x2f, 0x60, 0x49, 0x85, 0x51,
+    0x51, 0x01, 0x3b, 0x00, 0x05, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05,
+    0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0,
+    0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0xfc, 0x3f, 0x00, 0x00, 0x40, 0x1c,
+    0x31, 0x47, 0x44, 0x30, 0x0f, 0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58, 0x52, 0x61, 0x54, 0x54, 0xc0,
+    0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f,
+    0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50,
+    0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x55, 0x55, 0xfc, 0x0f, 0x00, 0x00, 0x10, 0x47, 0xcc, 0x11,
+    0x11, 0xcc, 0x00, 0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96, 0x54, 0x18, 0x15, 0x15, 0xb0, 0x03, 0x54,
+    0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b,
+    0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f,
+    0xff, 0xfc, 0x57, 0x55, 0x55, 0x55, 0xfc, 0x03, 0x00, 0x00, 0xc4, 0x11, 0x73, 0x44, 0x04, 0x13,
+    0x00, 0x18, 0x1c, 0x69, 0xbc, 0x80, 0x25, 0x15, 0x46, 0x45, 0x05, 0xec, 0x00, 0x15, 0x7c, 0x08,
+    0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4,
+    0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff,
+    0x55, 0x55, 0x55, 0x55, 0xfc, 0x00, 0x00, 0x00, 0x71, 0xc4, 0x1c, 0x11, 0xc1, 0x04, 0x00, 0x06,
+    0x47, 0x1a, 0x2f, 0x60, 0x49, 0x85, 0x51, 0x51, 0x01, 0x3b, 0x40, 0x05, 0x1f, 0xc2, 0xe0, 0x9c,
+    0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0,
+    0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55,
+    0x55, 0x55, 0x3c, 0x00, 0x00, 0x40, 0x1c, 0x11, 0x47, 0x44, 0x30, 0x01, 0x80, 0xc1, 0x91, 0xc6,
+    0x0b, 0x58, 0x52, 0x61, 0x54, 0x54, 0xc0, 0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9,
+    0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04,
+    0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x55, 0x55, 0x55,
+    0x0c, 0x00, 0x00, 0x10, 0x47, 0xc4, 0x11, 0x11, 0x4c, 0x00, 0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96,
+    0x54, 0x18, 0x15, 0x15, 0xb0, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff,
+    0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f,
+    0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+    0x00, 0xc4, 0x11, 0x71, 0x44, 0x04, 0x13, 0x00, 0x18, 0x1c, 0x69, 0xbc, 0x80, 0x25, 0x15, 0x46,
+    0x45, 0x05, 0xec, 0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15,
+    0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0,
+    0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x73,
+    0xc4, 0x1c, 0xff, 0xcf, 0x3c, 0x00, 0x06, 0x47, 0x1a, 0x2f, 0x60, 0x49, 0x86, 0x51, 0x51, 0x21,
+    0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f,
+    0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40,
+    0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0xe5, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xc0, 0x1c, 0x31, 0x57,
+    0xfc, 0x33, 0x0f, 0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58, 0x92, 0x61, 0x54, 0x54, 0xc8, 0x0e, 0xc0,
+    0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f,
+    0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c,
+    0xfc, 0xf3, 0x5f, 0x95, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0x47, 0xcc, 0x55, 0xf1, 0xcc,
+    0x03, 0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96, 0x64, 0x18, 0x15, 0x15, 0xb2, 0x03, 0xf0, 0xf3, 0x21,
+    0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90,
+    0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc,
+    0x57, 0x55, 0xfe, 0xff, 0xff, 0x03, 0x00, 0x00, 0xfc, 0x11, 0x73, 0x55, 0x05, 0xf3, 0x00, 0x18,
+    0x1c, 0x69, 0xbc, 0x80, 0x25, 0x19, 0x46, 0x45, 0x85, 0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83, 0x73,
+    0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83,
+    0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55,
+    0xf9, 0xff, 0xff, 0x00, 0x00, 0x40, 0x71, 0xc4, 0x5c, 0x55, 0xc1, 0x3c, 0x00, 0x06, 0x47, 0x1a,
+    0x2f, 0x60, 0x49, 0x85, 0x51, 0x51, 0x01, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7,
+    0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11,
+    0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0xfe,
+    0x3f, 0x00, 0x00, 0x40, 0x1c, 0x32, 0x47, 0x44, 0x30, 0x0f, 0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58,
+    0x52, 0x61, 0x54, 0x54, 0xc2, 0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe,
+    0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff,
+    0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x55, 0x55, 0xe5, 0x0f, 0x00,
+    0x00, 0x10, 0x47, 0xfc, 0x11, 0x11, 0x5c, 0x00, 0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96, 0x54, 0x18,
+    0x15, 0x95, 0xb0, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55,
+    0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00,
+    0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0x55, 0x95, 0x03, 0x00, 0x00, 0xc4,
+    0x51, 0x71, 0x44, 0x04, 0x17, 0x00, 0x18, 0x1c, 0x69, 0xbc, 0x80, 0x25, 0x15, 0x46, 0x45, 0x25,
+    0xec, 0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff,
+    0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02,
+    0x55, 0xc4, 0xc7, 0x3f, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0xa8, 0x7f, 0xc4, 0x1c,
+    0xff, 0xcf, 0x3c, 0x00, 0x06, 0x47, 0x1a, 0x2f, 0x60, 0x49, 0x8e, 0x51, 0x51, 0x21, 0x3b, 0x00,
+    0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf,
+    0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1,
+    0xf1, 0xcf, 0x7f, 0xe5, 0xff, 0xff, 0xff, 0x3f, 0x02, 0x80, 0xe8, 0x1f, 0x31, 0x57, 0xfc, 0x33,
+    0x0f, 0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58, 0x92, 0x63, 0x54, 0x54, 0xc8, 0x0e, 0xc0, 0xcf, 0x87,
+    0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40,
+    0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3,
+    0x5f, 0x95, 0xff, 0xff, 0xff, 0x0f, 0x02, 0xa0, 0xf8, 0x47, 0xcc, 0x55, 0xf1, 0xcc, 0x03, 0x60,
+    0x70, 0xa4, 0xf1, 0x02, 0x96, 0xe4, 0x18, 0x15, 0x15, 0xb2, 0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce,
+    0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c,
+    0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55,
+    0xee, 0xff, 0xff, 0x03, 0x0a, 0xa8, 0xfc, 0x11, 0x73, 0x55, 0x05, 0xf3, 0x00, 0x18, 0x1c, 0x69,
+    0xbc, 0x80, 0x25, 0x39, 0x46, 0x45, 0x85, 0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e,
+    0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47,
+    0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x95, 0xf9, 0xff,
+    0xff, 0x80, 0x02, 0x6a, 0x7c, 0xc4, 0x5c, 0x55, 0xc1, 0x3c, 0x00, 0x06, 0x47, 0x1a, 0x2f, 0x60,
+    0x49, 0x86, 0x51, 0x51, 0x21, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb,
+    0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff,
+    0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0xfe, 0xff, 0x3f, 0xa0,
+    0x80, 0x5a, 0x1c, 0x31, 0x57, 0x55, 0x30, 0x0f, 0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58, 0x52, 0x61,
+    0x54, 0x54, 0xc8, 0x0e, 0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55,
+    0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02,
+    0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x95, 0xff, 0xff, 0x0f, 0x28, 0xa0, 0x56,
+    0x44, 0xcc, 0x55, 0x15, 0xcc, 0x03, 0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96, 0x54, 0x18, 0x15, 0x15,
+    0xb2, 0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe,
+    0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08,
+    0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0xe5, 0xff, 0x03, 0x20, 0x00, 0xc4, 0xec, 0x7f,
+    0x44, 0x04, 0xf3, 0x00, 0x18, 0x1c, 0x69, 0xb8, 0x80, 0xa5, 0x15, 0x46, 0x45, 0x25, 0xec, 0x00,
+    0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff,
+    0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4,
+    0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0xf9, 0xff, 0x00, 0x08, 0x00, 0x71, 0xf8, 0x1f, 0x11, 0xc1,
+    0x3c, 0x00, 0x06, 0x47, 0x1a, 0x2e, 0x60, 0x69, 0x85, 0x51, 0x51, 0x09, 0x3b, 0x40, 0x05, 0x1f,
+    0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01,
+    0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf,
+    0x7f, 0x55, 0x55, 0x55, 0x95, 0x3b, 0x00, 0x2a, 0x40, 0x9c, 0xfc, 0x47, 0x44, 0x70, 0x01, 0x80,
+    0xc1, 0x91, 0x86, 0x0b, 0x58, 0x5a, 0x61, 0x54, 0x54, 0xc2, 0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38,
+    0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31,
+    0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55,
+    0x55, 0x55, 0xe5, 0x0e, 0x00, 0x0a, 0x10, 0x67, 0xfc, 0x11, 0x11, 0x5c, 0x00, 0x60, 0x70, 0xa4,
+    0xe1, 0x02, 0x96, 0x56, 0x18, 0x15, 0x95, 0xb0, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a,
+    0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f,
+    0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0x55,
+    0x99, 0x03, 0x80, 0x02, 0xc4, 0x59, 0x7c, 0x44, 0x04, 0x17, 0x00, 0x18, 0x1c, 0x69, 0xb8, 0x80,
+    0xa5, 0x15, 0x46, 0x45, 0x25, 0xec, 0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef,
+    0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc,
+    0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0x55, 0xe5, 0x00,
+    0xa0, 0x00, 0x71, 0x56, 0x1c, 0x11, 0xc1, 0x05, 0x00, 0x06, 0x47, 0x1a, 0x2e, 0x60, 0x69, 0x85,
+    0x51, 0x51, 0x09, 0x3b, 0x40, 0x05, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55,
+    0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08,
+    0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0x55, 0x39, 0x00, 0x28, 0x40,
+    0x9c, 0x55, 0x44, 0x44, 0x70, 0x01, 0x80, 0xc1, 0x91, 0x86, 0x0b, 0x58, 0x5a, 0x61, 0x54, 0x54,
+    0xc2, 0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8,
+    0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20,
+    0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x9f, 0xbb, 0xbb, 0xff, 0xff, 0xaf, 0x2a, 0xa0, 0xfa, 0x47, 0xcc,
+    0xfc, 0xff, 0xcc, 0x03, 0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96, 0xe4, 0x1b, 0x15, 0x15, 0xb2, 0x03,
+    0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc,
+    0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11,
+    0x1f, 0xff, 0xfc, 0xe7, 0xee, 0xee, 0xff, 0xff, 0xab, 0x0a, 0xa8, 0xfe, 0x11, 0x73, 0xfc, 0x3f,
+    0xf3, 0x00, 0x18, 0x1c, 0x69, 0xbc, 0x80, 0x25, 0xf9, 0x46, 0x45, 0x85, 0xec, 0x00, 0xfc, 0x7c,
+    0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04,
+    0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f,
+    0xff, 0x99, 0xbb, 0xfb, 0xff, 0xff, 0xaa, 0x02, 0xaa, 0x7f, 0xc4, 0x5c, 0xfc, 0xcf, 0x3c, 0x00,
+    0x06, 0x47, 0x1a, 0x2f, 0x60, 0x49, 0xbe, 0x51, 0x51, 0x21, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0,
+    0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7,
+    0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0xe5,
+    0xee, 0xfe, 0xff, 0xbf, 0xaa, 0x80, 0xea, 0x1f, 0x31, 0x57, 0xfc, 0x33, 0x0f, 0x80, 0xc1, 0x91,
+    0xc6, 0x0b, 0x58, 0x92, 0x6f, 0x54, 0x54, 0xc8, 0x0e, 0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8,
+    0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f,
+    0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x99, 0xbb, 0xff,
+    0xff, 0xaf, 0x2a, 0xa0, 0xfa, 0x47, 0xcc, 0x55, 0xfc, 0xcc, 0x03, 0x60, 0x70, 0xa4, 0xf1, 0x02,
+    0x96, 0xe4, 0x1b, 0x15, 0x15, 0xb2, 0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc,
+    0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1,
+    0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0xe5, 0xee, 0xff, 0xff, 0xab,
+    0x0a, 0xa8, 0xfe, 0x11, 0x73, 0x55, 0x3c, 0xf3, 0x00, 0x18, 0x1c, 0x69, 0xbc, 0x80, 0x25, 0xf9,
+    0x46, 0x45, 0x85, 0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56,
+    0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20,
+    0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x99, 0xfb, 0xff, 0xff, 0xaa, 0x02, 0xaa,
+    0x7f, 0xc4, 0x5c, 0x55, 0xcc, 0x3c, 0x00, 0x06, 0x47, 0x1a, 0x2f, 0x60, 0x49, 0xbe, 0x51, 0x51,
+    0x21, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2,
+    0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80,
+    0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xff, 0xbf, 0xaa, 0x80, 0xea, 0x1f, 0x31,
+    0x57, 0x55, 0x30, 0x0f, 0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58, 0x92, 0x6f, 0x54, 0x54, 0xc8, 0x0e,
+    0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0,
+    0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45,
+    0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x95, 0xff, 0xff, 0x0f, 0x28, 0xa0, 0x56, 0x46, 0xcc, 0x55, 0x15,
+    0xcc, 0x03, 0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96, 0x54, 0x18, 0x15, 0x15, 0xb2, 0x03, 0xf0, 0xf3,
+    0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13,
+    0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff,
+    0xfc, 0x57, 0x55, 0xe5, 0xff, 0xff, 0x03, 0x0a, 0xa8, 0x95, 0x11, 0x73, 0x55, 0x45, 0xf0, 0x00,
+    0x18, 0x1c, 0x69, 0xbc, 0x80, 0x25, 0x15, 0x46, 0x45, 0x85, 0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83,
+    0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c,
+    0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55,
+    0x55, 0x55, 0xf9, 0xee, 0x00, 0xa8, 0x00, 0x71, 0xfa, 0x1f, 0x11, 0xc1, 0x3c, 0x00, 0x06, 0x47,
+    0x1a, 0x2e, 0x60, 0x69, 0x85, 0x51, 0x51, 0x09, 0x3b, 0x40, 0x05, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2,
+    0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff,
+    0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55,
+    0x9e, 0x3b, 0x00, 0x2a, 0x40, 0x9c, 0xfe, 0x47, 0x44, 0x70, 0x0c, 0x80, 0xc1, 0x91, 0x86, 0x0b,
+    0x58, 0x5a, 0x61, 0x54, 0x54, 0xc2, 0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2,
+    0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7,
+    0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x55, 0x95, 0xe5, 0x0e,
+    0x80, 0x0a, 0x10, 0xa7, 0xff, 0x11, 0x11, 0x5c, 0x00, 0x60, 0x70, 0xa4, 0xe1, 0x02, 0x96, 0x56,
+    0x18, 0x15, 0x95, 0xb0, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a,
+    0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80,
+    0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0x55, 0x99, 0x03, 0x80, 0x02,
+    0xc4, 0x59, 0x7e, 0x44, 0x04, 0x17, 0x00, 0x18, 0x1c, 0x69, 0xb8, 0x80, 0xa5, 0x15, 0x46, 0x45,
+    0x25, 0xec, 0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88,
+    0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03,
+    0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0x55, 0xe5, 0x00, 0xa0, 0x00, 0x71, 0x56,
+    0x19, 0x11, 0xc1, 0x05, 0x00, 0x06, 0x47, 0x1a, 0x2e, 0x60, 0x69, 0x85, 0x51, 0x51, 0x09, 0x3b,
+    0x40, 0x05, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0,
+    0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15,
+    0xf1, 0xf1, 0xcf, 0x7f, 0xe6, 0xee, 0xfe, 0xff, 0xbf, 0xaa, 0x80, 0xea, 0x1f, 0x31, 0x97, 0xff,
+    0x33, 0x0f, 0x80, 0xc1, 0x91, 0xc6, 0x0b, 0x58, 0x92, 0x6f, 0x54, 0x54, 0xc8, 0x0e, 0xc0, 0xcf,
+    0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c,
+    0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc,
+    0xf3, 0x5f, 0x95, 0xbb, 0xff, 0xff, 0xaf, 0x2a, 0xa0, 0xfa, 0x47, 0xcc, 0x55, 0xf9, 0xcc, 0x03,
+    0x60, 0x70, 0xa4, 0xf1, 0x02, 0x96, 0xe4, 0x1b, 0x15, 0x15, 0xb2, 0x03, 0xf0, 0xf3, 0x21, 0x0c,
+    0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72,
+    0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57,
+    0x55, 0xee, 0xff, 0xff, 0xab, 0x0a, 0xa8, 0xfe, 0x11, 0x73, 0x55, 0x25, 0xf3, 0x00, 0x18, 0x1c,
+    0x69, 0xbc, 0x82, 0x25, 0xf9, 0x46, 0x45, 0x85, 0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83, 0x73, 0x8a,
+    0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe,
+    0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x95, 0xfb,
+    0xff, 0xff, 0xaa, 0x02, 0xaa, 0x7f, 0xc8, 0x5c, 0x55, 0xc9, 0x3e, 0x80, 0x24, 0x47, 0x5a, 0xa1,
+    0x60, 0x49, 0xbe, 0x51, 0x51, 0x21, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca,
+    0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c,
+    0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0xbe, 0x3b,
+    0x00, 0x2a, 0x40, 0x9c, 0xfe, 0x47, 0x44, 0xb0, 0x0f, 0x80, 0xcc, 0x91, 0x96, 0x0b, 0x58, 0x5a,
+    0x61, 0x54, 0x54, 0xc2, 0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b,
+    0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00,
+    0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x55, 0x95, 0xef, 0x0e, 0x80, 0x0a,
+    0x10, 0xa7, 0xff, 0x11, 0x11, 0xec, 0x03, 0x60, 0x70, 0xa4, 0xe5, 0x02, 0x96, 0x56, 0x18, 0x15,
+    0x95, 0xb0, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20,
+    0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f,
+    0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0x65, 0xb9, 0x03, 0xa0, 0x02, 0xc4, 0xe9,
+    0x7f, 0x44, 0x04, 0x97, 0x00, 0x18, 0x1c, 0x69, 0xb8, 0x80, 0xa5, 0x15, 0x46, 0x45, 0x25, 0xec,
+    0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00,
+    0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55,
+    0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0x59, 0xee, 0x00, 0xa8, 0x00, 0x71, 0xfa, 0x1f, 0x11,
+    0xc1, 0x25, 0x00, 0x46, 0x44, 0x1a, 0x2e, 0x60, 0x69, 0x85, 0x51, 0x51, 0x09, 0x3b, 0x40, 0x05,
+    0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30,
+    0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1,
+    0xcf, 0x7f, 0x55, 0x55, 0x55, 0x55, 0x39, 0x00, 0x28, 0x40, 0x9c, 0x55, 0x46, 0x44, 0x70, 0x81,
+    0x80, 0xc1, 0x9c, 0x86, 0x0b, 0x58, 0x5a, 0x61, 0x54, 0x54, 0xc2, 0x0e, 0x50, 0xc1, 0x87, 0x30,
+    0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca,
+    0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f,
+    0x55, 0x55, 0x55, 0x55, 0x0e, 0x00, 0x0a, 0x10, 0x67, 0x95, 0x11, 0x11, 0x5c, 0x20, 0x60, 0x70,
+    0xa4, 0xe1, 0x02, 0x96, 0x56, 0x18, 0x15, 0x95, 0xb0, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29,
+    0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa,
+    0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0xee,
+    0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x6c, 0xb9,
+    0x02, 0xbe, 0xf9, 0x46, 0x3c, 0xbf, 0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a,
+    0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70,
+    0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee,
+    0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x58, 0xae, 0x80, 0x6f,
+    0xbe, 0x11, 0xcf, 0x2f, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf,
+    0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03,
+    0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa,
+    0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x94, 0x2b, 0xc8, 0x9b, 0x6f, 0x54,
+    0xf0, 0xcb, 0x0e, 0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81,
+    0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c,
+    0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xff, 0xff, 0xaf, 0x2a, 0xa0, 0xfa, 0x47,
+    0xcc, 0x55, 0x95, 0xcc, 0x03, 0x68, 0x72, 0xa4, 0xfc, 0x0a, 0x96, 0xe4, 0x1b, 0x15, 0x15, 0xb2,
+    0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03,
+    0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54,
+    0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xff, 0xff, 0xab, 0x0a, 0xa8, 0xfe, 0x11, 0x73, 0x55,
+    0x25, 0xf3, 0x00, 0x9a, 0x1c, 0x69, 0xbc, 0x82, 0x25, 0xf9, 0x46, 0x45, 0x85, 0xec, 0x00, 0xfc,
+    0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2,
+    0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7,
+    0x3f, 0xff, 0x55, 0x95, 0xfb, 0xff, 0xff, 0xaa, 0x02, 0xaa, 0x7f, 0xc8, 0x5c, 0x55, 0xc9, 0x3e,
+    0x80, 0x26, 0x47, 0x5a, 0xac, 0x60, 0x49, 0xbe, 0x51, 0x51, 0x21, 0x3b, 0x00, 0x3f, 0x1f, 0xc2,
+    0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29,
+    0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f,
+    0x55, 0xe5, 0xfe, 0xff, 0xbf, 0xaa, 0x80, 0xea, 0x1f, 0x32, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9,
+    0x91, 0x56, 0x28, 0x58, 0x92, 0x6f, 0x54, 0x54, 0xc8, 0x0e, 0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7,
+    0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8,
+    0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x55,
+    0x95, 0xef, 0xae, 0x8a, 0xaa, 0x3a, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5,
+    0x08, 0x96, 0xc6, 0x1b, 0x15, 0x95, 0xb0, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa,
+    0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1,
+    0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0xe5, 0xbb,
+    0x03, 0xa0, 0x02, 0xc4, 0xe9, 0x7f, 0x44, 0x04, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x80, 0xa5,
+    0x15, 0x46, 0x45, 0x25, 0xec, 0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf,
+    0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f,
+    0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0x59, 0xee, 0x00, 0xa8,
+    0x00, 0x71, 0xfa, 0x1f, 0x11, 0xc1, 0x25, 0x00, 0x86, 0x47, 0x1a, 0x2e, 0x60, 0x69, 0x85, 0x51,
+    0x51, 0x09, 0x3b, 0x40, 0x05, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05,
+    0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0,
+    0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0x55, 0x39, 0x00, 0x28, 0x40, 0x9c,
+    0x55, 0x46, 0x44, 0x70, 0x81, 0x80, 0xc1, 0x99, 0x86, 0x0b, 0x58, 0x5a, 0x61, 0x54, 0x54, 0xc2,
+    0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f,
+    0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50,
+    0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55,
+    0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0xf8, 0xe6, 0x1b, 0xf1, 0xfc, 0xb2, 0x03, 0xf0,
+    0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b,
+    0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f,
+    0xff, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb,
+    0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xbc, 0xf9, 0x46, 0x05, 0xbf, 0xec, 0x00, 0xfc, 0x7c, 0x08,
+    0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4,
+    0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff,
+    0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26,
+    0x47, 0x5a, 0xae, 0x60, 0x6c, 0xbe, 0x51, 0xc1, 0x2f, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c,
+    0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0,
+    0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0xe5,
+    0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96,
+    0x2b, 0x58, 0x98, 0x6f, 0x54, 0xf0, 0xcb, 0x0e, 0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9,
+    0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04,
+    0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xff, 0xff,
+    0xaf, 0x2a, 0xa0, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96,
+    0xe4, 0x1b, 0x15, 0x15, 0xb2, 0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff,
+    0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f,
+    0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0xe5, 0xbb, 0xab, 0xa2,
+    0xaa, 0xce, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xfc, 0x46,
+    0x45, 0x25, 0xec, 0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15,
+    0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0,
+    0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0xf9, 0xee, 0xaa, 0xa8, 0xaa, 0x73,
+    0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbc, 0x51, 0x51, 0x09,
+    0x3b, 0x40, 0x05, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f,
+    0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40,
+    0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0xbe, 0x3b, 0x00, 0xaa, 0x6a, 0x9c, 0xfe, 0x57,
+    0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x5a, 0x6c, 0x54, 0x54, 0xc2, 0x0e, 0x50,
+    0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f,
+    0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c,
+    0xfc, 0xf3, 0x5f, 0x55, 0x55, 0x95, 0xef, 0x0e, 0x80, 0x0a, 0x10, 0xa7, 0xff, 0x55, 0x95, 0xec,
+    0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0x56, 0x18, 0x15, 0x95, 0xb0, 0x03, 0x54, 0xf0, 0x21,
+    0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90,
+    0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc,
+    0x57, 0x55, 0x55, 0xe5, 0xbb, 0x03, 0xa0, 0x02, 0xc4, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a,
+    0x1c, 0x69, 0xb9, 0x82, 0xa5, 0x95, 0x44, 0x45, 0x25, 0xc9, 0x00, 0x15, 0x45, 0x08, 0x83, 0x73,
+    0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83,
+    0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55,
+    0x55, 0x55, 0xe5, 0x00, 0xa0, 0x00, 0x71, 0x56, 0x19, 0x11, 0xc1, 0x05, 0x02, 0x06, 0x67, 0x1a,
+    0x2e, 0x68, 0x69, 0x85, 0x5c, 0x51, 0x09, 0x3b, 0x40, 0x05, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7,
+    0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11,
+    0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0x55,
+    0x39, 0x00, 0x28, 0x40, 0x9c, 0x55, 0x46, 0x44, 0x70, 0x81, 0x80, 0xc1, 0x99, 0x86, 0x0b, 0x5a,
+    0x5a, 0x61, 0x54, 0x54, 0xc2, 0x0e, 0x50, 0xc1, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe,
+    0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff,
+    0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa,
+    0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0xfa, 0xe6, 0x1b,
+    0xfc, 0xfc, 0xb2, 0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55,
+    0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00,
+    0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe,
+    0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xbe, 0xf9, 0x46, 0x3c, 0xbf,
+    0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff,
+    0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02,
+    0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f,
+    0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0xa0, 0x6f, 0xbe, 0x51, 0xcc, 0x2f, 0x3b, 0x00,
+    0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf,
+    0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1,
+    0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2,
+    0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0xe8, 0x9b, 0x6f, 0x54, 0xf0, 0xcb, 0x0e, 0xc0, 0xcf, 0x87,
+    0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40,
+    0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3,
+    0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68,
+    0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfc, 0xb2, 0x03, 0xf0, 0xf3, 0x21, 0x0c, 0xce,
+    0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c,
+    0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55,
+    0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69,
+    0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x45, 0xbc, 0xec, 0x00, 0xfc, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e,
+    0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47,
+    0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb,
+    0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60,
+    0x69, 0xbe, 0x51, 0x51, 0x2c, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb,
+    0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff,
+    0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa,
+    0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f,
+    0x54, 0x54, 0xc8, 0x0e, 0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55,
+    0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02,
+    0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x59, 0x95, 0xef, 0xae, 0x8a, 0xaa, 0xfa,
+    0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0x95,
+    0xb0, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe,
+    0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08,
+    0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0xe5, 0xbb, 0x03, 0xa0, 0x02, 0xc4, 0xe9, 0x7f,
+    0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0x95, 0x46, 0x45, 0x25, 0xec, 0x00,
+    0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff,
+    0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4,
+    0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0xf9, 0xee, 0x00, 0xa8, 0x00, 0x71, 0xfa, 0x5f, 0x55, 0xc9,
+    0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xa5, 0x51, 0x51, 0x49, 0x38, 0x40, 0x05, 0x1f,
+    0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01,
+    0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf,
+    0x7f, 0x55, 0x55, 0x55, 0xbe, 0x3b, 0x00, 0x2a, 0x40, 0x9c, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0,
+    0xc9, 0x91, 0x96, 0x2b, 0x58, 0x5a, 0x69, 0x54, 0x54, 0x92, 0x0c, 0x50, 0x51, 0x84, 0x30, 0x38,
+    0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31,
+    0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55,
+    0x55, 0x95, 0xef, 0x0e, 0x80, 0x0a, 0x10, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4,
+    0xe5, 0x0a, 0x96, 0x56, 0x1a, 0x15, 0x95, 0x64, 0x00, 0x54, 0x14, 0x21, 0x0c, 0xce, 0x29, 0x7a,
+    0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f,
+    0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0x55,
+    0x95, 0x03, 0x80, 0x02, 0xc4, 0x59, 0x65, 0x44, 0x04, 0x17, 0x08, 0x18, 0x9c, 0x69, 0xb8, 0xa0,
+    0xa5, 0x15, 0x66, 0x45, 0x25, 0xec, 0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef,
+    0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc,
+    0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa,
+    0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0xa0, 0x6f, 0xbe,
+    0xe1, 0xcf, 0x2f, 0x3b, 0x00, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55,
+    0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08,
+    0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea,
+    0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0xe8, 0x9b, 0x6f, 0x54, 0xf2,
+    0xcb, 0x0e, 0xc0, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8,
+    0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20,
+    0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff,
+    0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03,
+    0xf0, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc,
+    0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11,
+    0x1f, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xe7, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25,
+    0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x45, 0xa5, 0xec, 0x00, 0xfc, 0x7c,
+    0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04,
+    0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f,
+    0xff, 0x55, 0x95, 0x7b, 0xf9, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80,
+    0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0x51, 0x29, 0x3b, 0x40, 0x3c, 0x1f, 0xc2, 0xe0,
+    0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7,
+    0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55,
+    0xe5, 0x56, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91,
+    0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0x54, 0xca, 0x0e, 0x50, 0xcc, 0x87, 0x30, 0x38, 0xa7, 0xe8,
+    0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f,
+    0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x79, 0x95,
+    0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a,
+    0x96, 0xe6, 0x1b, 0x15, 0x95, 0xb2, 0x03, 0x54, 0xf0, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc,
+    0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1,
+    0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0x55, 0xe5, 0xbb, 0x03,
+    0xa0, 0x02, 0xc4, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0x95,
+    0x46, 0x45, 0x25, 0xe9, 0x00, 0x15, 0x7c, 0x08, 0x83, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56,
+    0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20,
+    0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x55, 0x55, 0xf9, 0xee, 0x00, 0xa8, 0x00,
+    0x71, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xa5, 0x51, 0x51,
+    0x49, 0x3a, 0x40, 0x45, 0x1c, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2,
+    0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80,
+    0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0xbe, 0x3b, 0x00, 0x2a, 0x40, 0x9c, 0xfe,
+    0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x5a, 0x69, 0x54, 0x54, 0x92, 0x0e,
+    0x50, 0x51, 0x84, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0,
+    0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45,
+    0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x0e, 0x00, 0x0a, 0x10, 0x67, 0x95, 0x11, 0x11,
+    0x5c, 0x20, 0x60, 0x70, 0xa6, 0xe1, 0x82, 0x96, 0x56, 0x98, 0x15, 0x95, 0xb0, 0x0b, 0x54, 0xf0,
+    0x2c, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13,
+    0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff,
+    0xfc, 0x57, 0x55, 0x55, 0x55, 0x95, 0x03, 0x80, 0x02, 0xc4, 0x59, 0x65, 0x44, 0x04, 0x17, 0x08,
+    0x18, 0x9c, 0x69, 0xb8, 0xa0, 0xa5, 0x15, 0x66, 0x45, 0x25, 0xec, 0x02, 0x15, 0x7c, 0x08, 0x83,
+    0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c,
+    0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55,
+    0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47,
+    0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x90, 0xe0, 0xcc, 0xaa,
+    0xa7, 0xe8, 0xfb, 0xaf, 0xc5, 0x3f, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff,
+    0x11, 0x1c, 0xff, 0x03, 0x08, 0xb0, 0x80, 0x20, 0x17, 0xf1, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xfe,
+    0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b,
+    0xe8, 0x9b, 0x6f, 0x54, 0xf2, 0xcb, 0x0e, 0xc2, 0xcf, 0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2,
+    0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7,
+    0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae,
+    0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6,
+    0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x0c, 0xce, 0x29, 0x7a, 0xaa, 0xbc, 0xff, 0x5a,
+    0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80,
+    0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa,
+    0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85,
+    0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x80, 0x73, 0x8a, 0x9e, 0x2a, 0xef, 0xbf, 0x56, 0x15, 0x88,
+    0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03,
+    0x02, 0x55, 0xc4, 0xc7, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xf9, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa,
+    0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0x51, 0x29, 0x3b,
+    0x80, 0x3f, 0x1f, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca, 0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0,
+    0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15,
+    0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0x56, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55,
+    0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0x54, 0xca, 0x0e, 0x50, 0xce,
+    0x87, 0x30, 0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c,
+    0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc,
+    0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03,
+    0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09,
+    0xcc, 0xa9, 0x78, 0xaa, 0x65, 0xf1, 0x5a, 0x55, 0x08, 0xfe, 0x03, 0xc5, 0x0b, 0x13, 0x90, 0x72,
+    0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0xa2, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15, 0xff, 0xfc, 0x57,
+    0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c,
+    0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x42, 0x70, 0x2a,
+    0x9e, 0x6a, 0x59, 0xbc, 0x56, 0x15, 0x82, 0xff, 0x40, 0xf1, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe,
+    0x47, 0x70, 0xfc, 0x8f, 0x28, 0xc0, 0xab, 0x02, 0x55, 0x55, 0xc5, 0x3f, 0xff, 0x55, 0x55, 0x55,
+    0xf9, 0xee, 0x00, 0xa8, 0x00, 0x71, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae,
+    0x60, 0x69, 0xa5, 0x51, 0x51, 0x49, 0x3a, 0x40, 0x45, 0x19, 0xc2, 0xe0, 0x9c, 0xa2, 0xa7, 0xca,
+    0xfb, 0xaf, 0x55, 0x05, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c,
+    0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0xf1, 0xf1, 0xcf, 0x7f, 0x55, 0x55, 0x55, 0xbe, 0x3b,
+    0x00, 0x2a, 0x40, 0x9c, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x5a,
+    0x69, 0x54, 0x54, 0x92, 0x0e, 0x50, 0x51, 0x86, 0x30, 0x78, 0xa4, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b,
+    0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00,
+    0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa,
+    0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15,
+    0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xac, 0x7a, 0x8a, 0xbe, 0xff, 0x5a, 0xfc, 0x23,
+    0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0b,
+    0x08, 0x72, 0x11, 0xff, 0xff, 0xff, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9,
+    0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec,
+    0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xa8, 0x9e, 0xa2, 0xef, 0xbf, 0x16, 0xff, 0x88, 0xff, 0x00,
+    0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x02, 0x82, 0x5c,
+    0xc4, 0xff, 0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55,
+    0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f,
+    0x1f, 0x92, 0xe0, 0x9c, 0xa8, 0xa7, 0xe2, 0xfb, 0xaf, 0x55, 0x3c, 0xe2, 0x3f, 0xc0, 0xbf, 0x30,
+    0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xb0, 0x80, 0x20, 0x15, 0xf1, 0xff,
+    0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f,
+    0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24,
+    0x38, 0xa7, 0xe8, 0xa9, 0xf2, 0xfe, 0x6b, 0x55, 0x81, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca,
+    0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45, 0x7c, 0xfc, 0xf3, 0x5f,
+    0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72,
+    0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9,
+    0x78, 0xaa, 0x65, 0xf1, 0x5a, 0x55, 0x08, 0xfe, 0x03, 0xc5, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa,
+    0x1f, 0xc1, 0xf1, 0x3f, 0xa2, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15, 0xff, 0xfc, 0x57, 0x55, 0xee,
+    0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9,
+    0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9c, 0x6a,
+    0x59, 0x85, 0x56, 0x15, 0x82, 0xff, 0x40, 0xf1, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70,
+    0xfc, 0x8f, 0x28, 0xc0, 0xab, 0x02, 0x55, 0x55, 0xc5, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee,
+    0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69,
+    0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0x6a, 0xa4, 0x5a, 0x56, 0xa1,
+    0x55, 0x85, 0xe0, 0x3f, 0x50, 0xbc, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x23,
+    0x0a, 0xf0, 0xaa, 0x40, 0x55, 0x55, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa,
+    0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54,
+    0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xac, 0x96, 0xfe, 0x4b, 0x55, 0xa1,
+    0x54, 0x01, 0x94, 0x0f, 0x48, 0x48, 0xe8, 0x25, 0xca, 0xbf, 0xa7, 0x57, 0x15, 0xa8, 0x02, 0xbc,
+    0x2a, 0x50, 0x55, 0x55, 0x54, 0xf1, 0x53, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7,
+    0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2,
+    0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xa8, 0xa5, 0xff, 0x52, 0x55, 0x28, 0x55, 0x00,
+    0xe5, 0x03, 0x12, 0x12, 0x7a, 0x89, 0xf2, 0xef, 0xe9, 0x55, 0x05, 0xaa, 0x00, 0xaf, 0x0a, 0x54,
+    0x55, 0x15, 0x55, 0xfc, 0x54, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55,
+    0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc,
+    0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0xa8, 0xef, 0xbf, 0xf2, 0xff, 0x88, 0xff, 0x00, 0xff, 0xc2,
+    0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x02, 0x82, 0xfc, 0xc4, 0xff,
+    0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e,
+    0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92,
+    0xe0, 0x9c, 0xaa, 0xa7, 0xe8, 0xfb, 0xaf, 0xc5, 0x3f, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29,
+    0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xb0, 0x80, 0x20, 0x17, 0xf1, 0xff, 0xff, 0x7f,
+    0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9,
+    0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7,
+    0xea, 0xa9, 0xf8, 0xfe, 0x6b, 0x15, 0x8f, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8,
+    0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x2c, 0x20, 0x48, 0x45, 0xfc, 0xff, 0xff, 0x5f, 0x55, 0xb9,
+    0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5,
+    0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa,
+    0xbc, 0xff, 0x5a, 0x55, 0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1,
+    0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x11, 0x1f, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb,
+    0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5,
+    0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xec, 0xbf,
+    0x56, 0x15, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f,
+    0x20, 0xc0, 0x03, 0x02, 0x55, 0xc4, 0xc5, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa,
+    0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51,
+    0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xf8, 0xaf, 0x55, 0x05,
+    0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0,
+    0x80, 0x40, 0x15, 0x51, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f,
+    0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb,
+    0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfc, 0x6b, 0x55, 0x21, 0xf8, 0x0f,
+    0x14, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x88, 0x02, 0xbc, 0x2a, 0x50,
+    0x55, 0x55, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55,
+    0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2,
+    0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0x65, 0xfc, 0x5a, 0x55, 0x08, 0xfe, 0x03, 0xc5, 0x0b,
+    0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0xa2, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15,
+    0xff, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb,
+    0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48,
+    0x82, 0x73, 0xaa, 0x9e, 0x6a, 0x59, 0xbc, 0x56, 0x15, 0x82, 0xff, 0x40, 0xf1, 0xc2, 0x04, 0xa4,
+    0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x8f, 0x28, 0xc0, 0xab, 0x02, 0x55, 0x55, 0xc5, 0x3f, 0xff,
+    0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26,
+    0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c,
+    0xaa, 0xa7, 0x5a, 0x56, 0xac, 0x55, 0x85, 0xe0, 0x3f, 0x50, 0xbc, 0x30, 0x01, 0x29, 0xc7, 0xa0,
+    0xff, 0x11, 0x1c, 0xff, 0x23, 0x0a, 0xf0, 0xaa, 0x40, 0x55, 0x55, 0xf1, 0xcf, 0x7f, 0x55, 0xe5,
+    0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96,
+    0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9,
+    0x96, 0x55, 0x68, 0x55, 0x21, 0xf8, 0x0f, 0x14, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04,
+    0xc7, 0xff, 0x88, 0x02, 0xbc, 0x2a, 0x50, 0x55, 0x55, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef,
+    0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96,
+    0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff,
+    0x58, 0x55, 0x28, 0xc5, 0x03, 0xe5, 0x03, 0x12, 0x12, 0x7a, 0x89, 0xf2, 0xef, 0xe9, 0x55, 0x05,
+    0xaa, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15, 0x55, 0xfc, 0x54, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa,
+    0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46,
+    0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x54, 0x15,
+    0x4a, 0x15, 0x40, 0xf9, 0x80, 0x84, 0x84, 0x5e, 0xa2, 0xfc, 0x7b, 0x7a, 0x55, 0x81, 0x2a, 0xc0,
+    0xab, 0x02, 0x55, 0x55, 0x45, 0x15, 0x3f, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f,
+    0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f,
+    0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf, 0xfc, 0x3f, 0xe2, 0x3f,
+    0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xb0, 0x80, 0x20,
+    0x3f, 0xf1, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57,
+    0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8,
+    0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0xfa, 0xfe, 0x6b, 0xfc, 0x8f, 0xf8, 0x0f, 0xf0, 0x2f,
+    0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x2c, 0x20, 0xc8, 0x47, 0xfc,
+    0xff, 0xff, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec,
+    0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21,
+    0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xbe, 0xff, 0x5a, 0xfc, 0x23, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90,
+    0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0b, 0x08, 0x72, 0x11, 0xff, 0xff, 0xff,
+    0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a,
+    0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73,
+    0xaa, 0x9e, 0xaa, 0xef, 0xbf, 0x56, 0xfc, 0x88, 0xff, 0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83,
+    0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x02, 0x82, 0x54, 0xc4, 0xff, 0xff, 0xff, 0x55, 0x95,
+    0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a,
+    0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7,
+    0xea, 0xfb, 0xaf, 0x55, 0x3c, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11,
+    0x1c, 0xff, 0x03, 0x08, 0xb0, 0x80, 0x20, 0x15, 0xf1, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe,
+    0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58,
+    0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0xfa, 0xfe,
+    0x6b, 0x55, 0x8c, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff,
+    0x00, 0x02, 0x2c, 0x20, 0x58, 0x45, 0xfc, 0xff, 0xff, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa,
+    0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b,
+    0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xbe, 0xff, 0x5a, 0x55,
+    0x20, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0x80, 0x00,
+    0x0f, 0x08, 0x54, 0x11, 0x3f, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe,
+    0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf,
+    0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56, 0x15, 0x88, 0xff,
+    0x00, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x03, 0x02,
+    0x55, 0x44, 0xc5, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f,
+    0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20,
+    0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x85, 0xe0, 0x3f, 0x50, 0xbc,
+    0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x23, 0x0a, 0xf0, 0xaa, 0x40, 0x55, 0x55,
+    0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2,
+    0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87,
+    0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0x95, 0x6b, 0x55, 0x21, 0xf8, 0x0f, 0x14, 0x2f, 0x4c, 0x40,
+    0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x88, 0x02, 0xbc, 0x2a, 0x50, 0x55, 0x55, 0xfc, 0xf3,
+    0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68,
+    0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce,
+    0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28, 0xfc, 0x03, 0xe5, 0x03, 0x12, 0x12, 0x7a, 0x89,
+    0xf2, 0xef, 0xe9, 0x55, 0x05, 0xaa, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15, 0x55, 0xfc, 0x54, 0x55,
+    0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69,
+    0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e,
+    0x6a, 0xe9, 0xbf, 0x56, 0x15, 0x4a, 0xfc, 0x40, 0xf9, 0x80, 0x84, 0x84, 0x5e, 0xa2, 0xfc, 0x7b,
+    0x7a, 0x55, 0x81, 0x2a, 0xc0, 0xab, 0x02, 0x55, 0x55, 0x45, 0x15, 0x3f, 0x55, 0x95, 0xfb, 0xfb,
+    0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60,
+    0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xfa,
+    0xaf, 0x55, 0x85, 0x52, 0x3c, 0x50, 0x3e, 0x20, 0x21, 0xa1, 0x97, 0x28, 0xff, 0x9e, 0x5e, 0x55,
+    0xa0, 0x0a, 0xf0, 0xaa, 0x40, 0x55, 0x55, 0x51, 0xc5, 0x4f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa,
+    0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f,
+    0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe, 0x6b, 0x55,
+    0xa1, 0x54, 0x0c, 0x94, 0x0f, 0x48, 0x48, 0xe8, 0x25, 0xca, 0xbf, 0xa7, 0x57, 0x15, 0xa8, 0x02,
+    0xbc, 0x2a, 0x50, 0x55, 0x55, 0x54, 0xf1, 0x53, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa,
+    0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe,
+    0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28, 0x55,
+    0x00, 0xe5, 0x03, 0x12, 0x12, 0x7a, 0x89, 0xf2, 0xef, 0xe9, 0x55, 0x05, 0xaa, 0x00, 0xaf, 0x0a,
+    0x54, 0x55, 0x15, 0x55, 0xfc, 0x54, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f,
+    0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80,
+    0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0xaa, 0xef, 0xbf, 0xfa, 0xff, 0x88, 0xff, 0x00, 0xff,
+    0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x0f, 0x20, 0xc0, 0x02, 0x82, 0xfc, 0xcf,
+    0xff, 0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9,
+    0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f,
+    0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf, 0xe5, 0x3f, 0xe2, 0x3f, 0xc0, 0xbf, 0x30, 0x01,
+    0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xb0, 0x80, 0x20, 0x17, 0xf1, 0xff, 0xff,
+    0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0,
+    0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38,
+    0xa7, 0xea, 0xa9, 0xfa, 0xfe, 0x6b, 0x55, 0x8e, 0xf8, 0x0f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31,
+    0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0xa4, 0xa0, 0x5a, 0x45, 0xfc, 0xff, 0xff, 0x5f, 0x55,
+    0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4,
+    0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a,
+    0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28, 0xfe, 0x03, 0xfc, 0x0b, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f,
+    0xc1, 0xf1, 0x3f, 0x80, 0x00, 0x0f, 0x08, 0x54, 0x51, 0x15, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xef,
+    0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82,
+    0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9,
+    0xbf, 0x56, 0x15, 0x8a, 0xff, 0x40, 0xfc, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc,
+    0x0f, 0x20, 0xc0, 0x8b, 0x02, 0x55, 0x55, 0xc5, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa,
+    0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe,
+    0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55,
+    0x85, 0xe2, 0x3f, 0x50, 0xbc, 0x30, 0x01, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x23, 0x0a,
+    0xf0, 0xaa, 0x40, 0x55, 0x55, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea,
+    0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8,
+    0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe, 0x6b, 0x55, 0xa1, 0xf8,
+    0x0f, 0x54, 0x2c, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x88, 0x02, 0xbc, 0x2a,
+    0x50, 0x55, 0x55, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff,
+    0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03,
+    0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28, 0xfe, 0x03, 0x55,
+    0x08, 0x13, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1, 0x3f, 0xa2, 0x00, 0xaf, 0x0a, 0x54, 0x55,
+    0x15, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25,
+    0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c,
+    0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56, 0x15, 0x8a, 0xff, 0x40, 0xf9, 0x80, 0x84,
+    0x84, 0x5e, 0xa2, 0xfc, 0x7b, 0x7a, 0x55, 0x81, 0x2a, 0xc0, 0xab, 0x02, 0x55, 0x55, 0x45, 0x15,
+    0x3f, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80,
+    0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0,
+    0x9c, 0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x85, 0x52, 0x25, 0x50, 0x3e, 0x20, 0x21, 0xa1, 0x97,
+    0x28, 0xff, 0x9e, 0x5e, 0x55, 0xa0, 0x0a, 0xf0, 0xaa, 0x40, 0x55, 0x55, 0x51, 0xc5, 0x4f, 0x55,
+    0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91,
+    0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea,
+    0xa9, 0xfa, 0xfe, 0xab, 0xff, 0x8f, 0xf8, 0x2f, 0xf0, 0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f,
+    0x04, 0xc7, 0xff, 0x00, 0x02, 0x24, 0xa2, 0xca, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x55, 0xb9, 0xbf,
+    0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a,
+    0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xbe,
+    0xff, 0xea, 0xff, 0x23, 0xfe, 0x0b, 0xfc, 0x4b, 0x10, 0x90, 0x72, 0x0c, 0xfa, 0x1f, 0xc1, 0xf1,
+    0x2f, 0x88, 0x22, 0x89, 0xaa, 0xf2, 0xff, 0xff, 0xff, 0xff, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab,
+    0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9,
+    0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0xaa, 0xef, 0xbf, 0x56,
+    0xe5, 0x88, 0xff, 0x20, 0xff, 0xc2, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x70, 0xfc, 0x8b, 0xa0,
+    0x48, 0x0a, 0xaa, 0x55, 0xc4, 0xff, 0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa,
+    0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1,
+    0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x85, 0xe2,
+    0x3f, 0xe0, 0xbf, 0x30, 0x0c, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c, 0xff, 0x03, 0x08, 0xf0, 0x80,
+    0x40, 0x15, 0x55, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe,
+    0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e,
+    0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe, 0x6b, 0x55, 0xa1, 0xf8, 0x0f, 0xf8,
+    0x2f, 0x4c, 0x40, 0xca, 0x31, 0xe8, 0x7f, 0x04, 0xc7, 0xff, 0x00, 0x02, 0x3c, 0x20, 0x50, 0x45,
+    0x55, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95,
+    0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3,
+    0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28, 0xfe, 0x03, 0xe5, 0x0b, 0x13,
+    0x90, 0x72, 0x08, 0xfa, 0x2f, 0xe1, 0xf1, 0x3f, 0xaa, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15, 0xff,
+    0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00,
+    0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82,
+    0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56, 0x15, 0x8a, 0xff, 0x40, 0x95, 0xc2, 0x04, 0xa4, 0x1c,
+    0x83, 0xfe, 0x47, 0x70, 0xfc, 0x8f, 0x28, 0xc0, 0xab, 0x02, 0x55, 0x55, 0xc5, 0x3f, 0xff, 0x55,
+    0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47,
+    0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa,
+    0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x85, 0xe2, 0x3f, 0x50, 0xbe, 0x20, 0x21, 0xac, 0x97, 0x28, 0xff,
+    0x9e, 0x5e, 0x55, 0xa0, 0x0a, 0xf0, 0xaa, 0x40, 0x55, 0x55, 0x51, 0xc5, 0x4f, 0x55, 0xe5, 0xfe,
+    0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b,
+    0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96,
+    0xfe, 0x6b, 0x55, 0xa1, 0xf8, 0x0f, 0x94, 0x2f, 0x48, 0x48, 0xe8, 0x25, 0xca, 0xbf, 0xa7, 0x57,
+    0x15, 0xa8, 0x02, 0xbc, 0x2a, 0x50, 0x55, 0x55, 0x54, 0xf1, 0x53, 0x55, 0xb9, 0xbf, 0xef, 0xae,
+    0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6,
+    0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a,
+    0x55, 0x28, 0xfe, 0x03, 0xe5, 0x0b, 0x12, 0x92, 0x78, 0x89, 0x16, 0xef, 0xe9, 0x55, 0x05, 0xaa,
+    0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15, 0x55, 0x5c, 0x54, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa,
+    0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85,
+    0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0xaa, 0xef, 0xbf, 0xfa, 0xff, 0x88,
+    0xff, 0x02, 0xff, 0x92, 0x04, 0xa4, 0x1c, 0x83, 0xfe, 0x47, 0x72, 0xfe, 0x0b, 0xaa, 0x48, 0xa2,
+    0xaa, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa,
+    0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b,
+    0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf, 0xfe, 0x3f, 0xe2, 0xbf, 0xc0,
+    0xbf, 0x24, 0x01, 0x69, 0xc4, 0xa0, 0xff, 0x91, 0x9c, 0xff, 0x82, 0x2a, 0x92, 0xa8, 0x2a, 0xff,
+    0xff, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55,
+    0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf,
+    0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0xfa, 0xfe, 0x6b, 0x55, 0x8e, 0xf8, 0x0f, 0xf2, 0x2f, 0x6c,
+    0x40, 0xca, 0x3c, 0xe8, 0xbf, 0x07, 0xe7, 0xbf, 0x08, 0x8a, 0xa4, 0xa0, 0x5a, 0xc5, 0xfc, 0xff,
+    0xff, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03,
+    0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09,
+    0xce, 0xa9, 0x7a, 0xaa, 0xbe, 0xff, 0x5a, 0x95, 0x23, 0xfe, 0x83, 0xfc, 0x0b, 0x1b, 0x90, 0x72,
+    0x0c, 0xfa, 0x2f, 0xc1, 0xf9, 0x2f, 0x82, 0x22, 0x29, 0xa8, 0x56, 0x11, 0xff, 0xff, 0xff, 0x57,
+    0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c,
+    0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa,
+    0x9e, 0xaa, 0xef, 0xbf, 0x56, 0xe5, 0x88, 0xff, 0x20, 0xff, 0xc2, 0x06, 0xa4, 0x5c, 0xa0, 0xfe,
+    0x4b, 0x70, 0xfe, 0x8b, 0xa0, 0x48, 0x0a, 0xaa, 0x55, 0xc4, 0xff, 0xff, 0xff, 0x55, 0x95, 0xfb,
+    0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae,
+    0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a,
+    0xfa, 0xaf, 0x55, 0x85, 0xe2, 0x3f, 0xe0, 0xbf, 0x30, 0x09, 0x29, 0xc7, 0xa0, 0xff, 0x11, 0x1c,
+    0xff, 0x03, 0x08, 0xf0, 0x80, 0x40, 0x15, 0x55, 0xf1, 0xcf, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb,
+    0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a,
+    0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe, 0x6b,
+    0x55, 0xa1, 0xf8, 0x0f, 0x94, 0x2f, 0x4c, 0x48, 0xca, 0x21, 0xe8, 0xbf, 0xa7, 0xc7, 0xff, 0xa8,
+    0x02, 0xbc, 0x2a, 0x50, 0x55, 0x55, 0xfc, 0xf3, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa,
+    0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15,
+    0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28,
+    0xfe, 0x03, 0xe5, 0x0b, 0x12, 0x92, 0x7a, 0x89, 0xf8, 0xef, 0xe9, 0x55, 0x3c, 0xaa, 0x00, 0xaf,
+    0x0a, 0x54, 0x55, 0x15, 0x57, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9,
+    0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec,
+    0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56, 0x15, 0x8a, 0xff, 0x40,
+    0xf9, 0x82, 0x84, 0xa4, 0x5e, 0xa2, 0xfc, 0x7b, 0x7a, 0x55, 0x81, 0x2a, 0xc0, 0xab, 0x02, 0x55,
+    0x55, 0x45, 0x15, 0x3f, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55,
+    0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f,
+    0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x85, 0xe2, 0x3f, 0x50, 0xbe, 0x20,
+    0x21, 0xa9, 0x97, 0x68, 0xfc, 0x9e, 0x5e, 0x55, 0xa0, 0x0a, 0xf0, 0xaa, 0x40, 0x55, 0x55, 0x51,
+    0xc5, 0x47, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f,
+    0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24,
+    0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe, 0x6b, 0x55, 0xa1, 0xf8, 0x0f, 0x94, 0x2f, 0x48, 0x48, 0xea,
+    0x25, 0x5a, 0xbc, 0xa7, 0x57, 0x15, 0xa8, 0x02, 0xbc, 0x2a, 0x50, 0x55, 0x55, 0x54, 0x71, 0x51,
+    0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72,
+    0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9,
+    0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28, 0xfe, 0x03, 0xe5, 0x0b, 0x12, 0x92, 0x7a, 0x89, 0x56,
+    0xec, 0xe9, 0x55, 0x05, 0xaa, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15, 0x55, 0x5c, 0x54, 0x55, 0xee,
+    0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9,
+    0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a,
+    0xe9, 0xbf, 0x56, 0x15, 0x8a, 0xff, 0x40, 0xf9, 0x82, 0x84, 0xa4, 0x5e, 0xa2, 0x55, 0x78, 0x7a,
+    0x55, 0x81, 0x2a, 0xc0, 0xab, 0x02, 0x55, 0x55, 0x45, 0x15, 0x17, 0x55, 0x95, 0xfb, 0xfb, 0xee,
+    0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69,
+    0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf,
+    0xfe, 0x3f, 0xe2, 0xbf, 0xc0, 0xbe, 0x24, 0x21, 0xa9, 0xbb, 0xa8, 0xff, 0x9c, 0x9e, 0xff, 0x82,
+    0x2a, 0x92, 0xa8, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa,
+    0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54,
+    0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0xfa, 0xfe, 0xab, 0xff, 0x8f,
+    0xf8, 0x2f, 0xf0, 0x2f, 0x49, 0x40, 0xea, 0x22, 0xea, 0x7f, 0xa4, 0xe7, 0xbf, 0xa0, 0x8a, 0x24,
+    0xaa, 0xca, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7,
+    0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2,
+    0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xbe, 0xff, 0x5a, 0x95, 0x23, 0xfe, 0x83,
+    0xfc, 0x0b, 0x1a, 0x90, 0xba, 0x8f, 0xfa, 0xef, 0xcc, 0xf9, 0x2f, 0x82, 0x22, 0x29, 0xa8, 0x56,
+    0xf1, 0xff, 0xff, 0xff, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55,
+    0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc,
+    0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0xaa, 0xef, 0xbf, 0x56, 0xe5, 0x88, 0xff, 0x20, 0xff, 0x82,
+    0x06, 0xa4, 0xee, 0xa3, 0xfe, 0x7b, 0x70, 0xfe, 0x8b, 0xa0, 0x48, 0x0a, 0xaa, 0x55, 0xfc, 0xff,
+    0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e,
+    0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92,
+    0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf, 0x55, 0x39, 0xe2, 0x3f, 0xc8, 0xbe, 0xb0, 0x21, 0x29,
+    0x97, 0xa8, 0xff, 0x1e, 0x9c, 0xff, 0x22, 0x28, 0x92, 0x82, 0x6a, 0x55, 0xf1, 0xff, 0xff, 0x7f,
+    0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9,
+    0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7,
+    0xea, 0xa9, 0xfa, 0xfe, 0x6b, 0x55, 0x8e, 0xf8, 0x0f, 0xb2, 0x2f, 0x6c, 0x48, 0xca, 0x25, 0xea,
+    0xbf, 0x47, 0xe4, 0xbf, 0x08, 0x8a, 0xa4, 0xa0, 0x5a, 0x55, 0xfc, 0xff, 0xff, 0x5f, 0x55, 0xb9,
+    0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5,
+    0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa,
+    0xa5, 0xff, 0x5a, 0x55, 0x28, 0xfe, 0x03, 0xe5, 0x0b, 0x12, 0x92, 0x7a, 0x89, 0xfa, 0xef, 0xe9,
+    0xfc, 0x3f, 0xaa, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15, 0xff, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb,
+    0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5,
+    0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf,
+    0x56, 0x15, 0x8a, 0xff, 0x40, 0xf9, 0x82, 0x84, 0xa4, 0x5e, 0xa2, 0xfe, 0x7b, 0x7a, 0xfc, 0x8f,
+    0x2a, 0xc0, 0xab, 0x02, 0x55, 0x55, 0xc5, 0x3f, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa,
+    0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51,
+    0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x85,
+    0xe2, 0x3f, 0x50, 0xbe, 0x20, 0x21, 0xa9, 0x97, 0xa8, 0xff, 0x9e, 0x5e, 0xfc, 0xa3, 0x0a, 0xf0,
+    0xaa, 0x40, 0x55, 0x55, 0xf1, 0xc7, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f,
+    0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb,
+    0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe, 0x6b, 0x55, 0xa1, 0xf8, 0x0f,
+    0x94, 0x2f, 0x48, 0x48, 0xea, 0x25, 0xea, 0xbf, 0xa7, 0x57, 0xfc, 0xa8, 0x02, 0xbc, 0x2a, 0x50,
+    0x55, 0x55, 0x7c, 0xf1, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55,
+    0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2,
+    0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28, 0xfe, 0x03, 0xe5, 0x0b,
+    0x12, 0x92, 0x7a, 0x89, 0xfa, 0xef, 0xe9, 0x55, 0x3c, 0xaa, 0x00, 0xaf, 0x0a, 0x54, 0x55, 0x15,
+    0x57, 0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb,
+    0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48,
+    0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56, 0x15, 0x8a, 0xff, 0x40, 0xf9, 0x82, 0x84, 0xa4,
+    0x5e, 0xa2, 0xfe, 0x7b, 0x7a, 0x55, 0x8c, 0x2a, 0xc0, 0xab, 0x02, 0x55, 0x55, 0x45, 0x15, 0xff,
+    0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26,
+    0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c,
+    0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x85, 0xe2, 0x3f, 0x50, 0xbe, 0x20, 0x21, 0xa9, 0x97, 0xa8,
+    0xff, 0x9e, 0x5e, 0x55, 0xa0, 0x0a, 0xf0, 0xaa, 0x40, 0x55, 0x55, 0x51, 0xc5, 0x7f, 0x55, 0xe5,
+    0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96,
+    0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9,
+    0x96, 0xfe, 0x6b, 0x55, 0xa1, 0xf8, 0x0f, 0x94, 0x2f, 0x48, 0x48, 0xea, 0x25, 0x5a, 0xbe, 0xa7,
+    0x57, 0x15, 0xa8, 0x02, 0xbc, 0x2a, 0x50, 0x55, 0x55, 0x54, 0x51, 0x51, 0x55, 0xb9, 0xbf, 0xef,
+    0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96,
+    0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xbe, 0xff,
+    0xea, 0xff, 0x23, 0xfe, 0x0b, 0xe4, 0x4b, 0x1a, 0x92, 0xba, 0x8b, 0xfa, 0xef, 0xe9, 0xf9, 0x2f,
+    0xa8, 0x22, 0x89, 0xaa, 0xf2, 0xff, 0xff, 0xff, 0xff, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa,
+    0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46,
+    0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0xaa, 0xef, 0xbf, 0x56, 0xe5,
+    0x88, 0xff, 0x20, 0xfb, 0x82, 0x86, 0xa4, 0xee, 0xa3, 0xfe, 0x7b, 0x72, 0xfe, 0x8b, 0xa0, 0x48,
+    0x8a, 0xaa, 0x55, 0xfc, 0xff, 0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f,
+    0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f,
+    0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf, 0x55, 0x39, 0xe2, 0x3f,
+    0x48, 0xbe, 0xa0, 0x21, 0xa9, 0x97, 0xa8, 0xff, 0x1e, 0x9e, 0xff, 0x22, 0x28, 0x92, 0x8a, 0x6a,
+    0x55, 0xf1, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57,
+    0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8,
+    0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x9a, 0xfe, 0x6b, 0x55, 0xae, 0xf8, 0x0f, 0x96, 0x2f,
+    0x69, 0x48, 0xea, 0x25, 0xea, 0xbf, 0xa7, 0xe7, 0xbf, 0xa8, 0x88, 0xa4, 0x8a, 0x5a, 0x55, 0xc5,
+    0xff, 0xff, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec,
+    0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21,
+    0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55, 0x28, 0xfe, 0x03, 0xe5, 0x0b, 0x1a, 0x92,
+    0x7a, 0x89, 0xfa, 0xef, 0xe9, 0xf9, 0x3f, 0xaa, 0x00, 0xab, 0x0a, 0x56, 0x55, 0x15, 0xff, 0xff,
+    0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a,
+    0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73,
+    0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56, 0x15, 0x8a, 0xff, 0x40, 0xf9, 0x82, 0x84, 0xa4, 0x5e, 0xa2,
+    0xfe, 0x7b, 0x7a, 0xe5, 0x8f, 0x2a, 0xc0, 0xab, 0x02, 0x55, 0x55, 0xc5, 0x17, 0xff, 0x55, 0x95,
+    0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a,
+    0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7,
+    0x5a, 0xfa, 0xaf, 0x55, 0x85, 0xe2, 0x3f, 0x50, 0xbe, 0xa0, 0x21, 0xa9, 0x97, 0xa8, 0xff, 0x9e,
+    0x5e, 0x55, 0xa2, 0x0a, 0xb0, 0xaa, 0x60, 0x55, 0x55, 0x55, 0xc5, 0x7f, 0x55, 0xe5, 0xfe, 0xbe,
+    0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58,
+    0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe,
+    0x6b, 0x55, 0xa1, 0xf8, 0x0f, 0x94, 0x2f, 0x48, 0x48, 0xea, 0x25, 0x5a, 0xbe, 0xa7, 0x57, 0x15,
+    0xaa, 0x02, 0xbc, 0x2a, 0x50, 0x55, 0x55, 0x54, 0x51, 0x51, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa,
+    0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b,
+    0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x55,
+    0x28, 0xfe, 0x03, 0xe5, 0x0b, 0x1a, 0x92, 0x7a, 0x89, 0x96, 0xef, 0xe9, 0x55, 0x85, 0xaa, 0x40,
+    0xac, 0x0a, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe,
+    0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf,
+    0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56, 0x15, 0x8a, 0xff,
+    0x60, 0xf9, 0x92, 0x86, 0xa4, 0x5e, 0xa2, 0xe5, 0x7b, 0x7a, 0x55, 0xa1, 0x2a, 0x50, 0xa8, 0x2a,
+    0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f,
+    0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20,
+    0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf, 0xfe, 0x3b, 0xe2, 0xbf, 0x48, 0xbe,
+    0xa4, 0x21, 0xa9, 0xbb, 0xa8, 0xff, 0x9e, 0x9e, 0xff, 0xa2, 0x2a, 0x92, 0xa8, 0x2a, 0xff, 0xff,
+    0xff, 0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2,
+    0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87,
+    0x24, 0x38, 0xa7, 0xea, 0xa9, 0xfa, 0xfe, 0x6b, 0x55, 0x8e, 0xf8, 0x0f, 0x92, 0x2f, 0x69, 0x48,
+    0xea, 0x3e, 0xea, 0xbf, 0x27, 0xe7, 0xbf, 0xa8, 0x8a, 0xa4, 0xa8, 0x5a, 0xc5, 0xff, 0xff, 0xff,
+    0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68,
+    0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce,
+    0xa9, 0x7a, 0xaa, 0xbe, 0xff, 0x5a, 0x95, 0x23, 0xfe, 0x83, 0xe4, 0x0b, 0x1a, 0x92, 0x7a, 0x89,
+    0xfa, 0xef, 0xe1, 0xf9, 0x2f, 0xaa, 0x22, 0xa9, 0xa8, 0x56, 0x15, 0xff, 0xff, 0xff, 0x57, 0x55,
+    0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69,
+    0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e,
+    0xaa, 0xe9, 0xbf, 0x56, 0xe5, 0x8a, 0xff, 0x60, 0xf9, 0x92, 0x86, 0xa4, 0x5e, 0xa2, 0xfe, 0x7b,
+    0x7a, 0xfe, 0x8b, 0xaa, 0x48, 0xaa, 0xa8, 0x55, 0x55, 0xfc, 0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb,
+    0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60,
+    0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xfa,
+    0xaf, 0x55, 0x85, 0xe2, 0x3f, 0x58, 0xbe, 0xa4, 0x21, 0xa9, 0x97, 0xa8, 0xff, 0x9e, 0x9e, 0xff,
+    0xa3, 0x2a, 0x90, 0xaa, 0x68, 0x55, 0x55, 0xf1, 0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa,
+    0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f,
+    0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe, 0x6b, 0x55,
+    0xa1, 0xf8, 0x0f, 0x96, 0x2f, 0x69, 0x48, 0xea, 0x25, 0xea, 0xbf, 0xa7, 0x57, 0x95, 0xa8, 0x82,
+    0xa4, 0xaa, 0x58, 0x55, 0x55, 0x55, 0xf1, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa,
+    0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe,
+    0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x95, 0x28, 0xfe,
+    0x83, 0xe5, 0x4b, 0x1a, 0x92, 0x7a, 0x89, 0x96, 0xef, 0xe9, 0x55, 0x85, 0xaa, 0x62, 0xa9, 0xaa,
+    0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f,
+    0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80,
+    0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0xaa, 0xef, 0xbf, 0xfa, 0xe7, 0x88, 0xff, 0x22, 0xf9,
+    0x92, 0x86, 0xa4, 0xee, 0xa2, 0xfe, 0x7b, 0x7a, 0xfe, 0x8b, 0xaa, 0x48, 0xaa, 0xaa, 0xfc, 0xff,
+    0xff, 0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9,
+    0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f,
+    0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf, 0x7e, 0x39, 0xe2, 0xbf, 0x48, 0xbe, 0xa4, 0x21,
+    0xa9, 0xbb, 0xa8, 0xff, 0x9e, 0x9e, 0xff, 0xa2, 0x2a, 0x92, 0xaa, 0x6a, 0xfc, 0xff, 0xff, 0xff,
+    0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0,
+    0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38,
+    0xa7, 0xea, 0xa9, 0xfa, 0xfe, 0xab, 0x57, 0x8e, 0xf8, 0x2f, 0x92, 0x2f, 0x69, 0x48, 0xea, 0x2e,
+    0xea, 0xbf, 0xa7, 0xe7, 0xbf, 0xa8, 0x8a, 0xa4, 0xaa, 0x5a, 0xfc, 0xff, 0xff, 0xff, 0x5f, 0x55,
+    0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4,
+    0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a,
+    0xaa, 0xbe, 0xff, 0x6a, 0x95, 0x23, 0xfe, 0x8b, 0xe4, 0x4b, 0x1a, 0x92, 0xba, 0x8b, 0xfa, 0xef,
+    0xe9, 0xf9, 0x2f, 0xaa, 0x22, 0xa9, 0xaa, 0x56, 0xfc, 0xff, 0xff, 0xff, 0x57, 0x55, 0xee, 0xef,
+    0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82,
+    0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0xaa, 0xef,
+    0xbf, 0x56, 0xe5, 0x88, 0xff, 0x22, 0xf9, 0x92, 0x86, 0xa4, 0xee, 0xa2, 0xfe, 0x7b, 0x7a, 0xfe,
+    0x8b, 0xaa, 0x48, 0xaa, 0xaa, 0x55, 0xfc, 0xff, 0xff, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa,
+    0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe,
+    0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0xea, 0xfb, 0xaf, 0x55,
+    0x39, 0xe2, 0xbf, 0x58, 0xbe, 0xa4, 0x21, 0xa9, 0x9b, 0xa8, 0xff, 0x9e, 0x9e, 0xff, 0xa2, 0x2a,
+    0x92, 0xaa, 0x6a, 0x55, 0xfc, 0xff, 0xff, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea,
+    0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8,
+    0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0xfa, 0xfe, 0x6b, 0x55, 0x8e, 0xf8,
+    0x0f, 0x96, 0x2f, 0x69, 0x48, 0xea, 0x25, 0xea, 0xbf, 0xa7, 0xe7, 0xbf, 0xa8, 0x8a, 0xa4, 0xaa,
+    0x5a, 0x55, 0xfc, 0xff, 0xff, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff,
+    0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03,
+    0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xae, 0xff, 0x5a, 0x95, 0x2b, 0xfe, 0x83, 0xe5,
+    0x4b, 0x1a, 0x92, 0x7a, 0x89, 0xfa, 0xef, 0xe9, 0xf9, 0x2f, 0xaa, 0x22, 0xa9, 0xaa, 0x56, 0x55,
+    0xfc, 0xff, 0xff, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25,
+    0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c,
+    0x48, 0x82, 0x73, 0xaa, 0x9e, 0xaa, 0xe9, 0xbf, 0x56, 0xe5, 0x8a, 0xff, 0x60, 0xf9, 0x92, 0x86,
+    0xa4, 0x5e, 0xa2, 0xfe, 0x7b, 0x7a, 0xfe, 0x8b, 0xaa, 0x48, 0xaa, 0xaa, 0x55, 0x55, 0xfc, 0xff,
+    0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80,
+    0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0,
+    0x9c, 0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0xb9, 0xe2, 0x3f, 0x58, 0xbe, 0xa4, 0x21, 0xa9, 0x97,
+    0xa8, 0xff, 0x9e, 0x9e, 0xff, 0xa2, 0x2a, 0x92, 0xaa, 0x6a, 0x55, 0x55, 0xfc, 0xff, 0x7f, 0x55,
+    0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91,
+    0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea,
+    0xa9, 0x96, 0xfe, 0x6b, 0x55, 0xa2, 0xf8, 0x0f, 0x96, 0x2f, 0x69, 0x48, 0xea, 0x25, 0xea, 0xbf,
+    0xa7, 0xe7, 0xbf, 0xa8, 0x8a, 0xa4, 0xaa, 0x5a, 0x55, 0x55, 0xfc, 0xff, 0x5f, 0x55, 0xb9, 0xbf,
+    0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a,
+    0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5,
+    0xff, 0x5a, 0x95, 0x28, 0xfe, 0x83, 0xe5, 0x4b, 0x1a, 0x92, 0x7a, 0x89, 0xfa, 0xef, 0xe9, 0xf9,
+    0x27, 0xaa, 0x22, 0xa9, 0xaa, 0x56, 0x55, 0x55, 0xfc, 0xff, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab,
+    0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00, 0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9,
+    0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82, 0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56,
+    0x25, 0x8a, 0xff, 0x60, 0xf9, 0x92, 0x86, 0xa4, 0x5e, 0xa2, 0xfe, 0x7b, 0x7a, 0x7e, 0x89, 0xaa,
+    0x48, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xfc, 0xff, 0x55, 0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa,
+    0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47, 0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1,
+    0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa, 0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x89, 0xe2,
+    0x3f, 0x58, 0xbe, 0xa4, 0x21, 0xa9, 0x97, 0xa8, 0xff, 0x9e, 0x9e, 0x57, 0xa2, 0x2a, 0x92, 0xaa,
+    0x6a, 0x55, 0x55, 0x55, 0xfc, 0x7f, 0x55, 0xe5, 0xfe, 0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe,
+    0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b, 0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e,
+    0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96, 0xfe, 0x6b, 0x55, 0xa2, 0xf8, 0x0f, 0x96,
+    0x2f, 0x69, 0x48, 0xea, 0x25, 0xea, 0xbf, 0xa7, 0x67, 0x95, 0xa8, 0x8a, 0xa4, 0xaa, 0x5a, 0x55,
+    0x55, 0x55, 0xfc, 0x5f, 0x55, 0xb9, 0xbf, 0xef, 0xae, 0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95,
+    0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6, 0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3,
+    0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a, 0x95, 0x28, 0xfe, 0x83, 0xe5, 0x4b, 0x1a,
+    0x92, 0x7a, 0x89, 0xfa, 0xef, 0xe9, 0x55, 0x25, 0xaa, 0x22, 0xa9, 0xaa, 0x56, 0x55, 0x55, 0x55,
+    0xfc, 0x57, 0x55, 0xee, 0xef, 0xbb, 0xab, 0xaa, 0xaa, 0xfe, 0xe9, 0x7f, 0x55, 0x25, 0xfb, 0x00,
+    0x9a, 0x1c, 0x69, 0xb9, 0x82, 0xa5, 0xf9, 0x46, 0x85, 0xbf, 0xec, 0x80, 0xfc, 0x7c, 0x48, 0x82,
+    0x73, 0xaa, 0x9e, 0x6a, 0xe9, 0xbf, 0x56, 0x25, 0x8a, 0xff, 0x60, 0xf9, 0x92, 0x86, 0xa4, 0x5e,
+    0xa2, 0xfe, 0x7b, 0x7a, 0x55, 0x89, 0xaa, 0x58, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xfc, 0x55,
+    0x95, 0xfb, 0xfb, 0xee, 0xaa, 0xaa, 0xaa, 0x7f, 0xfa, 0x5f, 0x55, 0xc9, 0x3e, 0x80, 0x26, 0x47,
+    0x5a, 0xae, 0x60, 0x69, 0xbe, 0x51, 0xe1, 0x2f, 0x3b, 0x20, 0x3f, 0x1f, 0x92, 0xe0, 0x9c, 0xaa,
+    0xa7, 0x5a, 0xfa, 0xaf, 0x55, 0x89, 0xe2, 0x3f, 0x58, 0xbe, 0xa4, 0x21, 0xa9, 0x97, 0xa8, 0xfb,
+    0x9e, 0x5e, 0x55, 0xaa, 0x2a, 0x96, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x7c, 0x55, 0xe5, 0xfe,
+    0xbe, 0xbb, 0xaa, 0xaa, 0xea, 0x9f, 0xfe, 0x57, 0x55, 0xb2, 0x0f, 0xa0, 0xc9, 0x91, 0x96, 0x2b,
+    0x58, 0x9a, 0x6f, 0x54, 0xf8, 0xcb, 0x0e, 0xc8, 0xcf, 0x87, 0x24, 0x38, 0xa7, 0xea, 0xa9, 0x96,
+    0xfe, 0x6b, 0x55, 0xa2, 0xf8, 0x0f, 0x96, 0x2f, 0x69, 0x48, 0xea, 0x25, 0x6a, 0xbe, 0xa7, 0x57,
+    0x95, 0xaa, 0x8a, 0xa5, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x55, 0xb9, 0xbf, 0xef, 0xae,
+    0xaa, 0xaa, 0xfa, 0xa7, 0xff, 0x55, 0x95, 0xec, 0x03, 0x68, 0x72, 0xa4, 0xe5, 0x0a, 0x96, 0xe6,
+    0x1b, 0x15, 0xfe, 0xb2, 0x03, 0xf2, 0xf3, 0x21, 0x09, 0xce, 0xa9, 0x7a, 0xaa, 0xa5, 0xff, 0x5a,
+    0x95, 0x28, 0xfe, 0x83, 0xe5, 0x4b, 0x1a, 0x92, 0x7a, 0x89, 0x96, 0xef, 0xe9, 0x55, 0xa5, 0xaa,
+    0x62, 0xa9, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 0xc0,
+    0x3f, 0xcc, 0xc7, 0x30, 0xc0, 0xf3, 0xfc, 0x3c, 0x13, 0x30, 0x30, 0xcf, 0xb3, 0x5f, 0x02, 0x1f,
+    0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96,
+    0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc,
+    0x33, 0x13, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xfc, 0xc3, 0x7c, 0x0c, 0x03, 0x3c, 0xcf, 0xcf,
+    0x33, 0x01, 0x03, 0xf3, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00,
+    0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30,
+    0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0xc0, 0x3f, 0xcc, 0xc7, 0x30, 0xc0, 0xf1, 0xfc, 0x3c, 0x13, 0x30, 0x30, 0xcf, 0xb3, 0x5f, 0x02,
+    0x1f, 0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33, 0x05, 0x0c, 0x0f,
+    0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45,
+    0xcc, 0x33, 0x53, 0xf1, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xfc, 0xc3, 0x7c, 0x0c, 0x03, 0x14, 0xcf,
+    0xcf, 0x33, 0x01, 0x03, 0xf3, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f,
+    0x00, 0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10,
+    0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xfc, 0xff, 0xff, 0xff,
+    0x00, 0xc0, 0x3f, 0xcc, 0xc7, 0x30, 0x40, 0xf1, 0xfc, 0x3c, 0x13, 0x30, 0x30, 0xcf, 0xb3, 0x5f,
+    0x02, 0x1f, 0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33, 0x05, 0x0c,
+    0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44,
+    0x45, 0xcc, 0x33, 0x53, 0x15, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xfc, 0xc3, 0x7c, 0x08, 0x03, 0x15,
+    0xcf, 0xcf, 0x33, 0x01, 0x03, 0xf3, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f,
+    0x0f, 0x00, 0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3,
+    0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xc5, 0xff, 0xff,
+    0xff, 0x00, 0xc0, 0x1f, 0xcc, 0x87, 0x30, 0x50, 0xf1, 0xfc, 0x3c, 0x13, 0x30, 0x30, 0xc7, 0xb3,
+    0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33, 0x05,
+    0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00,
+    0x44, 0x45, 0xcc, 0x33, 0x53, 0x55, 0xf1, 0xff, 0xff, 0x0f, 0x00, 0x7c, 0xc1, 0x7c, 0x08, 0x03,
+    0x15, 0xcf, 0xcf, 0x33, 0x01, 0x03, 0x53, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x07, 0xff,
+    0x3f, 0x0f, 0x00, 0x19, 0x7f, 0xf0, 0x33, 0x53, 0xc0, 0x70, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5,
+    0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x1c, 0x33, 0x55, 0x55, 0xfc,
+    0xff, 0xff, 0x00, 0xc0, 0x15, 0xcc, 0x87, 0x30, 0x50, 0xf1, 0xfc, 0x3c, 0x13, 0x30, 0x30, 0xc5,
+    0xb3, 0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0x50, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x05, 0x3f, 0x33,
+    0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00,
+    0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x15, 0xff, 0xff, 0x0f, 0x00, 0x54, 0xc1, 0x7c, 0x08,
+    0x03, 0x15, 0xcf, 0xcf, 0x33, 0x01, 0x02, 0x57, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x05,
+    0xff, 0x3f, 0x0f, 0x00, 0x19, 0x57, 0xf0, 0x33, 0x53, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54,
+    0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55,
+    0xc5, 0xff, 0xff, 0x00, 0x40, 0x15, 0xcc, 0x87, 0x30, 0x50, 0xf1, 0xfc, 0x3c, 0x13, 0x20, 0x70,
+    0xc5, 0xb3, 0x5f, 0x02, 0x1f, 0xc5, 0xf2, 0x54, 0xf0, 0xff, 0xb3, 0x00, 0x94, 0x71, 0x05, 0x3f,
+    0x13, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff,
+    0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0xf1, 0xff, 0x0f, 0x00, 0x54, 0xc1, 0x7c,
+    0x08, 0x03, 0x15, 0xcf, 0xc7, 0x33, 0x01, 0x02, 0x57, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x2c, 0x4f,
+    0x05, 0xff, 0x3f, 0x0b, 0x40, 0x19, 0x57, 0xf0, 0x33, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53,
+    0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55,
+    0x55, 0x55, 0xfc, 0xff, 0x00, 0x40, 0x15, 0xcc, 0x87, 0x30, 0x50, 0xf1, 0x5c, 0x3c, 0x13, 0x20,
+    0x70, 0xc5, 0xb1, 0x5f, 0x02, 0x1f, 0xc5, 0xf2, 0x54, 0xf0, 0xff, 0xb3, 0x00, 0x94, 0x71, 0x05,
+    0x3f, 0x13, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f,
+    0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x15, 0xff, 0x0f, 0x00, 0x54, 0xc1,
+    0x7c, 0x08, 0x03, 0x15, 0x4f, 0xc5, 0x33, 0x01, 0x02, 0x57, 0x14, 0xfb, 0x25, 0xf0, 0x51, 0x2c,
+    0x4f, 0x05, 0xff, 0x3f, 0x0b, 0x40, 0x19, 0x57, 0xf0, 0x33, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff,
+    0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33,
+    0x55, 0x55, 0x55, 0xc5, 0xff, 0x00, 0x40, 0x15, 0xcc, 0x87, 0x30, 0x50, 0xf1, 0x54, 0x3c, 0x13,
+    0x20, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0xc5, 0xf2, 0x54, 0xf0, 0xff, 0xb3, 0x00, 0x94, 0x71,
+    0x05, 0x3f, 0x13, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14,
+    0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x55, 0xf1, 0x0f, 0x00, 0x54,
+    0xc1, 0x7c, 0x08, 0x02, 0x15, 0x5b, 0xc5, 0x33, 0x41, 0x02, 0x57, 0x14, 0xfb, 0x25, 0xf0, 0x51,
+    0x24, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x33, 0x51, 0xc0, 0x50, 0x60, 0x09,
+    0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14,
+    0x33, 0x55, 0x55, 0x55, 0x55, 0xfc, 0x00, 0x40, 0x15, 0xc4, 0x87, 0x20, 0x50, 0xb1, 0x55, 0x1c,
+    0x13, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0x45, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94,
+    0x71, 0x05, 0x3f, 0x13, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53,
+    0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x55, 0x15, 0x0f, 0x00,
+    0x54, 0x41, 0x7c, 0x08, 0x02, 0x15, 0x5b, 0x45, 0x31, 0x41, 0x02, 0x57, 0x14, 0xfb, 0x25, 0xf0,
+    0x51, 0x24, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x33, 0x51, 0xc0, 0x50, 0x60,
+    0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4,
+    0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xc5, 0x00, 0x40, 0x15, 0xc4, 0x87, 0x20, 0x50, 0xb1, 0x55,
+    0x14, 0x13, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0x45, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00,
+    0x94, 0x71, 0x05, 0x3f, 0x13, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01,
+    0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x55, 0x55, 0x01,
+    0x00, 0x54, 0x41, 0x7c, 0x08, 0x02, 0x15, 0x5b, 0x45, 0x31, 0x41, 0x02, 0x57, 0x14, 0xfb, 0x25,
+    0xf0, 0x51, 0x24, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x33, 0x51, 0xc0, 0x50,
+    0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54,
+    0xc4, 0x14, 0x33, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x00, 0xc0, 0x3f, 0xcc, 0xc7, 0x30, 0xc0, 0xff,
+    0xfc, 0x3c, 0x13, 0x30, 0x30, 0xff, 0xbf, 0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3,
+    0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c,
+    0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0xff, 0xff, 0xff,
+    0x0f, 0x00, 0xfc, 0xcf, 0x7c, 0x08, 0x03, 0x15, 0xcf, 0xff, 0x7f, 0x01, 0x03, 0xf3, 0x3c, 0xfb,
+    0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0,
+    0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40,
+    0x54, 0xc4, 0x3c, 0x33, 0x55, 0x55, 0xe5, 0xff, 0xff, 0x00, 0x50, 0x15, 0xcc, 0x87, 0x30, 0x50,
+    0xf1, 0xfc, 0xff, 0x17, 0x20, 0x70, 0xc5, 0xb3, 0x5f, 0x02, 0x1f, 0xc5, 0xf2, 0x54, 0xf0, 0xff,
+    0xb3, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x13, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c,
+    0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x55,
+    0xf9, 0x0f, 0x00, 0x54, 0xc1, 0x7f, 0x08, 0x02, 0x15, 0x59, 0xc5, 0x33, 0x41, 0x02, 0x57, 0x14,
+    0xfb, 0x25, 0xf0, 0x51, 0x24, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51,
+    0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00,
+    0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9, 0x00, 0x40, 0x15, 0xc5, 0x87, 0x20,
+    0x50, 0x91, 0x55, 0x14, 0x13, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0x45, 0xf2, 0x54, 0xf0,
+    0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55,
+    0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x93, 0xff, 0xff,
+    0xff, 0xff, 0x2f, 0x00, 0xfc, 0xc3, 0x7c, 0x2c, 0x03, 0xfc, 0xcf, 0xcb, 0x33, 0x01, 0x2b, 0xf3,
+    0xff, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff, 0xf0, 0x33,
+    0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f,
+    0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x28, 0xc0, 0xff, 0x8c, 0x97,
+    0xb0, 0x52, 0xf1, 0xfc, 0xff, 0x17, 0x30, 0x30, 0xcf, 0xb3, 0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0xf0,
+    0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45,
+    0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95,
+    0x7f, 0xfe, 0xff, 0x8f, 0x02, 0xf1, 0xcf, 0x78, 0x09, 0x2b, 0x15, 0xcf, 0xff, 0x7f, 0x01, 0x03,
+    0x73, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff, 0xf0,
+    0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3,
+    0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xe5, 0xff, 0xff, 0x28, 0x50, 0xfc, 0x8c,
+    0x97, 0xb0, 0x52, 0xf1, 0xfc, 0xff, 0x17, 0x30, 0x30, 0xc5, 0xb3, 0x5f, 0x02, 0x1f, 0xc5, 0xf3,
+    0x70, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x07, 0x3f, 0x33, 0x05, 0x0c, 0x07, 0x96, 0xf0, 0x3f,
+    0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x31, 0x53,
+    0x95, 0x57, 0xfe, 0xff, 0x8f, 0x02, 0x15, 0xcf, 0x78, 0x09, 0x2b, 0x15, 0xcf, 0xff, 0x7f, 0x01,
+    0x03, 0x53, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x05, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0x5f,
+    0xf0, 0x33, 0x53, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1,
+    0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x59, 0xe5, 0xff, 0xff, 0x28, 0x50, 0xc5,
+    0x8c, 0x97, 0xb0, 0x52, 0xf1, 0xfc, 0xff, 0x17, 0x20, 0x70, 0xc5, 0xb3, 0x5f, 0x02, 0x1f, 0xc5,
+    0xf3, 0x50, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0x71, 0x05, 0x3f, 0x33, 0x05, 0x0c, 0x05, 0x96, 0xf0,
+    0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31,
+    0x53, 0x55, 0x55, 0xfe, 0xff, 0x8f, 0x02, 0x55, 0xc1, 0x78, 0x09, 0x2b, 0x15, 0xcf, 0xff, 0x7f,
+    0x01, 0x02, 0x57, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x2c, 0x4f, 0x05, 0xff, 0x3f, 0x0b, 0x40, 0x19,
+    0x57, 0xf0, 0x33, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45,
+    0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x55, 0x95, 0xfb, 0x80, 0x42,
+    0x15, 0xfc, 0x87, 0x24, 0x50, 0x91, 0x55, 0x3c, 0x13, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f,
+    0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96,
+    0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c,
+    0x31, 0x53, 0x55, 0x55, 0x55, 0x99, 0x0f, 0x28, 0x54, 0x11, 0x7f, 0x48, 0x02, 0x15, 0x59, 0xc5,
+    0x31, 0x41, 0x02, 0x57, 0x14, 0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40,
+    0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30,
+    0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9, 0x80,
+    0x42, 0x15, 0xc5, 0x87, 0x24, 0x50, 0x91, 0x55, 0x14, 0x13, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02,
+    0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05,
+    0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45,
+    0x4c, 0x31, 0x53, 0x55, 0x55, 0x55, 0x95, 0x0f, 0x28, 0x54, 0x51, 0x71, 0x48, 0x02, 0x15, 0x59,
+    0x45, 0x31, 0x41, 0x02, 0x57, 0x14, 0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09,
+    0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10,
+    0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9,
+    0x80, 0x42, 0x15, 0x55, 0x84, 0x24, 0x50, 0x91, 0x55, 0x14, 0x13, 0x24, 0x70, 0x45, 0xb1, 0x5f,
+    0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c,
+    0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44,
+    0x45, 0x4c, 0x31, 0x93, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x80, 0xfe, 0xcf, 0x3c, 0x2f, 0x03, 0xfc,
+    0xcf, 0xfb, 0x3f, 0x03, 0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f,
+    0x0f, 0x00, 0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3,
+    0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0xf9, 0xff, 0xff, 0xff,
+    0xff, 0x02, 0xe8, 0xff, 0xcc, 0xc7, 0x32, 0xc0, 0xff, 0xbc, 0xff, 0x13, 0xb0, 0x32, 0xff, 0xbf,
+    0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33, 0x05,
+    0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00,
+    0x44, 0x45, 0xcc, 0x33, 0x93, 0xbf, 0xff, 0xfe, 0xff, 0xaf, 0x82, 0xfe, 0xcf, 0x78, 0x21, 0x2b,
+    0xfc, 0xcf, 0xfb, 0x3f, 0x01, 0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff,
+    0x3f, 0x0f, 0x00, 0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5,
+    0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xef,
+    0xff, 0xff, 0x28, 0xe8, 0xff, 0x8c, 0x97, 0xb0, 0x52, 0xf1, 0xfc, 0xff, 0x17, 0x30, 0x30, 0xff,
+    0xbf, 0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33,
+    0x05, 0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00,
+    0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x55, 0x55, 0xfe, 0xff, 0x8f, 0x02, 0x55, 0xe9, 0x7b, 0x09,
+    0x2b, 0x15, 0xcb, 0xff, 0x7f, 0x41, 0x02, 0x57, 0x3c, 0xfb, 0x25, 0xf0, 0x51, 0x24, 0x4f, 0x05,
+    0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x33, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54,
+    0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55,
+    0xe5, 0xbf, 0xfb, 0xa8, 0x52, 0x95, 0xbe, 0x97, 0x84, 0x52, 0x91, 0xfc, 0xff, 0x17, 0x24, 0x70,
+    0xc5, 0xb3, 0x5f, 0x02, 0x1f, 0x45, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f,
+    0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff,
+    0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x55, 0xb9, 0x0f, 0x28, 0x55, 0xe9, 0x7f,
+    0x48, 0x02, 0x15, 0x59, 0xc5, 0x7f, 0x41, 0x02, 0x57, 0x14, 0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f,
+    0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53,
+    0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55,
+    0x55, 0x55, 0x55, 0xf9, 0x80, 0x52, 0x95, 0x95, 0x87, 0x24, 0x50, 0x91, 0x55, 0x15, 0x17, 0x24,
+    0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05,
+    0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f,
+    0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x93, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x80, 0xfe, 0xcf,
+    0xbc, 0x2f, 0x03, 0xfc, 0xcf, 0xfb, 0x3f, 0x0f, 0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0x3c,
+    0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff,
+    0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33,
+    0xf9, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff, 0x8c, 0x97, 0xb2, 0xc2, 0xff, 0xbc, 0xff, 0x17,
+    0xb0, 0x32, 0xff, 0xbf, 0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1,
+    0x0f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14,
+    0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x93, 0x97, 0xff, 0xfe, 0xff, 0xaf, 0x82, 0xfe,
+    0xcf, 0x78, 0x29, 0x2b, 0xf1, 0xcf, 0xfb, 0x7f, 0x01, 0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51,
+    0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09,
+    0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c,
+    0x33, 0x59, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff, 0x8c, 0x97, 0xb2, 0x52, 0xfc, 0xbc, 0xff,
+    0x17, 0xb0, 0x32, 0xff, 0xbf, 0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90,
+    0xf1, 0x0f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53,
+    0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0xff, 0xfe, 0xff, 0xaf, 0x82,
+    0xfe, 0xcf, 0x78, 0x29, 0x2b, 0x15, 0xcf, 0xfb, 0x7f, 0x01, 0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0,
+    0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60,
+    0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4,
+    0x3c, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff, 0xbe, 0x97, 0xa2, 0x52, 0xc5, 0xbe,
+    0xff, 0x17, 0xb0, 0x32, 0xff, 0xbf, 0x5f, 0x02, 0x1f, 0xc5, 0xf3, 0x70, 0xf0, 0xff, 0xf3, 0x00,
+    0x90, 0xf1, 0x07, 0x3f, 0x33, 0x05, 0x0c, 0x07, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01,
+    0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x31, 0x53, 0x95, 0xff, 0xfe, 0xbb, 0xaf,
+    0xaa, 0xfe, 0xef, 0x7b, 0x29, 0x2a, 0x55, 0xe1, 0xfb, 0x7f, 0x01, 0x2b, 0xf3, 0xff, 0xfb, 0x25,
+    0xf0, 0x51, 0x3c, 0x0f, 0x05, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0x5f, 0xf0, 0x33, 0x53, 0xc0, 0x50,
+    0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54,
+    0xc4, 0x14, 0x33, 0x55, 0x55, 0xe5, 0x9f, 0xfb, 0xa8, 0x52, 0x95, 0xbe, 0x97, 0xa4, 0x52, 0x91,
+    0xfc, 0xff, 0x17, 0x24, 0x70, 0xc5, 0xb3, 0x5f, 0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93,
+    0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c,
+    0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x7e, 0xb9,
+    0x8f, 0x2a, 0x55, 0xe9, 0x7b, 0x49, 0x2a, 0x15, 0x19, 0xff, 0x7f, 0x41, 0x02, 0x57, 0x1c, 0xfb,
+    0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0,
+    0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40,
+    0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0xe5, 0x95, 0xfb, 0xa8, 0x52, 0x95, 0xbe, 0x97, 0xa4, 0x52,
+    0x91, 0xc5, 0xff, 0x17, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff,
+    0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c,
+    0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x56,
+    0xb9, 0x8f, 0x2a, 0x55, 0xe9, 0x7b, 0x49, 0x2a, 0x15, 0x59, 0xf1, 0x7f, 0x41, 0x02, 0x57, 0x14,
+    0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51,
+    0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00,
+    0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x55, 0x95, 0xfb, 0xa8, 0x52, 0x95, 0xbe, 0x97, 0xa4,
+    0x52, 0x91, 0x55, 0xfc, 0x17, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0,
+    0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55,
+    0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55,
+    0x55, 0xb9, 0x8f, 0x2a, 0x55, 0xe9, 0x79, 0x49, 0x2a, 0x15, 0x59, 0x15, 0x7f, 0x41, 0x02, 0x57,
+    0x14, 0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73,
+    0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f,
+    0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x55, 0x95, 0xf9, 0xa8, 0x52, 0x95, 0x96, 0x97,
+    0xa4, 0x52, 0x91, 0x55, 0xc5, 0x17, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0x55, 0xf2, 0x54,
+    0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45,
+    0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55,
+    0x55, 0x55, 0x95, 0x8f, 0x2a, 0x55, 0x59, 0x79, 0x49, 0x2a, 0x15, 0x59, 0x55, 0x71, 0x41, 0x02,
+    0x57, 0x14, 0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0,
+    0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3,
+    0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x55, 0x55, 0xf9, 0xa8, 0x52, 0x95, 0x95,
+    0x97, 0xa4, 0x52, 0x91, 0x55, 0x55, 0x14, 0x24, 0x70, 0x45, 0xb1, 0x5f, 0x02, 0x1f, 0x55, 0xf2,
+    0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f,
+    0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x93,
+    0xbf, 0xff, 0xfe, 0xff, 0xaf, 0x82, 0xfe, 0xcf, 0xb8, 0x2b, 0xab, 0xfe, 0xcf, 0xfb, 0x3f, 0x0f,
+    0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff,
+    0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1,
+    0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0xf9, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff,
+    0x8c, 0x9b, 0xb2, 0xea, 0xff, 0xbc, 0xff, 0xc7, 0xb0, 0x32, 0xff, 0xbf, 0x5f, 0x02, 0x1f, 0xc5,
+    0xf3, 0xf0, 0xf0, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x0f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96, 0xf0,
+    0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33,
+    0x93, 0x9f, 0xff, 0xfe, 0xff, 0xaf, 0x82, 0xfe, 0xcf, 0x78, 0x29, 0xab, 0xfe, 0xcf, 0xfb, 0x7f,
+    0x01, 0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x0f, 0xff, 0x3f, 0x0f, 0x00, 0x19,
+    0xff, 0xf0, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45,
+    0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8,
+    0xff, 0x8c, 0x97, 0xb2, 0x52, 0xf9, 0xbc, 0xff, 0x17, 0xb0, 0x32, 0xff, 0xbf, 0x5f, 0x02, 0x1f,
+    0xc5, 0xf3, 0xf0, 0xf3, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x3f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96,
+    0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc,
+    0x33, 0x53, 0x95, 0xff, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xeb, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb,
+    0x7f, 0x01, 0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0x3c, 0x0f, 0x05, 0xff, 0x3f, 0x0f, 0x00,
+    0x19, 0x57, 0xf0, 0x33, 0x53, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30,
+    0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa,
+    0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0x84, 0x32, 0xff, 0xbf, 0x5f, 0x02,
+    0x1f, 0xc5, 0xf2, 0x54, 0xf0, 0xff, 0xb3, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x13, 0x05, 0x0c, 0x05,
+    0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45,
+    0x4c, 0x31, 0x53, 0x55, 0x55, 0xfe, 0xb9, 0x8f, 0xaa, 0x55, 0xe9, 0x7b, 0x49, 0x2a, 0x55, 0xe9,
+    0xff, 0x7f, 0x41, 0x02, 0x57, 0xfc, 0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09,
+    0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10,
+    0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x65, 0x95, 0xfb,
+    0xa8, 0x5a, 0x95, 0xbe, 0x97, 0xa4, 0x52, 0x95, 0x95, 0xff, 0x17, 0x24, 0x70, 0x55, 0xb1, 0x5f,
+    0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c,
+    0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44,
+    0x45, 0x4c, 0x31, 0x53, 0x95, 0xff, 0xfe, 0xff, 0xaf, 0x82, 0xfe, 0xcf, 0x78, 0x29, 0x2b, 0x95,
+    0xcf, 0xfb, 0x7f, 0x21, 0x2b, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0xbc, 0x0f, 0x3f, 0xff, 0x3f,
+    0x0f, 0x00, 0x19, 0xff, 0xf3, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3,
+    0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xef, 0xff,
+    0xff, 0x2a, 0xe8, 0xff, 0x8c, 0x97, 0xb2, 0x52, 0xf9, 0xbc, 0xff, 0x17, 0xb2, 0x06, 0xff, 0xbf,
+    0x5f, 0x02, 0x1f, 0xc5, 0xfb, 0xf0, 0xf3, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x3f, 0x3f, 0x33, 0x05,
+    0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00,
+    0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0x5f, 0xfe, 0xb9, 0xaf, 0xaa, 0x7e, 0xe9, 0x7b, 0x69, 0x2a,
+    0x55, 0xe9, 0xfb, 0x7f, 0x41, 0x2a, 0xf3, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0x24, 0x4f, 0x05, 0xff,
+    0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x33, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5,
+    0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x79, 0xe5,
+    0x9f, 0xfb, 0xaa, 0xea, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa4, 0x72, 0xfc,
+    0xbf, 0x5f, 0x02, 0x1f, 0x45, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17,
+    0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00,
+    0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69,
+    0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x41, 0x2a, 0x17, 0xff, 0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05,
+    0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54,
+    0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55,
+    0xe5, 0x9f, 0xfb, 0xaa, 0x5a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa4, 0x72,
+    0xc5, 0xbf, 0x5f, 0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f,
+    0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff,
+    0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x7e, 0xb9, 0xaf, 0xaa, 0x55, 0xe9, 0x7b,
+    0x69, 0x2a, 0x55, 0xe9, 0xf9, 0x7f, 0x41, 0x2a, 0x57, 0xf1, 0xfb, 0x25, 0xf0, 0x51, 0x25, 0x4f,
+    0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53,
+    0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55,
+    0x55, 0xe5, 0x95, 0xfb, 0xaa, 0x5a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0x96, 0xff, 0x17, 0xa4,
+    0x72, 0x55, 0xbc, 0x5f, 0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71, 0x05,
+    0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f,
+    0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x56, 0xb9, 0xaf, 0xaa, 0x55, 0xe9,
+    0x7b, 0x69, 0x2a, 0x55, 0x59, 0xf9, 0x7f, 0x41, 0x2a, 0x57, 0x15, 0xfb, 0x25, 0xf0, 0x51, 0x25,
+    0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff,
+    0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33,
+    0x55, 0x55, 0x65, 0x95, 0xfb, 0xaa, 0x5a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0x95, 0xff, 0x17,
+    0xa4, 0x72, 0x55, 0x85, 0x5f, 0x02, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x71,
+    0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14,
+    0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x56, 0xb9, 0xaf, 0xaa, 0x55,
+    0xe9, 0x7b, 0x69, 0x2a, 0x55, 0x59, 0xf9, 0x7f, 0x41, 0x2a, 0x57, 0x55, 0xf2, 0x25, 0x14, 0x51,
+    0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09,
+    0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14,
+    0x33, 0x55, 0x55, 0x65, 0x95, 0xfb, 0xaa, 0x5a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0x95, 0xff,
+    0x17, 0xa4, 0x72, 0x55, 0x65, 0x5c, 0x42, 0x11, 0x55, 0xf2, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94,
+    0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53,
+    0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x56, 0xb9, 0xaf, 0xaa,
+    0x55, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0x59, 0xf9, 0x7f, 0x41, 0x2a, 0x57, 0x55, 0x16, 0x25, 0x14,
+    0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60,
+    0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4,
+    0x14, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff, 0xbe, 0x97, 0xa2, 0x52, 0xf9, 0xbe,
+    0xff, 0x17, 0xb2, 0x3a, 0xf9, 0xbf, 0xcf, 0x2b, 0x1f, 0xfc, 0xfb, 0xf0, 0xf3, 0xff, 0xf3, 0x00,
+    0xf0, 0xf1, 0x3f, 0x3f, 0x33, 0x0c, 0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x3c, 0x01,
+    0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0xff, 0xfe, 0xff, 0xaf,
+    0x82, 0xfe, 0xef, 0x7b, 0x29, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xab, 0x93, 0xff, 0xfb, 0xb1,
+    0xf2, 0xc1, 0xbf, 0x0f, 0x3f, 0xff, 0x3f, 0x0f, 0x00, 0x1f, 0xff, 0xf3, 0x33, 0x43, 0xc0, 0xf0,
+    0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54,
+    0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff, 0xbe, 0x97, 0xa2, 0x52, 0xf9,
+    0xbe, 0xff, 0x17, 0xb2, 0x3a, 0xf9, 0xbf, 0x5f, 0x28, 0x1f, 0xfc, 0xfb, 0xf0, 0xf3, 0xff, 0xf3,
+    0x00, 0xf0, 0xf1, 0x3f, 0x3f, 0x33, 0x04, 0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x3c,
+    0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0xff, 0xfe, 0xff,
+    0xaf, 0x82, 0xfe, 0xcf, 0x78, 0x29, 0x2b, 0x95, 0xcf, 0xfb, 0x7f, 0x21, 0xab, 0xb3, 0xff, 0xfb,
+    0x25, 0xf2, 0x51, 0xbc, 0x0f, 0x3f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff, 0xf3, 0x33, 0x53, 0xc0,
+    0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40,
+    0x54, 0xc4, 0x3c, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52,
+    0x95, 0xbe, 0xff, 0x17, 0xa4, 0x72, 0xf9, 0xbf, 0x5f, 0x0a, 0x1f, 0x55, 0xf2, 0x54, 0xf0, 0xff,
+    0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c,
+    0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55, 0x56,
+    0xb9, 0xaf, 0xaa, 0x55, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0x59, 0xf9, 0x7f, 0x41, 0x2a, 0x57, 0x55,
+    0xfa, 0x25, 0xf0, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73, 0x51,
+    0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00,
+    0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x55, 0x65, 0x95, 0xfb, 0xaa, 0x5a, 0x95, 0xbe, 0x97, 0xa6,
+    0x52, 0x95, 0x95, 0xff, 0x17, 0xa4, 0x72, 0x55, 0xa5, 0x5f, 0x42, 0x1c, 0x55, 0xf2, 0x54, 0xf0,
+    0xff, 0x93, 0x00, 0x94, 0x71, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55,
+    0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x55, 0x55,
+    0x56, 0xb9, 0xaf, 0xaa, 0x55, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0x59, 0xf9, 0x7f, 0x41, 0x2a, 0x57,
+    0x55, 0xfa, 0x25, 0x14, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40, 0x19, 0x57, 0xf0, 0x73,
+    0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f,
+    0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff, 0xbe, 0x97,
+    0xa2, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xb2, 0x3a, 0xf9, 0xbf, 0xef, 0x2b, 0xcf, 0xfc, 0xfb, 0xf0,
+    0xf3, 0xff, 0xf3, 0x00, 0xf0, 0xf2, 0x3f, 0x3f, 0x33, 0x3c, 0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45,
+    0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95,
+    0xff, 0xfe, 0xff, 0xaf, 0x82, 0xfe, 0xef, 0x7b, 0x29, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xab,
+    0x93, 0xff, 0xfb, 0xbe, 0xf2, 0xc1, 0xbf, 0x0f, 0x3f, 0xff, 0x3f, 0x0f, 0x00, 0x1f, 0xff, 0xf3,
+    0x33, 0xc3, 0xc3, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3,
+    0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff, 0xbe,
+    0x97, 0xa2, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xb2, 0x3a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0xfc, 0xfb,
+    0xf0, 0xf3, 0xff, 0xf3, 0x00, 0xb0, 0xf1, 0x3f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96, 0xf0, 0x3f,
+    0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53,
+    0x95, 0xff, 0xfe, 0xff, 0xaf, 0x82, 0xfe, 0xef, 0x7b, 0x29, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21,
+    0xab, 0x93, 0xff, 0xfb, 0xa5, 0xf2, 0x11, 0xbf, 0x0f, 0x3f, 0xff, 0x3f, 0x0f, 0x00, 0x19, 0xff,
+    0xf3, 0x33, 0x53, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1,
+    0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff,
+    0xbe, 0x97, 0xa2, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xb2, 0x3a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0xc5,
+    0xfb, 0xf0, 0xf3, 0xff, 0xf3, 0x00, 0x90, 0xf1, 0x3f, 0x3f, 0x33, 0x05, 0x0c, 0x0f, 0x96, 0xf0,
+    0x3f, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33,
+    0x53, 0x95, 0xff, 0xfe, 0xbb, 0xaf, 0xaa, 0xfe, 0xef, 0x7b, 0x29, 0x2a, 0x95, 0xef, 0xfb, 0x7f,
+    0x21, 0xab, 0x93, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0xb1, 0x0f, 0x3f, 0xff, 0x3f, 0x0b, 0x40, 0x19,
+    0xff, 0xf3, 0x33, 0x51, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45,
+    0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xef, 0x9f, 0xfb, 0xaa, 0xea,
+    0xbf, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f,
+    0x55, 0xf8, 0xf0, 0xf3, 0xff, 0x93, 0x00, 0x94, 0xf1, 0x3f, 0x3f, 0x13, 0x05, 0x0c, 0x0f, 0x96,
+    0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc,
+    0x33, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb,
+    0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x25, 0x4f, 0x05, 0xff, 0x3f, 0x09, 0x40,
+    0x19, 0x57, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10, 0x30,
+    0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa,
+    0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa4, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a,
+    0x1f, 0x55, 0xc6, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0x51, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05,
+    0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45,
+    0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9,
+    0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x41, 0x05, 0xff, 0x3f, 0x09,
+    0x40, 0x19, 0x55, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x10,
+    0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff,
+    0x2a, 0xe8, 0xff, 0xbe, 0x97, 0xa2, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xb2, 0x3a, 0xf9, 0xbf, 0xef,
+    0x2b, 0xef, 0xfc, 0xfb, 0xf0, 0xf3, 0xff, 0xf3, 0x08, 0xf0, 0xfe, 0x3f, 0x3f, 0x33, 0x3c, 0x0c,
+    0x0f, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44,
+    0x45, 0xcc, 0x33, 0x53, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95,
+    0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0xa5, 0x0f, 0x3f, 0xff, 0x3f,
+    0x09, 0x40, 0x19, 0xff, 0xf3, 0x73, 0x51, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3,
+    0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xe5, 0x9f,
+    0xfb, 0xaa, 0xea, 0x97, 0xbe, 0x97, 0xa6, 0x52, 0xb9, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf,
+    0x5f, 0x2a, 0x1f, 0x55, 0xfa, 0xc4, 0xf3, 0xff, 0x93, 0x00, 0x94, 0xf1, 0x0f, 0x3f, 0x17, 0x05,
+    0x0c, 0x0f, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00,
+    0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0x57, 0xfe, 0xb9, 0xaf, 0xaa, 0x5e, 0xe9, 0x7b, 0x69, 0x2a,
+    0x95, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0xa5, 0x4f, 0x31, 0xff,
+    0x3f, 0x09, 0x40, 0x19, 0x7f, 0xf0, 0x73, 0x51, 0xc0, 0x70, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5,
+    0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x1c, 0x33, 0x55, 0x59, 0xe5,
+    0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9,
+    0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0xfa, 0x54, 0xf0, 0xff, 0x93, 0x00, 0x94, 0xf1, 0x05, 0x3f, 0x17,
+    0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x0c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00,
+    0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69,
+    0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x49, 0x05,
+    0xff, 0x7f, 0x09, 0x40, 0x59, 0x55, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53, 0x54,
+    0xc5, 0xc3, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x59,
+    0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa4, 0x7a,
+    0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x54, 0xc4, 0xff, 0x97, 0x00, 0x94, 0x55, 0x05, 0x3f,
+    0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x3f, 0x45, 0x55, 0x3c, 0x04, 0x01, 0x53, 0x14, 0x3f, 0xff,
+    0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b,
+    0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x49,
+    0x45, 0xf1, 0x7f, 0x09, 0x40, 0x59, 0x55, 0xf0, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x53,
+    0x54, 0xc5, 0x43, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55,
+    0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa4,
+    0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x54, 0x54, 0xfc, 0x97, 0x00, 0x94, 0x55, 0x05,
+    0x1f, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x2f, 0x45, 0x55, 0x3c, 0x05, 0x01, 0x53, 0x14, 0x3f,
+    0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9,
+    0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65,
+    0x49, 0x45, 0x15, 0x7f, 0x09, 0x40, 0x59, 0x55, 0x70, 0x71, 0x51, 0xc0, 0x50, 0x60, 0x09, 0x7f,
+    0x52, 0x54, 0xc5, 0x53, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33,
+    0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17,
+    0xa4, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x54, 0x54, 0xc5, 0x97, 0x00, 0x94, 0x55,
+    0x05, 0x15, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x25, 0x45, 0x55, 0x3c, 0x05, 0x01, 0x53, 0x14,
+    0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56,
+    0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51,
+    0x65, 0x49, 0x45, 0x55, 0x71, 0x09, 0x40, 0x59, 0x55, 0x50, 0x71, 0x51, 0xc0, 0x50, 0x60, 0x09,
+    0x57, 0x52, 0x54, 0xc5, 0x53, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14,
+    0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff,
+    0x17, 0xa4, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x54, 0x54, 0x55, 0x94, 0x00, 0x94,
+    0x55, 0x05, 0x15, 0x17, 0x05, 0x0c, 0x05, 0x96, 0x70, 0x25, 0x45, 0x55, 0x3c, 0x05, 0x01, 0x53,
+    0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0xff, 0xfe, 0xff, 0xaf, 0x82,
+    0xfe, 0xef, 0x7b, 0x29, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xab, 0x93, 0xff, 0xfb, 0xbe, 0xf2,
+    0xce, 0xbf, 0x2b, 0xbf, 0xff, 0x3f, 0xaf, 0x00, 0xef, 0xff, 0xf3, 0x33, 0xc3, 0xc3, 0xf0, 0x60,
+    0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4,
+    0x3c, 0x33, 0x55, 0xf9, 0xef, 0xbf, 0xfb, 0xaa, 0xea, 0xff, 0xbe, 0x97, 0xa2, 0x52, 0xf9, 0xbe,
+    0xff, 0x17, 0xb2, 0x3a, 0xf9, 0xbf, 0xef, 0x2b, 0xef, 0xfc, 0xba, 0xfa, 0xfb, 0xff, 0xc7, 0x0a,
+    0xf0, 0xfe, 0x3f, 0x3f, 0x13, 0x3c, 0x0c, 0x0f, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01,
+    0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0xff, 0xfe, 0xb9, 0xaf,
+    0xaa, 0xfe, 0xeb, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xbe,
+    0xf2, 0xce, 0xa7, 0xab, 0xbf, 0xff, 0x7f, 0xa1, 0x00, 0xef, 0xff, 0xf3, 0x33, 0xc1, 0xc3, 0xf0,
+    0x60, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54,
+    0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9,
+    0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0xfa, 0xf8, 0xf3, 0xff, 0x97,
+    0x08, 0x94, 0xf1, 0x3f, 0x3f, 0x17, 0x05, 0x0c, 0x0f, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c,
+    0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0x55, 0xfe, 0xb9,
+    0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb,
+    0xa5, 0xf2, 0x51, 0x65, 0x69, 0x85, 0xff, 0x7f, 0x29, 0x40, 0x59, 0x55, 0xf0, 0x73, 0x51, 0xc0,
+    0x50, 0x60, 0x09, 0xff, 0x53, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40,
+    0x54, 0xc4, 0x14, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52,
+    0x95, 0xbe, 0xff, 0x17, 0xa4, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x54, 0x94, 0xff,
+    0x97, 0x00, 0x94, 0x55, 0x05, 0xff, 0x17, 0x05, 0x0c, 0x05, 0x96, 0xf0, 0x2f, 0x45, 0x55, 0x3c,
+    0x05, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe,
+    0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff,
+    0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x49, 0x45, 0x55, 0x79, 0x09, 0x40, 0x59, 0x55, 0x54, 0x71, 0x51,
+    0xc0, 0x50, 0x60, 0x09, 0x55, 0x52, 0x54, 0xc5, 0x53, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00,
+    0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0xf9, 0xef, 0xff, 0xff, 0x2a, 0xe8, 0xff, 0xbe, 0x97, 0xa2,
+    0x52, 0xf9, 0xbe, 0xff, 0x17, 0xb2, 0x3a, 0xf9, 0xbf, 0xef, 0x2b, 0xef, 0xfc, 0xbb, 0xf2, 0xfb,
+    0xff, 0xfb, 0x0a, 0xf0, 0xfe, 0x3f, 0x3f, 0xf3, 0x3c, 0x0c, 0x0f, 0x96, 0xf0, 0xbf, 0x45, 0x55,
+    0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0x7f,
+    0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97,
+    0xff, 0xfb, 0xbe, 0xf2, 0xce, 0xa5, 0xab, 0xbf, 0xff, 0x7f, 0xa9, 0x00, 0xef, 0xff, 0xf3, 0x73,
+    0xc1, 0xc3, 0xf0, 0x60, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f,
+    0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97,
+    0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0xef, 0x2b, 0xef, 0x54, 0xba, 0xfa,
+    0xfb, 0xff, 0x97, 0x0a, 0xc4, 0xfe, 0x3f, 0x3f, 0x17, 0x3c, 0x0c, 0x0f, 0x96, 0xf0, 0xbf, 0x45,
+    0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95,
+    0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa,
+    0x97, 0xff, 0xfb, 0xbe, 0xf2, 0x4e, 0xa5, 0xab, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0xe1, 0xff, 0xf3,
+    0x73, 0xc1, 0xc3, 0xf0, 0x60, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3,
+    0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe,
+    0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x2f, 0x55, 0xba,
+    0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0xfc, 0x3f, 0x3f, 0x17, 0x05, 0x0c, 0x0f, 0x96, 0xf0, 0xbf,
+    0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53,
+    0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21,
+    0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0xa5, 0xab, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x19, 0xff,
+    0xf3, 0x73, 0x51, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1,
+    0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f,
+    0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55,
+    0x9a, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0xc5, 0x3f, 0x3f, 0x17, 0x05, 0x0c, 0x0f, 0x96, 0xf0,
+    0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33,
+    0x53, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f,
+    0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59,
+    0xf1, 0xf3, 0x73, 0x51, 0xc0, 0xf0, 0x60, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45,
+    0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xe5, 0x9f, 0xfb, 0xaa, 0xea,
+    0x97, 0xbe, 0x97, 0xa6, 0x52, 0xb9, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f,
+    0x55, 0x96, 0xfa, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x55, 0x3c, 0x3f, 0x17, 0x05, 0x0c, 0x07, 0x96,
+    0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc,
+    0x31, 0x53, 0x95, 0x57, 0xfe, 0xb9, 0xaf, 0xaa, 0x5e, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xe9, 0xfb,
+    0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x87, 0xff, 0x7f, 0xa9, 0x40,
+    0x59, 0x15, 0xf3, 0x73, 0x51, 0xc0, 0x50, 0x60, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30,
+    0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa,
+    0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a,
+    0x1f, 0x55, 0x96, 0x5a, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x55, 0x05, 0x3f, 0x17, 0x05, 0x0c, 0x05,
+    0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45,
+    0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9,
+    0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x49, 0x45, 0xf9, 0x7b, 0x09,
+    0x4a, 0x59, 0x55, 0xf0, 0x7f, 0x51, 0xc0, 0x50, 0x60, 0x09, 0x7f, 0x52, 0x54, 0xc5, 0x53, 0x10,
+    0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb,
+    0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa4, 0x7a, 0xf9, 0xbf, 0x5f,
+    0x2a, 0x1f, 0x55, 0x96, 0x54, 0x94, 0x9f, 0x97, 0xa0, 0x94, 0x55, 0x45, 0xfc, 0x17, 0x05, 0x0c,
+    0x05, 0x96, 0xf0, 0x25, 0x45, 0x55, 0x3c, 0x05, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44,
+    0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55,
+    0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x49, 0x45, 0x79, 0x79,
+    0x09, 0x4a, 0x59, 0x55, 0x14, 0x7f, 0x51, 0xc0, 0x50, 0x60, 0x09, 0x57, 0x52, 0x54, 0xc5, 0x53,
+    0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x14, 0x33, 0x55, 0x59, 0xe5, 0x9f,
+    0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa4, 0x7a, 0xf9, 0xbf,
+    0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x54, 0x94, 0x95, 0x97, 0xa0, 0x94, 0x55, 0x45, 0xc5, 0x17, 0x05,
+    0x0c, 0x05, 0x96, 0x50, 0x25, 0x45, 0x55, 0x3c, 0x05, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00,
+    0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a,
+    0x55, 0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x49, 0x45, 0x55,
+    0x79, 0x09, 0x4a, 0x59, 0x55, 0x54, 0x71, 0x51, 0xc0, 0x50, 0x60, 0x09, 0x55, 0x52, 0x54, 0xc5,
+    0x53, 0x10, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0x44, 0x15, 0x33, 0x55, 0x59, 0xe5,
+    0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa4, 0x7a, 0xf9,
+    0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x54, 0x54, 0x95, 0x97, 0xa0, 0x94, 0x55, 0x45, 0x55, 0x14,
+    0x05, 0x0c, 0x05, 0x96, 0x54, 0x25, 0x45, 0x55, 0x3c, 0x05, 0x01, 0x53, 0x14, 0x3b, 0xff, 0x00,
+    0x02, 0x44, 0x45, 0x54, 0x31, 0x53, 0x95, 0xff, 0xfe, 0xbb, 0xaf, 0xaa, 0xfe, 0xef, 0x7b, 0x29,
+    0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xab, 0x93, 0xff, 0xfb, 0xbe, 0xf2, 0xce, 0xaf, 0xab, 0xbf,
+    0xff, 0xbf, 0xab, 0xa0, 0xef, 0xff, 0xf3, 0x33, 0xcf, 0xc3, 0xf0, 0x60, 0x09, 0xff, 0x5b, 0x54,
+    0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55, 0xf9,
+    0xef, 0x9f, 0xfb, 0xaa, 0xea, 0xbf, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a,
+    0xf9, 0xbf, 0xef, 0x2b, 0xef, 0x7c, 0xba, 0xfa, 0xfb, 0xff, 0x9b, 0x0a, 0xfa, 0xfe, 0x3f, 0x3f,
+    0xc7, 0x3c, 0x0c, 0x0f, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff,
+    0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b,
+    0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xbe, 0xf2, 0xce, 0xa5, 0xab,
+    0xbf, 0xff, 0x7f, 0xa9, 0xa0, 0xef, 0xff, 0xf3, 0x73, 0xc1, 0xc3, 0xf0, 0x60, 0x09, 0xff, 0x5b,
+    0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33, 0x55,
+    0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2,
+    0x7a, 0xf9, 0xbf, 0xef, 0x2a, 0xef, 0x55, 0xba, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0xfe, 0x3f,
+    0x3f, 0x17, 0x3c, 0x0c, 0x0f, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f,
+    0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9,
+    0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa6, 0xf2, 0x5e, 0xa5,
+    0xab, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0xe9, 0xff, 0xf3, 0x73, 0x11, 0xc3, 0xf0, 0x60, 0x09, 0xff,
+    0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c, 0x33,
+    0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17,
+    0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0xef, 0x55, 0xba, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0xfe,
+    0x3f, 0x3f, 0x17, 0x05, 0x0c, 0x0f, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14,
+    0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x33, 0x53, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe,
+    0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51,
+    0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf3, 0x73, 0x51, 0xc0, 0xf0, 0x6b, 0x09,
+    0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4, 0x3c,
+    0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff,
+    0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x5a, 0xf8, 0xff, 0x97, 0x0a, 0x94,
+    0x55, 0x25, 0x3f, 0x17, 0x05, 0x4c, 0x85, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53,
+    0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa,
+    0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2,
+    0x51, 0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x55, 0xf2, 0x73, 0x51, 0x10, 0x54, 0x68,
+    0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54, 0xc4,
+    0x14, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe,
+    0xff, 0x17, 0xa4, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x54, 0x54, 0x95, 0x97, 0xa0,
+    0x94, 0x55, 0x45, 0x55, 0x16, 0x05, 0x4c, 0x25, 0x96, 0x54, 0x25, 0x45, 0x55, 0x3c, 0x05, 0x01,
+    0x53, 0x14, 0x3b, 0xff, 0x00, 0x02, 0x44, 0x45, 0x54, 0x31, 0x53, 0x95, 0x7f, 0xfe, 0xb9, 0xaf,
+    0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5,
+    0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xf2,
+    0x6b, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40, 0x54,
+    0xc4, 0x3c, 0x33, 0x55, 0xf9, 0xe5, 0x9f, 0xfb, 0xaa, 0xea, 0x97, 0xbe, 0x97, 0xa6, 0x52, 0xb9,
+    0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xf8, 0xff, 0x97,
+    0x0a, 0x94, 0x95, 0x27, 0x3f, 0x16, 0x85, 0x6e, 0xbc, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c, 0x3c,
+    0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0x31, 0x53, 0x95, 0x57, 0xfe, 0xb9,
+    0xaf, 0xaa, 0x5e, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb,
+    0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x87, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x59, 0xf2, 0x63, 0x51, 0xe8,
+    0x16, 0x6b, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xf3, 0x0f, 0x00, 0x40,
+    0x54, 0xc4, 0x14, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52,
+    0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x5a, 0xf8, 0xff,
+    0x97, 0x0a, 0x94, 0x55, 0x25, 0x3f, 0x16, 0x85, 0x6e, 0x85, 0x96, 0xf0, 0xbf, 0x45, 0x55, 0x3c,
+    0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0x4c, 0x31, 0x53, 0x95, 0x55, 0xfe,
+    0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff,
+    0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x49, 0x45, 0x55, 0x79, 0x09, 0x4a, 0x59, 0x55, 0x54, 0x65, 0x51,
+    0xe8, 0x56, 0x62, 0x49, 0x55, 0x52, 0x54, 0xc5, 0x53, 0x10, 0x30, 0x45, 0xb1, 0xf3, 0x0f, 0x20,
+    0x40, 0x54, 0x44, 0x15, 0x33, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6,
+    0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb,
+    0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0xf8, 0xf2, 0xbf, 0x3c, 0xff,
+    0x3f, 0x3c, 0x02, 0xc2, 0x1b, 0xbf, 0xbb, 0x20, 0xa8, 0xcc, 0xff, 0xff, 0xff, 0x5f, 0x95, 0x7f,
+    0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97,
+    0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63,
+    0x51, 0xe8, 0xfa, 0x2b, 0x2f, 0xff, 0x5b, 0xf0, 0xff, 0xc3, 0x13, 0x30, 0x4c, 0xf1, 0xb3, 0x0b,
+    0x80, 0xca, 0xfc, 0xc7, 0xfc, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97,
+    0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa,
+    0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0xc6, 0xf2, 0xbf, 0x05,
+    0xff, 0x3f, 0x3c, 0x01, 0x43, 0x14, 0x3f, 0xbb, 0x00, 0xa8, 0xc4, 0x7f, 0xcc, 0xff, 0x5f, 0x95,
+    0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa,
+    0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2,
+    0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x21, 0xff, 0x5b, 0xf0, 0xff, 0xc3, 0x13, 0x30, 0x44, 0xf1, 0xb3,
+    0x0b, 0x80, 0x4a, 0xfc, 0xc7, 0xfc, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe,
+    0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96,
+    0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xf0, 0xbf,
+    0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xff, 0x00, 0x00, 0x44, 0x45, 0xcc, 0xff, 0x5f,
+    0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61,
+    0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x55,
+    0xf2, 0x63, 0x51, 0xe8, 0x56, 0x6a, 0x09, 0xff, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0xf1,
+    0xf3, 0x0f, 0x00, 0x40, 0x54, 0x44, 0x15, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95,
+    0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55,
+    0x96, 0x5a, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x55, 0x25, 0x5f, 0x16, 0x85, 0x6e, 0xa5, 0x96, 0xc4,
+    0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3b, 0xff, 0x00, 0x02, 0x44, 0x45, 0x54, 0x31,
+    0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f,
+    0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff, 0x7b, 0xa9, 0x48, 0x59,
+    0x55, 0x72, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49, 0xf1, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45,
+    0xb1, 0xf3, 0x0f, 0x20, 0x40, 0x54, 0x44, 0x15, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a,
+    0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f,
+    0x55, 0x96, 0x5a, 0xf8, 0x9f, 0x97, 0x8a, 0x94, 0x55, 0x25, 0x55, 0x16, 0x85, 0x6e, 0xa5, 0x96,
+    0x54, 0xbc, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3b, 0xff, 0x00, 0x02, 0x44, 0x45, 0x54,
+    0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb,
+    0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0x7f, 0x79, 0xa9, 0x48,
+    0x59, 0x55, 0x52, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49, 0x15, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30,
+    0x45, 0xb1, 0xf3, 0x0f, 0x20, 0x40, 0x54, 0x44, 0x15, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa,
+    0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a,
+    0x1f, 0x55, 0x96, 0x5a, 0xf8, 0x95, 0x97, 0x8a, 0x94, 0x55, 0x65, 0x55, 0x16, 0x85, 0x6e, 0xa5,
+    0x96, 0x54, 0x85, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3b, 0xff, 0x00, 0x02, 0x44, 0x45,
+    0x54, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9,
+    0xfb, 0x7f, 0x41, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0x69, 0x45, 0x55, 0x79, 0x29,
+    0x4a, 0x59, 0x55, 0x56, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49, 0x55, 0x52, 0x54, 0xc5, 0x53, 0x10,
+    0x30, 0x45, 0xb1, 0xf3, 0x0f, 0x20, 0x40, 0x54, 0x44, 0x15, 0x33, 0x55, 0xf9, 0xe7, 0x9f, 0xfb,
+    0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f,
+    0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae,
+    0xbf, 0xfa, 0xf2, 0xbf, 0x3c, 0xff, 0x3f, 0x3c, 0x02, 0xc2, 0x1b, 0xbf, 0xbb, 0x20, 0xa8, 0xcc,
+    0xff, 0xff, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95,
+    0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f,
+    0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0xab, 0x2f, 0xff, 0x1b, 0xf3, 0xff, 0xc3,
+    0x23, 0x20, 0xbc, 0xf1, 0xbb, 0x0b, 0x82, 0xca, 0xfc, 0xff, 0xff, 0xff, 0x55, 0xf9, 0xe7, 0x9f,
+    0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf,
+    0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85,
+    0xae, 0xbf, 0xfa, 0xf2, 0xbf, 0x05, 0xff, 0x3f, 0x3c, 0x01, 0xc3, 0x17, 0x3f, 0xbb, 0x20, 0xa8,
+    0xcc, 0xff, 0xcc, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a,
+    0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff,
+    0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xff, 0x5b, 0xf0, 0xff,
+    0xc3, 0x13, 0x30, 0x45, 0xf1, 0xb3, 0x0b, 0x80, 0x4a, 0xfc, 0xc7, 0xfc, 0xff, 0x55, 0xf9, 0xe7,
+    0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9,
+    0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16,
+    0x85, 0xae, 0xbf, 0x96, 0xf2, 0xbf, 0x45, 0xfc, 0x3f, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xbb, 0x00,
+    0xa8, 0xc4, 0x4f, 0xcc, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69,
+    0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf,
+    0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xff, 0x5b, 0x14,
+    0xff, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xb3, 0x0b, 0x80, 0x4a, 0x7c, 0xc4, 0xfc, 0xff, 0x55, 0xf9,
+    0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a,
+    0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f,
+    0x16, 0x85, 0xae, 0xbf, 0x96, 0xf2, 0xbf, 0x45, 0xc5, 0x3f, 0x3c, 0x01, 0x53, 0x14, 0x3f, 0xbb,
+    0x00, 0xa8, 0xc4, 0x45, 0xcc, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b,
+    0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9,
+    0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xff, 0x5b,
+    0x54, 0xf1, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xb3, 0x0b, 0x80, 0x4a, 0x54, 0xc4, 0xfc, 0xff, 0x55,
+    0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2,
+    0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f,
+    0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xf2, 0xbf, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53, 0x14, 0x3f,
+    0xbb, 0x00, 0xa8, 0x44, 0x45, 0xcc, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9,
+    0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65,
+    0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xff,
+    0x5b, 0x54, 0x15, 0xc3, 0x13, 0x30, 0x45, 0xf1, 0xb3, 0x0b, 0x80, 0x4a, 0x54, 0xc4, 0xfc, 0xff,
+    0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17,
+    0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95,
+    0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xf2, 0xbf, 0x45, 0x55, 0x05, 0x3c, 0x01, 0x53, 0x14,
+    0x3f, 0xbb, 0x00, 0xa8, 0x44, 0x45, 0xcc, 0xff, 0x5f, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56,
+    0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51,
+    0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x55, 0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49,
+    0xfe, 0x5b, 0x54, 0xc5, 0xc3, 0x13, 0x30, 0x45, 0x91, 0xf3, 0x0f, 0x20, 0x50, 0x55, 0x55, 0x15,
+    0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff,
+    0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x5a, 0x78, 0x95, 0x97, 0xaa, 0x94,
+    0x55, 0x65, 0x55, 0x16, 0x85, 0x6e, 0xa5, 0x96, 0x54, 0xa5, 0x45, 0x55, 0x3c, 0x3c, 0x01, 0x53,
+    0x14, 0x3b, 0xff, 0x00, 0x02, 0x44, 0x45, 0x54, 0x31, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa,
+    0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2,
+    0x51, 0x65, 0xa9, 0x85, 0x55, 0x79, 0xa9, 0x4a, 0x59, 0x55, 0x56, 0x65, 0x51, 0xe8, 0x56, 0x6a,
+    0x49, 0x55, 0x5a, 0x54, 0xc5, 0x13, 0x13, 0x30, 0x45, 0xb1, 0xf3, 0x0f, 0x20, 0x40, 0x54, 0x44,
+    0x15, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe,
+    0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x5a, 0x54, 0x95, 0x97, 0xaa,
+    0x94, 0x55, 0x65, 0x55, 0x16, 0x85, 0x6e, 0xa5, 0x96, 0x54, 0xa5, 0x45, 0x55, 0x3c, 0x05, 0x01,
+    0x53, 0x14, 0x3b, 0xff, 0x00, 0x02, 0x44, 0x45, 0x54, 0x31, 0x53, 0x95, 0x7f, 0xfe, 0xb9, 0xaf,
+    0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5,
+    0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa,
+    0xab, 0x2f, 0xff, 0x9b, 0xf3, 0xff, 0xc3, 0xe3, 0x20, 0xbc, 0xb3, 0xbb, 0x0b, 0xaa, 0xca, 0xfc,
+    0xff, 0xff, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9,
+    0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97,
+    0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xf2, 0xbf, 0x89, 0xff, 0x3f, 0xbc,
+    0x0c, 0x52, 0x18, 0xbf, 0xbb, 0x20, 0xa8, 0xc4, 0xff, 0xff, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9,
+    0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb,
+    0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8,
+    0xfa, 0x6b, 0x29, 0xff, 0x5b, 0xf8, 0xff, 0xc3, 0x1b, 0x30, 0x45, 0xf1, 0xb3, 0x0b, 0x82, 0x4a,
+    0xfc, 0xcf, 0xfc, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52,
+    0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff,
+    0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xf2, 0xbf, 0x45, 0x55, 0x3e,
+    0x3c, 0x01, 0x52, 0x14, 0xbf, 0xbb, 0x00, 0xa8, 0x55, 0x45, 0xcc, 0xff, 0x5f, 0x95, 0x55, 0xfe,
+    0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff,
+    0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x55, 0xf2, 0x65, 0x51,
+    0xe8, 0x56, 0x6a, 0x49, 0xfe, 0x5b, 0x54, 0xc5, 0xcb, 0x13, 0x30, 0x45, 0x91, 0xf3, 0xaf, 0x2a,
+    0x50, 0x55, 0x55, 0x15, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6,
+    0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x5a, 0xf8,
+    0xff, 0x97, 0x0a, 0x94, 0x55, 0x25, 0x5f, 0x16, 0x85, 0x6e, 0xa5, 0x96, 0xe4, 0xbf, 0x45, 0x55,
+    0xbc, 0xbc, 0x41, 0x50, 0x56, 0x39, 0xff, 0xaa, 0x02, 0x55, 0x55, 0x55, 0x31, 0x53, 0x95, 0x55,
+    0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97,
+    0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x45, 0x55, 0x79, 0xa9, 0x4a, 0x59, 0x55, 0x56, 0x65,
+    0x51, 0xe8, 0x56, 0x6a, 0x49, 0x55, 0x5a, 0x54, 0xc5, 0x53, 0x12, 0x30, 0x45, 0xb1, 0xf3, 0x0f,
+    0x20, 0x40, 0x54, 0x44, 0x15, 0x33, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97,
+    0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa,
+    0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0xba, 0xf2, 0xbf, 0xb9,
+    0xff, 0x3f, 0xbc, 0x0e, 0xc2, 0x3b, 0xbb, 0xbb, 0xa0, 0xaa, 0xcc, 0xff, 0xff, 0xff, 0x5f, 0x95,
+    0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa,
+    0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2,
+    0x63, 0x51, 0xe8, 0xfa, 0xab, 0x29, 0xff, 0x9b, 0xfb, 0xff, 0xc3, 0xeb, 0x20, 0xb1, 0xb3, 0xbb,
+    0x0b, 0xaa, 0x4a, 0xfc, 0xff, 0xff, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe,
+    0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96,
+    0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xf2, 0xbf,
+    0xb9, 0xff, 0x3f, 0xbc, 0x0e, 0x52, 0x38, 0xbb, 0xbb, 0xa0, 0xaa, 0xc4, 0xff, 0xff, 0xff, 0x5f,
+    0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21,
+    0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9,
+    0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xff, 0x9b, 0x54, 0xe5, 0xc3, 0x2b, 0x22, 0x25, 0xff,
+    0xbb, 0xab, 0x80, 0x5a, 0x55, 0xcc, 0xfc, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f,
+    0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55,
+    0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xf2,
+    0xbf, 0x45, 0x55, 0x3e, 0xbc, 0x21, 0x52, 0xc6, 0xbf, 0xbb, 0x0a, 0xa8, 0x55, 0x45, 0xcc, 0xff,
+    0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f,
+    0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59,
+    0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xff, 0x5b, 0x54, 0xe5, 0xc3, 0x13, 0x22, 0x45,
+    0xf1, 0xbb, 0xab, 0x80, 0x5a, 0x55, 0xc4, 0xfc, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea,
+    0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f,
+    0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96,
+    0xf2, 0xbf, 0x45, 0x55, 0x3e, 0x3c, 0x61, 0x52, 0x54, 0xbc, 0xbb, 0x0a, 0xa8, 0x55, 0x45, 0xc4,
+    0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb,
+    0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40,
+    0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xfe, 0x5b, 0x54, 0xe5, 0xcb, 0x13, 0x26,
+    0x45, 0x15, 0xbb, 0xab, 0x80, 0x5a, 0x55, 0x44, 0xfc, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa,
+    0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a,
+    0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf,
+    0x96, 0xe2, 0xbf, 0x45, 0x55, 0xbe, 0x3c, 0x61, 0x52, 0x54, 0x85, 0xbb, 0x0a, 0xa8, 0x55, 0x45,
+    0xc4, 0xff, 0x5f, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9,
+    0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9,
+    0x40, 0x59, 0x55, 0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49, 0xfe, 0x9b, 0x54, 0xc5, 0xcb, 0x2b,
+    0x26, 0x65, 0x95, 0xf3, 0xaf, 0x2a, 0x50, 0x55, 0x55, 0x15, 0x33, 0x55, 0x59, 0xe5, 0x9f, 0xfb,
+    0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f,
+    0x2a, 0x1f, 0x55, 0x96, 0x5a, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x55, 0x25, 0x5f, 0x16, 0x85, 0x6e,
+    0xa5, 0x96, 0xe4, 0xbf, 0x49, 0x55, 0xbc, 0xbc, 0x62, 0x52, 0x56, 0x79, 0xfc, 0xaa, 0x02, 0x55,
+    0x55, 0x55, 0x11, 0x53, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55,
+    0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff, 0x7f,
+    0xa9, 0x40, 0x59, 0x55, 0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49, 0xfe, 0x9b, 0x54, 0xc5, 0xcb,
+    0x2b, 0x26, 0x65, 0x95, 0x17, 0xaf, 0x2a, 0x50, 0x55, 0x55, 0x15, 0x31, 0x55, 0x59, 0xe5, 0x9f,
+    0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf,
+    0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x5a, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x55, 0x25, 0x5f, 0x16, 0x85,
+    0x6e, 0xa5, 0x96, 0xe4, 0xbf, 0x49, 0x55, 0xbc, 0xbc, 0x62, 0x52, 0x56, 0x79, 0xc5, 0xaa, 0x02,
+    0x55, 0x55, 0x55, 0x11, 0x51, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a,
+    0x55, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff,
+    0x7f, 0xa9, 0x40, 0x59, 0x55, 0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49, 0xfe, 0x9b, 0x54, 0xc5,
+    0xcb, 0x2b, 0x26, 0x65, 0x95, 0x57, 0xa1, 0x2a, 0x50, 0x55, 0x55, 0x15, 0x11, 0x55, 0xf9, 0xe7,
+    0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9,
+    0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16,
+    0x85, 0xae, 0xbf, 0xba, 0xf2, 0xbf, 0xb9, 0xff, 0x3f, 0xbc, 0x4e, 0xe2, 0xbb, 0xbb, 0xbb, 0xa0,
+    0xaa, 0xfc, 0xff, 0xff, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69,
+    0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf,
+    0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xff, 0x9b, 0xfb,
+    0xff, 0xc3, 0xeb, 0x24, 0xa5, 0xbb, 0xbb, 0x0b, 0xaa, 0x5a, 0xfc, 0xff, 0xff, 0xff, 0x55, 0xf9,
+    0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a,
+    0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f,
+    0x16, 0x85, 0xae, 0xbf, 0x96, 0xf2, 0xbf, 0x79, 0x55, 0x3e, 0xbc, 0x6e, 0x52, 0xfa, 0xbf, 0xbb,
+    0x0a, 0xa8, 0x55, 0xc5, 0xff, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b,
+    0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9,
+    0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xff, 0x5b,
+    0x54, 0xe5, 0xc3, 0x1b, 0x26, 0x65, 0xf9, 0xbb, 0xab, 0x80, 0x5a, 0x55, 0xc5, 0xff, 0xff, 0x55,
+    0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2,
+    0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f,
+    0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xe2, 0xbf, 0x45, 0x55, 0xbe, 0xbc, 0x61, 0x52, 0x56, 0xb9,
+    0xbb, 0x0a, 0xa8, 0x55, 0x55, 0xc5, 0xff, 0x5f, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9,
+    0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65,
+    0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x55, 0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49, 0xfe,
+    0x9b, 0x54, 0xe5, 0xcb, 0x2b, 0x26, 0x65, 0x95, 0xfb, 0xaf, 0x2a, 0x50, 0x55, 0x55, 0x15, 0xff,
+    0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17,
+    0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0x5a, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x55,
+    0x25, 0x5f, 0x16, 0x85, 0x6e, 0xa5, 0x96, 0xe4, 0xbf, 0x49, 0x55, 0xbe, 0xbc, 0x62, 0x52, 0x56,
+    0x79, 0xf9, 0xaa, 0x02, 0x55, 0x55, 0x55, 0x15, 0x5f, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56,
+    0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51,
+    0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x55, 0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x49,
+    0xfe, 0x9b, 0x54, 0xe5, 0xcb, 0x2b, 0x26, 0x65, 0x95, 0x57, 0xa9, 0x2a, 0x50, 0x55, 0x55, 0x55,
+    0x15, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe, 0xff,
+    0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a, 0x94,
+    0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0xba, 0xe2, 0xbf, 0xb9, 0xff, 0xbe, 0xbc, 0x6e, 0xe2,
+    0xba, 0xbb, 0xbb, 0xaa, 0xaa, 0xfc, 0xff, 0xff, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf, 0xaa,
+    0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2,
+    0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa, 0xab,
+    0x29, 0xfe, 0x9b, 0xfb, 0xef, 0xcb, 0xeb, 0x26, 0xa6, 0xbb, 0xbb, 0xab, 0xaa, 0x1a, 0xff, 0xff,
+    0xff, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9, 0xbe,
+    0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97, 0x0a,
+    0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xe2, 0xbf, 0xb9, 0xff, 0xbe, 0xbc, 0x6e,
+    0x52, 0xba, 0xbb, 0xbb, 0xaa, 0xaa, 0xc5, 0xff, 0xff, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9, 0xaf,
+    0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb, 0xa5,
+    0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8, 0xfa,
+    0x6b, 0x29, 0xfe, 0x9b, 0xfb, 0xe7, 0xcb, 0xeb, 0x26, 0xa5, 0xbb, 0xbb, 0xab, 0xaa, 0x5a, 0xf1,
+    0xff, 0xff, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52, 0xf9,
+    0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff, 0x97,
+    0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xe2, 0xbf, 0xb9, 0x5f, 0xbe, 0xbc,
+    0x6e, 0x52, 0xba, 0xbb, 0xbb, 0xaa, 0xaa, 0x55, 0xfc, 0xff, 0xff, 0x5f, 0x95, 0x7f, 0xfe, 0xb9,
+    0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff, 0xfb,
+    0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51, 0xe8,
+    0xfa, 0x6b, 0x29, 0xfe, 0x9b, 0x7b, 0xe5, 0xcb, 0xeb, 0x26, 0xa5, 0xbb, 0xbb, 0xab, 0xaa, 0x5a,
+    0x15, 0xff, 0xff, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6, 0x52,
+    0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb, 0xff,
+    0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xe2, 0xbf, 0xb9, 0x55, 0xbe,
+    0xbc, 0x6e, 0x52, 0xba, 0xbb, 0xbb, 0xaa, 0xaa, 0x55, 0xc5, 0xff, 0xff, 0x5f, 0x95, 0x7f, 0xfe,
+    0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97, 0xff,
+    0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63, 0x51,
+    0xe8, 0xfa, 0x6b, 0x29, 0xfe, 0x9b, 0x57, 0xe5, 0xcb, 0xeb, 0x26, 0xa5, 0xb9, 0xbb, 0xab, 0xaa,
+    0x5a, 0x55, 0xf1, 0xff, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97, 0xa6,
+    0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa, 0xfb,
+    0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x3f, 0x16, 0x85, 0xae, 0xbf, 0x96, 0xe2, 0xbf, 0x49, 0x55,
+    0xbe, 0xbc, 0x62, 0x52, 0x96, 0xbb, 0xbb, 0xaa, 0xaa, 0x55, 0x55, 0xfc, 0xff, 0x5f, 0x95, 0x7f,
+    0xfe, 0xb9, 0xaf, 0xaa, 0xfe, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xef, 0xfb, 0x7f, 0x21, 0xaa, 0x97,
+    0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0xbf, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0xf9, 0xf2, 0x63,
+    0x51, 0xe8, 0xfa, 0x6b, 0x29, 0xfe, 0x9b, 0x54, 0xe5, 0xcb, 0x2b, 0x26, 0x65, 0x99, 0xbb, 0xab,
+    0xaa, 0x5a, 0x55, 0x15, 0xff, 0xff, 0x55, 0xf9, 0xe7, 0x9f, 0xfb, 0xaa, 0xea, 0x9f, 0xbe, 0x97,
+    0xa6, 0x52, 0xf9, 0xbe, 0xff, 0x17, 0xa2, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96, 0xfa,
+    0xfb, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x2f, 0x5f, 0x16, 0x85, 0xae, 0xaf, 0x96, 0xe6, 0xbf, 0x49,
+    0x55, 0xbe, 0xbc, 0x62, 0x52, 0x56, 0xb9, 0xbb, 0xaa, 0xaa, 0x55, 0x55, 0xc5, 0xff, 0x5f, 0x95,
+    0x5f, 0xfe, 0xb9, 0xaf, 0xaa, 0x7e, 0xe9, 0x7b, 0x69, 0x2a, 0x95, 0xeb, 0xfb, 0x7f, 0x61, 0xaa,
+    0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x8f, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x79, 0xf2,
+    0x65, 0x51, 0xe8, 0x7a, 0x6a, 0x69, 0xfe, 0x9b, 0x54, 0xe5, 0xcb, 0x2b, 0x26, 0x65, 0x95, 0xbb,
+    0xab, 0xaa, 0x5a, 0x55, 0x55, 0xf1, 0xff, 0x55, 0x79, 0xe5, 0x9f, 0xfb, 0xaa, 0xea, 0x95, 0xbe,
+    0x97, 0xa6, 0x52, 0x99, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55, 0x96,
+    0x7a, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x95, 0x25, 0x5f, 0x16, 0x85, 0xae, 0xa5, 0x96, 0xe6, 0xbf,
+    0x49, 0x55, 0xbe, 0xbc, 0x62, 0x52, 0x56, 0xb9, 0xbb, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xfc, 0x5f,
+    0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f, 0x61,
+    0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40, 0x59, 0x55,
+    0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x69, 0xfe, 0x9b, 0x54, 0xe5, 0xcb, 0x2b, 0x26, 0x65, 0x95,
+    0xbb, 0xab, 0xaa, 0x5a, 0x55, 0x55, 0x15, 0xff, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a, 0x95,
+    0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f, 0x55,
+    0x96, 0x5a, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x55, 0x25, 0x5f, 0x16, 0x85, 0x6e, 0xa5, 0x96, 0xe6,
+    0xbf, 0x49, 0x55, 0xbe, 0xbc, 0x62, 0x52, 0x56, 0xb9, 0xb9, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xc5,
+    0x5f, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb, 0x7f,
+    0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40, 0x59,
+    0x55, 0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x69, 0xfe, 0x9b, 0x54, 0xe5, 0xcb, 0x2b, 0x26, 0x65,
+    0x95, 0x97, 0xab, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0xf1, 0x55, 0x59, 0xe5, 0x9f, 0xfb, 0xaa, 0x6a,
+    0x95, 0xbe, 0x97, 0xa6, 0x52, 0x95, 0xbe, 0xff, 0x17, 0xa6, 0x7a, 0xf9, 0xbf, 0x5f, 0x2a, 0x1f,
+    0x55, 0x96, 0x5a, 0xf8, 0xff, 0x97, 0x0a, 0x94, 0x55, 0x25, 0x5f, 0x16, 0x85, 0x6e, 0xa5, 0x96,
+    0xe6, 0xbf, 0x49, 0x55, 0xbe, 0xbc, 0x62, 0x52, 0x56, 0x79, 0x99, 0xaa, 0xaa, 0x55, 0x55, 0x55,
+    0x55, 0x5c, 0x95, 0x55, 0xfe, 0xb9, 0xaf, 0xaa, 0x56, 0xe9, 0x7b, 0x69, 0x2a, 0x55, 0xe9, 0xfb,
+    0x7f, 0x61, 0xaa, 0x97, 0xff, 0xfb, 0xa5, 0xf2, 0x51, 0x65, 0xa9, 0x85, 0xff, 0x7f, 0xa9, 0x40,
+    0x59, 0x55, 0xf2, 0x65, 0x51, 0xe8, 0x56, 0x6a, 0x69, 0xfe, 0x9b, 0x54, 0xe5, 0xcb, 0x2b, 0x26,
+    0x65, 0x95, 0x57, 0xa9, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x15, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0xc0, 0x18, 0x04, 0xf3, 0xfc, 0xc4, 0x08, 0xc0, 0xf3, 0x3f, 0x01, 0x3f, 0x00, 0x00, 0x04, 0x0c,
+    0xc5, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x1b, 0x28,
+    0xe8, 0xc3, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x47, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c,
+    0x0f, 0x03, 0x80, 0x50, 0x3c, 0x15, 0xf3, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x63,
+    0x10, 0xcc, 0xf1, 0x13, 0x23, 0x00, 0xcf, 0xff, 0x04, 0xfc, 0x00, 0x00, 0x10, 0x30, 0x14, 0x21,
+    0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0, 0xa0, 0x0f,
+    0xff, 0xcf, 0xff, 0x02, 0x08, 0x68, 0x1c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c,
+    0x00, 0x42, 0xf1, 0x54, 0xcc, 0xff, 0x53, 0xfc, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x8c, 0x41, 0x30,
+    0xc5, 0x4f, 0x8c, 0x00, 0x3c, 0xff, 0x13, 0xf0, 0x03, 0x00, 0x40, 0xc0, 0x50, 0x84, 0x1c, 0x4c,
+    0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x3e, 0xfc, 0x3f,
+    0xff, 0x0b, 0x20, 0xa0, 0x71, 0x54, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08,
+    0xc5, 0x53, 0x31, 0xff, 0x4f, 0xc5, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x30, 0x06, 0xc1, 0x14, 0x3f,
+    0x31, 0x02, 0xf0, 0xfc, 0x4f, 0xc0, 0x0f, 0x00, 0x00, 0x01, 0x43, 0x11, 0x72, 0x30, 0x01, 0x3b,
+    0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a, 0xfa, 0xf0, 0xff, 0xfc, 0x2f,
+    0x80, 0x80, 0xc6, 0x51, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x4f,
+    0xc5, 0xfc, 0x3f, 0x55, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x80, 0x18, 0x04, 0x57, 0xfc, 0xc4, 0x08,
+    0xc0, 0xf3, 0x3f, 0x01, 0x3f, 0x00, 0x00, 0x04, 0x0c, 0x45, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81,
+    0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x1b, 0x28, 0xe8, 0xc3, 0xff, 0xf3, 0xbf, 0x00, 0x02,
+    0x1a, 0x47, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x3c, 0x15, 0xf3,
+    0xff, 0x54, 0xc5, 0xff, 0xff, 0xff, 0x03, 0x00, 0x52, 0x10, 0x5c, 0xf1, 0x13, 0x23, 0x00, 0xcf,
+    0xff, 0x04, 0x7c, 0x00, 0x00, 0x10, 0x30, 0x14, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c,
+    0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0, 0xa0, 0x07, 0xff, 0xcf, 0xff, 0x02, 0x08, 0x68, 0x1c,
+    0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0xf1, 0x54, 0xcc, 0xff, 0x53,
+    0x55, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x48, 0x41, 0x70, 0xc5, 0x43, 0x8c, 0x00, 0x3c, 0xff, 0x13,
+    0x70, 0x01, 0x00, 0x40, 0xc0, 0x50, 0x84, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1,
+    0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x16, 0xfc, 0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71, 0x54, 0x0c,
+    0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x53, 0x31, 0xff, 0x4f, 0x55, 0xc5,
+    0xff, 0xff, 0x3f, 0x00, 0x20, 0x05, 0xc1, 0x15, 0x07, 0x31, 0x02, 0xf0, 0xfc, 0x4f, 0x40, 0x05,
+    0x00, 0x00, 0x01, 0x43, 0x11, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10,
+    0xfc, 0xfb, 0x06, 0x0a, 0x56, 0xf0, 0xff, 0xfc, 0x2f, 0x80, 0x80, 0xc6, 0x51, 0x31, 0xfc, 0x07,
+    0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x4f, 0xc5, 0xfc, 0x3f, 0x55, 0x55, 0xfc, 0xff,
+    0xff, 0x00, 0x80, 0x14, 0x04, 0x57, 0x14, 0xc4, 0x08, 0xc0, 0xf3, 0x3f, 0x01, 0x15, 0x00, 0x00,
+    0x04, 0x0c, 0x45, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef,
+    0x1b, 0x28, 0x58, 0xc1, 0xff, 0xf3, 0x8f, 0x00, 0x02, 0x1a, 0x47, 0xc5, 0xf0, 0x1f, 0x0c, 0x06,
+    0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x3c, 0x15, 0xf3, 0xff, 0x54, 0x55, 0xc5, 0xff, 0xff, 0x03,
+    0x00, 0x52, 0x10, 0x5c, 0x51, 0x10, 0x23, 0x00, 0xcf, 0xff, 0x04, 0x54, 0x00, 0x00, 0x10, 0x30,
+    0x14, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0,
+    0x60, 0x05, 0xff, 0xcf, 0x3f, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0,
+    0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0xff, 0x53, 0x55, 0x55, 0xfc, 0xff, 0x0f, 0x00, 0x48,
+    0x41, 0x70, 0x45, 0x41, 0x8c, 0x00, 0x0c, 0xff, 0x13, 0x50, 0x01, 0x00, 0x40, 0xc0, 0x50, 0x84,
+    0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x15,
+    0xfc, 0x3f, 0x7f, 0x08, 0x20, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30,
+    0x00, 0x08, 0xc5, 0x51, 0x31, 0xff, 0x47, 0x55, 0x55, 0xc5, 0xff, 0x3f, 0x00, 0x20, 0x05, 0xc1,
+    0x15, 0x05, 0x31, 0x02, 0x10, 0xfc, 0x4f, 0x40, 0x05, 0x00, 0x00, 0x01, 0x43, 0x11, 0x72, 0x30,
+    0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a, 0x56, 0xf0, 0xff,
+    0x7c, 0x21, 0x80, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20,
+    0x14, 0x47, 0xc5, 0xfc, 0x17, 0x55, 0x55, 0x55, 0xfc, 0xff, 0x00, 0x80, 0x14, 0x04, 0x57, 0x14,
+    0xc4, 0x08, 0x40, 0xf0, 0x3f, 0x01, 0x15, 0x00, 0x00, 0x04, 0x0c, 0x45, 0xc8, 0xc1, 0x04, 0xec,
+    0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x1b, 0x28, 0x58, 0xc1, 0xff, 0x73, 0x85,
+    0x00, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x1c,
+    0x15, 0xf3, 0x57, 0x54, 0x55, 0x55, 0xc5, 0xff, 0x03, 0x00, 0x52, 0x10, 0x5c, 0x51, 0x10, 0x23,
+    0x00, 0xc1, 0x7c, 0x04, 0x54, 0x00, 0x00, 0x10, 0x30, 0x14, 0x21, 0x07, 0x11, 0xb0, 0x33, 0x04,
+    0x8a, 0x44, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0, 0x60, 0x05, 0xff, 0x4f, 0x15, 0x02, 0x08,
+    0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc,
+    0x57, 0x51, 0x55, 0x55, 0x55, 0xfc, 0x0f, 0x00, 0x48, 0x41, 0x70, 0x45, 0x41, 0x8c, 0x00, 0x04,
+    0xf1, 0x11, 0x50, 0x01, 0x00, 0x40, 0xc0, 0x50, 0x84, 0x1c, 0x44, 0xc0, 0xce, 0x10, 0x28, 0x12,
+    0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x15, 0xfc, 0x3f, 0x55, 0x08, 0x20, 0xa0, 0x71,
+    0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x51, 0x31, 0x57, 0x45,
+    0x55, 0x55, 0x55, 0xc5, 0x3f, 0x00, 0x20, 0x05, 0xc1, 0x15, 0x05, 0x31, 0x02, 0x10, 0xc4, 0x47,
+    0x40, 0x05, 0x00, 0x00, 0x01, 0x43, 0x11, 0x72, 0x10, 0x01, 0x3b, 0x43, 0xa0, 0x48, 0x14, 0x85,
+    0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a, 0x56, 0xf0, 0xbf, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31,
+    0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x45, 0xc5, 0x5c, 0x15, 0x55, 0x55,
+    0x55, 0x55, 0xfc, 0x00, 0x80, 0x14, 0x04, 0x57, 0x14, 0x84, 0x08, 0x40, 0x14, 0x1f, 0x01, 0x15,
+    0x00, 0x00, 0x04, 0x0c, 0x45, 0xc8, 0x41, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x51, 0x14, 0xba, 0x43,
+    0xf0, 0xeb, 0x1b, 0x28, 0x5a, 0xc1, 0x7f, 0x56, 0x85, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f,
+    0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x14, 0x15, 0x73, 0x55, 0x54, 0x55, 0x55, 0x55,
+    0xc5, 0x03, 0x00, 0x52, 0x10, 0x5c, 0x51, 0x10, 0x22, 0x00, 0x51, 0x5c, 0x04, 0x54, 0x00, 0x00,
+    0x10, 0x30, 0x14, 0x21, 0x07, 0x11, 0xb0, 0x33, 0x04, 0x8a, 0x44, 0x51, 0xe8, 0x0e, 0xc1, 0xa7,
+    0x6f, 0xa0, 0x68, 0x05, 0x7f, 0x59, 0x15, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18,
+    0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x55, 0x54, 0xcc, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x0c,
+    0x00, 0x48, 0x41, 0x70, 0x45, 0x41, 0x88, 0x00, 0x44, 0x51, 0x11, 0x50, 0x01, 0x00, 0x40, 0x40,
+    0x50, 0x84, 0x1c, 0x44, 0xc0, 0xce, 0x10, 0x28, 0x12, 0x45, 0xa1, 0x3b, 0x04, 0x97, 0xbe, 0x81,
+    0xa2, 0x15, 0x7c, 0x65, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1,
+    0xf3, 0x30, 0x08, 0x48, 0x55, 0x51, 0x31, 0x57, 0x45, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x20,
+    0x05, 0xc1, 0x15, 0x05, 0x21, 0x02, 0x10, 0x45, 0x45, 0x40, 0x05, 0x00, 0x00, 0x01, 0x41, 0x11,
+    0x72, 0x10, 0x01, 0x3b, 0x43, 0xa0, 0x48, 0x14, 0x85, 0xee, 0x10, 0x5c, 0xfa, 0x06, 0x8a, 0x56,
+    0xf0, 0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3,
+    0x20, 0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0xc0, 0x38, 0x04,
+    0xf3, 0xff, 0xc4, 0x08, 0xc0, 0xf3, 0x3f, 0x01, 0xff, 0x00, 0x00, 0x04, 0x0c, 0xc5, 0xc8, 0xc1,
+    0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x1b, 0x28, 0xe8, 0xcf, 0xff,
+    0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x47, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80,
+    0x50, 0x3c, 0x15, 0xf3, 0xff, 0x54, 0xf9, 0xff, 0xff, 0xff, 0x03, 0x00, 0xe2, 0x10, 0x5c, 0xf1,
+    0x13, 0x23, 0x00, 0xcf, 0xff, 0x04, 0xfc, 0x03, 0x00, 0x10, 0x30, 0x14, 0x21, 0x07, 0x13, 0xb0,
+    0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0, 0xa0, 0x3f, 0xff, 0xcf, 0xff,
+    0x02, 0x08, 0x68, 0x1c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0xf1,
+    0x54, 0xcc, 0xff, 0x53, 0x55, 0x95, 0xff, 0xff, 0x0f, 0x00, 0x48, 0x41, 0x70, 0x55, 0x81, 0x8c,
+    0x00, 0x3c, 0xff, 0x13, 0x50, 0x01, 0x00, 0x40, 0xc0, 0x50, 0x84, 0x1c, 0x4c, 0xc0, 0xce, 0x10,
+    0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x15, 0xfc, 0x3f, 0xff, 0x0b, 0x20,
+    0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x51, 0x31,
+    0xff, 0x4f, 0x55, 0x55, 0x95, 0xff, 0x3f, 0x00, 0x20, 0x05, 0xc1, 0x15, 0x05, 0xb1, 0x02, 0x14,
+    0xfc, 0x7f, 0x50, 0x05, 0x00, 0x00, 0x01, 0x43, 0x15, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8,
+    0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a, 0x56, 0xf0, 0xff, 0x5c, 0x21, 0x80, 0x80, 0xc6,
+    0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x47, 0xc5, 0xfc, 0x15,
+    0x55, 0x55, 0x55, 0x55, 0xfe, 0x00, 0x80, 0x14, 0x04, 0x57, 0x14, 0x84, 0x08, 0x40, 0x14, 0x3f,
+    0x01, 0x15, 0x00, 0x00, 0x04, 0x0c, 0x45, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14,
+    0xba, 0x43, 0xf0, 0xeb, 0x1b, 0x28, 0x5a, 0xc1, 0x7f, 0x56, 0x85, 0x80, 0x02, 0x1a, 0x57, 0xc5,
+    0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x14, 0x15, 0x73, 0x55, 0x54, 0x55,
+    0x55, 0x55, 0x95, 0x03, 0x00, 0x52, 0x10, 0x5c, 0x51, 0x10, 0x22, 0x00, 0x51, 0x54, 0x04, 0x54,
+    0x00, 0x00, 0x10, 0x10, 0x14, 0x21, 0x07, 0x11, 0xb0, 0x33, 0x04, 0x8a, 0x44, 0x51, 0xe8, 0x0e,
+    0x41, 0xa5, 0x6f, 0xa0, 0x68, 0x05, 0x57, 0x59, 0x15, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f,
+    0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0x55, 0xe1, 0xff, 0xff, 0xff,
+    0xff, 0x2f, 0x00, 0xac, 0x4f, 0x30, 0xff, 0x8f, 0x8c, 0x00, 0x3c, 0xff, 0x13, 0xf0, 0x0f, 0x00,
+    0x40, 0xc0, 0x50, 0x8c, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff,
+    0xbe, 0x82, 0x82, 0xfe, 0xfc, 0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71, 0x54, 0x0c, 0xff, 0xc1, 0x60,
+    0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x53, 0x31, 0xff, 0x8f, 0xbf, 0xff, 0xfe, 0xff, 0xbf,
+    0x0a, 0x84, 0x3e, 0xc1, 0xfc, 0x3f, 0xbe, 0x02, 0xf0, 0xfc, 0x7f, 0xc0, 0x3f, 0x00, 0x00, 0x01,
+    0x43, 0x31, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x0a,
+    0x0a, 0xfa, 0xf3, 0xff, 0xfc, 0x2f, 0x80, 0x80, 0xc6, 0x51, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04,
+    0xcf, 0xc3, 0x00, 0x20, 0x14, 0x4f, 0xc5, 0xfc, 0x3f, 0x55, 0xfe, 0xff, 0xff, 0xff, 0x08, 0x90,
+    0xf8, 0x04, 0x57, 0xfc, 0xc8, 0x08, 0xc0, 0xf3, 0x3f, 0x01, 0xff, 0x00, 0x00, 0x04, 0x0c, 0x45,
+    0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x2b, 0x28, 0xe8,
+    0xcf, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x47, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f,
+    0x03, 0x80, 0x50, 0x3c, 0x15, 0xf3, 0xff, 0x54, 0x59, 0xe5, 0xff, 0xff, 0xab, 0x40, 0xca, 0x13,
+    0x5c, 0x55, 0xe0, 0x2b, 0x00, 0xcf, 0xff, 0x07, 0x5c, 0x00, 0x00, 0x10, 0x30, 0x14, 0x21, 0x07,
+    0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0, 0xa0, 0x07, 0xff,
+    0xcf, 0xff, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00,
+    0x42, 0x71, 0x54, 0xcc, 0xff, 0x53, 0x55, 0x95, 0xff, 0xff, 0xaf, 0x02, 0x69, 0x4c, 0x70, 0x55,
+    0x81, 0xaf, 0x00, 0x3c, 0xff, 0x1f, 0x50, 0x01, 0x00, 0x40, 0xc0, 0x50, 0x84, 0x1c, 0x4c, 0xc0,
+    0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x16, 0xfc, 0x3f, 0xff,
+    0x0b, 0x20, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5,
+    0x51, 0x31, 0xff, 0x4f, 0x55, 0x55, 0xfe, 0xff, 0x3f, 0x08, 0xa4, 0x05, 0xc1, 0x55, 0x05, 0xbe,
+    0x02, 0xf0, 0xfc, 0x7f, 0x40, 0x05, 0x00, 0x00, 0x01, 0x43, 0x11, 0x72, 0x30, 0x01, 0x3b, 0x43,
+    0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a, 0x56, 0xf0, 0xff, 0xfc, 0x2f, 0x80,
+    0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x47, 0xc5,
+    0xfc, 0x3f, 0x55, 0x55, 0x55, 0xfe, 0xff, 0x80, 0x80, 0x14, 0x08, 0x56, 0x14, 0xc6, 0x2a, 0x58,
+    0xf0, 0xff, 0x41, 0x15, 0x00, 0x20, 0x04, 0x0c, 0x55, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22,
+    0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x1b, 0x28, 0x58, 0xc1, 0xff, 0x73, 0x85, 0x00, 0x02, 0x1a,
+    0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x1c, 0x15, 0xf3, 0x57,
+    0x54, 0x55, 0x55, 0x55, 0xf9, 0x03, 0x08, 0x52, 0xc8, 0x58, 0x51, 0x58, 0xa2, 0x60, 0x51, 0xfc,
+    0x07, 0x55, 0x00, 0x80, 0x10, 0x30, 0x54, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51,
+    0xe8, 0x0e, 0xc1, 0xaf, 0x6f, 0xa0, 0x68, 0x05, 0xff, 0x59, 0x15, 0x02, 0x0a, 0x68, 0x5c, 0x15,
+    0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x51, 0x54, 0xcc, 0x55, 0x51, 0x55,
+    0x55, 0x55, 0xe5, 0x0f, 0x20, 0x48, 0x41, 0x70, 0x45, 0x41, 0x89, 0x00, 0x45, 0xf1, 0x1f, 0x54,
+    0x01, 0x00, 0x40, 0xc0, 0x50, 0x85, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b,
+    0x04, 0xbf, 0xbe, 0x81, 0xa2, 0x15, 0xfc, 0x67, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff,
+    0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0x45, 0x51, 0x31, 0x57, 0x45, 0x55, 0x55, 0x55,
+    0x55, 0x39, 0x00, 0x22, 0x05, 0xc1, 0x15, 0x05, 0x21, 0x02, 0x10, 0x55, 0x45, 0x40, 0x05, 0x00,
+    0x00, 0x01, 0x41, 0x11, 0x72, 0x10, 0x01, 0x3b, 0x43, 0xa0, 0x48, 0x14, 0x85, 0xee, 0x10, 0x54,
+    0xfa, 0x06, 0x8a, 0x56, 0x50, 0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83,
+    0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15, 0x55, 0x55, 0x55, 0x55, 0xe5,
+    0x00, 0x88, 0x14, 0x44, 0x54, 0x14, 0x94, 0x0a, 0x50, 0x54, 0x15, 0x41, 0x15, 0x00, 0x00, 0x04,
+    0x04, 0x55, 0xc8, 0x41, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x51, 0x14, 0xba, 0x43, 0x50, 0xe9, 0x1b,
+    0x28, 0x5a, 0x41, 0x55, 0x56, 0x85, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90,
+    0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15, 0x73, 0x55, 0xf8, 0xf9, 0xef, 0xff, 0xff, 0xab, 0x40,
+    0xea, 0x13, 0xcc, 0xff, 0xe3, 0x2b, 0x00, 0xcf, 0xff, 0x07, 0xfc, 0x03, 0x00, 0x10, 0x30, 0x14,
+    0x23, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0xaf, 0xa0, 0xa0,
+    0x3f, 0xff, 0xcf, 0xff, 0x02, 0x08, 0x68, 0x1c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c,
+    0x0c, 0x00, 0x42, 0xf1, 0x54, 0xcc, 0xff, 0xe3, 0xe5, 0xbf, 0xff, 0xff, 0xaf, 0x02, 0xa9, 0x4f,
+    0x70, 0xfc, 0x8f, 0xaf, 0x00, 0x3c, 0xff, 0x1f, 0xf0, 0x0f, 0x00, 0x40, 0xc0, 0x50, 0x8c, 0x1c,
+    0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x82, 0x82, 0xfe, 0xfc,
+    0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71, 0x54, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00,
+    0x08, 0xc5, 0x53, 0x31, 0xff, 0x8f, 0x95, 0xff, 0xfe, 0xff, 0xbf, 0x0a, 0xa4, 0x3e, 0xc1, 0xc5,
+    0x3f, 0xbe, 0x02, 0xf0, 0xfc, 0x7f, 0xc0, 0x3f, 0x00, 0x00, 0x01, 0x43, 0x31, 0x72, 0x30, 0x01,
+    0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x0a, 0x0a, 0xfa, 0xf3, 0xff, 0xfc,
+    0x2f, 0x80, 0x80, 0xc6, 0x51, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14,
+    0x4f, 0xc5, 0xfc, 0x3f, 0x55, 0xfe, 0xfb, 0xff, 0xff, 0x2a, 0x90, 0xfa, 0x04, 0x57, 0xfc, 0xf8,
+    0x0a, 0xc0, 0xf3, 0xff, 0x01, 0xff, 0x00, 0x00, 0x04, 0x0c, 0x45, 0xc8, 0xc1, 0x04, 0xec, 0x0c,
+    0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x2b, 0x28, 0xe8, 0xcf, 0xff, 0xf3, 0xbf, 0x00,
+    0x02, 0x1a, 0x47, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x3c, 0x15,
+    0xf3, 0xff, 0x54, 0xf9, 0xe7, 0xff, 0xff, 0xab, 0x40, 0xea, 0x13, 0x5c, 0xc5, 0xe3, 0x2b, 0x00,
+    0xcf, 0xff, 0x07, 0xfc, 0x03, 0x00, 0x10, 0x30, 0x14, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a,
+    0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0xaf, 0xa0, 0xa0, 0x3f, 0xff, 0xcf, 0xff, 0x02, 0x08, 0x68,
+    0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0xff,
+    0x53, 0xe5, 0x97, 0xff, 0xff, 0xaf, 0x02, 0xa9, 0x4f, 0x70, 0x55, 0x8c, 0xaf, 0x00, 0x3c, 0xff,
+    0x1f, 0xf0, 0x03, 0x00, 0x40, 0xc0, 0x50, 0x84, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45,
+    0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0xfe, 0xfc, 0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71, 0x55,
+    0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x51, 0x31, 0xff, 0x4f, 0x95,
+    0x57, 0xfe, 0xff, 0xbf, 0x0a, 0xa4, 0x3e, 0xc1, 0x55, 0x05, 0xbe, 0x02, 0xf0, 0xfc, 0x7f, 0xc0,
+    0x07, 0x00, 0x00, 0x01, 0x43, 0x11, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee,
+    0x10, 0xfc, 0xfb, 0x06, 0x0a, 0xfa, 0xf0, 0xff, 0xfc, 0x2f, 0x80, 0x80, 0xc6, 0x55, 0x31, 0xfc,
+    0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x47, 0xc5, 0xfc, 0x3f, 0x55, 0x55, 0xf9,
+    0xff, 0xff, 0x20, 0x90, 0x96, 0x0a, 0x56, 0x15, 0xf8, 0x2a, 0xc0, 0xf3, 0xff, 0x41, 0x15, 0x00,
+    0x00, 0x04, 0x0c, 0x55, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0,
+    0xef, 0x1b, 0x28, 0x58, 0xc1, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c,
+    0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x1c, 0x15, 0xf3, 0xff, 0x54, 0x55, 0x55, 0xf9, 0xff,
+    0x83, 0x42, 0x5a, 0xea, 0x58, 0x55, 0xc8, 0xab, 0x60, 0xc1, 0xff, 0x07, 0x55, 0x00, 0x80, 0x10,
+    0x30, 0x54, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f,
+    0xa0, 0x60, 0x05, 0xff, 0xcf, 0x17, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40,
+    0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0x7f, 0x51, 0x55, 0x55, 0xe5, 0xff, 0x0f, 0x08,
+    0x48, 0xa9, 0x63, 0x55, 0x61, 0xac, 0x82, 0x05, 0xff, 0x1f, 0x54, 0x01, 0x00, 0x42, 0xc0, 0x50,
+    0x85, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82,
+    0x15, 0xfc, 0x3f, 0x57, 0x08, 0x20, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3,
+    0x30, 0x00, 0x08, 0xc5, 0x51, 0x31, 0x7f, 0x45, 0x55, 0x55, 0x95, 0xbf, 0x3f, 0xa0, 0x20, 0xa5,
+    0x9e, 0x55, 0x85, 0x85, 0x0a, 0x16, 0xfc, 0x7f, 0x50, 0x05, 0x00, 0x08, 0x01, 0x43, 0x15, 0x72,
+    0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a, 0x56, 0xf0,
+    0xff, 0x54, 0x21, 0x80, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00,
+    0x20, 0x14, 0x47, 0xc5, 0x7c, 0x15, 0x55, 0x55, 0x55, 0x55, 0xfe, 0x80, 0x82, 0x94, 0x3a, 0x56,
+    0x15, 0x96, 0x28, 0x58, 0x14, 0xff, 0x41, 0x15, 0x00, 0x20, 0x04, 0x0c, 0x55, 0xc8, 0xc1, 0x04,
+    0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xeb, 0x1b, 0x28, 0x5a, 0xc1, 0x7f, 0x56,
+    0x85, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50,
+    0x14, 0x15, 0x73, 0x55, 0x54, 0x55, 0x55, 0x59, 0x99, 0x03, 0x2a, 0x52, 0xea, 0x59, 0x55, 0x58,
+    0x8a, 0x60, 0x51, 0xc5, 0x07, 0x55, 0x00, 0x80, 0x10, 0x10, 0x54, 0x21, 0x07, 0x13, 0xb0, 0x33,
+    0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xa5, 0x6f, 0xa0, 0x68, 0x05, 0x5f, 0x59, 0x15, 0x02,
+    0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x02, 0x52, 0x55, 0x54,
+    0xcc, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x0e, 0x80, 0x48, 0xa1, 0x64, 0x45, 0x61, 0xa9, 0x80,
+    0x45, 0x55, 0x11, 0x54, 0x01, 0x00, 0x42, 0x40, 0x50, 0x85, 0x1c, 0x44, 0xc0, 0xce, 0x10, 0x28,
+    0x12, 0x45, 0xa1, 0x3b, 0x04, 0x95, 0xbe, 0x81, 0xa2, 0x15, 0x54, 0x65, 0x55, 0x08, 0x28, 0xa0,
+    0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x57,
+    0x85, 0x9f, 0xff, 0xfe, 0xff, 0xbf, 0x0a, 0xa4, 0x3e, 0xc1, 0xfe, 0x3f, 0xbe, 0x02, 0xf0, 0xfc,
+    0x7f, 0xc0, 0x3f, 0x00, 0x00, 0x01, 0x43, 0x31, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14,
+    0x85, 0xee, 0x10, 0xfc, 0xfb, 0x0a, 0x0a, 0xfa, 0xf3, 0xff, 0xfc, 0x2f, 0x80, 0x80, 0xc6, 0x51,
+    0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x4f, 0xc5, 0xfc, 0x3f, 0x56,
+    0xfe, 0xfb, 0xff, 0xff, 0x2a, 0x90, 0xfa, 0x04, 0x97, 0xff, 0xf8, 0x0a, 0xc0, 0xf3, 0xff, 0x01,
+    0xff, 0x00, 0x00, 0x04, 0x0c, 0xc5, 0xcb, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba,
+    0x43, 0xf0, 0xef, 0xeb, 0x28, 0xe8, 0xcf, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x47, 0xc5, 0xf0,
+    0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x3c, 0x15, 0xf3, 0xff, 0x54, 0xf9, 0xe7,
+    0xff, 0xff, 0xab, 0x40, 0xea, 0x2b, 0x58, 0xe5, 0xe3, 0xab, 0x80, 0xcf, 0xff, 0x07, 0xfc, 0x03,
+    0x00, 0x10, 0x30, 0x54, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1,
+    0xbf, 0xaf, 0xa0, 0xa0, 0x3f, 0xff, 0xcf, 0xff, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30,
+    0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0xff, 0x53, 0x55, 0x95, 0xef, 0xff,
+    0x0f, 0x0a, 0x69, 0xa9, 0x63, 0x55, 0xa1, 0xaf, 0x82, 0x3c, 0xff, 0x1f, 0x54, 0x01, 0x00, 0x42,
+    0xc0, 0x50, 0x85, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe,
+    0x81, 0x82, 0x15, 0xfc, 0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00,
+    0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x51, 0x31, 0xff, 0x4f, 0x55, 0x55, 0x9e, 0xff, 0x3f, 0x28,
+    0xa4, 0xa5, 0x8e, 0x55, 0x85, 0xbe, 0x0a, 0xc6, 0xfc, 0x7f, 0x50, 0x05, 0x00, 0x08, 0x01, 0x43,
+    0x15, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a,
+    0x56, 0xf0, 0xff, 0xfc, 0x23, 0x80, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf,
+    0xc3, 0x00, 0x20, 0x14, 0x47, 0xc5, 0xfc, 0x3f, 0x55, 0x55, 0x59, 0xfe, 0xff, 0xa0, 0x90, 0x96,
+    0x3a, 0x56, 0x15, 0xfa, 0x2a, 0x58, 0xf0, 0xff, 0x41, 0x15, 0x00, 0x20, 0x04, 0x0c, 0x55, 0xc8,
+    0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x1b, 0x28, 0x58, 0xc1,
+    0xff, 0xf3, 0x87, 0x00, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03,
+    0x80, 0x50, 0x1c, 0x15, 0xf3, 0x7f, 0x54, 0x55, 0x55, 0xf9, 0xf9, 0x03, 0x0a, 0x52, 0xea, 0x59,
+    0x55, 0x58, 0xaa, 0x60, 0xc1, 0xff, 0x07, 0x55, 0x00, 0x80, 0x10, 0x30, 0x54, 0x21, 0x07, 0x13,
+    0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0, 0x60, 0x05, 0xff, 0x4f,
+    0x15, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42,
+    0x71, 0x54, 0xcc, 0x55, 0x51, 0x55, 0x55, 0xe5, 0xe5, 0x0f, 0x28, 0x48, 0xa9, 0x67, 0x55, 0x61,
+    0xa9, 0x82, 0x45, 0xfc, 0x1f, 0x54, 0x01, 0x00, 0x42, 0xc0, 0x50, 0x85, 0x1c, 0x4c, 0xc0, 0xce,
+    0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x15, 0xfc, 0x6f, 0x55, 0x08,
+    0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0x45, 0x51,
+    0x31, 0x57, 0x45, 0x55, 0x55, 0x95, 0x95, 0x3f, 0xa0, 0x20, 0xa5, 0x9e, 0x55, 0x85, 0xa5, 0x0a,
+    0x16, 0xc5, 0x7f, 0x50, 0x05, 0x00, 0x08, 0x01, 0x43, 0x15, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0,
+    0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfa, 0x06, 0x8a, 0x56, 0xf0, 0x9f, 0x55, 0x21, 0xa0, 0x80,
+    0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x45, 0xc5, 0x5c,
+    0x15, 0x55, 0x55, 0x55, 0x56, 0xee, 0x80, 0x8a, 0x94, 0x7a, 0x56, 0x15, 0x96, 0x2a, 0x58, 0x54,
+    0xfc, 0x41, 0x15, 0x00, 0x20, 0x04, 0x04, 0x55, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53,
+    0x14, 0xba, 0x43, 0xf0, 0xe9, 0x1b, 0x28, 0x5a, 0xc1, 0x5f, 0x56, 0x85, 0x80, 0x02, 0x1a, 0x57,
+    0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x15, 0x15, 0x73, 0x55, 0x54,
+    0x55, 0x55, 0x59, 0x99, 0x03, 0x2a, 0x52, 0xea, 0x59, 0x55, 0x58, 0xaa, 0x60, 0x51, 0xc5, 0x07,
+    0x55, 0x00, 0x80, 0x10, 0x10, 0x54, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8,
+    0x0e, 0xc1, 0xa5, 0x6f, 0xa0, 0x68, 0x05, 0x5f, 0x59, 0x15, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3,
+    0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0x55, 0x51, 0x55, 0x55,
+    0x65, 0x55, 0x0e, 0xa8, 0x48, 0xa9, 0x67, 0x55, 0x61, 0xa9, 0x82, 0x45, 0x55, 0x1c, 0x54, 0x01,
+    0x00, 0x42, 0x40, 0x50, 0x85, 0x1c, 0x44, 0xc0, 0xce, 0x10, 0x28, 0x12, 0x45, 0xa1, 0x3b, 0x04,
+    0x95, 0xbe, 0x81, 0xa2, 0x15, 0x5c, 0x65, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1,
+    0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x57, 0x45, 0x55, 0x55, 0x55, 0x55,
+    0x39, 0x20, 0x22, 0xa5, 0x9e, 0x55, 0x85, 0xa5, 0x0a, 0x16, 0x55, 0x45, 0x50, 0x05, 0x00, 0x08,
+    0x01, 0x41, 0x15, 0x72, 0x10, 0x01, 0x3b, 0x43, 0xa0, 0x48, 0x14, 0x85, 0xee, 0x10, 0x54, 0xfa,
+    0x06, 0x8a, 0x56, 0x50, 0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01,
+    0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15, 0x7e, 0xfe, 0xfb, 0xff, 0xff, 0x2a,
+    0x90, 0xfa, 0x04, 0xfb, 0xff, 0xf8, 0x8a, 0xc0, 0xf3, 0xff, 0x0c, 0xff, 0x00, 0x00, 0x04, 0x0c,
+    0xc5, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x2b, 0x28,
+    0xe8, 0xcf, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x47, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c,
+    0x0f, 0x03, 0x80, 0x50, 0x3c, 0x15, 0xf3, 0xff, 0xf8, 0xf9, 0xef, 0xff, 0xff, 0xab, 0x40, 0xea,
+    0x13, 0xec, 0xff, 0xe3, 0x2b, 0x02, 0xcf, 0xff, 0x07, 0xfc, 0x03, 0x00, 0x10, 0x30, 0x14, 0x23,
+    0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0xaf, 0xa0, 0xa0, 0x3f,
+    0xff, 0xcf, 0xff, 0x02, 0x08, 0x68, 0x1c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c,
+    0x00, 0x42, 0xf1, 0x54, 0xcc, 0xff, 0x63, 0xe5, 0xbf, 0xff, 0xff, 0xaf, 0x02, 0xa9, 0x4f, 0x70,
+    0xf9, 0x8f, 0xaf, 0x20, 0x3c, 0xff, 0x1f, 0xf0, 0x0f, 0x00, 0x48, 0xc0, 0x50, 0xbc, 0x1c, 0x4c,
+    0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0xbb, 0x04, 0xff, 0xbe, 0x8e, 0x82, 0xfe, 0xfc, 0x3f,
+    0xff, 0x0b, 0x20, 0xa0, 0x71, 0x54, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08,
+    0xc5, 0x53, 0x31, 0xff, 0x4f, 0x95, 0x7f, 0xbe, 0xff, 0xbf, 0x2a, 0xa4, 0xae, 0x8e, 0x55, 0xbe,
+    0xbe, 0x0a, 0xfa, 0xfc, 0x7f, 0xc0, 0x3f, 0x00, 0x08, 0x01, 0x43, 0x15, 0x72, 0x30, 0x01, 0x3b,
+    0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x0a, 0x0a, 0xfa, 0xf3, 0xff, 0xfc, 0x2f,
+    0x80, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x47,
+    0xc5, 0xfc, 0x3f, 0x55, 0x7e, 0xf9, 0xfe, 0xff, 0xaa, 0x90, 0x9a, 0x3a, 0x56, 0xf9, 0xfa, 0x2a,
+    0xe8, 0xf3, 0xff, 0x41, 0xfc, 0x00, 0x20, 0x04, 0x0c, 0x55, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81,
+    0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef, 0x1b, 0x28, 0xe8, 0xcf, 0xff, 0xf3, 0xbf, 0x00, 0x02,
+    0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x1c, 0x15, 0xf3,
+    0xff, 0x54, 0x79, 0xe5, 0xfb, 0xff, 0xab, 0x42, 0x5a, 0xea, 0x58, 0xe5, 0xeb, 0xab, 0xa0, 0xcf,
+    0xff, 0x07, 0xc5, 0x03, 0x80, 0x10, 0x30, 0x54, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c,
+    0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0, 0xa0, 0x0f, 0xff, 0xcf, 0xff, 0x02, 0x08, 0x68, 0x5c,
+    0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0xff, 0x53,
+    0x65, 0x95, 0xef, 0xff, 0xaf, 0x0a, 0x69, 0xa9, 0x63, 0x95, 0xa3, 0xaf, 0x82, 0x3e, 0xff, 0x1f,
+    0x54, 0x0c, 0x00, 0x42, 0xc0, 0x50, 0x85, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1,
+    0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x1e, 0xfc, 0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71, 0x55, 0x0c,
+    0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x51, 0x31, 0xff, 0x4f, 0x55, 0x55,
+    0xbe, 0xff, 0xbf, 0x2a, 0xa4, 0xa5, 0x8e, 0x55, 0x86, 0xbe, 0x0a, 0xfa, 0xfc, 0x7f, 0x50, 0x05,
+    0x00, 0x08, 0x01, 0x43, 0x15, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10,
+    0xfc, 0xfb, 0x06, 0x0a, 0x5a, 0xf0, 0xff, 0xfc, 0x2f, 0x80, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07,
+    0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x47, 0xc5, 0xfc, 0x3f, 0x55, 0x55, 0x59, 0xfe,
+    0xff, 0xa0, 0x90, 0x96, 0x3a, 0x56, 0x15, 0xfa, 0x2a, 0x58, 0xf2, 0xff, 0x41, 0x15, 0x00, 0x20,
+    0x04, 0x0c, 0x55, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0, 0xef,
+    0x1b, 0x28, 0x58, 0xc1, 0xff, 0xf3, 0x87, 0x00, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06,
+    0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x1c, 0x15, 0xf3, 0x7f, 0x54, 0x55, 0x55, 0xf9, 0xf9, 0x03,
+    0x0a, 0x52, 0xea, 0x59, 0x55, 0x58, 0xaa, 0x60, 0xe1, 0xff, 0x07, 0x55, 0x00, 0x80, 0x10, 0x30,
+    0x54, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f, 0xa0,
+    0x60, 0x05, 0xff, 0x4f, 0x15, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0,
+    0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0x55, 0x51, 0x55, 0x55, 0x65, 0xe5, 0x0f, 0x28, 0x48,
+    0xa9, 0x67, 0x55, 0x61, 0xa9, 0x82, 0x45, 0xf9, 0x1f, 0x54, 0x01, 0x00, 0x42, 0xc0, 0x53, 0x85,
+    0x1c, 0x7c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0x9f, 0xbe, 0x81, 0xa2, 0x15,
+    0xfc, 0x65, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30,
+    0x00, 0x08, 0x55, 0x51, 0x31, 0x57, 0x45, 0x55, 0x55, 0x95, 0x95, 0x39, 0xa0, 0x22, 0xa5, 0x9e,
+    0x55, 0x85, 0xa5, 0x0a, 0x16, 0x55, 0x7e, 0x50, 0x05, 0x00, 0x08, 0x41, 0x41, 0x15, 0x72, 0xf0,
+    0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0x54, 0xfa, 0x06, 0x8a, 0x56, 0x70, 0x95,
+    0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20,
+    0x55, 0x45, 0xc5, 0x5c, 0x15, 0x55, 0x55, 0x55, 0x55, 0xe5, 0x80, 0x88, 0x94, 0x7a, 0x56, 0x15,
+    0x96, 0x2a, 0x58, 0x54, 0x95, 0x41, 0x15, 0x00, 0x20, 0x04, 0x04, 0x55, 0xc8, 0x51, 0x04, 0xec,
+    0x0c, 0x81, 0x22, 0x51, 0x14, 0xba, 0x43, 0x54, 0xe9, 0x1b, 0x28, 0x5a, 0x41, 0x55, 0x56, 0x85,
+    0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15,
+    0x15, 0x73, 0x55, 0xf8, 0xf9, 0xef, 0xff, 0xff, 0xab, 0x40, 0xea, 0x13, 0xec, 0xff, 0xe3, 0x2b,
+    0x02, 0xcf, 0xff, 0x3b, 0xfc, 0x03, 0x00, 0x10, 0x30, 0x14, 0x23, 0x07, 0x13, 0xb0, 0x33, 0x04,
+    0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0xaf, 0xa0, 0xa0, 0x3f, 0xff, 0xcf, 0xff, 0x02, 0x08,
+    0x68, 0x1c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0xf1, 0x54, 0xcc,
+    0xff, 0x63, 0xe5, 0xbf, 0xff, 0xff, 0xaf, 0x02, 0xa9, 0xaf, 0x60, 0xf9, 0x8f, 0xaf, 0x22, 0x3e,
+    0xff, 0x1f, 0xfa, 0x0f, 0x00, 0x48, 0xc0, 0x50, 0xbc, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32,
+    0x45, 0xa1, 0xbb, 0x04, 0xff, 0xbe, 0x8e, 0x82, 0xfe, 0xfc, 0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71,
+    0x54, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x53, 0x31, 0xff, 0x4f,
+    0x95, 0x7f, 0xbe, 0xff, 0xbf, 0x2a, 0xa4, 0xae, 0x8e, 0x55, 0xbe, 0xbe, 0x0a, 0xfa, 0xfc, 0x7f,
+    0xe8, 0x3f, 0x00, 0x08, 0x01, 0x43, 0x15, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85,
+    0xee, 0x10, 0xfc, 0xfb, 0x3a, 0x0a, 0xfa, 0xf3, 0xff, 0xfc, 0x2f, 0x80, 0x80, 0xc6, 0x55, 0x31,
+    0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x47, 0xc5, 0xfc, 0x3f, 0x55, 0x56,
+    0xf9, 0xfe, 0xff, 0xaa, 0x90, 0x96, 0x3a, 0x56, 0x39, 0xfa, 0x2a, 0xe8, 0xf3, 0xff, 0x41, 0xe5,
+    0x00, 0x20, 0x04, 0x0c, 0x55, 0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43,
+    0xf0, 0xef, 0x1b, 0x28, 0xe8, 0xc1, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f,
+    0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x1c, 0x15, 0xf3, 0xff, 0x54, 0x55, 0x65, 0xf9,
+    0xff, 0x83, 0x42, 0x5a, 0xea, 0x58, 0x55, 0xe8, 0xab, 0x60, 0xc9, 0xff, 0x07, 0x55, 0x08, 0x80,
+    0xc0, 0x30, 0x54, 0x21, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf,
+    0x6f, 0xa0, 0x60, 0x05, 0xff, 0xcf, 0x1f, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18,
+    0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0xff, 0x51, 0x55, 0x95, 0xe5, 0xff, 0x0f,
+    0x0a, 0x69, 0xa9, 0x63, 0x55, 0xa1, 0xaf, 0x82, 0x25, 0xff, 0x1f, 0x54, 0x21, 0x00, 0x42, 0xc0,
+    0x50, 0x85, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81,
+    0x82, 0x15, 0xfc, 0x3f, 0x7f, 0x08, 0x20, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1,
+    0xf3, 0x30, 0x00, 0x08, 0xc5, 0x51, 0x31, 0xff, 0x47, 0x55, 0x55, 0x95, 0x9f, 0x3f, 0xa0, 0x20,
+    0xa5, 0x9e, 0x55, 0x85, 0xa5, 0x0a, 0x16, 0xfe, 0x7f, 0x50, 0x05, 0x02, 0x08, 0x01, 0x43, 0x15,
+    0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a, 0x56,
+    0xf0, 0xff, 0x54, 0x21, 0x80, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3,
+    0x00, 0x20, 0x14, 0x47, 0xc5, 0x5c, 0x15, 0x55, 0x55, 0x55, 0x56, 0xfe, 0x80, 0x82, 0x94, 0x7a,
+    0x56, 0x15, 0x96, 0x2a, 0x58, 0x94, 0xfb, 0x41, 0x15, 0xa0, 0x20, 0x04, 0xbc, 0x55, 0xc8, 0xc1,
+    0x07, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0x70, 0xe9, 0x1b, 0x28, 0x5a, 0xc1, 0x57,
+    0x56, 0x85, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x83, 0x80,
+    0x54, 0x15, 0x15, 0x73, 0x55, 0x54, 0x55, 0x55, 0x59, 0xb9, 0x03, 0x2a, 0x52, 0xea, 0x59, 0x55,
+    0x58, 0xaa, 0x60, 0x51, 0xe6, 0x07, 0x55, 0x80, 0x82, 0x10, 0xc4, 0x56, 0x21, 0x07, 0x1f, 0xb0,
+    0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0x41, 0xa5, 0x6f, 0xa0, 0x68, 0x05, 0x57, 0x59, 0x15,
+    0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55,
+    0x54, 0xcc, 0x55, 0x51, 0x55, 0x55, 0x65, 0x65, 0x0e, 0xa8, 0x48, 0xa9, 0x67, 0x55, 0x61, 0xa9,
+    0x82, 0x45, 0x95, 0x1f, 0x54, 0x01, 0x0a, 0x42, 0x50, 0x58, 0x85, 0x1c, 0x7c, 0xc0, 0xce, 0x10,
+    0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0x95, 0xbe, 0x81, 0xa2, 0x15, 0x54, 0x65, 0x55, 0x08, 0x28,
+    0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31,
+    0x57, 0x45, 0x55, 0x55, 0x55, 0x55, 0x39, 0x20, 0x22, 0xa5, 0x9e, 0x55, 0x85, 0xa5, 0x0a, 0x16,
+    0x55, 0x65, 0x50, 0x05, 0x80, 0x08, 0x41, 0x49, 0x15, 0x72, 0x14, 0x01, 0x3b, 0x43, 0xa0, 0x48,
+    0x14, 0xa5, 0xee, 0x10, 0x55, 0xfa, 0x06, 0x8a, 0x56, 0x54, 0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6,
+    0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15,
+    0x56, 0xfe, 0xfb, 0xfe, 0xff, 0xaa, 0x90, 0xba, 0x3a, 0x96, 0xfb, 0xfa, 0x2a, 0xea, 0xf3, 0xff,
+    0xa1, 0xff, 0x00, 0xa0, 0x04, 0x0c, 0xfc, 0xcb, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14,
+    0xba, 0x4b, 0xf0, 0xef, 0xeb, 0x28, 0xe8, 0xcf, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x47, 0xc5,
+    0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x3c, 0x15, 0xf3, 0xff, 0x58, 0xf9,
+    0xef, 0xfb, 0xff, 0xab, 0x42, 0xea, 0xea, 0x58, 0xee, 0xeb, 0xab, 0xa8, 0xcf, 0xff, 0x87, 0xfe,
+    0x03, 0x80, 0x12, 0x30, 0xc4, 0x2f, 0x07, 0x13, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x2e,
+    0xc1, 0xbf, 0xaf, 0xa3, 0xa0, 0x3f, 0xff, 0xcf, 0xff, 0x02, 0x08, 0x68, 0x1c, 0x15, 0xc3, 0x7f,
+    0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0xf1, 0x54, 0xcc, 0xff, 0x63, 0xe5, 0xbf, 0xef,
+    0xff, 0xaf, 0x0a, 0xa9, 0xab, 0x63, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0xff, 0x1f, 0xfa, 0x0f, 0x00,
+    0x4a, 0xc0, 0x50, 0xbc, 0x1c, 0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0xbb, 0x04, 0xff,
+    0xbe, 0x8e, 0x82, 0xfe, 0xfc, 0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71, 0x54, 0x0c, 0xff, 0xc1, 0x60,
+    0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5, 0x53, 0x31, 0xff, 0x8f, 0x95, 0x7f, 0xbe, 0xff, 0xbf,
+    0x2a, 0xa4, 0xae, 0x8e, 0x65, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x7f, 0xe8, 0x3f, 0x00, 0x28, 0x01,
+    0x43, 0xc5, 0x72, 0x30, 0x01, 0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x12, 0xfc, 0xfb, 0x3a,
+    0x0a, 0xfa, 0xf3, 0xff, 0xfc, 0x2f, 0x80, 0x80, 0xc6, 0x51, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04,
+    0xcf, 0xc3, 0x00, 0x20, 0x14, 0x4f, 0xc5, 0xfc, 0x3f, 0x55, 0xfe, 0xf9, 0xfe, 0xff, 0xaa, 0x90,
+    0xba, 0x3a, 0x56, 0xf9, 0xfa, 0x2a, 0xea, 0xf3, 0xff, 0xa1, 0xff, 0x00, 0xa0, 0x04, 0x0c, 0x55,
+    0xc8, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x4b, 0xf0, 0xef, 0xeb, 0x28, 0xe8,
+    0xcf, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f,
+    0x03, 0x80, 0x50, 0x1c, 0x15, 0xf3, 0xff, 0x54, 0xf9, 0xe7, 0xfb, 0xbf, 0xab, 0x62, 0xea, 0xea,
+    0x59, 0xe5, 0xeb, 0xab, 0xa8, 0xcf, 0x5f, 0x86, 0xfe, 0x03, 0x8a, 0x12, 0x90, 0x56, 0x09, 0x47,
+    0x19, 0x64, 0xb0, 0x86, 0x88, 0x65, 0x51, 0xe2, 0x2e, 0x51, 0xbc, 0xaf, 0xa3, 0xa0, 0x3f, 0x55,
+    0xc9, 0xff, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02,
+    0x52, 0x55, 0x54, 0xcc, 0xff, 0x53, 0x55, 0x95, 0xe5, 0xff, 0x0f, 0x0a, 0x69, 0xa9, 0x63, 0x55,
+    0xa1, 0xaf, 0x82, 0x25, 0xff, 0x1f, 0x54, 0x21, 0x00, 0x42, 0xc2, 0x50, 0x85, 0x1c, 0x4c, 0xc0,
+    0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b, 0x04, 0xff, 0xbe, 0x81, 0x82, 0x15, 0xfc, 0x3f, 0x7f,
+    0x08, 0x20, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0xc5,
+    0x51, 0x31, 0xff, 0x47, 0x55, 0x55, 0x96, 0xff, 0x3f, 0x28, 0xa4, 0xa5, 0x8e, 0x55, 0x85, 0xbe,
+    0x0a, 0x96, 0xfc, 0x7f, 0x50, 0x85, 0x00, 0x08, 0x09, 0x43, 0x15, 0x46, 0x30, 0x01, 0x3b, 0x43,
+    0xa0, 0xc8, 0x14, 0x85, 0xee, 0x10, 0xfc, 0xfb, 0x06, 0x0a, 0x56, 0xf0, 0xff, 0xfc, 0x21, 0x80,
+    0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14, 0x47, 0xc5,
+    0xfc, 0x1f, 0x55, 0x55, 0x55, 0x56, 0xfe, 0x80, 0x82, 0x94, 0x7a, 0x56, 0x15, 0x96, 0x2a, 0x58,
+    0x94, 0xfb, 0x41, 0x15, 0xa0, 0x20, 0x04, 0xbe, 0x55, 0xc8, 0xcc, 0x07, 0xec, 0x0c, 0x81, 0x22,
+    0x53, 0x14, 0xba, 0x43, 0x70, 0xe9, 0x1b, 0x28, 0x5a, 0xc1, 0x57, 0x56, 0x85, 0x80, 0x02, 0x1a,
+    0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x83, 0x80, 0x54, 0x15, 0x15, 0x73, 0x55,
+    0x54, 0x55, 0x55, 0x59, 0xf9, 0x03, 0x0a, 0x52, 0xea, 0x59, 0x55, 0x58, 0xaa, 0x60, 0x51, 0xee,
+    0x07, 0x55, 0x80, 0x82, 0x10, 0xf8, 0x56, 0x21, 0x07, 0x1f, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51,
+    0xe8, 0x0e, 0xc1, 0xa5, 0x6f, 0xa0, 0x68, 0x05, 0x5f, 0x59, 0x15, 0x02, 0x0a, 0x68, 0x5c, 0x15,
+    0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0x55, 0x51, 0x55,
+    0x55, 0x65, 0x65, 0x0e, 0xa8, 0x48, 0xa9, 0x67, 0x55, 0x61, 0xa9, 0x82, 0x45, 0x95, 0x1b, 0x54,
+    0x01, 0x2a, 0x42, 0x50, 0x5a, 0x85, 0x1c, 0x7c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0x3b,
+    0x44, 0x95, 0xbe, 0x81, 0xa2, 0x15, 0x54, 0x65, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff,
+    0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x57, 0x45, 0x55, 0x55, 0x95,
+    0x55, 0x39, 0xa0, 0x22, 0xa5, 0x9e, 0x55, 0x85, 0xa5, 0x0a, 0x16, 0x55, 0x66, 0x50, 0x05, 0xa8,
+    0x08, 0x41, 0x69, 0x15, 0x72, 0xc4, 0x01, 0x3b, 0x43, 0xa0, 0x48, 0x14, 0xa5, 0xee, 0x10, 0x55,
+    0xfa, 0x06, 0x8a, 0x56, 0x54, 0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83,
+    0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15, 0x55, 0x55, 0x55, 0x55, 0xe5,
+    0x80, 0x88, 0x94, 0x7a, 0x56, 0x15, 0x96, 0x2a, 0x58, 0x54, 0x95, 0x41, 0x15, 0xa0, 0x22, 0x04,
+    0xa5, 0x55, 0xc8, 0x51, 0x04, 0xe8, 0x0c, 0xa1, 0x22, 0x51, 0x94, 0xba, 0x43, 0x54, 0xe9, 0x1b,
+    0x2a, 0x5a, 0x51, 0x55, 0x56, 0x85, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90,
+    0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15, 0x73, 0x55, 0x58, 0xf9, 0xef, 0xfb, 0xff, 0xab, 0x42,
+    0xea, 0xea, 0x58, 0xee, 0xeb, 0xab, 0xa8, 0xcf, 0xff, 0x87, 0xfe, 0x03, 0x80, 0x12, 0x30, 0xf8,
+    0x2f, 0x07, 0xc3, 0xb0, 0x33, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x2e, 0xc1, 0xbf, 0xaf, 0xa3, 0xa0,
+    0x3f, 0xff, 0xcf, 0xff, 0x02, 0x08, 0x68, 0x1c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c,
+    0x0c, 0x00, 0x42, 0xf1, 0x54, 0xcc, 0xff, 0x63, 0xe5, 0xbf, 0xef, 0xff, 0xaf, 0x0a, 0xa9, 0xab,
+    0x63, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0xff, 0x1f, 0xfa, 0x0f, 0x00, 0x4a, 0xc0, 0xe0, 0xbf, 0x1c,
+    0x4c, 0xc0, 0xce, 0x10, 0x28, 0x32, 0x45, 0xa1, 0xbb, 0x04, 0xff, 0xbe, 0x8e, 0x82, 0xfe, 0xfc,
+    0x3f, 0xff, 0x0b, 0x20, 0xa0, 0x71, 0x54, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00,
+    0x08, 0xc5, 0x53, 0x31, 0xff, 0x8f, 0x95, 0xff, 0xbe, 0xff, 0xbf, 0x2a, 0xa4, 0xae, 0x8e, 0xe5,
+    0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x7f, 0xe8, 0x3f, 0x00, 0x28, 0x01, 0x43, 0xf9, 0x72, 0x30, 0x01,
+    0x3b, 0x43, 0xa0, 0xc8, 0x14, 0x85, 0xee, 0x12, 0xfc, 0xfb, 0x3a, 0x0a, 0xfa, 0xf3, 0xff, 0xfc,
+    0x2f, 0x80, 0x80, 0xc6, 0x71, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0x20, 0x14,
+    0xcf, 0xc5, 0xfc, 0x3f, 0x55, 0xfe, 0xf9, 0xfe, 0xff, 0xaa, 0x90, 0xba, 0x3a, 0x56, 0xf9, 0xfa,
+    0x2a, 0xea, 0xf3, 0xff, 0xa1, 0xff, 0x00, 0xa0, 0x04, 0x0c, 0x55, 0xca, 0xc1, 0x04, 0xec, 0x0c,
+    0x81, 0x22, 0x59, 0x14, 0xba, 0x4b, 0xf0, 0xef, 0xeb, 0x28, 0xe8, 0xcf, 0xff, 0xf2, 0xbf, 0x80,
+    0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x14, 0x15,
+    0xf3, 0xff, 0x54, 0xf9, 0xe7, 0xfb, 0xff, 0xab, 0x42, 0xea, 0xea, 0x58, 0xe5, 0xeb, 0xab, 0xa8,
+    0xcf, 0xff, 0x87, 0xfe, 0x03, 0x80, 0x12, 0x30, 0x54, 0x29, 0x07, 0x13, 0x84, 0x33, 0x06, 0x8a,
+    0x64, 0x51, 0xe8, 0x2e, 0xc1, 0xbf, 0xaf, 0xa3, 0xa0, 0x3f, 0xff, 0xc9, 0xff, 0x02, 0x0a, 0x68,
+    0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x51, 0x54, 0xcc, 0xff,
+    0x53, 0xe5, 0x9f, 0xef, 0xff, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0xaf, 0xaf, 0xa2, 0x3e, 0x7f,
+    0x19, 0xfa, 0x0f, 0x28, 0x4a, 0x40, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xcc, 0x1a, 0x22, 0x96, 0x45,
+    0x89, 0xbb, 0x44, 0xf1, 0xbe, 0x8e, 0x82, 0xfe, 0x54, 0x25, 0xff, 0x0b, 0x28, 0xa0, 0x71, 0x55,
+    0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0xff, 0x4f, 0x95,
+    0x7f, 0xbe, 0xff, 0xbb, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x65, 0xe8,
+    0x3f, 0xa0, 0x28, 0x01, 0x69, 0x95, 0x72, 0x94, 0x41, 0x06, 0x6b, 0x88, 0x58, 0x16, 0x25, 0xee,
+    0x12, 0xc5, 0xfb, 0x3a, 0x0a, 0xfa, 0x53, 0x95, 0xfc, 0x2f, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc,
+    0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0xfc, 0x3f, 0x55, 0x55, 0x59,
+    0xfe, 0xff, 0xa0, 0x90, 0x96, 0x3a, 0x56, 0x15, 0xfa, 0x2a, 0x58, 0xf2, 0xff, 0x41, 0x15, 0x02,
+    0x20, 0x24, 0x0c, 0x55, 0x98, 0xc1, 0x04, 0xec, 0x0c, 0x81, 0x22, 0x53, 0x14, 0xba, 0x43, 0xf0,
+    0xef, 0x1b, 0x28, 0x58, 0xc1, 0xff, 0xf3, 0x87, 0x00, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c,
+    0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x1c, 0x15, 0xf3, 0x7f, 0x54, 0x55, 0x65, 0xf9, 0xff,
+    0x83, 0x42, 0x5a, 0xea, 0x58, 0x55, 0xe8, 0xab, 0x60, 0xc9, 0xff, 0x07, 0x55, 0x08, 0x80, 0x90,
+    0x30, 0x54, 0x61, 0x06, 0x13, 0xb0, 0x07, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1, 0xbf, 0x6f,
+    0xa0, 0x60, 0x05, 0xff, 0xcf, 0x1f, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40,
+    0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0xff, 0x51, 0x55, 0x55, 0x65, 0x65, 0x0e, 0xa8,
+    0x48, 0xa9, 0x67, 0x55, 0x61, 0xa9, 0x82, 0x45, 0x95, 0x1b, 0x54, 0x01, 0x2a, 0x42, 0x50, 0x5a,
+    0x85, 0x1c, 0x7e, 0xc0, 0xce, 0x10, 0x28, 0xf2, 0x45, 0xa9, 0x3b, 0x44, 0x95, 0xbe, 0x81, 0xa2,
+    0x15, 0x55, 0x65, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3,
+    0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x57, 0x45, 0x55, 0x55, 0x55, 0x55, 0x39, 0x20, 0x22, 0xa5,
+    0x9e, 0x55, 0x85, 0xa5, 0x0a, 0x16, 0x55, 0x65, 0x50, 0x05, 0xa8, 0x08, 0x41, 0x69, 0x15, 0x72,
+    0x94, 0x01, 0x3a, 0x43, 0xa8, 0x58, 0x14, 0xa5, 0xee, 0x18, 0x55, 0xfa, 0x86, 0x8a, 0x56, 0x54,
+    0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28,
+    0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15, 0x56, 0xfe, 0xfb, 0xfe, 0xff, 0xaa, 0x90, 0xba, 0x3a, 0x96,
+    0xfb, 0xfa, 0x2a, 0xea, 0xf3, 0xff, 0xa1, 0xff, 0x00, 0xa0, 0x04, 0x0c, 0xe5, 0xcb, 0xc1, 0x84,
+    0xec, 0x0c, 0x8c, 0x22, 0x53, 0x14, 0xba, 0x4b, 0xf0, 0xef, 0xeb, 0x28, 0xe8, 0xcf, 0xff, 0xf3,
+    0xbf, 0x00, 0x02, 0x1a, 0xc7, 0xcf, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50,
+    0x3c, 0x3f, 0xf3, 0xff, 0x58, 0xf9, 0xef, 0xfb, 0xff, 0xab, 0x42, 0xea, 0xea, 0x58, 0xee, 0xeb,
+    0xab, 0xa8, 0xcf, 0xff, 0x87, 0xfe, 0x03, 0x80, 0x12, 0x30, 0x94, 0x2f, 0x07, 0x13, 0xb2, 0x33,
+    0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x2e, 0xc1, 0xbf, 0xaf, 0xa3, 0xa0, 0x3f, 0xff, 0xcf, 0xff, 0x02,
+    0x08, 0x68, 0x1c, 0x1f, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0xf1, 0x7c,
+    0xcc, 0xff, 0x53, 0xe5, 0x9f, 0xef, 0xff, 0xaf, 0x0a, 0xa9, 0xab, 0x63, 0x95, 0xaf, 0xaf, 0xa2,
+    0x3e, 0xff, 0x1f, 0xfa, 0x0f, 0x00, 0x4a, 0xc0, 0x50, 0xa5, 0x1c, 0x64, 0x90, 0xce, 0x18, 0x28,
+    0x96, 0x45, 0xa1, 0xbb, 0x04, 0xff, 0xbe, 0x8e, 0x82, 0xfe, 0xfc, 0x25, 0xff, 0x0b, 0x28, 0xa0,
+    0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x08, 0x55, 0x51, 0x31, 0xff,
+    0x4f, 0x95, 0x7f, 0xbe, 0xff, 0xbb, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc,
+    0x65, 0xe8, 0x3f, 0xa0, 0x28, 0x01, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0x88, 0x58, 0x16,
+    0x25, 0xee, 0x12, 0xc5, 0xfb, 0x3a, 0x0a, 0xfa, 0x53, 0x95, 0xfc, 0x2f, 0xa0, 0x80, 0xc6, 0x55,
+    0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0xfc, 0x3f, 0x55,
+    0xfe, 0xf9, 0xfe, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0xfa, 0x2a, 0xea, 0x73, 0x95, 0xa1,
+    0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x60, 0x59, 0x94, 0xb2,
+    0x4b, 0x54, 0xe1, 0xeb, 0x2a, 0xe8, 0x5f, 0x55, 0xf2, 0xbf, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0,
+    0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15, 0xf3, 0xff, 0x54, 0x55, 0x65,
+    0xf9, 0xff, 0x83, 0x42, 0x5a, 0xea, 0x58, 0x55, 0xe8, 0xab, 0x60, 0xc9, 0xff, 0x07, 0x55, 0x08,
+    0x80, 0x90, 0x30, 0x54, 0x61, 0x06, 0x13, 0xb0, 0x27, 0x04, 0x8a, 0x4c, 0x51, 0xe8, 0x0e, 0xc1,
+    0xbf, 0x6f, 0xa0, 0x60, 0x05, 0xff, 0xcf, 0x1f, 0x02, 0x08, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30,
+    0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x42, 0x71, 0x54, 0xcc, 0xff, 0x51, 0xe5, 0x9f, 0x5f, 0x55,
+    0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0xaf, 0xa9, 0xa2, 0x7e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a,
+    0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x94, 0x46, 0xa9, 0x87, 0x46, 0x95, 0x85,
+    0xae, 0x22, 0xfe, 0x55, 0x65, 0xf1, 0x0b, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00,
+    0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0xff, 0x45, 0x55, 0x55, 0x95, 0x95, 0x39, 0xa0,
+    0x22, 0xa5, 0x9e, 0x55, 0x85, 0xa5, 0x0a, 0x16, 0x55, 0x6e, 0x50, 0x05, 0xa8, 0x08, 0x41, 0x69,
+    0x15, 0x72, 0xb8, 0x01, 0x3a, 0x6b, 0xa8, 0xc8, 0x17, 0xa5, 0xee, 0x10, 0x55, 0xfa, 0x86, 0x8a,
+    0x56, 0x54, 0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf,
+    0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15, 0x55, 0x55, 0x55, 0x56, 0xe5, 0x80, 0x8a, 0x94,
+    0x7a, 0x56, 0x15, 0x96, 0x2a, 0x58, 0x54, 0x99, 0x41, 0x15, 0xa0, 0x22, 0x04, 0xa5, 0x55, 0xc8,
+    0x61, 0x06, 0xe8, 0xac, 0xa1, 0x62, 0x5c, 0x94, 0xba, 0x63, 0x54, 0xe9, 0x1b, 0x2a, 0x5a, 0x51,
+    0x55, 0x56, 0x85, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3,
+    0x80, 0x54, 0x15, 0x15, 0x73, 0x55, 0x54, 0x55, 0x55, 0x55, 0x95, 0x03, 0x22, 0x52, 0xea, 0x59,
+    0x55, 0x58, 0xaa, 0x60, 0x51, 0x55, 0x06, 0x55, 0x80, 0x8a, 0x10, 0x94, 0x56, 0x21, 0x47, 0x19,
+    0xa4, 0xb3, 0x86, 0x8a, 0x85, 0x51, 0xea, 0x8e, 0x51, 0xa5, 0x6f, 0xa8, 0x68, 0x45, 0x55, 0x59,
+    0x15, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52,
+    0x55, 0x54, 0xcc, 0x55, 0x61, 0xe5, 0xbf, 0xef, 0xff, 0xaf, 0x0a, 0xa9, 0xab, 0x63, 0xb9, 0xaf,
+    0xaf, 0xa2, 0x3e, 0xff, 0x1f, 0xfa, 0x0f, 0x00, 0x4a, 0xc0, 0x50, 0xbe, 0x1c, 0x4c, 0xc8, 0xce,
+    0xe0, 0x28, 0x92, 0x7c, 0xa1, 0xbb, 0x04, 0xff, 0xbe, 0x8e, 0x82, 0xfe, 0xfc, 0xbf, 0xff, 0x0b,
+    0xa0, 0xa0, 0x71, 0xfc, 0x0f, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x28, 0xc5, 0xf3,
+    0x33, 0xff, 0xbf, 0x95, 0xff, 0xbe, 0xff, 0xbf, 0x2a, 0xa4, 0xae, 0x8e, 0xe5, 0xbe, 0xbe, 0x8a,
+    0xfa, 0xfc, 0x7f, 0xe8, 0x3f, 0x00, 0x28, 0x01, 0x43, 0xf9, 0x72, 0x30, 0x21, 0x3b, 0x83, 0xa3,
+    0xc8, 0xc4, 0x85, 0xee, 0x12, 0xfc, 0xfb, 0x3a, 0x0a, 0xfa, 0xf3, 0xff, 0xfc, 0x2f, 0x80, 0x82,
+    0xc6, 0xf1, 0x3f, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0xa0, 0x14, 0xcf, 0xcf, 0xfc,
+    0xff, 0x56, 0xfe, 0xfb, 0xfe, 0xff, 0xaa, 0x90, 0xba, 0x3a, 0x96, 0xfb, 0xfa, 0x2a, 0xea, 0xf3,
+    0xff, 0xa1, 0xff, 0x00, 0xa0, 0x04, 0x0c, 0xe5, 0xcb, 0xc1, 0x84, 0xec, 0x0c, 0x8e, 0x22, 0x53,
+    0x14, 0xba, 0x4b, 0xf0, 0xef, 0xeb, 0x28, 0xe8, 0xcf, 0xff, 0xf3, 0xbf, 0x00, 0x02, 0x1a, 0xc7,
+    0xff, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x50, 0x3c, 0x3f, 0xf3, 0xff, 0x57,
+    0xf9, 0xe7, 0xfb, 0xff, 0xab, 0x42, 0xea, 0xea, 0x58, 0xe5, 0xeb, 0xab, 0xa8, 0xcf, 0xff, 0x87,
+    0xfe, 0x03, 0x80, 0x12, 0x30, 0x56, 0x29, 0x07, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0x65, 0xc1, 0xeb,
+    0x2e, 0xc1, 0xbf, 0xaf, 0xa3, 0xa0, 0x3f, 0x5f, 0xc9, 0xff, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3,
+    0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0xff, 0x53, 0xe5, 0x9f,
+    0xef, 0xff, 0xaf, 0x0a, 0xa9, 0xab, 0x63, 0x95, 0xaf, 0xaf, 0xa2, 0x3e, 0xff, 0x1f, 0xfa, 0x0f,
+    0x00, 0x4a, 0xc0, 0x58, 0xa5, 0x1c, 0x64, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x45, 0xac, 0xbb, 0x04,
+    0xff, 0xbe, 0x8e, 0x82, 0xfe, 0x7c, 0x25, 0xff, 0x0b, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1,
+    0x60, 0x00, 0xc1, 0xf3, 0x30, 0x08, 0x48, 0x55, 0x51, 0x31, 0xff, 0x4f, 0x95, 0x7f, 0xbe, 0xff,
+    0xbf, 0x2a, 0xa4, 0xae, 0x8e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x7f, 0xe8, 0x3f, 0x00, 0x28,
+    0x01, 0x63, 0x95, 0x72, 0x90, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x16, 0x85, 0xee, 0x12, 0xfc, 0xfb,
+    0x3a, 0x0a, 0xfa, 0xf3, 0x95, 0xfc, 0x2f, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01,
+    0x04, 0xcf, 0xc3, 0x20, 0x20, 0x55, 0x45, 0xc5, 0xfc, 0x3f, 0x55, 0xfe, 0xf9, 0xfe, 0xef, 0xaa,
+    0x98, 0xba, 0x7a, 0x56, 0xf9, 0xfa, 0x2a, 0xea, 0xf3, 0x97, 0xa1, 0xff, 0x80, 0xa2, 0x04, 0xa4,
+    0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x59, 0x94, 0xb8, 0x4b, 0x14, 0xef, 0xeb, 0x28,
+    0xe8, 0x4f, 0x55, 0xf2, 0xbf, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c,
+    0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15, 0xf3, 0xff, 0x54, 0xf9, 0xe7, 0xfb, 0x97, 0xab, 0x62, 0xea,
+    0xea, 0x59, 0xe5, 0xeb, 0xab, 0xa8, 0xcf, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29,
+    0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0x65, 0x51, 0xca, 0x2e, 0x51, 0x85, 0xaf, 0xab, 0xa0, 0x7f,
+    0x55, 0xc9, 0xff, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c,
+    0x02, 0x52, 0x55, 0x54, 0xcc, 0xff, 0x53, 0xe5, 0x9f, 0xef, 0x5f, 0xae, 0x8a, 0xa9, 0xab, 0x67,
+    0x95, 0xaf, 0xaf, 0xa2, 0x3e, 0x57, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65,
+    0x90, 0xce, 0x1a, 0x2a, 0x96, 0x45, 0x69, 0xb8, 0x44, 0x15, 0xbe, 0xae, 0x82, 0xfe, 0x55, 0x25,
+    0xff, 0x0b, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48,
+    0x55, 0x51, 0x31, 0xff, 0x4f, 0x95, 0x7f, 0x7e, 0x55, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe,
+    0xa6, 0x8a, 0xfa, 0x55, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a,
+    0x6b, 0xa8, 0x58, 0x1a, 0xa5, 0xce, 0x1a, 0x55, 0x16, 0xba, 0x8a, 0xf8, 0x57, 0x95, 0xc5, 0x2f,
+    0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45,
+    0xc5, 0xfc, 0x17, 0x55, 0xfe, 0xf9, 0x55, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0x9a, 0x2a,
+    0xea, 0x57, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1,
+    0x62, 0x69, 0x94, 0x7a, 0x68, 0x54, 0x59, 0xe8, 0x2a, 0xe2, 0x5f, 0x55, 0x16, 0xbf, 0x80, 0x02,
+    0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15, 0xf3,
+    0x5f, 0x54, 0x55, 0x55, 0x55, 0x95, 0x03, 0x22, 0x52, 0xea, 0x59, 0x55, 0x58, 0xaa, 0x60, 0x51,
+    0x55, 0x86, 0x55, 0x80, 0x8a, 0x10, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5,
+    0x51, 0xea, 0x8e, 0x51, 0xa5, 0x6f, 0xa8, 0x68, 0x45, 0x55, 0x59, 0x15, 0x02, 0x0a, 0x68, 0x5c,
+    0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0x55, 0x61,
+    0xe5, 0xbf, 0xef, 0xff, 0xaf, 0x0a, 0xa9, 0xab, 0x63, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0xff, 0x1f,
+    0xfa, 0x0f, 0x00, 0x4a, 0xc0, 0x50, 0xbe, 0x1c, 0x4c, 0xc8, 0xce, 0xe8, 0x28, 0x92, 0x7e, 0xa1,
+    0xbb, 0x04, 0xbf, 0xbe, 0x8e, 0xa2, 0xfe, 0xfc, 0xbf, 0xff, 0x0b, 0xa0, 0xa0, 0x71, 0xfc, 0x0f,
+    0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x28, 0xc5, 0xf3, 0x33, 0xff, 0x7f, 0x95, 0x7f,
+    0xbe, 0xff, 0xbf, 0x2a, 0xa4, 0xae, 0x8e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x7f, 0xe8, 0x3f,
+    0x00, 0x28, 0x01, 0x63, 0x95, 0x72, 0x90, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x16, 0xbe, 0xee, 0xc2,
+    0xfc, 0xfb, 0x3a, 0x0a, 0xfa, 0xf3, 0x95, 0xfc, 0x2f, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07,
+    0x83, 0x01, 0x04, 0xcf, 0xc3, 0x20, 0x20, 0x55, 0x45, 0xc5, 0xfc, 0x3f, 0x55, 0xfe, 0xf9, 0xfe,
+    0xff, 0xaa, 0x90, 0xba, 0x3a, 0x56, 0xf9, 0xfa, 0x2a, 0xea, 0xf3, 0xff, 0xa1, 0xff, 0x00, 0xa0,
+    0x04, 0x8c, 0x55, 0xca, 0x41, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x59, 0xf8, 0xba, 0x4b, 0xf0, 0xef,
+    0xeb, 0x28, 0xe8, 0xcf, 0x57, 0xf2, 0xbf, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06,
+    0x10, 0x3c, 0x0f, 0x83, 0x80, 0x54, 0x15, 0x15, 0xf3, 0xff, 0x54, 0xf9, 0xe7, 0xfb, 0xff, 0xab,
+    0x42, 0xea, 0xea, 0x58, 0xe5, 0xeb, 0xab, 0xa8, 0xcf, 0xff, 0x86, 0xfe, 0x03, 0x88, 0x12, 0x30,
+    0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0x65, 0x51, 0xea, 0x2e, 0xc1, 0xbf, 0xaf, 0xa3,
+    0xa0, 0x3f, 0x57, 0xc9, 0xff, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2,
+    0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0xff, 0x53, 0xe5, 0x9f, 0xef, 0xff, 0xaf, 0x0a, 0xa9,
+    0xab, 0x67, 0x95, 0xaf, 0xaf, 0xa2, 0x3e, 0xff, 0x19, 0xfa, 0x0f, 0x20, 0x4a, 0x40, 0x5a, 0xa5,
+    0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x45, 0xa9, 0xbb, 0x44, 0xfc, 0xbe, 0x8e, 0x82, 0xfe,
+    0x54, 0x25, 0xff, 0x0b, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30,
+    0x0a, 0x48, 0x55, 0x51, 0x31, 0xff, 0x4f, 0x95, 0x7f, 0xbe, 0xff, 0xbb, 0x2a, 0xa6, 0xae, 0x9e,
+    0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x65, 0xe8, 0x3f, 0xa0, 0x28, 0x01, 0x69, 0x95, 0x72, 0x94,
+    0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x16, 0xa5, 0xee, 0x12, 0xc5, 0xfb, 0x3a, 0x0a, 0xfa, 0x53, 0x95,
+    0xfc, 0x2f, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20,
+    0x55, 0x45, 0xc5, 0xfc, 0x3f, 0x55, 0xfe, 0xf9, 0xfe, 0xe7, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9,
+    0xfa, 0x2a, 0xea, 0xf3, 0x95, 0xa1, 0xff, 0x80, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9,
+    0xac, 0xa1, 0x62, 0x59, 0x94, 0xba, 0x4b, 0x54, 0xec, 0xeb, 0x28, 0xe8, 0x5f, 0x55, 0xf2, 0xbf,
+    0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15,
+    0x15, 0xf3, 0xff, 0x54, 0xf9, 0xe7, 0xfb, 0x97, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0xeb, 0xab,
+    0xa8, 0xcf, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86,
+    0x8a, 0x65, 0x51, 0xea, 0x2e, 0x51, 0x85, 0xaf, 0xab, 0xa0, 0x7f, 0x55, 0xc9, 0xff, 0x02, 0x0a,
+    0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54, 0xcc,
+    0xff, 0x53, 0xe5, 0x9f, 0x5f, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0xaf, 0xa9, 0xa2, 0x7e,
+    0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96,
+    0x46, 0xa9, 0xbb, 0x46, 0x95, 0xbc, 0xae, 0x22, 0xfe, 0x55, 0x65, 0xf1, 0x0b, 0x28, 0xa0, 0x71,
+    0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0xff, 0x45,
+    0x95, 0x7f, 0x7e, 0x55, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xa6, 0x8a, 0xfa, 0x55, 0x65,
+    0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x1a, 0xa5,
+    0xee, 0x1a, 0x55, 0xc6, 0xba, 0x8a, 0xf8, 0x57, 0x95, 0xc5, 0x2f, 0xa0, 0x80, 0xc6, 0x55, 0x31,
+    0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0xfc, 0x17, 0x55, 0xfe,
+    0xf9, 0x55, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0x9a, 0x2a, 0xea, 0x57, 0x95, 0xa1, 0xff,
+    0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x69, 0x94, 0xba, 0x6b,
+    0x54, 0x59, 0xe8, 0x2a, 0xe2, 0x5f, 0x55, 0x16, 0xbf, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f,
+    0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15, 0xf3, 0x5f, 0x54, 0x79, 0x55, 0x55,
+    0x95, 0x2b, 0x62, 0x6a, 0xea, 0x59, 0xe5, 0x5b, 0xaa, 0x68, 0x51, 0x55, 0x86, 0xfe, 0x80, 0x8a,
+    0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x51, 0xea, 0xae, 0x51, 0xa5,
+    0x8f, 0xab, 0x68, 0x7c, 0x55, 0x59, 0x15, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18,
+    0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x0e,
+    0x88, 0x69, 0xa9, 0x67, 0x95, 0x61, 0xa9, 0xa2, 0x45, 0x55, 0x19, 0x5a, 0x01, 0x2a, 0x4a, 0x50,
+    0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x46, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xac,
+    0xa2, 0x15, 0x55, 0x65, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9,
+    0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x57, 0x45, 0x55, 0x55, 0x55, 0x55, 0x39, 0x20, 0x22,
+    0xa5, 0x9e, 0x55, 0x85, 0xa5, 0x8a, 0x16, 0x55, 0x65, 0x58, 0x05, 0xa8, 0x28, 0x41, 0x69, 0x95,
+    0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x1a, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0x86, 0x8a, 0x56,
+    0x54, 0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3,
+    0x28, 0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15, 0x56, 0xfe, 0xfb, 0xfe, 0xff, 0xaa, 0x90, 0xba, 0x3a,
+    0x96, 0xfb, 0xfa, 0x2a, 0xea, 0xf3, 0xff, 0xa1, 0xff, 0x00, 0xa0, 0x04, 0x0c, 0xe5, 0xcb, 0x41,
+    0x86, 0xec, 0x8c, 0x8e, 0x62, 0xe9, 0x17, 0xba, 0x6b, 0xf0, 0xe9, 0xeb, 0x28, 0xea, 0xcf, 0xff,
+    0xfb, 0xbf, 0x00, 0x0a, 0x1a, 0xc7, 0xff, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80,
+    0x52, 0x3c, 0x3f, 0xf3, 0xff, 0x5b, 0xf9, 0xef, 0xfb, 0xff, 0xab, 0x42, 0xea, 0xea, 0x59, 0xee,
+    0xeb, 0xab, 0xa8, 0xcf, 0x7f, 0x86, 0xfe, 0x03, 0x88, 0x12, 0x90, 0x96, 0x2f, 0x47, 0x19, 0xb2,
+    0xb3, 0x3a, 0x8a, 0xa5, 0x5f, 0xe8, 0xae, 0x41, 0xa5, 0xaf, 0x8b, 0xa8, 0x7f, 0xf1, 0xef, 0xff,
+    0x02, 0x28, 0x68, 0x1c, 0xff, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x4a, 0xf1,
+    0xfc, 0xcc, 0xff, 0x6f, 0xe5, 0xbf, 0xef, 0x5f, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0xb9, 0xaf, 0xaf,
+    0xa2, 0x3e, 0x57, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xbe, 0x1c, 0x65, 0x88, 0xce, 0xea,
+    0x2a, 0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa0, 0xfe, 0x55, 0xb1, 0xff, 0x0b, 0xa0,
+    0xa0, 0x71, 0xfc, 0x0f, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x28, 0x45, 0xf1, 0x33,
+    0xff, 0x7f, 0x95, 0x7f, 0xbe, 0xff, 0xbb, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa,
+    0xfc, 0x65, 0xe8, 0x3f, 0xa0, 0x28, 0x01, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58,
+    0x16, 0xa5, 0xee, 0x12, 0xe5, 0xfb, 0x3a, 0x0a, 0xfa, 0x53, 0x95, 0xfc, 0x2f, 0xa0, 0x80, 0xc6,
+    0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0xfc, 0x3f,
+    0x55, 0xfe, 0xf9, 0x7e, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0xfa, 0x2a, 0xea, 0x53, 0x95,
+    0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x59, 0x94,
+    0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xe8, 0x5f, 0x55, 0xf2, 0xbf, 0x80, 0x02, 0x1a, 0x57, 0xc5,
+    0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15, 0xf3, 0xff, 0x54, 0xf9,
+    0xe7, 0x57, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0x6b, 0xaa, 0xa8, 0x5f, 0x55, 0x86, 0xfe,
+    0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x51, 0xea, 0xae,
+    0x51, 0xa5, 0xaf, 0xab, 0x88, 0x7f, 0x55, 0x59, 0xfc, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f,
+    0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0x7f, 0x51, 0xe5, 0x57, 0x55,
+    0x55, 0xae, 0x88, 0xa9, 0xab, 0x67, 0x95, 0x6f, 0xa9, 0xa2, 0x45, 0x55, 0x19, 0xfa, 0x0f, 0x2a,
+    0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x46, 0xa9, 0xbb, 0x46, 0x95,
+    0xbe, 0xae, 0xa2, 0xfc, 0x55, 0x65, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60,
+    0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x57, 0x45, 0x95, 0x57, 0x55, 0x55, 0xb9,
+    0x22, 0xa6, 0xa6, 0x9e, 0x55, 0xbe, 0xa5, 0x8a, 0x16, 0x55, 0x65, 0xe8, 0x0f, 0xa8, 0x28, 0x41,
+    0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x1a, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba,
+    0x8a, 0xc6, 0x57, 0x95, 0x55, 0x21, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24,
+    0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0x5c, 0x15, 0x55, 0x56, 0x55, 0x55, 0xe5, 0x8a, 0x98,
+    0x96, 0x7a, 0x56, 0xf9, 0x96, 0x2a, 0x5a, 0x54, 0x95, 0xa1, 0x1f, 0xa0, 0xa2, 0x04, 0xa5, 0x55,
+    0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x69, 0x94, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0x5a,
+    0x5c, 0x55, 0x56, 0x85, 0x80, 0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f,
+    0xa3, 0x80, 0x54, 0x15, 0x15, 0x73, 0x55, 0x54, 0x55, 0x55, 0x55, 0x95, 0x2b, 0x62, 0x5a, 0xea,
+    0x59, 0xe5, 0x58, 0xaa, 0x68, 0x51, 0x55, 0x86, 0x5e, 0x80, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47,
+    0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x51, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0x68, 0x45, 0x55,
+    0x59, 0x15, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02,
+    0x52, 0x55, 0x54, 0xcc, 0x55, 0x61, 0xe5, 0xbf, 0xef, 0xff, 0xaf, 0x0a, 0xa9, 0xab, 0x63, 0xb9,
+    0xaf, 0xaf, 0xa2, 0x3e, 0xff, 0x1f, 0xfa, 0x0f, 0x00, 0x4a, 0xc0, 0x58, 0xbe, 0x1c, 0x64, 0xc8,
+    0xce, 0xea, 0x28, 0x96, 0x7e, 0xa1, 0xbb, 0x06, 0x97, 0xbe, 0xae, 0xa2, 0xfe, 0xfc, 0xbf, 0xff,
+    0x0b, 0xa0, 0xa0, 0x71, 0xfc, 0x0f, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x28, 0xc5,
+    0xf3, 0x33, 0xff, 0xbf, 0x95, 0xff, 0xbe, 0xff, 0xbf, 0x2a, 0xa4, 0xae, 0x8e, 0xe5, 0xbe, 0xbe,
+    0x8a, 0xfa, 0xfc, 0x6f, 0xe8, 0x3f, 0x80, 0x28, 0x01, 0x63, 0xf9, 0x72, 0x94, 0x21, 0x3b, 0xab,
+    0xa3, 0x58, 0xfa, 0x85, 0xee, 0x1a, 0x54, 0xfa, 0xba, 0x8a, 0xfa, 0xc7, 0xff, 0xfe, 0x2f, 0x80,
+    0x82, 0xc6, 0xf1, 0x3f, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x00, 0xa0, 0x14, 0xcf, 0xcf,
+    0xfc, 0xff, 0x56, 0xfe, 0xfb, 0xfe, 0xff, 0xaa, 0x90, 0xba, 0x7a, 0x96, 0xfb, 0xfa, 0x2a, 0xea,
+    0xf3, 0x9f, 0xa1, 0xff, 0x00, 0xa2, 0x04, 0xa4, 0xe5, 0xcb, 0x51, 0x86, 0xec, 0xac, 0x8e, 0x62,
+    0xe9, 0x17, 0xba, 0x6b, 0x50, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0xfc, 0xfb, 0xbf, 0x00, 0x0a, 0x1a,
+    0xc7, 0xff, 0xf0, 0x1f, 0x0c, 0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x52, 0x3c, 0x3f, 0xf3, 0xff,
+    0x5b, 0xf9, 0xef, 0xfb, 0xbf, 0xab, 0x62, 0xea, 0xea, 0x59, 0xee, 0xeb, 0xab, 0xa8, 0xcf, 0x5f,
+    0x86, 0xfe, 0x03, 0x8a, 0x12, 0x90, 0x96, 0x2f, 0x47, 0x19, 0xb2, 0xb3, 0x3a, 0x8a, 0xa5, 0x5f,
+    0xe8, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0xc5, 0xef, 0xff, 0x02, 0x28, 0x68, 0x1c, 0xff,
+    0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf0, 0x3c, 0x0c, 0x00, 0x4a, 0x71, 0xfc, 0xcc, 0xff, 0x6f, 0xe5,
+    0xbf, 0xef, 0x7f, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0x5f, 0x19, 0xfa,
+    0x0f, 0x28, 0x4a, 0x50, 0x5a, 0xbe, 0x1c, 0x65, 0xc8, 0xce, 0xea, 0x28, 0x96, 0x7e, 0xa9, 0xbb,
+    0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0xbc, 0xff, 0x0b, 0xa0, 0xa0, 0x71, 0xfc, 0x0f, 0xff,
+    0xc1, 0x60, 0x00, 0xc1, 0xf3, 0x30, 0x00, 0x28, 0x45, 0xf1, 0x33, 0xff, 0xbf, 0x95, 0xff, 0xbe,
+    0x7f, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0xe5, 0xbe, 0xbe, 0x8a, 0xfa, 0x5c, 0x65, 0xe8, 0x3f, 0xa8,
+    0x28, 0x41, 0x69, 0xf9, 0x72, 0x94, 0x21, 0x3a, 0xab, 0xab, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55,
+    0xfa, 0xba, 0x8a, 0xfa, 0x57, 0xc5, 0xfe, 0x2f, 0x80, 0x82, 0xc6, 0xf1, 0x3f, 0xfc, 0x07, 0x83,
+    0x01, 0x04, 0xcf, 0xc3, 0x00, 0xa0, 0x14, 0xc5, 0xcf, 0xfc, 0xff, 0x56, 0xfe, 0xfb, 0x7e, 0xe5,
+    0xaa, 0x98, 0xba, 0x7a, 0x96, 0xfb, 0xfa, 0x2a, 0xea, 0x53, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04,
+    0xa5, 0xe5, 0xcb, 0x51, 0x86, 0xe8, 0xac, 0xae, 0x62, 0xe9, 0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb,
+    0x2a, 0xea, 0x5f, 0x55, 0xf8, 0xbf, 0x00, 0x0a, 0x1a, 0xc7, 0xff, 0xf0, 0x1f, 0x0c, 0x06, 0x10,
+    0x3c, 0x0f, 0x03, 0x80, 0x52, 0x15, 0x3f, 0xf3, 0xff, 0x57, 0xf9, 0xe7, 0x7b, 0x95, 0xab, 0x62,
+    0xea, 0xea, 0x59, 0xe5, 0xeb, 0xab, 0xa8, 0x4f, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56,
+    0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x51, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8,
+    0x7f, 0x55, 0xc9, 0xff, 0x02, 0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c,
+    0x8c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0xff, 0x53, 0xe5, 0x9f, 0x6f, 0x55, 0xae, 0x8a, 0xa9, 0xab,
+    0x67, 0x95, 0xaf, 0xab, 0xa2, 0x7e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c,
+    0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x46, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55,
+    0x65, 0xfc, 0x0b, 0x28, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a,
+    0x48, 0x55, 0x51, 0x31, 0xff, 0x47, 0x95, 0x7f, 0x7e, 0x55, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55,
+    0xbe, 0xa6, 0x8a, 0xfa, 0x55, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41,
+    0x3a, 0x6b, 0xa8, 0x58, 0x1a, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0xc5,
+    0x2f, 0xa0, 0x80, 0xc6, 0x55, 0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55,
+    0x45, 0xc5, 0xfc, 0x17, 0x55, 0xfe, 0x79, 0x55, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0x96,
+    0x2a, 0xea, 0x57, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac,
+    0xa1, 0x62, 0x69, 0x94, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0x56, 0xbc, 0x80,
+    0x02, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15,
+    0xf3, 0x57, 0x54, 0xf9, 0x67, 0x55, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0x5b, 0xaa, 0xa8,
+    0x53, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a,
+    0xa5, 0x51, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0x59, 0xc5, 0x02, 0x0a, 0x68,
+    0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54, 0xcc, 0x57,
+    0x51, 0xe5, 0x5f, 0x55, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0x6f, 0xa9, 0xa2, 0x46, 0x55,
+    0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x46,
+    0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0x65, 0x55, 0x08, 0x28, 0xa0, 0x71, 0x55,
+    0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x57, 0x45, 0x95,
+    0x7f, 0x55, 0x55, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xa5, 0x8a, 0x1a, 0x55, 0x65, 0xe8,
+    0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x1a, 0xa5, 0xee,
+    0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0x55, 0x09, 0xa0, 0xa0, 0x84, 0x55, 0x31, 0x55,
+    0x88, 0x83, 0x01, 0x26, 0x4f, 0x42, 0xa8, 0x2a, 0x55, 0x55, 0x55, 0x55, 0x15, 0x56, 0xfe, 0xfb,
+    0xfe, 0xff, 0xaa, 0x90, 0xba, 0x3a, 0x96, 0xfb, 0xfa, 0x2a, 0xea, 0xf3, 0xff, 0xa1, 0xff, 0x00,
+    0xa0, 0x04, 0x8c, 0xe5, 0xcb, 0x41, 0x86, 0xec, 0xac, 0x8e, 0x62, 0xe9, 0x17, 0xba, 0x6b, 0x70,
+    0xe9, 0xeb, 0x2a, 0xea, 0xef, 0xff, 0xfb, 0xbf, 0x00, 0x0a, 0x1a, 0xc7, 0xff, 0xf0, 0x1f, 0x0c,
+    0x06, 0x10, 0x3c, 0x0f, 0x03, 0x80, 0x52, 0x3c, 0x3f, 0xf3, 0xff, 0x5b, 0xf9, 0xef, 0xfb, 0xff,
+    0xab, 0x42, 0xea, 0xea, 0x59, 0xee, 0xeb, 0xab, 0xa8, 0xcf, 0x7f, 0x86, 0xfe, 0x03, 0x88, 0x12,
+    0x90, 0x96, 0x2f, 0x47, 0x19, 0xb2, 0xb3, 0x3a, 0x8a, 0xa5, 0x5f, 0xe8, 0xae, 0x41, 0xa5, 0xaf,
+    0xab, 0xa8, 0x7f, 0xf9, 0xef, 0xff, 0x02, 0x28, 0x68, 0x1c, 0xff, 0xc3, 0x7f, 0x30, 0x18, 0x40,
+    0xf0, 0x3c, 0x24, 0x00, 0x4a, 0xf1, 0xff, 0xff, 0xff, 0x6f, 0xe5, 0xbf, 0xef, 0x7f, 0xae, 0x8a,
+    0xa9, 0xab, 0x67, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0x5f, 0x19, 0xfa, 0x0f, 0x28, 0x4a, 0x50, 0x5a,
+    0xbe, 0x1c, 0x65, 0xc8, 0xce, 0xea, 0x28, 0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2,
+    0xfe, 0x55, 0xbe, 0xff, 0x0b, 0xa0, 0xa0, 0x71, 0xfc, 0x0f, 0xff, 0xc1, 0x60, 0x00, 0xc1, 0xf3,
+    0x30, 0x00, 0x28, 0x45, 0xf1, 0x33, 0xff, 0xbf, 0x95, 0xff, 0xbe, 0x57, 0xb9, 0x2a, 0xa6, 0xae,
+    0x9e, 0xe5, 0xbe, 0xbe, 0x8a, 0xfa, 0x54, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0xb9, 0x72,
+    0x94, 0x61, 0x3a, 0xab, 0xab, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57,
+    0x95, 0xfe, 0x2f, 0x80, 0x82, 0xc6, 0xf1, 0x3f, 0xfc, 0x07, 0x83, 0x01, 0x04, 0xcf, 0xc3, 0x20,
+    0xa0, 0x55, 0xc5, 0xcf, 0xfc, 0xff, 0x55, 0xfe, 0xf9, 0x5e, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56,
+    0xf9, 0xfa, 0x2a, 0xea, 0x53, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06,
+    0xe9, 0xac, 0xae, 0x62, 0xe9, 0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0xfa,
+    0xbf, 0x80, 0x08, 0x1a, 0x57, 0xfc, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x56,
+    0x15, 0x17, 0xf3, 0xff, 0x57, 0xf9, 0xe7, 0x7b, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0xeb,
+    0xab, 0xa8, 0x4f, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3,
+    0x86, 0x8a, 0xa5, 0x53, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0xe9, 0xff, 0x02,
+    0x0a, 0x68, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54,
+    0xcc, 0xff, 0x5f, 0xe5, 0x9f, 0x57, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0x6f, 0xa9, 0xa2,
+    0x7e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a,
+    0x96, 0x46, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0x65, 0xe5, 0x0b, 0x28, 0xa0,
+    0x71, 0x55, 0x0c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x7f,
+    0x45, 0x95, 0x7f, 0x55, 0x55, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xa5, 0x8a, 0x1a, 0x55,
+    0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x1a,
+    0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0x55, 0x29, 0xa0, 0x80, 0xc6, 0x55,
+    0x31, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0x20, 0x55, 0x45, 0xc5, 0x54, 0x15, 0x55,
+    0xfe, 0x55, 0x55, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0x96, 0x2a, 0x6a, 0x54, 0x95, 0xa1,
+    0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x69, 0x94, 0xba,
+    0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0x56, 0xa5, 0x80, 0x82, 0x18, 0x57, 0xc5, 0x14,
+    0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0b, 0xa3, 0xa0, 0x54, 0x15, 0x15, 0x55, 0x55, 0x54, 0xf9, 0x57,
+    0x55, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0x5b, 0xaa, 0xa8, 0x51, 0x55, 0x86, 0xfe, 0x83,
+    0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x51, 0xea, 0xae, 0x51,
+    0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0x59, 0x95, 0x02, 0x0a, 0x4a, 0x58, 0x15, 0x53, 0x85, 0x38,
+    0x18, 0x60, 0xf2, 0x24, 0x84, 0xaa, 0x52, 0x55, 0x55, 0x55, 0x55, 0x61, 0xe5, 0xbf, 0xef, 0xff,
+    0xaf, 0x0a, 0xa9, 0xab, 0x67, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0xff, 0x19, 0xfa, 0x0f, 0x20, 0x4a,
+    0x40, 0x5a, 0xbe, 0x1c, 0x65, 0xc8, 0xce, 0xea, 0x28, 0x96, 0x7e, 0xa1, 0xbb, 0x06, 0x95, 0xbe,
+    0xae, 0xa2, 0xfe, 0xe5, 0xbf, 0xff, 0x8b, 0xa0, 0xa0, 0x7c, 0xfc, 0x0f, 0xbf, 0xc1, 0x60, 0x20,
+    0xc1, 0xb3, 0x90, 0xa0, 0x2a, 0xc7, 0xff, 0xff, 0xff, 0xbf, 0x95, 0xff, 0xbe, 0xff, 0xbf, 0x2a,
+    0xa4, 0xae, 0x9e, 0xe5, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x67, 0xe8, 0x3f, 0x80, 0x28, 0x01, 0x69,
+    0xf9, 0x72, 0x94, 0x21, 0x3b, 0xab, 0xa3, 0x58, 0xfa, 0x85, 0xee, 0x1a, 0x54, 0xfa, 0xba, 0x8a,
+    0xfa, 0x97, 0xff, 0xfe, 0x2f, 0x82, 0x82, 0xc6, 0xf1, 0x3f, 0xfc, 0x06, 0x83, 0x81, 0x04, 0xcf,
+    0x42, 0x82, 0xaa, 0x14, 0xff, 0xff, 0xff, 0xff, 0x56, 0xfe, 0xfb, 0xfe, 0xff, 0xaa, 0x90, 0xba,
+    0x7a, 0x96, 0xfb, 0xfa, 0x2a, 0xea, 0xf3, 0x9f, 0xa1, 0xff, 0x00, 0xa2, 0x04, 0xa4, 0xe5, 0xcb,
+    0x51, 0x86, 0xec, 0xac, 0x8e, 0x62, 0xe9, 0x17, 0xba, 0x6b, 0x50, 0xe9, 0xeb, 0x2a, 0xea, 0x5f,
+    0xfe, 0xfb, 0xbf, 0x08, 0x0a, 0x5a, 0xc4, 0xff, 0xf0, 0x19, 0x0c, 0x06, 0x12, 0xbe, 0x4b, 0x09,
+    0xaa, 0x52, 0xfc, 0xff, 0xff, 0xff, 0x5b, 0xf9, 0xe7, 0x7b, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59,
+    0xe6, 0xeb, 0xab, 0xa8, 0x4f, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x96, 0x29, 0x47, 0x19,
+    0xa6, 0xb3, 0xba, 0x8a, 0xa5, 0x5f, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0xe9,
+    0xff, 0x02, 0x2a, 0x68, 0xcc, 0xff, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x5a,
+    0x55, 0xfc, 0xcc, 0xff, 0x6f, 0xe5, 0x9f, 0xef, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x99, 0xaf,
+    0xaf, 0xa2, 0x3e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa6, 0x1c, 0x65, 0x98, 0xce,
+    0xea, 0x2a, 0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0xa5, 0xff, 0x0b,
+    0xa8, 0xa0, 0x71, 0xfc, 0x0f, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x68, 0x55, 0xf1,
+    0x33, 0xff, 0x7f, 0x95, 0x7f, 0xbe, 0x57, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xbe, 0x8a,
+    0xfa, 0x54, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x61, 0x3a, 0xab, 0xab,
+    0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0xfe, 0x2f, 0xa0, 0x82,
+    0xc6, 0xc5, 0x3f, 0xfc, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc3, 0x28, 0xa0, 0x55, 0xc5, 0xc7, 0xfc,
+    0xff, 0x55, 0xfe, 0xf9, 0x5e, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0xfa, 0x2a, 0xea, 0x53,
+    0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xae, 0x62, 0xe9,
+    0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0xfa, 0xbf, 0x80, 0x0a, 0x1a, 0x57,
+    0xfc, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c, 0x0f, 0xa3, 0x80, 0x56, 0x15, 0x17, 0xf3, 0xff, 0x57,
+    0xf9, 0xe7, 0x7b, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0xeb, 0xab, 0xa8, 0x4f, 0x55, 0x86,
+    0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x8a, 0x8a, 0xa5, 0x5f, 0xea,
+    0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0xe9, 0xff, 0x02, 0x2a, 0x68, 0x5c, 0xc5, 0xc3,
+    0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x5a, 0x55, 0x54, 0xcc, 0xff, 0x5f, 0xe5, 0x9f,
+    0xef, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0xaf, 0xaf, 0xa2, 0x3e, 0x55, 0x19, 0xfa, 0x0f,
+    0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x7e, 0xa9, 0xbb, 0x46,
+    0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0xa5, 0xff, 0x0b, 0xa8, 0xa0, 0x71, 0x55, 0x0c, 0xff, 0xc1,
+    0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x68, 0x55, 0x51, 0x31, 0xff, 0x7f, 0x95, 0x7f, 0xbe, 0x57,
+    0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0x54, 0x65, 0xe8, 0x3f, 0xa8, 0x28,
+    0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa,
+    0xba, 0x8a, 0xfa, 0x57, 0x95, 0xfe, 0x2f, 0xa0, 0x82, 0xc6, 0x55, 0x05, 0xfc, 0x07, 0x83, 0x01,
+    0x24, 0xcf, 0xc3, 0x28, 0xa0, 0x55, 0x45, 0xc5, 0xfc, 0xff, 0x55, 0xfe, 0x79, 0x55, 0xe5, 0xaa,
+    0x98, 0xba, 0x7a, 0x56, 0xf9, 0x96, 0x2a, 0xea, 0x57, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5,
+    0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x69, 0x94, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a,
+    0xea, 0x5f, 0x55, 0x56, 0xbe, 0x80, 0x22, 0x1a, 0x57, 0xc5, 0xf0, 0x1f, 0x0c, 0x06, 0x90, 0x3c,
+    0x0f, 0xa3, 0x80, 0x54, 0x15, 0x15, 0xf3, 0x57, 0x54, 0xf9, 0x57, 0x55, 0x95, 0xab, 0x62, 0xea,
+    0xea, 0x59, 0xe5, 0x5b, 0xaa, 0xa8, 0x51, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29,
+    0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x51, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f,
+    0x55, 0x59, 0x95, 0x02, 0x0a, 0x6a, 0x5c, 0x15, 0xc3, 0x7f, 0x30, 0x18, 0x40, 0xf2, 0x3c, 0x8c,
+    0x02, 0x52, 0x55, 0x54, 0x4c, 0x55, 0x51, 0xe5, 0x5f, 0x55, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67,
+    0x95, 0x6f, 0xa9, 0xa2, 0x46, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65,
+    0x90, 0xce, 0x1a, 0x2a, 0x96, 0x46, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0x65,
+    0x55, 0x0a, 0x28, 0xa8, 0x71, 0x55, 0x4c, 0xfc, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48,
+    0x55, 0x51, 0x51, 0x55, 0x45, 0x95, 0x7f, 0x55, 0x55, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe,
+    0xa5, 0x8a, 0x1a, 0x55, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a,
+    0x6b, 0xa8, 0x58, 0x1a, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0x55, 0x29,
+    0xa0, 0xa0, 0xc6, 0x55, 0x31, 0xc5, 0x07, 0x83, 0x01, 0x24, 0xcf, 0xc2, 0x28, 0x28, 0x55, 0x45,
+    0x45, 0x55, 0x15, 0x55, 0xfe, 0x55, 0x55, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0x96, 0x2a,
+    0x6a, 0x54, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1,
+    0x62, 0x69, 0x94, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0x56, 0xa5, 0x80, 0x82,
+    0x1a, 0x56, 0xc5, 0x54, 0x1c, 0x0e, 0x06, 0x98, 0x3c, 0x09, 0xa1, 0xa0, 0x54, 0x55, 0x55, 0x55,
+    0x55, 0x54, 0xf9, 0x57, 0x55, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0x5b, 0xaa, 0xa8, 0x51,
+    0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5,
+    0x51, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0x59, 0x95, 0x02, 0x0a, 0x6a, 0x58,
+    0x15, 0x53, 0x85, 0x38, 0x18, 0x60, 0xf2, 0x24, 0x84, 0xaa, 0x52, 0x55, 0x55, 0x55, 0x55, 0x61,
+    0xe5, 0xbf, 0xef, 0xff, 0xaf, 0x0a, 0xa9, 0xab, 0x67, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0xff, 0x19,
+    0xfa, 0x0f, 0x20, 0x4a, 0x40, 0x5a, 0xbe, 0x1c, 0x65, 0xc8, 0xce, 0xea, 0x28, 0x96, 0x7e, 0xa1,
+    0xbb, 0x06, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0xe5, 0xbf, 0xff, 0x8b, 0xa0, 0xa0, 0x7e, 0xfc, 0x0f,
+    0x9f, 0xcc, 0x60, 0x20, 0xe1, 0xbb, 0x94, 0xa0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x95, 0xff,
+    0xbe, 0xff, 0xbf, 0x2a, 0xa4, 0xae, 0x9e, 0xe5, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x67, 0xe8, 0x3f,
+    0x80, 0x28, 0x01, 0x69, 0xf9, 0x72, 0x94, 0x21, 0x3b, 0xab, 0xa3, 0x58, 0xfa, 0x85, 0xee, 0x1a,
+    0x54, 0xfa, 0xba, 0x8a, 0xfa, 0x97, 0xff, 0xfe, 0x2f, 0x82, 0x82, 0xfa, 0xf1, 0x3f, 0xfc, 0x06,
+    0x83, 0x81, 0x04, 0xcf, 0x42, 0x82, 0xaa, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x56, 0xfe, 0xfb, 0xfe,
+    0xff, 0xaa, 0x90, 0xba, 0x7a, 0x96, 0xfb, 0xfa, 0x2a, 0xea, 0xf3, 0x9f, 0xa1, 0xff, 0x00, 0xa2,
+    0x04, 0xa4, 0xe5, 0xcb, 0x51, 0x86, 0xec, 0xac, 0x8e, 0x62, 0xe9, 0x17, 0xba, 0x6b, 0x50, 0xe9,
+    0xeb, 0x2a, 0xea, 0x5f, 0xfe, 0xfb, 0xbf, 0x08, 0x0a, 0x5a, 0xc6, 0xef, 0x70, 0x19, 0xac, 0x86,
+    0x12, 0xbe, 0x4b, 0x09, 0xaa, 0x56, 0xfc, 0xff, 0xff, 0xff, 0x5b, 0xf9, 0xef, 0xfb, 0xff, 0xab,
+    0x42, 0xea, 0xea, 0x59, 0xee, 0xeb, 0xab, 0xa8, 0xcf, 0x7f, 0x86, 0xfe, 0x03, 0x88, 0x12, 0x90,
+    0x96, 0x2f, 0x47, 0x19, 0xb2, 0xb3, 0x3a, 0x8a, 0xa5, 0x5f, 0xe8, 0xae, 0x41, 0xa5, 0xaf, 0xab,
+    0xa8, 0x7f, 0xf9, 0xef, 0xff, 0x22, 0x28, 0x68, 0x19, 0xbf, 0xc3, 0x65, 0x84, 0x1a, 0x4a, 0xf8,
+    0x2e, 0x25, 0xa8, 0x5a, 0xf1, 0xff, 0xff, 0xff, 0x6f, 0xe5, 0x9f, 0xef, 0x55, 0xae, 0x8a, 0xa9,
+    0xab, 0x67, 0x99, 0xaf, 0xaf, 0xa2, 0x3e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa6,
+    0x1c, 0x65, 0x98, 0xce, 0xea, 0x2a, 0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe,
+    0x55, 0xa5, 0xff, 0x0b, 0xa8, 0xa0, 0x61, 0xfe, 0x0f, 0xff, 0xe1, 0x60, 0x80, 0xc9, 0xf3, 0x90,
+    0x0a, 0x68, 0x55, 0xf1, 0xff, 0xff, 0x7f, 0x95, 0x7f, 0xbe, 0x57, 0xb9, 0x2a, 0xa6, 0xae, 0x9e,
+    0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0x54, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94,
+    0x41, 0x3a, 0x6b, 0xa8, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95,
+    0xfe, 0x2f, 0xa0, 0x82, 0x86, 0x55, 0x39, 0xfc, 0x87, 0x83, 0x01, 0x26, 0xcf, 0x43, 0x2a, 0xa0,
+    0x55, 0x55, 0xc5, 0xfc, 0xff, 0x55, 0xfe, 0xf9, 0x5e, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9,
+    0xfa, 0x2a, 0xea, 0x53, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9,
+    0xac, 0xa1, 0x62, 0xe9, 0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0xfa, 0xbf,
+    0x80, 0x0a, 0x1a, 0x56, 0xe5, 0x70, 0x29, 0x8e, 0x84, 0x9a, 0x7c, 0x41, 0xa9, 0x82, 0x56, 0x55,
+    0x15, 0xf1, 0xff, 0x57, 0xf9, 0x57, 0x55, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0x5b, 0xaa,
+    0xa8, 0x51, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86,
+    0x8a, 0xa5, 0x51, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0x59, 0x95, 0x02, 0x0a,
+    0x6a, 0x5c, 0x15, 0xe3, 0x7f, 0x30, 0xc8, 0x40, 0xf2, 0x3c, 0x8c, 0x02, 0x52, 0x55, 0x54, 0x4c,
+    0x55, 0x51, 0xe5, 0x5f, 0x55, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0x6f, 0xa9, 0xa2, 0x46,
+    0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96,
+    0x46, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0x65, 0x55, 0x0a, 0x28, 0xa8, 0x71,
+    0x55, 0x8c, 0xff, 0xc1, 0x60, 0x00, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x55, 0x45,
+    0x95, 0x7f, 0x55, 0x55, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xa5, 0x8a, 0x1a, 0x55, 0x65,
+    0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x1a, 0xa5,
+    0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0x55, 0x29, 0xa0, 0xa0, 0x86, 0x55, 0x31,
+    0xe5, 0x87, 0x83, 0x01, 0x26, 0x4f, 0xc2, 0x2b, 0x28, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0xfe,
+    0x55, 0x55, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0x96, 0x2a, 0x6a, 0x54, 0x95, 0xa1, 0xff,
+    0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x69, 0x94, 0xba, 0x6b,
+    0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0x56, 0xa5, 0x80, 0x82, 0x5a, 0x56, 0xc5, 0x54, 0x29,
+    0x0e, 0x06, 0x98, 0x7e, 0x49, 0xa1, 0xaa, 0x54, 0x55, 0x55, 0x55, 0x55, 0x58, 0xf9, 0xef, 0xfb,
+    0xff, 0xab, 0x42, 0xea, 0xea, 0x59, 0xee, 0xeb, 0xab, 0xa8, 0xcf, 0x7f, 0x86, 0xfe, 0x03, 0x88,
+    0x12, 0x90, 0x96, 0x2f, 0x47, 0x19, 0xb2, 0xb3, 0x3a, 0x8a, 0xa5, 0x5f, 0xe8, 0xae, 0x41, 0xa5,
+    0xaf, 0xab, 0xa8, 0x7f, 0xf9, 0xef, 0xff, 0x22, 0x28, 0xa8, 0x1f, 0xbf, 0xc3, 0xa5, 0xb3, 0x1a,
+    0x4a, 0xf8, 0x2e, 0x25, 0xaa, 0xca, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xe5, 0xbf, 0xef, 0xff, 0xae,
+    0x8a, 0xa9, 0xab, 0x67, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0x7f, 0x19, 0xfa, 0x0f, 0x28, 0x4a, 0x40,
+    0x5a, 0xbe, 0x1c, 0x65, 0xc8, 0xce, 0xea, 0x28, 0x96, 0x7e, 0xa1, 0xbb, 0x46, 0x95, 0xbe, 0xae,
+    0xa2, 0xfe, 0xe5, 0xbf, 0xff, 0x8b, 0xa0, 0xa0, 0x65, 0xfe, 0x0e, 0x97, 0xe1, 0x6a, 0x28, 0xec,
+    0xbb, 0x94, 0xa2, 0x6a, 0xc5, 0xff, 0xff, 0xff, 0xbf, 0x95, 0xff, 0xbe, 0xff, 0xbb, 0x2a, 0xa6,
+    0xae, 0x9e, 0xe5, 0xbe, 0xbe, 0x8a, 0xfa, 0xfc, 0x65, 0xe8, 0x3f, 0xa0, 0x28, 0x01, 0x69, 0xf9,
+    0x72, 0x94, 0x21, 0x3b, 0xab, 0xa3, 0x58, 0xfa, 0x85, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa,
+    0x97, 0xff, 0xfe, 0x2f, 0x82, 0x82, 0x96, 0xf9, 0x3b, 0x5c, 0x86, 0xab, 0xa1, 0x84, 0xef, 0x52,
+    0x8a, 0xaa, 0x15, 0xff, 0xff, 0xff, 0xff, 0x56, 0xfe, 0xf9, 0x5e, 0xe5, 0xaa, 0x98, 0xba, 0x7a,
+    0x96, 0xf9, 0xfa, 0x2a, 0xea, 0x53, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x65, 0xca, 0x51,
+    0x86, 0xe9, 0xac, 0xae, 0x62, 0xe9, 0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55,
+    0xfa, 0xbf, 0x80, 0x0a, 0x1a, 0xe6, 0xff, 0xf0, 0x2b, 0x2e, 0x06, 0x9a, 0x3c, 0x0b, 0xa9, 0xa8,
+    0x56, 0x15, 0xff, 0xff, 0xff, 0x5b, 0xf9, 0xe7, 0x7b, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe6,
+    0xeb, 0xab, 0xa8, 0x4f, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x96, 0x29, 0x47, 0x19, 0xa6,
+    0xb3, 0xba, 0x8a, 0xa5, 0x5f, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0xe9, 0xff,
+    0x02, 0x2a, 0x68, 0x98, 0xff, 0xc3, 0xaf, 0xb8, 0x18, 0x68, 0xc6, 0x2c, 0xa4, 0xa2, 0x5a, 0x55,
+    0xfc, 0xff, 0xff, 0x6f, 0xe5, 0x9f, 0xef, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x99, 0xaf, 0xaf,
+    0xa2, 0x3e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa6, 0x1c, 0x65, 0x98, 0xce, 0xea,
+    0x2a, 0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0xa5, 0xff, 0x0b, 0xa8,
+    0xa0, 0x61, 0xfe, 0x0f, 0xbf, 0xe2, 0x62, 0xa0, 0x59, 0xb0, 0x90, 0x8a, 0x6a, 0x55, 0xf1, 0xff,
+    0xff, 0x7f, 0x95, 0x7f, 0xbe, 0x57, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa,
+    0x54, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58,
+    0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0xfe, 0x2f, 0xa0, 0x82, 0x86,
+    0x55, 0x39, 0xfc, 0x8a, 0xa3, 0x81, 0x26, 0xcf, 0x43, 0xaa, 0xa0, 0x55, 0x55, 0xc5, 0xfc, 0xff,
+    0x55, 0xfe, 0xf9, 0x5e, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0xfa, 0x2a, 0xea, 0x53, 0x95,
+    0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0xe9, 0x97,
+    0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0xfa, 0xbf, 0x80, 0x0a, 0x1a, 0x56, 0xe5,
+    0xf0, 0x29, 0x8e, 0x06, 0x9a, 0x7c, 0x4c, 0xa9, 0x82, 0x56, 0x55, 0x15, 0xf1, 0xff, 0x57, 0xf9,
+    0xe7, 0x7b, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0xeb, 0xab, 0xa8, 0x4f, 0x55, 0x86, 0xfe,
+    0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x5f, 0xea, 0xae,
+    0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0xe9, 0xff, 0x02, 0x2a, 0x68, 0x58, 0x95, 0xc3, 0xa5,
+    0x38, 0x1a, 0x6a, 0xf2, 0x05, 0xa5, 0x0a, 0x5a, 0x55, 0x55, 0xc4, 0xff, 0x5f, 0xe5, 0x5f, 0x55,
+    0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0x6f, 0xa9, 0xa2, 0x46, 0x55, 0x19, 0xfa, 0x0f, 0x2a,
+    0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x46, 0xa9, 0xbb, 0x46, 0x95,
+    0xbe, 0xae, 0xa2, 0xfe, 0x55, 0x65, 0x55, 0x0a, 0x28, 0xa8, 0x71, 0x55, 0x8c, 0xff, 0xc1, 0xa0,
+    0x03, 0xc9, 0xf3, 0x30, 0x0a, 0x48, 0x55, 0x51, 0x31, 0x55, 0x45, 0x95, 0x7f, 0x55, 0x55, 0xb9,
+    0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xa5, 0x8a, 0x1a, 0x55, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41,
+    0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0x1a, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba,
+    0x8a, 0xfa, 0x57, 0x95, 0x55, 0x29, 0xa0, 0xa0, 0x86, 0x55, 0x31, 0xe5, 0x8a, 0x83, 0xa1, 0x26,
+    0x4f, 0xc2, 0xab, 0x2a, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0xfe, 0x55, 0x55, 0xe5, 0xaa, 0x98,
+    0xba, 0x7a, 0x56, 0xf9, 0x96, 0x2a, 0x6a, 0x54, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55,
+    0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0x69, 0x94, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea,
+    0x5f, 0x55, 0x56, 0xa5, 0x80, 0x82, 0x5a, 0x56, 0xc5, 0x94, 0x29, 0x0e, 0x86, 0x9a, 0x7e, 0x49,
+    0xac, 0xaa, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0xf9, 0x57, 0x55, 0x95, 0xab, 0x62, 0xea, 0xea,
+    0x59, 0xe5, 0x5b, 0xaa, 0xa8, 0x51, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47,
+    0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x51, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55,
+    0x59, 0x95, 0x22, 0x0a, 0x6a, 0x59, 0x15, 0x53, 0xa5, 0xb8, 0x1a, 0x6a, 0xfa, 0x25, 0x85, 0xaa,
+    0x52, 0x55, 0x55, 0x55, 0x55, 0x61, 0xe5, 0xbf, 0xef, 0xff, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0xb9,
+    0xaf, 0xaf, 0xa2, 0x3e, 0x7f, 0x19, 0xfa, 0x0f, 0x28, 0x4a, 0x40, 0x5a, 0xbe, 0x1c, 0x65, 0xc8,
+    0xce, 0xea, 0x28, 0x96, 0x7e, 0xa1, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0xe5, 0xbf, 0xff,
+    0x8b, 0xa0, 0xa0, 0x7e, 0xfe, 0x0e, 0x97, 0xce, 0x6a, 0xa8, 0xe9, 0xbb, 0x94, 0xa8, 0x2a, 0xff,
+    0xff, 0xff, 0xff, 0xbf, 0x95, 0xff, 0xbe, 0xff, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0xe5, 0xbe, 0xbe,
+    0x8a, 0xfa, 0x7c, 0x65, 0xe8, 0x3f, 0xa0, 0x28, 0x41, 0x69, 0xf9, 0x72, 0x94, 0x21, 0x3b, 0xab,
+    0xa3, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x97, 0xbf, 0xfe, 0x2f, 0xa2,
+    0x82, 0x96, 0xf9, 0x3b, 0x5c, 0x86, 0xab, 0xa1, 0xa6, 0xef, 0x52, 0x8a, 0xaa, 0x15, 0xff, 0xff,
+    0xff, 0xff, 0x56, 0xfe, 0xf9, 0x5e, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x96, 0xf9, 0xfa, 0x2a, 0xea,
+    0x53, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x65, 0xca, 0x51, 0x86, 0xe9, 0xac, 0xae, 0x62,
+    0xe9, 0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0xfa, 0xbf, 0x80, 0x0a, 0x5a,
+    0xe6, 0xff, 0xf0, 0x29, 0x2e, 0x06, 0x9a, 0xbe, 0x4b, 0xa9, 0xa8, 0x56, 0x15, 0xff, 0xff, 0xff,
+    0x57, 0xf9, 0xe7, 0x7b, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0xeb, 0xab, 0xa8, 0x4f, 0x55,
+    0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x5f,
+    0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0xe9, 0xff, 0x02, 0x2a, 0x68, 0x59, 0x95,
+    0xc3, 0xa7, 0x38, 0x1a, 0x68, 0xfa, 0x3e, 0xa5, 0x0a, 0x5a, 0x55, 0x55, 0xfc, 0xff, 0x5f, 0xe5,
+    0x9f, 0xef, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0xaf, 0xaf, 0xa2, 0x3e, 0x55, 0x19, 0xfa,
+    0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x7e, 0xa9, 0xbb,
+    0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0xa5, 0xff, 0x0b, 0xa8, 0xa0, 0x65, 0x55, 0x0e, 0x95,
+    0xe2, 0x68, 0xa8, 0xe9, 0x97, 0x94, 0x2a, 0x68, 0x55, 0x55, 0x15, 0xff, 0x7f, 0x95, 0x7f, 0xbe,
+    0x55, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xae, 0x8a, 0xfa, 0x55, 0x65, 0xe8, 0x3f, 0xa8,
+    0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55,
+    0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0xfe, 0x29, 0xa2, 0xa2, 0x96, 0x55, 0x39, 0x55, 0x8a, 0xab,
+    0xa1, 0xa6, 0x5f, 0x52, 0xaa, 0x8a, 0x55, 0x55, 0x55, 0x15, 0xff, 0x55, 0xfe, 0x55, 0x55, 0xe5,
+    0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0x96, 0x2a, 0x6a, 0x54, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04,
+    0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0xe9, 0x94, 0xba, 0x6b, 0x54, 0xe9, 0xeb,
+    0x2a, 0xea, 0x5f, 0x55, 0x56, 0xa5, 0x88, 0x82, 0x5a, 0x56, 0xe5, 0x54, 0x29, 0xae, 0x86, 0x9a,
+    0x7e, 0x49, 0xa9, 0xaa, 0x54, 0x55, 0x55, 0x55, 0x55, 0x58, 0xf9, 0xef, 0xfb, 0x9f, 0xab, 0x62,
+    0xea, 0xea, 0x59, 0xee, 0xeb, 0xab, 0xa8, 0xcf, 0x57, 0x86, 0xfe, 0x03, 0x8a, 0x12, 0x94, 0x96,
+    0x2f, 0x47, 0x19, 0xb2, 0xb3, 0x3a, 0x8a, 0xa5, 0x5f, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8,
+    0x7f, 0xf9, 0xeb, 0xff, 0x22, 0x2a, 0xa8, 0x9b, 0xbf, 0xc3, 0xa5, 0xbb, 0x1a, 0x6a, 0xfa, 0x2e,
+    0xa5, 0xaa, 0xca, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xe5, 0xbf, 0xef, 0x5f, 0xae, 0x8a, 0xa9, 0xab,
+    0x67, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0x57, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xbe, 0x1c,
+    0x65, 0x88, 0xce, 0xea, 0x2a, 0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0xe5,
+    0xa7, 0xff, 0x8b, 0xa8, 0xa0, 0x66, 0xfe, 0x0e, 0x97, 0xee, 0x6a, 0xa8, 0xe9, 0xbb, 0x94, 0xaa,
+    0x6a, 0xfc, 0xff, 0xff, 0xff, 0xbf, 0x95, 0xff, 0xbe, 0x7f, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0xe5,
+    0xbe, 0xbe, 0x8a, 0xfa, 0x5c, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0xf9, 0x72, 0x94, 0x21,
+    0x3a, 0xab, 0xab, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x97, 0x9f, 0xfe,
+    0x2f, 0xa2, 0x82, 0x96, 0xf9, 0x3b, 0x5c, 0xba, 0xab, 0xa1, 0xa6, 0xef, 0x52, 0xaa, 0xaa, 0xc5,
+    0xff, 0xff, 0xff, 0xff, 0x56, 0xfe, 0xfb, 0xfe, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x96, 0xfb, 0xfa,
+    0x2a, 0xea, 0x73, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0xe5, 0xcb, 0x51, 0x86, 0xe8, 0xac,
+    0xae, 0x62, 0xe9, 0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x7e, 0xfa, 0xbf, 0x88,
+    0x0a, 0x5a, 0xe6, 0xef, 0x70, 0x29, 0xae, 0x86, 0x9a, 0xbe, 0x4b, 0xa9, 0xaa, 0x56, 0xfc, 0xff,
+    0xff, 0xff, 0x5b, 0xf9, 0xef, 0xfb, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xee, 0xeb, 0xab, 0xa8,
+    0x4f, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x96, 0x2f, 0x47, 0x19, 0xa2, 0xb3, 0xba, 0x8a,
+    0xa5, 0x5f, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x79, 0xe9, 0xff, 0x22, 0x2a, 0x68,
+    0x99, 0xbf, 0xc3, 0xa5, 0xb8, 0x1a, 0x6a, 0xfa, 0x2e, 0xa5, 0xaa, 0x5a, 0xc5, 0xff, 0xff, 0xff,
+    0x6f, 0xe5, 0xbf, 0xef, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0xb9, 0xaf, 0xaf, 0xa2, 0x3e, 0x55,
+    0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xae, 0x1c, 0x65, 0x98, 0xce, 0xea, 0x2a, 0x96, 0x7e,
+    0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x65, 0xa5, 0xff, 0x8b, 0xa8, 0xa0, 0x65, 0xfe,
+    0x0e, 0x97, 0xe2, 0x6a, 0xa8, 0xe9, 0xbb, 0x94, 0xaa, 0x6a, 0x55, 0xfc, 0xff, 0xff, 0xbf, 0x95,
+    0x7f, 0xbe, 0x57, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x65, 0xbe, 0xbe, 0x8a, 0xfa, 0x54, 0x65, 0xe8,
+    0x3f, 0xa8, 0x28, 0x41, 0x69, 0x99, 0x72, 0x94, 0x61, 0x3a, 0xab, 0xab, 0x58, 0xfa, 0xa5, 0xee,
+    0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0xfe, 0x2f, 0xa2, 0x82, 0x96, 0xf9, 0x3b, 0x5c,
+    0x8a, 0xab, 0xa1, 0xa6, 0xef, 0x52, 0xaa, 0xaa, 0x55, 0xc5, 0xff, 0xff, 0xff, 0x55, 0xfe, 0xf9,
+    0x5e, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0xfa, 0x2a, 0xea, 0x53, 0x95, 0xa1, 0xff, 0xa0,
+    0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x86, 0xe9, 0xac, 0xae, 0x62, 0xe9, 0x97, 0xba, 0x6b, 0x54,
+    0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0xfa, 0xbf, 0x88, 0x0a, 0x5a, 0xe6, 0xe7, 0x70, 0x29, 0xae,
+    0x86, 0x9a, 0xbe, 0x4b, 0xa9, 0xaa, 0x56, 0x55, 0xfc, 0xff, 0xff, 0x57, 0xf9, 0xe7, 0x7b, 0x95,
+    0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0xeb, 0xab, 0xa8, 0x4f, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12,
+    0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0xba, 0x8a, 0xa5, 0x5f, 0xea, 0xae, 0x51, 0xa5, 0xaf,
+    0xab, 0xa8, 0x7f, 0x55, 0xe9, 0xff, 0x22, 0x2a, 0x68, 0x99, 0x97, 0xc3, 0xa5, 0xb8, 0x1a, 0x6a,
+    0xfa, 0x2e, 0xa5, 0xaa, 0x5a, 0x55, 0xc5, 0xff, 0xff, 0x5f, 0xe5, 0x9f, 0xef, 0x55, 0xae, 0x8a,
+    0xa9, 0xab, 0x67, 0x95, 0xaf, 0xaf, 0xa2, 0x3e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a,
+    0xa5, 0x1c, 0x65, 0x90, 0xce, 0x2a, 0x2a, 0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2,
+    0xfe, 0x55, 0xa5, 0xff, 0x8b, 0xa8, 0xa0, 0x65, 0x56, 0x0e, 0x97, 0xe2, 0x6a, 0xa8, 0xe9, 0xbb,
+    0x94, 0xaa, 0x6a, 0x55, 0x55, 0xfc, 0xff, 0x7f, 0x95, 0x7f, 0xbe, 0x57, 0xb9, 0x2a, 0xa6, 0xae,
+    0x9e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0x54, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72,
+    0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57,
+    0x95, 0xfe, 0x2f, 0xa2, 0x82, 0x96, 0x55, 0x39, 0x5c, 0x8a, 0xab, 0xa1, 0xa6, 0xef, 0x52, 0xaa,
+    0xaa, 0x55, 0x55, 0xc5, 0xff, 0xff, 0x55, 0xfe, 0xf9, 0x5e, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56,
+    0xf9, 0xfa, 0x2a, 0xea, 0x53, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06,
+    0xe9, 0xac, 0xa1, 0x62, 0xe9, 0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0xfa,
+    0xbf, 0x88, 0x0a, 0x5a, 0x56, 0xe5, 0x50, 0x29, 0xae, 0x86, 0x9a, 0xbe, 0x49, 0xa9, 0xaa, 0x56,
+    0x55, 0x55, 0xfc, 0xff, 0x57, 0xf9, 0xe7, 0x7b, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0xeb,
+    0xab, 0xa8, 0x4f, 0x55, 0x86, 0xfe, 0x83, 0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3,
+    0x86, 0x8a, 0xa5, 0x5f, 0xea, 0xae, 0x51, 0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0xe9, 0xff, 0x22,
+    0x2a, 0x68, 0x59, 0x95, 0x43, 0xa5, 0xb8, 0x1a, 0x6a, 0xfa, 0x25, 0xa5, 0xaa, 0x5a, 0x55, 0x55,
+    0xc5, 0xff, 0x5f, 0xe5, 0x9f, 0xef, 0x55, 0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0xaf, 0xaf, 0xa2,
+    0x3e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a, 0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a,
+    0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe, 0xae, 0xa2, 0xfe, 0x55, 0xa5, 0xff, 0x8b, 0xa8, 0xa0,
+    0x65, 0x55, 0x4e, 0x95, 0xe2, 0x6a, 0xa8, 0xe9, 0x97, 0x94, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0xfc,
+    0x7f, 0x95, 0x7f, 0xbe, 0x57, 0xb9, 0x2a, 0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xbe, 0x8a, 0xfa, 0x54,
+    0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69, 0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0xfa,
+    0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a, 0xfa, 0x57, 0x95, 0xfe, 0x2b, 0xa2, 0xa2, 0x96, 0x55,
+    0x39, 0x55, 0x8a, 0xab, 0xa1, 0xa6, 0x5f, 0x52, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xc5, 0xff, 0x55,
+    0xfe, 0xf9, 0x56, 0xe5, 0xaa, 0x98, 0xba, 0x7a, 0x56, 0xf9, 0xba, 0x2a, 0xea, 0x57, 0x95, 0xa1,
+    0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca, 0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0xe9, 0x97, 0xba,
+    0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f, 0x55, 0xfa, 0xa7, 0x88, 0x8a, 0x5a, 0x56, 0xe5, 0x54,
+    0x29, 0xae, 0x86, 0x9a, 0x7e, 0x49, 0xa9, 0xaa, 0x56, 0x55, 0x55, 0x55, 0xfc, 0x57, 0xf9, 0xe7,
+    0x57, 0x95, 0xab, 0x62, 0xea, 0xea, 0x59, 0xe5, 0x6b, 0xaa, 0xa8, 0x5f, 0x55, 0x86, 0xfe, 0x83,
+    0x8a, 0x12, 0x94, 0x56, 0x29, 0x47, 0x19, 0xa4, 0xb3, 0x86, 0x8a, 0xa5, 0x5f, 0xea, 0xae, 0x51,
+    0xa5, 0xaf, 0xab, 0xa8, 0x7f, 0x55, 0xe9, 0x97, 0x22, 0x2a, 0x6a, 0x59, 0x95, 0x53, 0xa5, 0xb8,
+    0x1a, 0x6a, 0xfa, 0x25, 0xa5, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0xc5, 0x5f, 0xe5, 0x9f, 0x57, 0x55,
+    0xae, 0x8a, 0xa9, 0xab, 0x67, 0x95, 0x6f, 0xa9, 0xa2, 0x7e, 0x55, 0x19, 0xfa, 0x0f, 0x2a, 0x4a,
+    0x50, 0x5a, 0xa5, 0x1c, 0x65, 0x90, 0xce, 0x1a, 0x2a, 0x96, 0x7e, 0xa9, 0xbb, 0x46, 0x95, 0xbe,
+    0xae, 0xa2, 0xfe, 0x55, 0xa5, 0x57, 0x8a, 0xa8, 0xa8, 0x65, 0x55, 0x4e, 0x95, 0xe2, 0x6a, 0xa8,
+    0xe9, 0x97, 0x94, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x7c, 0x95, 0x7f, 0x56, 0x55, 0xb9, 0x2a,
+    0xa6, 0xae, 0x9e, 0x55, 0xbe, 0xa5, 0x8a, 0x3a, 0x55, 0x65, 0xe8, 0x3f, 0xa8, 0x28, 0x41, 0x69,
+    0x95, 0x72, 0x94, 0x41, 0x3a, 0x6b, 0xa8, 0x58, 0xfa, 0xa5, 0xee, 0x1a, 0x55, 0xfa, 0xba, 0x8a,
+    0xfa, 0x57, 0x95, 0x56, 0x29, 0xa2, 0xa2, 0x96, 0x55, 0x39, 0x55, 0x8a, 0xab, 0xa1, 0xa6, 0x5f,
+    0x52, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0xc5, 0x55, 0xfe, 0x55, 0x55, 0xe5, 0xaa, 0x98, 0xba,
+    0x7a, 0x56, 0xf9, 0x96, 0x2a, 0x6a, 0x54, 0x95, 0xa1, 0xff, 0xa0, 0xa2, 0x04, 0xa5, 0x55, 0xca,
+    0x51, 0x06, 0xe9, 0xac, 0xa1, 0x62, 0xe9, 0x97, 0xba, 0x6b, 0x54, 0xe9, 0xeb, 0x2a, 0xea, 0x5f,
+    0x55, 0x56, 0xa5, 0x88, 0x8a, 0x5a, 0x56, 0xe5, 0x54, 0x29, 0xae, 0x86, 0x9a, 0x7e, 0x49, 0xa9,
+    0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3c, 0x13,
+    0x33, 0xc5, 0x0f, 0x0f, 0x1c, 0x17, 0xc7, 0x33, 0x04, 0xf2, 0xff, 0x07, 0x1f, 0xcf, 0x11, 0xbc,
+    0xf0, 0xc3, 0xff, 0xcf, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05,
+    0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0xc4,
+    0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xf0, 0x4c, 0xcc, 0x14, 0x3f, 0x3c, 0x70, 0x5c, 0x1c, 0xcf,
+    0x10, 0xc8, 0xff, 0x1f, 0x7c, 0x3c, 0x47, 0xf0, 0xc2, 0x0f, 0xff, 0x3f, 0xcb, 0x50, 0x96, 0xfc,
+    0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5,
+    0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0xfc, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xc0, 0x33,
+    0x31, 0x53, 0xfc, 0xf0, 0xc0, 0x71, 0x71, 0x3c, 0x43, 0x20, 0xff, 0x7f, 0xf0, 0xf1, 0x1c, 0xc1,
+    0x0b, 0x3f, 0xfc, 0xff, 0x2c, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51,
+    0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f,
+    0xc5, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xcf, 0xc4, 0x4c, 0xf1, 0xc3, 0x03, 0xc7, 0xc5, 0xf1,
+    0x0c, 0x41, 0xfc, 0xff, 0xc1, 0xc7, 0x73, 0x04, 0x2f, 0xfc, 0xf0, 0xff, 0xb1, 0x0c, 0x65, 0xc9,
+    0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55,
+    0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3c,
+    0x13, 0x33, 0xc5, 0x0f, 0x0f, 0x1c, 0x17, 0xc7, 0x33, 0x04, 0xf1, 0xff, 0x07, 0x1f, 0xc3, 0x11,
+    0xbc, 0xf0, 0xc3, 0xff, 0xc5, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19,
+    0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3,
+    0x54, 0xc5, 0xff, 0xff, 0xff, 0x03, 0x00, 0xf0, 0x4c, 0xcc, 0x14, 0x3f, 0x3c, 0x70, 0x5c, 0x1c,
+    0xcf, 0x10, 0xc4, 0xff, 0x1f, 0x7c, 0x04, 0x47, 0xf0, 0xc2, 0x0f, 0xff, 0x17, 0xcb, 0x50, 0x96,
+    0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55,
+    0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0xc0,
+    0x33, 0x31, 0x53, 0xfc, 0xf0, 0xc0, 0x71, 0x71, 0x3c, 0x43, 0x10, 0xff, 0x7f, 0xf0, 0x11, 0x1c,
+    0xc1, 0x0b, 0x3f, 0xfc, 0x5f, 0x2c, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95,
+    0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33,
+    0x4f, 0x55, 0xc5, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xcf, 0xc4, 0x4c, 0xf1, 0xc3, 0x03, 0xc7, 0xc5,
+    0xf1, 0x0c, 0x41, 0xfc, 0xff, 0xc1, 0x57, 0x70, 0x04, 0x2f, 0x3c, 0xf0, 0x7f, 0xb1, 0x0c, 0x65,
+    0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55,
+    0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0xfc, 0xff, 0xff, 0x00, 0x00,
+    0x1c, 0x13, 0x33, 0xc5, 0x0f, 0x0f, 0x1c, 0x17, 0xc7, 0x33, 0x84, 0xf1, 0xff, 0x07, 0x5f, 0xc1,
+    0x11, 0xbc, 0x70, 0xc0, 0xff, 0xc5, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e,
+    0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31,
+    0xf3, 0x54, 0x55, 0xc5, 0xff, 0xff, 0x03, 0x00, 0x50, 0x4c, 0xcc, 0x14, 0x3f, 0x3c, 0x60, 0x5c,
+    0x1c, 0xef, 0x10, 0xc6, 0xff, 0x1f, 0x7c, 0x05, 0x47, 0xf0, 0x42, 0x01, 0xff, 0x17, 0xcb, 0x50,
+    0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52,
+    0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0xfc, 0xff, 0x0f, 0x00,
+    0x40, 0x31, 0x31, 0x53, 0xfc, 0xf0, 0x80, 0x71, 0x71, 0xbc, 0x43, 0x18, 0xff, 0x7f, 0xf0, 0x15,
+    0x1c, 0xc1, 0x0b, 0x05, 0xfc, 0x5f, 0x2c, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef,
+    0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11,
+    0x33, 0x4f, 0x55, 0x55, 0xc5, 0xff, 0x3f, 0x00, 0x00, 0x45, 0xc4, 0x4c, 0xf1, 0xc3, 0x03, 0xc6,
+    0xc5, 0xf1, 0x0e, 0x61, 0xfc, 0x7f, 0xc1, 0x57, 0x70, 0x04, 0x2f, 0x14, 0xf0, 0x5f, 0xb1, 0x0c,
+    0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20,
+    0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0x55, 0xfc, 0xff, 0x00,
+    0x00, 0x14, 0x11, 0x33, 0xc5, 0x0f, 0x0f, 0x18, 0x17, 0xc7, 0x3b, 0x84, 0xf1, 0x7f, 0x05, 0x5f,
+    0xc1, 0x11, 0xbc, 0x50, 0xc0, 0x5f, 0xc5, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc,
+    0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11,
+    0x31, 0xf3, 0x54, 0x55, 0x55, 0xc5, 0xff, 0x03, 0x00, 0x50, 0x44, 0xcc, 0x14, 0x3f, 0x0c, 0x60,
+    0x5c, 0x1c, 0xef, 0x10, 0xc6, 0x7f, 0x15, 0x7c, 0x05, 0x47, 0xf0, 0x42, 0x01, 0x5f, 0x15, 0xcb,
+    0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05,
+    0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0x55, 0xfc, 0x0f,
+    0x00, 0x40, 0x11, 0x31, 0x53, 0xfc, 0x10, 0x80, 0x71, 0x71, 0xbc, 0x43, 0x18, 0x7f, 0x55, 0xf0,
+    0x15, 0x1c, 0xc1, 0x0b, 0x05, 0x5c, 0x55, 0x2c, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9,
+    0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15,
+    0x11, 0x33, 0x4f, 0x55, 0x55, 0x55, 0xc5, 0x3f, 0x00, 0x00, 0x45, 0xc4, 0x4c, 0xf1, 0x43, 0x00,
+    0xc6, 0xc5, 0xf1, 0x0e, 0x61, 0x7c, 0x55, 0xc1, 0x57, 0x70, 0x04, 0x2f, 0x14, 0x50, 0x55, 0xb1,
+    0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57,
+    0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0x55, 0x55, 0xfc,
+    0x00, 0x00, 0x14, 0x11, 0x31, 0xc5, 0x0f, 0x01, 0x18, 0x17, 0xc7, 0x3b, 0x84, 0x71, 0x55, 0x05,
+    0x5f, 0xc1, 0x11, 0xbc, 0x50, 0x40, 0x55, 0xc5, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96,
+    0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50,
+    0x11, 0x31, 0xf3, 0x54, 0x55, 0x55, 0x55, 0xc5, 0x03, 0x00, 0x50, 0x44, 0xc4, 0x14, 0x3f, 0x04,
+    0x60, 0x5c, 0x1c, 0xef, 0x10, 0x46, 0x55, 0x15, 0x7c, 0x05, 0x47, 0xb0, 0x42, 0x41, 0x55, 0x15,
+    0x4b, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73,
+    0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0x55, 0x55,
+    0x0c, 0x00, 0x40, 0x11, 0x11, 0x51, 0xfc, 0x10, 0x80, 0x71, 0x71, 0xbc, 0x43, 0x18, 0x55, 0x55,
+    0xf0, 0x15, 0x1c, 0xc1, 0x0a, 0x05, 0x55, 0x55, 0x2c, 0x41, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63,
+    0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00,
+    0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x45, 0x44, 0x44, 0xf1, 0x43,
+    0x00, 0xc6, 0xc5, 0xf1, 0x0e, 0x61, 0x54, 0x55, 0xc1, 0x57, 0x70, 0x04, 0x29, 0x14, 0x54, 0x55,
+    0xb1, 0x04, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c,
+    0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0xe5, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x3c, 0x13, 0x33, 0xc5, 0x0f, 0x0f, 0x1c, 0x17, 0xc7, 0x33, 0x04, 0xfe, 0xff,
+    0x0f, 0x1f, 0xcf, 0x11, 0xbc, 0xf0, 0xc3, 0xff, 0xff, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38,
+    0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00,
+    0x50, 0x11, 0x31, 0xf3, 0x54, 0x55, 0xfe, 0xff, 0xff, 0x03, 0x00, 0xf0, 0xbf, 0xcc, 0x14, 0x3f,
+    0x3c, 0x70, 0x5c, 0x1c, 0xcf, 0x10, 0xc6, 0xff, 0x3f, 0x7c, 0x05, 0x47, 0xf0, 0xc2, 0x01, 0xff,
+    0x1f, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1,
+    0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0xfe,
+    0xff, 0x0f, 0x00, 0x50, 0xf1, 0x32, 0x53, 0xbc, 0xf0, 0x90, 0x71, 0x71, 0xbc, 0x43, 0x18, 0xff,
+    0xff, 0xf0, 0x15, 0x1c, 0xc1, 0x4b, 0x05, 0xfc, 0x7f, 0x2c, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88,
+    0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00,
+    0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0x95, 0xff, 0x3f, 0x00, 0x40, 0x55, 0xc8, 0x4c, 0xf1,
+    0xc2, 0x43, 0xc6, 0xc5, 0xf1, 0x0e, 0x61, 0xfc, 0x7f, 0xc1, 0x57, 0x70, 0x04, 0x2f, 0x15, 0xf0,
+    0x5f, 0xb1, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15,
+    0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0x55,
+    0x95, 0xff, 0x00, 0x00, 0x14, 0x11, 0xff, 0xc5, 0x4f, 0x01, 0x18, 0x17, 0xc7, 0x3b, 0x84, 0x71,
+    0x55, 0x05, 0x5f, 0xc1, 0x11, 0xbc, 0x50, 0x40, 0x55, 0xc5, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85,
+    0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c,
+    0x00, 0x50, 0x11, 0x31, 0xf3, 0x54, 0x55, 0x55, 0x55, 0xe5, 0x03, 0x00, 0x50, 0x44, 0xc5, 0x17,
+    0x3f, 0x05, 0x60, 0x5c, 0x1c, 0xef, 0x10, 0x46, 0x55, 0x15, 0x7c, 0x05, 0x47, 0x90, 0x42, 0x41,
+    0x55, 0x15, 0x4b, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53,
+    0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55,
+    0x55, 0x55, 0x09, 0x00, 0x40, 0x11, 0x55, 0x51, 0xbc, 0x14, 0x90, 0x71, 0x71, 0xbc, 0x43, 0x58,
+    0x55, 0x55, 0xf0, 0x15, 0x1c, 0x41, 0x4a, 0x05, 0x55, 0x55, 0x2c, 0x41, 0x59, 0xf2, 0xfb, 0x54,
+    0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf,
+    0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0xf9, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xcf, 0xc4, 0x4c,
+    0xf1, 0xc3, 0x03, 0xc7, 0xc5, 0xf1, 0x2c, 0x81, 0xff, 0xff, 0xcf, 0xc7, 0x73, 0x04, 0x2f, 0xfc,
+    0xf0, 0xff, 0xbf, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f,
+    0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x95,
+    0xef, 0xfe, 0xff, 0xa8, 0x00, 0xfc, 0xef, 0xff, 0xc5, 0x0f, 0x0f, 0x18, 0x17, 0xc7, 0x3b, 0x84,
+    0xf1, 0xff, 0x0f, 0x5f, 0xc1, 0x11, 0xbc, 0x50, 0xc0, 0xff, 0xc7, 0x32, 0x94, 0x25, 0xbf, 0x4f,
+    0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff,
+    0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x54, 0x55, 0x9e, 0xfb, 0xff, 0xa3, 0x02, 0xc4, 0xbf, 0xff,
+    0x17, 0x3f, 0x3c, 0x60, 0x5c, 0x1c, 0xef, 0x10, 0xc6, 0xff, 0x3f, 0x7c, 0x05, 0x47, 0xf0, 0x42,
+    0x01, 0xff, 0x1f, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc,
+    0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55,
+    0x59, 0xee, 0xff, 0x8f, 0x0a, 0x50, 0xfc, 0xfe, 0x5f, 0xbc, 0xf0, 0x90, 0x71, 0x71, 0xbc, 0x43,
+    0x18, 0xff, 0xff, 0xf0, 0x15, 0x1c, 0xc1, 0x4b, 0x05, 0xfc, 0x7f, 0x2c, 0x43, 0x59, 0xf2, 0xfb,
+    0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff,
+    0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0xb9, 0xff, 0x3f, 0x2a, 0x40, 0xc5, 0xfb,
+    0x7f, 0x71, 0xc2, 0x43, 0xc6, 0xc5, 0xf1, 0x0e, 0x61, 0xfc, 0xff, 0xc3, 0x57, 0x70, 0x06, 0x2f,
+    0x15, 0xf0, 0xff, 0xb1, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1,
+    0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55,
+    0x55, 0x65, 0xfe, 0xff, 0xa8, 0x00, 0x55, 0xec, 0xff, 0xc5, 0x09, 0x0f, 0x19, 0x17, 0xc7, 0x3b,
+    0x84, 0xf1, 0xff, 0x07, 0x5f, 0xc1, 0x19, 0xbc, 0x54, 0xc0, 0xff, 0xc5, 0x32, 0x94, 0x25, 0xbf,
+    0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1,
+    0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x54, 0x55, 0x55, 0xf9, 0xff, 0xa3, 0x02, 0x54, 0x85,
+    0xff, 0x17, 0x27, 0x3c, 0x64, 0x5c, 0x1c, 0xef, 0x10, 0xc6, 0xff, 0x17, 0x7c, 0x05, 0x67, 0xf0,
+    0x52, 0x01, 0xff, 0x15, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14,
+    0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53,
+    0x55, 0x55, 0x55, 0xb9, 0x8b, 0xaa, 0x52, 0x95, 0xfc, 0x5f, 0x9c, 0x14, 0x90, 0x71, 0x71, 0xbc,
+    0x43, 0x18, 0x5f, 0x55, 0xf0, 0x15, 0x9c, 0xc1, 0x4b, 0x05, 0x54, 0x55, 0x2c, 0x43, 0x59, 0xf2,
+    0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15,
+    0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0x55, 0xe5, 0x2e, 0x80, 0x4a, 0x55,
+    0xc6, 0x7f, 0xf1, 0x52, 0x40, 0xc6, 0xc5, 0xf1, 0x0e, 0x61, 0x5c, 0x55, 0xc1, 0x57, 0x70, 0x04,
+    0x2f, 0x15, 0x50, 0x55, 0xb1, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46,
+    0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c,
+    0x55, 0x55, 0x55, 0x95, 0xb9, 0x00, 0x2a, 0x55, 0x59, 0xfc, 0xc5, 0x4b, 0x01, 0x19, 0x17, 0xc7,
+    0x3b, 0x84, 0x51, 0x55, 0x05, 0x5f, 0xc1, 0x11, 0xac, 0x54, 0x50, 0x55, 0xc5, 0x12, 0x94, 0x25,
+    0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55,
+    0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x54, 0x55, 0x55, 0x55, 0xe5, 0x02, 0xa8, 0x54,
+    0x65, 0xc5, 0x17, 0x2f, 0x05, 0x64, 0x5c, 0x1c, 0xef, 0x10, 0x46, 0x55, 0x15, 0x7c, 0x05, 0x47,
+    0x90, 0x52, 0x41, 0x55, 0x15, 0x4b, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65,
+    0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc,
+    0x53, 0x55, 0x55, 0x55, 0x95, 0x09, 0xa0, 0x52, 0x95, 0x55, 0x5c, 0x9c, 0x14, 0x90, 0x71, 0x71,
+    0xbc, 0x43, 0x58, 0x55, 0x55, 0xf0, 0x15, 0x9c, 0x41, 0x4a, 0x05, 0x55, 0x55, 0x2c, 0x41, 0x59,
+    0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55,
+    0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x25, 0x80, 0x4a,
+    0x55, 0x56, 0x45, 0x71, 0x52, 0x40, 0xc6, 0xc5, 0xf1, 0x0e, 0x61, 0x55, 0x55, 0xc1, 0x57, 0x70,
+    0x06, 0x29, 0x15, 0x54, 0x55, 0xb1, 0x04, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57,
+    0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc,
+    0x3c, 0xe5, 0xff, 0xff, 0xff, 0xff, 0x02, 0x80, 0x3c, 0x13, 0x33, 0xfc, 0x0f, 0x0f, 0x2c, 0x17,
+    0xc7, 0xb3, 0x06, 0xfe, 0xff, 0x3f, 0x1f, 0xcf, 0x11, 0xbc, 0xf0, 0xc3, 0xff, 0xff, 0x32, 0x94,
+    0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54,
+    0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00,
+    0xf2, 0x4c, 0xcc, 0xc4, 0x3f, 0x3c, 0xb0, 0x5c, 0x1c, 0xcf, 0x1a, 0xf8, 0xff, 0xff, 0x7c, 0x3c,
+    0x47, 0xf0, 0xc2, 0x0f, 0xff, 0xff, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b,
+    0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4,
+    0xcc, 0x53, 0xfe, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xc8, 0x33, 0x31, 0x53, 0xfc, 0xf0, 0xc0, 0x72,
+    0x71, 0x3c, 0x6b, 0xe0, 0xff, 0xff, 0xf3, 0xf1, 0x1c, 0xc1, 0x0b, 0x3f, 0xfc, 0xff, 0x2f, 0x43,
+    0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48,
+    0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0xf9, 0xff, 0xff, 0xff, 0xbf, 0x00,
+    0x20, 0xcf, 0xc4, 0x4c, 0xc5, 0xc3, 0x03, 0xfb, 0xe5, 0xf1, 0xac, 0x81, 0xff, 0xff, 0xcf, 0xc7,
+    0x73, 0x04, 0x2f, 0x3c, 0xf0, 0xff, 0xbf, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf,
+    0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44,
+    0xcc, 0x3c, 0xe5, 0xff, 0xff, 0xff, 0xff, 0x02, 0x80, 0x3c, 0x13, 0x23, 0x55, 0x2c, 0x2f, 0xec,
+    0x97, 0xc7, 0xb3, 0x06, 0xfe, 0xff, 0x3f, 0x1f, 0xcf, 0x11, 0xbc, 0x70, 0xc0, 0xff, 0xff, 0x32,
+    0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81,
+    0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0x72, 0xbe, 0x8c, 0x57, 0x85, 0xbc, 0xb0, 0x5f, 0x1e, 0xcf, 0x1a, 0xf8, 0xff, 0xff, 0x7c,
+    0x3c, 0x47, 0xf0, 0x42, 0x01, 0xff, 0xff, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2,
+    0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45,
+    0xc4, 0xcc, 0x53, 0x55, 0x55, 0xee, 0xff, 0x8f, 0x0a, 0x50, 0xf9, 0xfe, 0x5f, 0x94, 0xf0, 0x90,
+    0x71, 0x71, 0xbc, 0x43, 0x18, 0xff, 0xff, 0xfb, 0x15, 0x9c, 0xc1, 0x4b, 0x05, 0xfc, 0x7f, 0x2c,
+    0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15,
+    0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0x95, 0xef, 0x2e,
+    0xaa, 0x4a, 0x55, 0xfa, 0x7f, 0x71, 0xc2, 0x43, 0xc6, 0xc5, 0xf1, 0x0e, 0x61, 0xfc, 0x5f, 0xc1,
+    0x57, 0x70, 0x06, 0x2f, 0x15, 0xf0, 0x57, 0xb1, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25,
+    0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54,
+    0x44, 0xcc, 0x3c, 0x55, 0x55, 0x55, 0x9e, 0xbb, 0xa8, 0x2a, 0x55, 0xe9, 0xff, 0xc5, 0x49, 0x0c,
+    0x19, 0x17, 0xc7, 0x3b, 0x84, 0xf1, 0x5f, 0x05, 0x5f, 0xc1, 0x19, 0xbc, 0x54, 0xc0, 0x57, 0xc5,
+    0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c,
+    0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x54, 0x55, 0x55, 0x59, 0xee,
+    0xa2, 0xaa, 0x54, 0xa5, 0xff, 0x17, 0x27, 0x05, 0x64, 0x5c, 0x1c, 0xef, 0x10, 0xc6, 0x5f, 0x15,
+    0x7c, 0x05, 0x67, 0xf0, 0x52, 0x01, 0x57, 0x15, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58,
+    0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40,
+    0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0x55, 0x95, 0x09, 0xa0, 0x52, 0x95, 0x55, 0x5e, 0x94, 0x14,
+    0x90, 0x71, 0x71, 0xbc, 0x4b, 0x58, 0x55, 0x55, 0xf8, 0x15, 0x9c, 0x41, 0x4a, 0x05, 0x55, 0x55,
+    0x2c, 0x41, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf,
+    0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0xf9, 0xff, 0xff, 0xff,
+    0xbf, 0x00, 0x20, 0xcf, 0xc4, 0x4c, 0xf9, 0xc3, 0x03, 0xcb, 0xc5, 0xf1, 0xac, 0x81, 0xff, 0xff,
+    0xcf, 0xc7, 0x73, 0x08, 0x2f, 0xfc, 0xf0, 0xff, 0xbf, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e,
+    0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00,
+    0x54, 0x44, 0xcc, 0x3c, 0xe5, 0xff, 0xef, 0xfe, 0xbf, 0xa2, 0xa0, 0x94, 0xef, 0xe7, 0x55, 0x29,
+    0x2f, 0xec, 0x97, 0xc7, 0xb3, 0x06, 0xfe, 0xff, 0x3f, 0x1f, 0xcf, 0x11, 0xbc, 0x50, 0xc0, 0xff,
+    0xff, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0,
+    0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0xff, 0x9f, 0xfb,
+    0xff, 0x8a, 0x82, 0x52, 0xbe, 0x9f, 0x57, 0xa5, 0xbc, 0x84, 0x5f, 0x1e, 0xcf, 0x1a, 0xf8, 0xff,
+    0xff, 0x7c, 0x3c, 0x47, 0xf0, 0x52, 0x01, 0xff, 0xff, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2,
+    0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00,
+    0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0xee, 0xff, 0x8f, 0x0a, 0x50, 0xf9, 0xfe, 0x5f, 0x95,
+    0xf2, 0x90, 0x7c, 0x79, 0xbc, 0x63, 0x1a, 0xff, 0xff, 0xfb, 0x15, 0x9c, 0xc1, 0x4b, 0x05, 0xfc,
+    0x7f, 0x2c, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05,
+    0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0xb9,
+    0xff, 0x3f, 0x2a, 0x40, 0xe5, 0xfb, 0x7f, 0x51, 0xca, 0x43, 0xc6, 0xc5, 0xf1, 0x8e, 0x69, 0xfc,
+    0xff, 0xef, 0x57, 0x70, 0x06, 0x2f, 0x15, 0xf0, 0xff, 0xb1, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21,
+    0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03,
+    0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0xe5, 0xfe, 0xff, 0xa8, 0x00, 0x95, 0xef, 0xff, 0x45,
+    0x29, 0x0f, 0x59, 0x14, 0xc7, 0x3b, 0xa6, 0xf1, 0xff, 0xbf, 0x5f, 0xc1, 0x19, 0xbc, 0x54, 0xc0,
+    0xff, 0xc7, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54,
+    0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x54, 0x55, 0x55,
+    0x55, 0x65, 0x02, 0xa8, 0x54, 0x65, 0x95, 0x17, 0x25, 0x85, 0xa4, 0xcc, 0x1f, 0xef, 0x92, 0x56,
+    0x55, 0x15, 0x7e, 0x05, 0x67, 0x90, 0x52, 0x41, 0x55, 0x15, 0x4b, 0x50, 0x96, 0xfc, 0x3e, 0x15,
+    0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33,
+    0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0x55, 0x95, 0x09, 0xa0, 0x52, 0x95, 0x55, 0x5e,
+    0x94, 0x14, 0x92, 0x72, 0x7c, 0xbc, 0x4b, 0x5a, 0x55, 0x55, 0xf8, 0x15, 0x9c, 0x41, 0x4a, 0x05,
+    0x55, 0x55, 0x2c, 0x41, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f,
+    0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55,
+    0x55, 0x55, 0x26, 0x80, 0x4a, 0x55, 0x56, 0x79, 0x51, 0x52, 0x48, 0xca, 0xc5, 0xf1, 0x2e, 0x69,
+    0x55, 0x55, 0xe1, 0x57, 0x70, 0x06, 0x29, 0x15, 0x54, 0x55, 0xb1, 0x04, 0x65, 0xc9, 0xef, 0x53,
+    0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f,
+    0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0x55, 0x55, 0x99, 0x00, 0x2a, 0x55, 0x59, 0xe5,
+    0x45, 0x49, 0x21, 0x29, 0x57, 0xc4, 0xbb, 0xa4, 0x55, 0x55, 0x85, 0x5f, 0xc1, 0x19, 0xa4, 0x54,
+    0x50, 0x55, 0xc5, 0x12, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff,
+    0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0xff,
+    0xff, 0xff, 0xff, 0x0b, 0x00, 0xf2, 0x4c, 0xcc, 0x94, 0x3f, 0x3c, 0xb2, 0x5c, 0xcc, 0xcf, 0x1a,
+    0xf8, 0xff, 0xff, 0xbc, 0x3c, 0x87, 0xf3, 0xc2, 0x0f, 0xff, 0xff, 0xcb, 0x50, 0x96, 0xfc, 0x3e,
+    0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff,
+    0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0xfe, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xc8, 0x33, 0x31,
+    0x53, 0xfe, 0xf0, 0xc8, 0x72, 0x71, 0x3c, 0x6b, 0xe0, 0xff, 0xff, 0xf3, 0xf1, 0x1c, 0xce, 0x0b,
+    0x3f, 0xfc, 0xff, 0x2f, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0,
+    0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0xf9,
+    0xff, 0xff, 0xff, 0xbf, 0x00, 0x20, 0xcf, 0xc4, 0x4c, 0xf9, 0xc3, 0x23, 0xcb, 0xc5, 0xc5, 0xac,
+    0x81, 0xff, 0xff, 0xcf, 0xc7, 0x73, 0x38, 0x2f, 0xfc, 0xf0, 0xff, 0xbf, 0x0c, 0x65, 0xc9, 0xef,
+    0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc,
+    0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0xe5, 0xff, 0xff, 0xff, 0xff, 0x02, 0x80, 0x3c, 0x13,
+    0x33, 0xe5, 0x0f, 0x8f, 0x2c, 0x17, 0x57, 0xb0, 0x06, 0xfe, 0xff, 0x3f, 0x1f, 0xcf, 0xe1, 0xbc,
+    0xf0, 0xc3, 0xff, 0xff, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05,
+    0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94,
+    0xff, 0x97, 0xfb, 0xff, 0x8a, 0x82, 0x56, 0xbe, 0x9f, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xcf,
+    0x1a, 0xf8, 0xff, 0xff, 0x7c, 0x3c, 0x67, 0xf0, 0x52, 0x01, 0xff, 0xff, 0xcb, 0x50, 0x96, 0xfc,
+    0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5,
+    0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0xfe, 0x5f, 0xee, 0xff, 0x2b, 0x0a, 0x5a, 0xf9,
+    0x7e, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0x7c, 0x68, 0xe0, 0xff, 0xff, 0xf3, 0xf1, 0x9c, 0xc1,
+    0x4b, 0x05, 0xfc, 0xff, 0x2f, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51,
+    0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f,
+    0x55, 0x55, 0xb9, 0xff, 0x3f, 0x2a, 0x60, 0xe5, 0xfb, 0x7b, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1,
+    0x8e, 0x69, 0xfc, 0xff, 0xef, 0x57, 0x70, 0x06, 0x2f, 0x15, 0xf0, 0xff, 0xb1, 0x0c, 0x65, 0xc9,
+    0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55,
+    0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0x55, 0x55, 0x99, 0x00, 0x2a, 0x55,
+    0x59, 0xe5, 0x55, 0x49, 0x21, 0xe9, 0x97, 0xc7, 0xbb, 0xa4, 0x55, 0x55, 0x85, 0x5f, 0xc1, 0x19,
+    0xa4, 0x54, 0x50, 0x55, 0xc5, 0x12, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19,
+    0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3,
+    0x94, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0xf2, 0x4c, 0xcc, 0x94, 0x3f, 0x3c, 0xb2, 0x5f, 0xee,
+    0xcf, 0xca, 0xf8, 0xff, 0xff, 0xbc, 0x3f, 0x87, 0xf3, 0xc2, 0x0f, 0xff, 0xff, 0xcb, 0x50, 0x96,
+    0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55,
+    0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0xfe, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xc8,
+    0x33, 0x31, 0x53, 0xfe, 0xf0, 0xc8, 0x7e, 0xb9, 0x3f, 0x6b, 0xe0, 0xff, 0xff, 0xf3, 0xfe, 0x1c,
+    0xce, 0x0b, 0x3f, 0xfc, 0xff, 0x2f, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95,
+    0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33,
+    0x4f, 0xf9, 0x5f, 0xb9, 0xff, 0xaf, 0x2a, 0x68, 0xe5, 0xfb, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5,
+    0xf1, 0xae, 0x81, 0xff, 0xff, 0xef, 0xc7, 0x73, 0x06, 0x2f, 0x15, 0xf0, 0xff, 0xbf, 0x0c, 0x65,
+    0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55,
+    0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x65, 0x55, 0xe5, 0xfe, 0xbf, 0xaa, 0xa0,
+    0x95, 0xef, 0xe7, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfc, 0xff, 0xbf, 0x5f, 0xc1,
+    0x19, 0xbc, 0x54, 0xc0, 0xff, 0xcf, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e,
+    0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31,
+    0xf3, 0x54, 0x55, 0x95, 0xfb, 0xff, 0xaa, 0x82, 0x56, 0xbe, 0x9f, 0x57, 0xa5, 0xbc, 0xa4, 0x5f,
+    0x1e, 0xef, 0x9a, 0xc6, 0xff, 0xff, 0x7e, 0x05, 0x67, 0xf0, 0x52, 0x01, 0xff, 0x1f, 0xcb, 0x50,
+    0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52,
+    0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0xee, 0xbf, 0xa9, 0x8a,
+    0x5a, 0xf9, 0x5e, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0x5a, 0xfc, 0xff, 0xfb, 0x15,
+    0x9c, 0xc1, 0x4b, 0x05, 0xfc, 0x5f, 0x2c, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef,
+    0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11,
+    0x33, 0x4f, 0x55, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa,
+    0xe5, 0xf1, 0xae, 0x69, 0xc5, 0xff, 0xef, 0x57, 0x70, 0x06, 0x2f, 0x15, 0xf0, 0x5f, 0xb1, 0x0c,
+    0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20,
+    0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0xe5, 0x7e, 0x99, 0xaa,
+    0xaa, 0x95, 0x5f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0x55, 0xfc, 0xbf, 0x5f,
+    0xc1, 0x19, 0xbc, 0x54, 0xc0, 0x5f, 0xc5, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc,
+    0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11,
+    0x31, 0xf3, 0x54, 0x55, 0x95, 0x7b, 0x65, 0xaa, 0xaa, 0x56, 0x7e, 0x95, 0x57, 0xa5, 0x8c, 0xa4,
+    0x5f, 0x1e, 0xef, 0x9a, 0x56, 0xc5, 0xff, 0x7e, 0x05, 0x67, 0xf0, 0x52, 0x01, 0x5f, 0x15, 0xcb,
+    0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05,
+    0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0x6e, 0x95, 0xa9,
+    0xaa, 0x5a, 0xf9, 0x55, 0x5e, 0x95, 0x12, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0x5a, 0x55, 0xfc, 0xfb,
+    0x15, 0x9c, 0xc1, 0x4b, 0x05, 0x5c, 0x55, 0x2c, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9,
+    0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15,
+    0x11, 0x33, 0x4f, 0x55, 0x55, 0x79, 0x55, 0xa6, 0xaa, 0x6a, 0xe5, 0x57, 0x79, 0x55, 0x4a, 0x48,
+    0xfa, 0xe5, 0xf1, 0xae, 0x69, 0x55, 0xc5, 0xef, 0x57, 0x70, 0x06, 0x2f, 0x15, 0x50, 0x55, 0xb1,
+    0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57,
+    0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0x65, 0x55, 0x99,
+    0x2a, 0xaa, 0x95, 0x5b, 0xe5, 0x55, 0x69, 0x21, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0x55, 0x55, 0xbc,
+    0x5f, 0xc1, 0x19, 0xbc, 0x54, 0x40, 0x55, 0xc5, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96,
+    0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50,
+    0x11, 0x31, 0xf3, 0x54, 0x55, 0x55, 0x55, 0x65, 0xaa, 0xa8, 0x56, 0x66, 0x95, 0x57, 0xa5, 0x85,
+    0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0x56, 0x55, 0xc5, 0x7e, 0x05, 0x67, 0xb0, 0x52, 0x41, 0x55, 0x15,
+    0x4b, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73,
+    0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0x55, 0x95,
+    0x09, 0xa0, 0x5a, 0x95, 0x55, 0x5e, 0x95, 0x16, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0x5a, 0x55, 0x55,
+    0xf8, 0x15, 0x9c, 0x41, 0x4a, 0x05, 0x55, 0x55, 0x2c, 0x41, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63,
+    0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00,
+    0x15, 0x11, 0x33, 0x4f, 0xf9, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x20, 0xcf, 0xc4, 0x48, 0xf9, 0xcb,
+    0x2b, 0xfb, 0xe5, 0xfe, 0xac, 0xa9, 0xff, 0xff, 0xcf, 0xfb, 0x73, 0x38, 0x2f, 0xfc, 0xf0, 0xff,
+    0xbf, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c,
+    0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0xe5, 0xff, 0xff, 0xff,
+    0xff, 0x02, 0x80, 0x3c, 0x13, 0x23, 0xe5, 0x2f, 0xaf, 0xec, 0x97, 0xfb, 0xb3, 0xa6, 0xfe, 0xff,
+    0x7f, 0xec, 0xcf, 0xe1, 0xbc, 0xf0, 0xc3, 0xff, 0xff, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38,
+    0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00,
+    0x50, 0x11, 0x31, 0xf3, 0x94, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0xf2, 0x4c, 0x8c, 0x94, 0xbf,
+    0xbc, 0xb2, 0x5f, 0xee, 0xcf, 0x9a, 0xfa, 0xff, 0xff, 0x85, 0x3f, 0x87, 0xf3, 0xc2, 0x0f, 0xff,
+    0xff, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1,
+    0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0xfe, 0x55, 0xee,
+    0xff, 0xab, 0x0a, 0x5a, 0xf9, 0x7e, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0xb9, 0xbc, 0x6b, 0xea, 0xff,
+    0xff, 0xfb, 0xfc, 0x9c, 0xc1, 0x4b, 0x05, 0xfc, 0xff, 0x2f, 0x43, 0x59, 0xf2, 0xfb, 0x54, 0x88,
+    0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00,
+    0x00, 0x15, 0x11, 0x33, 0x4f, 0xf9, 0x57, 0xb9, 0xff, 0xaf, 0x2a, 0x68, 0xe5, 0xfb, 0x79, 0x55,
+    0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0xff, 0xef, 0xc7, 0x73, 0x06, 0x2f, 0x15, 0xf0,
+    0xff, 0xbf, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15,
+    0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0xe5, 0x57, 0xe5,
+    0xfe, 0xbf, 0xaa, 0xa0, 0x95, 0xef, 0xe7, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe,
+    0xff, 0xbf, 0x5f, 0xcc, 0x19, 0xbc, 0x54, 0xc0, 0xff, 0xff, 0x32, 0x94, 0x25, 0xbf, 0x4f, 0x85,
+    0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c,
+    0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0xff, 0xaa, 0x82, 0x56, 0xbe, 0x9f, 0x57,
+    0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0xff, 0x7e, 0x05, 0x67, 0xf0, 0x52, 0x01,
+    0xff, 0xff, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53,
+    0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55,
+    0x55, 0x95, 0x09, 0xa0, 0x5a, 0x95, 0x55, 0x5e, 0x95, 0x16, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0x5a,
+    0x55, 0x55, 0xfa, 0x15, 0x9c, 0x41, 0x4a, 0x05, 0x55, 0x55, 0x6c, 0x41, 0x59, 0xf2, 0xfb, 0x54,
+    0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf,
+    0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0x55, 0x55, 0x26, 0x80, 0x6a, 0x55, 0x56, 0x79,
+    0x55, 0x5a, 0x48, 0xfa, 0xe5, 0xf1, 0xae, 0x69, 0x55, 0x55, 0xe9, 0x57, 0x44, 0x06, 0x29, 0x15,
+    0x54, 0x55, 0xb1, 0x05, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f,
+    0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0xe5, 0xff,
+    0xff, 0xff, 0xff, 0x02, 0x80, 0x9c, 0x2f, 0xe3, 0xe5, 0x2f, 0xaf, 0xe8, 0x97, 0xfb, 0xbb, 0xa6,
+    0xfe, 0xff, 0xbf, 0xef, 0xcf, 0xec, 0xbc, 0xf0, 0xc3, 0xff, 0xff, 0x32, 0x94, 0x25, 0xbf, 0x4f,
+    0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff,
+    0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x72, 0xbe, 0x8c,
+    0x97, 0xbf, 0xbc, 0xa2, 0x5f, 0xee, 0xef, 0x9a, 0xfa, 0xff, 0xff, 0xbe, 0x3f, 0x87, 0xf3, 0xc2,
+    0x0f, 0xff, 0xff, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc,
+    0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0xfe,
+    0x55, 0xee, 0xff, 0xab, 0x0a, 0x5a, 0xf9, 0x7e, 0x5e, 0x95, 0xf2, 0x9a, 0x7e, 0xb9, 0xbf, 0x6b,
+    0xea, 0xff, 0xff, 0xfb, 0xfe, 0x9c, 0xcc, 0x4b, 0x05, 0xfc, 0xff, 0x2f, 0x43, 0x59, 0xf2, 0xfb,
+    0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff,
+    0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0xf9, 0x57, 0xb9, 0xff, 0xaf, 0x2a, 0x68, 0xe5, 0xfb,
+    0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xfe, 0xae, 0xa9, 0xff, 0xff, 0xef, 0xfb, 0x73, 0x06, 0x2f,
+    0x15, 0xf0, 0xff, 0xbf, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1,
+    0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0xe5,
+    0x55, 0xe5, 0xfe, 0xbf, 0xaa, 0xa0, 0x95, 0xef, 0xe7, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb,
+    0xa6, 0xfe, 0xff, 0xbf, 0x5f, 0xc9, 0x19, 0xbc, 0x56, 0xc0, 0xff, 0xff, 0x32, 0x94, 0x25, 0xbf,
+    0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1,
+    0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0xff, 0xaa, 0x82, 0x56, 0xbe,
+    0x9f, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0xbf, 0x7e, 0xa5, 0x67, 0xc4,
+    0x5a, 0x01, 0xff, 0xff, 0x4b, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14,
+    0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53,
+    0x5e, 0x55, 0xee, 0xbf, 0xa9, 0x8a, 0x5a, 0xf9, 0x5e, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc,
+    0x6b, 0xea, 0xff, 0x7f, 0xfa, 0x95, 0x9e, 0x51, 0x68, 0x05, 0xfc, 0xff, 0x2f, 0x41, 0x59, 0xf2,
+    0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15,
+    0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x79, 0x55, 0x55, 0x55, 0xa6, 0x8a, 0x6a, 0x65,
+    0x56, 0x79, 0x55, 0x5a, 0x48, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0x57, 0x55, 0xe9, 0x57, 0x7a, 0x46,
+    0x89, 0x15, 0x54, 0x15, 0xbf, 0x05, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46,
+    0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c,
+    0x55, 0x55, 0x55, 0x55, 0x99, 0x00, 0xaa, 0x55, 0x59, 0xe5, 0x55, 0x69, 0x21, 0xe9, 0x97, 0xc7,
+    0xbb, 0xa6, 0x55, 0x55, 0xa5, 0x5f, 0xe1, 0x19, 0xa5, 0x54, 0x50, 0x55, 0xc5, 0x16, 0x94, 0x25,
+    0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55,
+    0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0xff, 0xbf, 0xfb, 0xff, 0x8a, 0x82, 0x52,
+    0xbe, 0x9f, 0x97, 0xbf, 0xbc, 0xa2, 0x5f, 0xee, 0xef, 0x9a, 0xfa, 0xff, 0xff, 0xbe, 0x3f, 0xa7,
+    0xf3, 0xc2, 0x0f, 0xff, 0xff, 0xcb, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65,
+    0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc,
+    0x53, 0xfe, 0x7f, 0xee, 0xff, 0x2b, 0x0a, 0x4a, 0xf9, 0x7e, 0x5e, 0xbe, 0xf2, 0x9a, 0x7e, 0xb9,
+    0xbf, 0x6b, 0xea, 0xff, 0xff, 0xfb, 0xfe, 0x9c, 0xce, 0x4b, 0x3c, 0xfc, 0xff, 0x2f, 0x43, 0x59,
+    0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55,
+    0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0xf9, 0x7f, 0xb9, 0xff, 0xaf, 0x28, 0x68,
+    0xe5, 0xfb, 0x79, 0x79, 0xca, 0x6b, 0xfa, 0xe5, 0xfe, 0xae, 0xa9, 0xff, 0xff, 0xef, 0xfb, 0x73,
+    0x3a, 0x2f, 0xc5, 0xf0, 0xff, 0xbf, 0x0c, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57,
+    0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc,
+    0x3c, 0xe5, 0x7f, 0xe5, 0xfe, 0xbf, 0xaa, 0xa0, 0x95, 0xef, 0xe7, 0x65, 0x29, 0xaf, 0xe9, 0x97,
+    0xfb, 0xbb, 0xa6, 0xfe, 0xff, 0xbf, 0xef, 0xcf, 0xe9, 0xbc, 0x54, 0xc0, 0xff, 0xff, 0x32, 0x94,
+    0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54,
+    0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0xff, 0xaa, 0x82,
+    0x56, 0xbe, 0x9f, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0xff, 0x7e, 0x25,
+    0x67, 0xf8, 0x5a, 0x01, 0xff, 0xff, 0xcb, 0x53, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b,
+    0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45, 0xc4,
+    0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e,
+    0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x05, 0xfc, 0xff, 0x6f, 0x41,
+    0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48,
+    0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x79, 0x55, 0xb9, 0x5f, 0xa6, 0xaa,
+    0x6a, 0xe5, 0x57, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x5f, 0xe9, 0x57,
+    0x7a, 0x46, 0xa9, 0x15, 0xc4, 0xff, 0xbf, 0x05, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25, 0xbf,
+    0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54, 0x44,
+    0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0x5e, 0x99, 0xaa, 0xaa, 0x95, 0x5f, 0xe5, 0x55, 0x29, 0x23, 0xe9,
+    0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0x5f, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0x50, 0xfc, 0xff, 0x16,
+    0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81,
+    0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0x57, 0x95, 0x5b, 0x65, 0xaa,
+    0xaa, 0x56, 0x7e, 0x95, 0x57, 0xa5, 0x84, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0x5f, 0x95, 0x7e,
+    0xa5, 0x67, 0x94, 0x5a, 0x41, 0xc5, 0xff, 0x5b, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58, 0xf2,
+    0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40, 0x45,
+    0xc4, 0xcc, 0x53, 0x5e, 0x55, 0x5e, 0x95, 0xa9, 0xaa, 0x5a, 0xf9, 0x55, 0x5e, 0x95, 0x12, 0x92,
+    0x7e, 0x79, 0xbc, 0x6b, 0xea, 0x5f, 0x55, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x05, 0x55, 0xfc, 0x6f,
+    0x41, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15,
+    0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x79, 0x55, 0x59, 0x55, 0xa6,
+    0x8a, 0x6a, 0xe5, 0x56, 0x79, 0x55, 0x5a, 0x48, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0x5f, 0x55, 0xe9,
+    0x57, 0x7a, 0x46, 0xa9, 0x15, 0x54, 0xc5, 0xbf, 0x05, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e, 0x25,
+    0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00, 0x54,
+    0x44, 0xcc, 0x3c, 0xe5, 0x55, 0x55, 0x55, 0x99, 0x2a, 0xaa, 0x95, 0x59, 0xe5, 0x55, 0x69, 0x21,
+    0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0x5e, 0x55, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0x50, 0x55, 0xfc,
+    0x16, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c,
+    0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0x55, 0x55, 0x55, 0x65,
+    0x0a, 0xa8, 0x56, 0x65, 0x95, 0x57, 0xa5, 0x85, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0x5a, 0x55, 0x95,
+    0x7e, 0xa5, 0x67, 0x94, 0x5a, 0x41, 0x55, 0xc5, 0x5b, 0x50, 0x96, 0xfc, 0x3e, 0x15, 0xe2, 0x58,
+    0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00, 0x40,
+    0x45, 0xc4, 0xcc, 0x53, 0x55, 0x55, 0x55, 0x95, 0x29, 0xa0, 0x5a, 0x95, 0x55, 0x5e, 0x95, 0x16,
+    0x92, 0x7e, 0x79, 0xbc, 0x6b, 0x5a, 0x55, 0x55, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x05, 0x55, 0x55,
+    0x6c, 0x41, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf,
+    0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x55, 0x55, 0x55, 0x55,
+    0xa6, 0x80, 0x6a, 0x55, 0x56, 0x79, 0x55, 0x5a, 0x48, 0xfa, 0xe5, 0xf1, 0xae, 0x69, 0x55, 0x55,
+    0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0x54, 0x55, 0x85, 0x05, 0x65, 0xc9, 0xef, 0x53, 0x21, 0x8e,
+    0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03, 0x00,
+    0x54, 0x44, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29,
+    0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff,
+    0xff, 0x94, 0xf0, 0x7e, 0xbe, 0x0f, 0x3f, 0x3a, 0xf2, 0xfe, 0x5e, 0x19, 0x3c, 0xff, 0x54, 0xf0,
+    0x5c, 0x81, 0xf0, 0x57, 0xf1, 0xff, 0x0f, 0x00, 0xf0, 0x13, 0x31, 0xf3, 0x94, 0x57, 0x95, 0xfb,
+    0xff, 0xaa, 0x82, 0x56, 0xbe, 0x9f, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff,
+    0xbf, 0x7e, 0xa5, 0x67, 0xb8, 0x5a, 0xa1, 0xff, 0xff, 0xcb, 0x53, 0x96, 0xfc, 0x3e, 0x15, 0xe2,
+    0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x33, 0x00,
+    0x40, 0x45, 0xc4, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0xbf, 0xa9, 0x8a, 0x5a, 0xf9, 0x5e, 0x5e, 0x95,
+    0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x7f, 0xfa, 0x95, 0x9e, 0x61, 0x6a, 0x85, 0xfe,
+    0xff, 0x6f, 0x4c, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05,
+    0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x79, 0x55, 0xb9,
+    0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff,
+    0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x05, 0x65, 0xc9, 0xef, 0x53, 0x21,
+    0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x3f, 0x03,
+    0x00, 0x54, 0x44, 0xcc, 0x3c, 0x55, 0x55, 0x55, 0x55, 0x99, 0x02, 0xaa, 0x55, 0x59, 0xe5, 0x55,
+    0x69, 0x21, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0x55, 0x55, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0x50,
+    0x55, 0x95, 0x16, 0x94, 0x25, 0xbf, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54,
+    0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0x57, 0x95,
+    0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa,
+    0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0xc2, 0xfb, 0xf9, 0x3e, 0xfc,
+    0xe8, 0xc8, 0xfb, 0x7b, 0x65, 0xf0, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0xc2, 0x5f, 0xc5, 0xff, 0x3f,
+    0x00, 0xc0, 0x4f, 0xc4, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e,
+    0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85,
+    0xfe, 0xff, 0x6f, 0x49, 0xec, 0xe7, 0xfb, 0xf0, 0xa3, 0x23, 0xef, 0xef, 0x95, 0xc1, 0xf3, 0x4f,
+    0x05, 0xcf, 0x15, 0x08, 0x7f, 0x15, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x11, 0x33, 0x4f, 0x79, 0x55,
+    0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9,
+    0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x85, 0x9f, 0xef, 0xc3,
+    0x8f, 0x8e, 0xbc, 0xbf, 0x57, 0x06, 0xcf, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0xfc, 0x55, 0xfc, 0xff,
+    0x03, 0x00, 0xfc, 0x44, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5,
+    0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56,
+    0xe8, 0xff, 0xff, 0x96, 0x94, 0x7c, 0xbe, 0x4f, 0x05, 0x3a, 0xf2, 0xfe, 0x5e, 0x19, 0x3c, 0xff,
+    0x54, 0xf0, 0x5c, 0x81, 0xf0, 0x57, 0xf1, 0xff, 0x0f, 0x00, 0xf0, 0x13, 0x31, 0xf3, 0x94, 0x57,
+    0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a,
+    0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0xc6, 0xf9, 0x3e,
+    0x15, 0xe8, 0xc8, 0xfb, 0x7b, 0x65, 0xf0, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0xc2, 0x5f, 0xc5, 0xff,
+    0x3f, 0x00, 0xc0, 0x4f, 0xc4, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56,
+    0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a,
+    0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe4, 0xfb, 0x54, 0xa0, 0x23, 0xef, 0xef, 0x95, 0xc1, 0xf3,
+    0x4f, 0x05, 0xcf, 0x15, 0x08, 0x7f, 0x15, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x11, 0x33, 0x4f, 0x79,
+    0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae,
+    0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0xc9, 0xef,
+    0x53, 0x21, 0x8e, 0x25, 0xbf, 0x57, 0x46, 0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc,
+    0x3f, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f,
+    0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5,
+    0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbc, 0x4f, 0x85, 0x38, 0x96, 0xfc, 0x5e, 0x19, 0x05,
+    0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94,
+    0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef,
+    0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xc5,
+    0x3e, 0x15, 0xe2, 0x58, 0xf2, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0xc5,
+    0xff, 0x33, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9,
+    0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51,
+    0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0x56, 0xf8, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95, 0x51,
+    0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f,
+    0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1,
+    0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99,
+    0xcf, 0x53, 0xa1, 0xc1, 0x65, 0x05, 0x57, 0x46, 0xc1, 0x07, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55,
+    0x7c, 0x15, 0x03, 0x00, 0x54, 0x44, 0x4c, 0x14, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95,
+    0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19,
+    0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0x7e, 0x4c, 0x85, 0x06, 0x97, 0x15, 0x5c, 0x19,
+    0x05, 0x17, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0x71, 0x55, 0x0c, 0x00, 0x50, 0x11, 0x31, 0x51,
+    0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e,
+    0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96,
+    0xf9, 0x05, 0x15, 0x1a, 0x5c, 0x56, 0x70, 0x65, 0x14, 0x54, 0x50, 0xc1, 0x73, 0x05, 0x52, 0x55,
+    0x45, 0x55, 0x31, 0x00, 0x40, 0x45, 0x44, 0x44, 0x51, 0x55, 0x55, 0x55, 0x95, 0x29, 0xa0, 0x5a,
+    0x95, 0x55, 0x5e, 0x95, 0x16, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0x5a, 0x55, 0x55, 0xfa, 0x95, 0x9e,
+    0x51, 0x6a, 0x05, 0x55, 0x55, 0x69, 0x61, 0x59, 0xf2, 0xfb, 0x54, 0x88, 0x63, 0xc9, 0xef, 0x95,
+    0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xcf, 0x00, 0x00, 0x15, 0x11, 0x33,
+    0x4f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5,
+    0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0xa5,
+    0x9f, 0xef, 0xc3, 0x8f, 0x8e, 0xbc, 0xbf, 0x57, 0x06, 0xcf, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0xfc,
+    0x55, 0xfc, 0xff, 0x03, 0x00, 0xfc, 0x44, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8,
+    0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9,
+    0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x7e, 0xbe, 0x4f, 0x3c, 0x3a, 0xf2, 0xfe, 0x5e,
+    0x19, 0x3c, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0xf0, 0x57, 0xf1, 0xff, 0x0f, 0x00, 0xf0, 0x13, 0x31,
+    0xf3, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f,
+    0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52,
+    0xfa, 0xf9, 0x3e, 0xc5, 0xe8, 0xc8, 0xfb, 0x7b, 0x65, 0xf0, 0xfc, 0x53, 0xc1, 0x73, 0x05, 0xc2,
+    0x5f, 0xc5, 0xff, 0x3f, 0x00, 0xc0, 0x4f, 0xc4, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a,
+    0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95,
+    0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0xe9, 0xe7, 0xfb, 0x54, 0xa0, 0x23, 0xef, 0xef,
+    0x95, 0xc1, 0xf3, 0x4f, 0x05, 0xcf, 0x15, 0x08, 0x7f, 0x15, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x11,
+    0x33, 0x4f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa,
+    0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25,
+    0x65, 0x99, 0xef, 0x53, 0x81, 0x8e, 0xbc, 0xbf, 0x57, 0x06, 0xcf, 0x3f, 0x15, 0x3c, 0x57, 0x20,
+    0xfc, 0x55, 0xfc, 0xff, 0x03, 0x00, 0xfc, 0x44, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa,
+    0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f,
+    0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f, 0x85, 0x38, 0x96, 0xfc,
+    0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00, 0x50, 0x11,
+    0x31, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4,
+    0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b,
+    0x52, 0x96, 0xf9, 0x3e, 0x15, 0xca, 0x5c, 0x56, 0x70, 0x65, 0x14, 0xfc, 0x53, 0xc1, 0x73, 0x05,
+    0x52, 0x55, 0xc5, 0x5f, 0x31, 0x00, 0x40, 0x45, 0xc4, 0x4c, 0x51, 0x5e, 0x55, 0xee, 0x9f, 0xa9,
+    0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa,
+    0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0x68, 0x70, 0x59,
+    0xc1, 0x95, 0x51, 0xf0, 0x43, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0x7f, 0xc5, 0x00, 0x00, 0x15,
+    0x11, 0x33, 0x45, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b,
+    0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf,
+    0x25, 0x65, 0x99, 0x5f, 0x52, 0xa1, 0xc1, 0x65, 0x05, 0x57, 0x46, 0x41, 0x05, 0x15, 0x3c, 0x57,
+    0x20, 0x55, 0x55, 0x54, 0x15, 0x03, 0x00, 0x54, 0x44, 0x44, 0x14, 0xe5, 0x55, 0xe5, 0xfe, 0x99,
+    0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5,
+    0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0x7e, 0x49, 0x85, 0x46, 0x94,
+    0x15, 0x5c, 0x19, 0x45, 0x15, 0x56, 0xf0, 0x5c, 0x89, 0x54, 0x55, 0x55, 0x55, 0x0c, 0x00, 0x50,
+    0x11, 0x11, 0x51, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc,
+    0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff,
+    0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0xc8, 0xfb, 0x7b, 0x65, 0xf0, 0xfc, 0x53, 0xc1, 0x73,
+    0x05, 0xc2, 0x5f, 0xc5, 0xff, 0x3f, 0x00, 0xc0, 0x4f, 0xc4, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f,
+    0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f,
+    0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8, 0x63,
+    0xec, 0xef, 0x95, 0xc1, 0xf3, 0x4f, 0x05, 0xcf, 0x15, 0x08, 0x5f, 0x15, 0xff, 0xff, 0x00, 0x00,
+    0x1f, 0x11, 0x33, 0x4f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca,
+    0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff,
+    0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0x85, 0xbf, 0x57, 0x06, 0xcf, 0x3f, 0x15, 0x3c,
+    0x57, 0x20, 0x5c, 0x55, 0xfc, 0xff, 0x03, 0x00, 0x5c, 0x44, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe,
+    0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff,
+    0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f, 0x85, 0x3a,
+    0x96, 0xfc, 0x5e, 0x19, 0x05, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55, 0xf1, 0xff, 0x0c, 0x00,
+    0x50, 0x11, 0x31, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5,
+    0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff,
+    0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0x58, 0xc6, 0x7b, 0x65, 0x14, 0xfc, 0x53, 0xc1,
+    0x73, 0x05, 0x52, 0x55, 0xc5, 0xff, 0x31, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x51, 0x5e, 0x55, 0xee,
+    0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff,
+    0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8,
+    0x63, 0x59, 0xec, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15, 0xff, 0xc5, 0x00,
+    0x00, 0x15, 0x11, 0x33, 0x45, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55,
+    0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa,
+    0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0x65, 0x85, 0x57, 0x46, 0xc1, 0x3f, 0x15,
+    0x3c, 0x57, 0x20, 0x55, 0x55, 0xfc, 0x15, 0x03, 0x00, 0x54, 0x44, 0xcc, 0x14, 0xe5, 0x55, 0xe5,
+    0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe,
+    0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0x7e, 0x49, 0x85,
+    0x46, 0x96, 0x95, 0x5c, 0x19, 0x45, 0x15, 0x56, 0xf0, 0x5c, 0x89, 0x54, 0x55, 0x55, 0x55, 0x0c,
+    0x00, 0x50, 0x11, 0x11, 0x51, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57,
+    0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1,
+    0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x25, 0x15, 0x1a, 0x59, 0x56, 0x46, 0x65, 0x14, 0x55, 0x58,
+    0xc1, 0x73, 0x25, 0x52, 0x55, 0x55, 0x55, 0x31, 0x00, 0x40, 0x45, 0x44, 0x44, 0x51, 0x5e, 0x55,
+    0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea,
+    0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54,
+    0xa8, 0xa3, 0xef, 0xef, 0xfc, 0xce, 0xf3, 0x0b, 0x3f, 0xef, 0x3c, 0x2a, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x3f, 0x33, 0x33, 0x4f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79,
+    0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15,
+    0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0xbe, 0xbf, 0xc7, 0x3b, 0xcf, 0x2f,
+    0xfc, 0xbc, 0x73, 0xa8, 0xfc, 0xff, 0xff, 0xff, 0x03, 0x00, 0xfc, 0xcc, 0xcc, 0x3c, 0xe5, 0x55,
+    0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6,
+    0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f,
+    0x85, 0x3a, 0xfa, 0xfe, 0x5e, 0xec, 0x3c, 0xbf, 0xf0, 0xf3, 0x4e, 0xa1, 0xf2, 0xff, 0xff, 0xff,
+    0x0f, 0x00, 0xf0, 0x33, 0x33, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95,
+    0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a,
+    0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0xe8, 0xfb, 0x7b, 0x85, 0xf3, 0xfc,
+    0xc2, 0xcf, 0x3b, 0x85, 0xca, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xc0, 0xcf, 0xcc, 0xcc, 0x53, 0x5e,
+    0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b,
+    0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb,
+    0x54, 0xa8, 0xa3, 0xef, 0xef, 0x95, 0xcc, 0xf3, 0x4f, 0x05, 0xcf, 0x15, 0x08, 0xff, 0x17, 0xff,
+    0xff, 0x00, 0x00, 0x3f, 0x13, 0x33, 0x4f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b,
+    0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9,
+    0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0xbe, 0xbf, 0x57, 0x06, 0xcf,
+    0x3f, 0x15, 0x3c, 0x57, 0x20, 0xfc, 0x57, 0xfc, 0xff, 0x03, 0x00, 0xfc, 0x44, 0xcc, 0x3c, 0xe5,
+    0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb,
+    0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe,
+    0x4f, 0x85, 0x3a, 0x96, 0xfe, 0x5e, 0x19, 0x3c, 0xff, 0x54, 0xf0, 0x5c, 0x81, 0x50, 0x55, 0xf1,
+    0xff, 0x0f, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe,
+    0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94,
+    0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0x58, 0xfa, 0x7b, 0x65, 0xc4,
+    0xfc, 0x53, 0xc1, 0x73, 0x05, 0x42, 0x55, 0xc5, 0xff, 0x3f, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53,
+    0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc,
+    0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6,
+    0xfb, 0x54, 0xa8, 0x63, 0xe9, 0xef, 0x95, 0x51, 0xf0, 0x4f, 0x05, 0xcf, 0x15, 0x48, 0x55, 0x15,
+    0xff, 0xff, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5,
+    0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46,
+    0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0x65, 0xa5, 0x57, 0x46,
+    0xc1, 0x3f, 0x15, 0x3c, 0x57, 0x20, 0x55, 0x55, 0x7c, 0x15, 0x03, 0x00, 0x54, 0x44, 0x4c, 0x14,
+    0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7,
+    0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65,
+    0xbe, 0x4b, 0x85, 0x7a, 0x96, 0x95, 0x5e, 0x19, 0x45, 0xfc, 0x54, 0xf0, 0x5c, 0x81, 0x54, 0x55,
+    0x71, 0x55, 0x0c, 0x00, 0x50, 0x11, 0x31, 0x51, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56,
+    0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67,
+    0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x26, 0x15, 0xea, 0x59, 0x56, 0x7a, 0x65,
+    0x14, 0xc5, 0x53, 0xc1, 0x73, 0x05, 0x52, 0x55, 0x45, 0x55, 0x31, 0x00, 0x40, 0x45, 0x44, 0x44,
+    0x51, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79,
+    0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59,
+    0xe6, 0x97, 0x54, 0xa8, 0x67, 0x59, 0xe9, 0x95, 0x51, 0x54, 0x4c, 0x05, 0xcf, 0x15, 0x48, 0x55,
+    0x15, 0x55, 0xc5, 0x00, 0x00, 0x15, 0x11, 0x11, 0x45, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a,
+    0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a,
+    0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0x5f, 0x52, 0xa1, 0x92, 0x65, 0xa5, 0x57,
+    0x46, 0x51, 0x85, 0x15, 0x3c, 0x57, 0x22, 0x55, 0x55, 0x55, 0x15, 0x03, 0x00, 0x54, 0x44, 0x44,
+    0x14, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97,
+    0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94,
+    0x65, 0xbe, 0x4f, 0x85, 0x3a, 0xfa, 0xfe, 0xee, 0xef, 0x2c, 0x9f, 0xf0, 0xfb, 0xce, 0xaf, 0xf2,
+    0xff, 0xff, 0xff, 0x0f, 0x00, 0xf0, 0x33, 0x33, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2,
+    0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5,
+    0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0xe8, 0xfb, 0x7b,
+    0xa5, 0xf3, 0xfc, 0xc2, 0xcf, 0x7b, 0x85, 0xca, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xc0, 0xcf, 0xcc,
+    0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e,
+    0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49,
+    0x59, 0xe6, 0xfb, 0x54, 0xa8, 0xa3, 0xef, 0xef, 0x95, 0xce, 0xf3, 0x4f, 0x3c, 0xcf, 0x15, 0x28,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x33, 0x33, 0x4f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a,
+    0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57,
+    0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0xbe, 0xbf,
+    0x57, 0x3a, 0xcf, 0x3f, 0xc5, 0x3c, 0x57, 0x20, 0xfc, 0xff, 0xfc, 0xff, 0x03, 0x00, 0xfc, 0xcc,
+    0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9,
+    0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96,
+    0x94, 0x65, 0xbe, 0x4f, 0x85, 0x3a, 0xfa, 0xfe, 0x5e, 0xe9, 0x3c, 0xff, 0x54, 0xf0, 0x5c, 0x81,
+    0xf0, 0xff, 0xf1, 0xff, 0x0f, 0x00, 0xf0, 0x33, 0x31, 0xf3, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa,
+    0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e,
+    0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0x58, 0xfa,
+    0x7b, 0x65, 0x94, 0xfc, 0x5b, 0xc1, 0x73, 0x25, 0x5a, 0x55, 0xc5, 0xff, 0x3f, 0x00, 0x40, 0x45,
+    0xc4, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92,
+    0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f,
+    0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8, 0x63, 0xe9, 0xef, 0x95, 0x51, 0xf2, 0x6f, 0x45, 0xcc, 0x95,
+    0x68, 0x55, 0x15, 0xff, 0xff, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x79, 0x55, 0xb9, 0x7f, 0xa6,
+    0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9,
+    0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0xa5,
+    0xbf, 0x57, 0x46, 0xc9, 0xbf, 0x15, 0x05, 0x57, 0xa2, 0x55, 0x55, 0xfc, 0xff, 0x03, 0x00, 0x54,
+    0x44, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f,
+    0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff,
+    0x96, 0x94, 0x65, 0x7e, 0x49, 0x85, 0x4a, 0x96, 0x95, 0x5e, 0x19, 0x45, 0x95, 0x5a, 0xf0, 0x5c,
+    0xa9, 0x54, 0x55, 0x55, 0x55, 0x0c, 0x00, 0x50, 0x11, 0x11, 0x51, 0x94, 0x57, 0x95, 0xfb, 0x67,
+    0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97,
+    0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x25, 0x15, 0x2a, 0x59,
+    0x56, 0x7a, 0x65, 0x14, 0x55, 0x6a, 0xc1, 0x47, 0xa5, 0x52, 0x55, 0x55, 0x55, 0x31, 0x00, 0x40,
+    0x45, 0x44, 0x44, 0x51, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2,
+    0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff,
+    0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8, 0xa3, 0xef, 0xef, 0xbe, 0xce, 0xf2, 0xa9, 0xbf, 0xef,
+    0xfc, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x33, 0x33, 0x4f, 0x79, 0x55, 0xb9, 0x7f,
+    0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f,
+    0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e,
+    0xbe, 0xbf, 0x7b, 0x3a, 0xcb, 0xa7, 0xfe, 0xbe, 0xc7, 0xab, 0xfc, 0xff, 0xff, 0xff, 0x03, 0x00,
+    0xfc, 0xcc, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29,
+    0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff,
+    0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f, 0x85, 0x3a, 0xfa, 0xfe, 0x6e, 0xe9, 0x2c, 0x9f, 0xfa, 0xfb,
+    0x5e, 0xac, 0xf2, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xf0, 0x33, 0x33, 0xf3, 0x94, 0x57, 0x95, 0xfb,
+    0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff,
+    0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea,
+    0xe8, 0xfb, 0x7b, 0xa5, 0xb3, 0x7c, 0xea, 0xef, 0x7b, 0x85, 0xca, 0xff, 0xff, 0xff, 0x3f, 0x00,
+    0xc0, 0xcf, 0xcc, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95,
+    0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe,
+    0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8, 0x63, 0xe9, 0xef, 0x95, 0x51, 0xf2, 0xab, 0x85,
+    0xef, 0x95, 0x68, 0x55, 0x15, 0xff, 0xff, 0x00, 0x00, 0x15, 0x11, 0x33, 0x4f, 0x79, 0x55, 0xb9,
+    0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff,
+    0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0x5f, 0x52, 0xa1,
+    0x92, 0xa5, 0xaf, 0x57, 0x46, 0x59, 0xa5, 0x1e, 0xbe, 0x57, 0x8a, 0x55, 0x55, 0x55, 0xfc, 0x03,
+    0x00, 0x54, 0x44, 0x44, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55,
+    0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8,
+    0xff, 0xff, 0x96, 0x94, 0x65, 0x7e, 0x49, 0x85, 0x4a, 0x96, 0x95, 0x5e, 0x19, 0x45, 0x95, 0x7a,
+    0xf8, 0x5e, 0xa9, 0x54, 0x55, 0x55, 0x55, 0x0c, 0x00, 0x50, 0x11, 0x11, 0x51, 0x94, 0x57, 0x95,
+    0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa,
+    0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15,
+    0xea, 0xe8, 0xfb, 0x7b, 0xa5, 0x93, 0x7c, 0xea, 0xef, 0x7b, 0xa5, 0xca, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0xc0, 0xcf, 0xcc, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e,
+    0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85,
+    0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8, 0xa3, 0xef, 0xef, 0x95, 0x4e, 0xf2, 0xa9,
+    0xbf, 0xef, 0x95, 0x6a, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1f, 0x33, 0x33, 0x4f, 0x79, 0x55,
+    0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9,
+    0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53,
+    0xa1, 0x8e, 0xae, 0xbf, 0x57, 0x7a, 0xc9, 0xa7, 0xfe, 0xbe, 0x57, 0xaa, 0xc5, 0xff, 0xff, 0xff,
+    0x03, 0x00, 0x5c, 0xcc, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5,
+    0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56,
+    0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f, 0x85, 0x3a, 0x9a, 0xfe, 0x5e, 0xe9, 0x25, 0x9f,
+    0xfa, 0xfb, 0x5e, 0xa9, 0x56, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x50, 0x31, 0x33, 0xf3, 0x94, 0x57,
+    0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a,
+    0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e,
+    0x15, 0xea, 0x58, 0xfa, 0x7b, 0xa5, 0x97, 0x7c, 0xea, 0xef, 0x7b, 0xa5, 0x5a, 0xc5, 0xff, 0xff,
+    0x3f, 0x00, 0x40, 0xc5, 0xcc, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56,
+    0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a,
+    0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8, 0x63, 0xe9, 0xef, 0x95, 0x52, 0xf2,
+    0xa9, 0xbf, 0xef, 0x95, 0x6a, 0x55, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x15, 0x31, 0x33, 0x4f, 0x79,
+    0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae,
+    0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0xef,
+    0x53, 0xa1, 0x8e, 0xa5, 0xbf, 0x57, 0x46, 0xc9, 0xa7, 0xfe, 0xbe, 0x57, 0xaa, 0x55, 0xc5, 0xff,
+    0xff, 0x03, 0x00, 0x54, 0xc4, 0xcc, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f,
+    0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5,
+    0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f, 0x85, 0x3a, 0x96, 0xfe, 0x5e, 0x19, 0x25,
+    0x9f, 0xfa, 0xf8, 0x5e, 0xa9, 0x56, 0x55, 0xfc, 0xff, 0x0f, 0x00, 0x50, 0x11, 0x31, 0xf3, 0x94,
+    0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef,
+    0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9,
+    0x3e, 0x15, 0xea, 0x58, 0xfa, 0x7b, 0x65, 0x94, 0x7c, 0xea, 0xe1, 0x7b, 0xa5, 0x5a, 0x55, 0xc5,
+    0xff, 0x3f, 0x00, 0x40, 0x45, 0xc4, 0xcc, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9,
+    0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51,
+    0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xbb, 0x54, 0xa8, 0x67, 0xe9, 0xef, 0x95, 0x51,
+    0x72, 0xa9, 0x87, 0xef, 0x95, 0x6a, 0x55, 0x55, 0xfc, 0xff, 0x00, 0x00, 0x15, 0x11, 0x31, 0x4f,
+    0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1,
+    0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99,
+    0x6f, 0x52, 0xa1, 0x9e, 0xa5, 0xbf, 0x57, 0x46, 0x49, 0xa5, 0x1e, 0xbe, 0x57, 0xaa, 0x55, 0x55,
+    0xc5, 0xff, 0x03, 0x00, 0x54, 0x44, 0xc4, 0x3c, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95,
+    0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19,
+    0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0x7e, 0x49, 0x85, 0x7a, 0x96, 0xfe, 0x5e, 0x19,
+    0x25, 0x95, 0x7a, 0xf8, 0x5e, 0xa9, 0x56, 0x55, 0x55, 0xfc, 0x0f, 0x00, 0x50, 0x11, 0x11, 0xf1,
+    0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e,
+    0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96,
+    0xf9, 0x25, 0x15, 0x2a, 0x59, 0xfa, 0x7a, 0x65, 0x94, 0x55, 0xea, 0xe1, 0x7b, 0xa5, 0x5a, 0x55,
+    0x55, 0xc5, 0x3f, 0x00, 0x40, 0x45, 0x44, 0xc4, 0x53, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a,
+    0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e,
+    0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0x97, 0x54, 0xa8, 0x64, 0xe9, 0xe9, 0x95,
+    0x51, 0x56, 0xa9, 0x87, 0xef, 0x95, 0x6a, 0x55, 0x55, 0x55, 0xfc, 0x00, 0x00, 0x15, 0x11, 0x11,
+    0x47, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5,
+    0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65,
+    0x99, 0x5f, 0x52, 0xa1, 0x92, 0xa5, 0xa5, 0x57, 0x46, 0x59, 0xa5, 0x1e, 0xbe, 0x57, 0xaa, 0x55,
+    0x55, 0x55, 0xc5, 0x03, 0x00, 0x54, 0x44, 0x44, 0x14, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8,
+    0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9,
+    0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0x7e, 0x49, 0x85, 0x4a, 0x96, 0x95, 0x5e,
+    0x19, 0x65, 0x95, 0x7a, 0xf8, 0x5e, 0xa9, 0x56, 0x55, 0x55, 0x55, 0x0c, 0x00, 0x50, 0x11, 0x11,
+    0x51, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4, 0x5f,
+    0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b, 0x52,
+    0x96, 0xf9, 0x25, 0x15, 0x2a, 0x59, 0x56, 0x7a, 0x65, 0x94, 0x55, 0xea, 0xe1, 0x7b, 0xa5, 0x5a,
+    0x55, 0x55, 0x55, 0x05, 0x00, 0x40, 0x45, 0x44, 0x44, 0x51, 0x5e, 0x55, 0xee, 0x9f, 0xa9, 0x8a,
+    0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa, 0x95,
+    0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8, 0xa3, 0xef, 0xef,
+    0x95, 0x4e, 0xf2, 0xa9, 0xbf, 0xef, 0x95, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0xff, 0x7f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b, 0xfa,
+    0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf, 0x25,
+    0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0xa5, 0xbf, 0x57, 0x7a, 0xc9, 0xa7, 0xfe, 0xbe, 0x57, 0xaa,
+    0x55, 0xfe, 0xff, 0xff, 0x03, 0x00, 0x55, 0xfc, 0xff, 0xff, 0xe5, 0x55, 0xe5, 0xfe, 0x99, 0xaa,
+    0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5, 0x5f,
+    0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f, 0x85, 0x3a, 0x96, 0xfe,
+    0x5e, 0x19, 0x25, 0x9f, 0xfa, 0xfb, 0x5e, 0xa9, 0x56, 0x95, 0xff, 0xff, 0x0f, 0x00, 0x54, 0x15,
+    0xff, 0xff, 0x97, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc, 0xa4,
+    0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff, 0x5b,
+    0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0x58, 0xfa, 0x7b, 0x65, 0x94, 0x7c, 0xea, 0xe1, 0x7b, 0xa5,
+    0x5a, 0x55, 0xe5, 0xff, 0x3f, 0x00, 0x50, 0x55, 0xc5, 0xff, 0x5f, 0x5e, 0x55, 0xee, 0x9f, 0xa9,
+    0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f, 0xfa,
+    0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0x9b, 0x54, 0xa8, 0x67, 0xe9,
+    0xef, 0x95, 0x51, 0x52, 0xa9, 0x87, 0xef, 0x95, 0x6a, 0x55, 0x55, 0xf9, 0xff, 0x00, 0x40, 0x55,
+    0x55, 0xf1, 0x7f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca, 0x4b,
+    0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff, 0xbf,
+    0x25, 0x65, 0x99, 0x5f, 0x52, 0xa1, 0x92, 0xa5, 0xaf, 0x57, 0x46, 0x59, 0xa5, 0x1e, 0xbe, 0x57,
+    0xaa, 0x55, 0x55, 0x55, 0xfe, 0x03, 0x00, 0x55, 0x55, 0x55, 0xfc, 0xe5, 0x55, 0xe5, 0xfe, 0x99,
+    0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff, 0xa5,
+    0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0x7e, 0x49, 0x85, 0x4a, 0x96,
+    0x95, 0x5e, 0x19, 0x65, 0x95, 0x7a, 0xf8, 0x5e, 0xa9, 0x56, 0x55, 0x55, 0x55, 0x0e, 0x00, 0x54,
+    0x55, 0x55, 0x55, 0x94, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5, 0xbc,
+    0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff, 0xff,
+    0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0xe8, 0xfb, 0x7b, 0xa5, 0x93, 0x7c, 0xea, 0xef, 0x7b,
+    0xa5, 0xea, 0xef, 0xee, 0xee, 0xbb, 0xaa, 0xca, 0xff, 0xff, 0xff, 0x5f, 0x5e, 0x55, 0xee, 0x9f,
+    0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff, 0x5f,
+    0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8, 0xa3,
+    0xef, 0xef, 0x95, 0x4e, 0xf2, 0xa9, 0xbf, 0xef, 0x95, 0xaa, 0x9f, 0xbb, 0xbb, 0xef, 0xaa, 0x6a,
+    0xfc, 0xff, 0xff, 0x7f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55, 0xca,
+    0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa, 0xff,
+    0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0xae, 0xbf, 0x57, 0x7a, 0xc9, 0xa7, 0xfe, 0xbe,
+    0x57, 0xaa, 0x5e, 0xee, 0xee, 0xbe, 0xab, 0xaa, 0xc5, 0xff, 0xff, 0xff, 0xe5, 0x55, 0xe5, 0xfe,
+    0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe, 0xff,
+    0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f, 0x85, 0x3a,
+    0x9a, 0xfe, 0x5e, 0xe9, 0x25, 0x9f, 0xfa, 0xfb, 0x5e, 0xa9, 0x5a, 0xb9, 0xbb, 0xfb, 0xae, 0xaa,
+    0x56, 0xfc, 0xff, 0xff, 0x97, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57, 0xa5,
+    0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1, 0xff,
+    0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0x58, 0xfa, 0x7b, 0xa5, 0x97, 0x7c, 0xea, 0xef,
+    0x7b, 0xa5, 0x5a, 0xe5, 0xee, 0xee, 0xbb, 0xaa, 0x5a, 0xc5, 0xff, 0xff, 0x5f, 0x5e, 0x55, 0xee,
+    0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea, 0xff,
+    0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xfb, 0x54, 0xa8,
+    0x63, 0xe9, 0xef, 0x95, 0x52, 0xf2, 0xa9, 0xbf, 0xef, 0x95, 0x6a, 0x95, 0xb9, 0xbb, 0xef, 0xaa,
+    0x6a, 0x55, 0xfc, 0xff, 0x7f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79, 0x55,
+    0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15, 0xfa,
+    0xff, 0xbf, 0x25, 0x65, 0x99, 0xef, 0x53, 0xa1, 0x8e, 0xa5, 0xbf, 0x57, 0x46, 0xc9, 0xa7, 0xfe,
+    0xbe, 0x57, 0xaa, 0x55, 0xe5, 0xee, 0xbe, 0xab, 0xaa, 0x55, 0xc5, 0xff, 0xff, 0xe5, 0x55, 0xe5,
+    0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6, 0xfe,
+    0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0xbe, 0x4f, 0x85,
+    0x3a, 0x96, 0xfe, 0x5e, 0x19, 0x25, 0x9f, 0xfa, 0xf8, 0x5e, 0xa9, 0x56, 0x95, 0xb9, 0xfb, 0xae,
+    0xaa, 0x56, 0x55, 0xfc, 0xff, 0x97, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95, 0x57,
+    0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a, 0xa1,
+    0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x3e, 0x15, 0xea, 0x58, 0xfa, 0x7b, 0x65, 0x94, 0x7c, 0xea,
+    0xe1, 0x7b, 0xa5, 0x5a, 0x55, 0xe5, 0xee, 0xbb, 0xaa, 0x5a, 0x55, 0xc5, 0xff, 0x5f, 0x5e, 0x55,
+    0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b, 0xea,
+    0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0xbb, 0x54,
+    0xa8, 0x67, 0xe9, 0xef, 0x95, 0x51, 0x72, 0xa9, 0x87, 0xef, 0x95, 0x6a, 0x55, 0x95, 0xb9, 0xef,
+    0xaa, 0x6a, 0x55, 0x55, 0xfc, 0x7f, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b, 0x79,
+    0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9, 0x15,
+    0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0x6f, 0x52, 0xa1, 0x9e, 0xa5, 0xbf, 0x57, 0x46, 0x49, 0xa5,
+    0x1e, 0xbe, 0x57, 0xaa, 0x55, 0x55, 0xe5, 0xbe, 0xab, 0xaa, 0x55, 0x55, 0xc5, 0xff, 0xe5, 0x55,
+    0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb, 0xa6,
+    0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0x7e, 0x49,
+    0x85, 0x7a, 0x96, 0xfe, 0x5e, 0x19, 0x25, 0x95, 0x7a, 0xf8, 0x5e, 0xa9, 0x56, 0x55, 0x95, 0xf9,
+    0xae, 0xaa, 0x56, 0x55, 0x55, 0xfc, 0x97, 0x57, 0x95, 0xfb, 0x67, 0xaa, 0xa2, 0x56, 0xbe, 0x95,
+    0x57, 0xa5, 0xbc, 0xa4, 0x5f, 0x1e, 0xef, 0x9a, 0xfa, 0xff, 0x97, 0x7e, 0xa5, 0x67, 0x94, 0x5a,
+    0xa1, 0xff, 0xff, 0x5b, 0x52, 0x96, 0xf9, 0x25, 0x15, 0x2a, 0x59, 0xfa, 0x7a, 0x65, 0x94, 0x55,
+    0xea, 0xe1, 0x7b, 0xa5, 0x5a, 0x55, 0x55, 0xe5, 0xbb, 0xaa, 0x5a, 0x55, 0x55, 0xc5, 0x5f, 0x5e,
+    0x55, 0xee, 0x9f, 0xa9, 0x8a, 0x5a, 0xf9, 0x56, 0x5e, 0x95, 0xf2, 0x92, 0x7e, 0x79, 0xbc, 0x6b,
+    0xea, 0xff, 0x5f, 0xfa, 0x95, 0x9e, 0x51, 0x6a, 0x85, 0xfe, 0xff, 0x6f, 0x49, 0x59, 0xe6, 0x97,
+    0x54, 0xa8, 0x64, 0xe9, 0xe9, 0x95, 0x51, 0x56, 0xa9, 0x87, 0xef, 0x95, 0x6a, 0x55, 0x55, 0x95,
+    0xe7, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x7c, 0x79, 0x55, 0xb9, 0x7f, 0xa6, 0x2a, 0x6a, 0xe5, 0x5b,
+    0x79, 0x55, 0xca, 0x4b, 0xfa, 0xe5, 0xf1, 0xae, 0xa9, 0xff, 0x7f, 0xe9, 0x57, 0x7a, 0x46, 0xa9,
+    0x15, 0xfa, 0xff, 0xbf, 0x25, 0x65, 0x99, 0x5f, 0x52, 0xa1, 0x92, 0xa5, 0xa5, 0x57, 0x46, 0x59,
+    0xa5, 0x1e, 0xbe, 0x57, 0xaa, 0x55, 0x55, 0x55, 0x96, 0xab, 0xaa, 0x55, 0x55, 0x55, 0xc5, 0xe5,
+    0x55, 0xe5, 0xfe, 0x99, 0xaa, 0xa8, 0x95, 0x6f, 0xe5, 0x55, 0x29, 0x2f, 0xe9, 0x97, 0xc7, 0xbb,
+    0xa6, 0xfe, 0xff, 0xa5, 0x5f, 0xe9, 0x19, 0xa5, 0x56, 0xe8, 0xff, 0xff, 0x96, 0x94, 0x65, 0x7e,
+    0x49, 0x85, 0x4a, 0x96, 0x95, 0x5e, 0x19, 0x65, 0x95, 0x7a, 0xf8, 0x5e, 0xa9, 0x56, 0x55, 0x55,
+    0x55, 0xae, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x00
+};
+
+static_assert(sizeof(route_ranks) == ROUTE_MAPS * ROUTE_WIDTH * ROUTE_HEIGHT * sizeof(uint16_t), "Route table size mismatch");
@@ -0,0 +1,42 @@
+/*
+ * Phantom Slayer
+ * Route tables
+ *
+ * GENERATED by tools/route-compiler from the map pack -- do not edit
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _ROUTES_DATA_HEADER_
+#define _ROUTES_DATA_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+// The tables are good only for the map pack that
+// has this size and checksum (32-bit FNV-1a)
+#define ROUTE_PACK_BYTES        400
+#define ROUTE_PACK_CHECKSUM     0x48537B54
+#define ROUTE_MAPS              6
+#define ROUTE_WIDTH             20
+#define ROUTE_HEIGHT            20
+#define ROUTE_NO_SQUARE         0xFFFF
+
+
+/*
+ *      GLOBALS
+ */
+// Each map's corridor squares, and where its table starts in 'route_hops'
+extern const uint16_t   route_counts[];
+extern const uint32_t   route_offsets[];
+// Each map's squares' numbers, by row, or 'ROUTE_NO_SQUARE' for walls
+extern const uint16_t   route_ranks[];
+// The steps: see 'tools/route_compiler.cpp'
+extern const uint8_t    route_hops[];
+
+
+#endif  // _ROUTES_DATA_HEADER_
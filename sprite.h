@@ -0,0 +1,58 @@
+/*
+ * Phantom Slayer
+ * Sprite sheet formats
+ *
+ * Sheets are compiled from the images in 'assets/' by the asset
+ * compiler in 'tools/'. A 'raw' sheet keeps every pixel. An 'rle'
+ * sheet keeps only the non-transparent rows of each frame, each row
+ * being a run count followed by that many runs, each run being:
+ *
+ *   skip, count, count pixels
+ *
+ * where 'skip' is the number of transparent pixels before the run
+ * and 'count' has `RLE_BLEND` set if the run's pixels are partly
+ * transparent and must be blended rather than copied.
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _SPRITE_FORMAT_HEADER_
+#define _SPRITE_FORMAT_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+#define RLE_BLEND               0x8000
+#define RLE_COUNT_MASK          0x7FFF
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+// Where a frame sits in its sheet
+typedef struct {
+    uint8_t                 x;
+    uint8_t                 y;
+    uint8_t                 width;
+    uint8_t                 height;
+} SpriteFrame;
+
+// Which of an 'rle' sheet's rows belong to a frame
+typedef struct {
+    uint16_t                first_row;      // Index in 'rows' of the frame's top stored row
+    uint8_t                 top;            // Transparent rows trimmed from the top
+    uint8_t                 rows;           // Rows stored
+} RleFrame;
+
+typedef struct {
+    const uint16_t*         rows;           // Offset of each stored row in 'data'
+    const uint16_t*         data;
+    const RleFrame*         frames;
+} RleSheet;
+
+
+#endif  // _SPRITE_FORMAT_HEADER_
@@ -0,0 +1,242 @@
+/*
+ * Phantom Slayer
+ * Phantom swarms
+ *
+ * A swarm is many more Phantoms than the game's own, held as a
+ * structure of arrays rather than as `Phantom` objects, and moved
+ * together by one pass over the arrays. Swarm Phantoms move just as
+ * `Phantom::move()` moves the game's, by the same decision tables,
+ * but a swarm has its own occupancy bitboard, so no move has to scan
+ * the other Phantoms
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+
+
+/*
+ *      EXTERNALLY-DEFINED GLOBALS
+ */
+extern Game         game;
+
+
+/*
+ *      GLOBALS
+ */
+// The swarm's Phantoms, by field. Phantom i is at
+// (swarm_x[i], swarm_y[i]), or off the board at `NOT_ON_BOARD`
+uint16_t        swarm_x[SWARM_CAPACITY];
+uint16_t        swarm_y[SWARM_CAPACITY];
+int8_t          swarm_hp[SWARM_CAPACITY];
+uint8_t         swarm_direction[SWARM_CAPACITY];
+uint8_t         swarm_back_steps[SWARM_CAPACITY];
+uint16_t        swarm_count = 0;
+static_assert(SWARM_CAPACITY < SWARM_NONE, "Swarm too large");
+
+// Which squares the swarm's Phantoms are on, a bit per
+// square, by row, like the map's occupancy bitboard
+uint32_t        swarm_occupied[MAP_SIZE_MAX * MAP_SIZE_MAX / 32];
+
+
+namespace Swarm {
+
+
+/*
+ *      STATIC PROTOTYPES
+ */
+static bool     is_occupied(uint32_t square);
+static void     set_occupied(uint32_t square, bool is_taken);
+
+
+/**
+    Remove every Phantom from the swarm.
+ */
+void clear() {
+    swarm_count = 0;
+    memset(swarm_occupied, 0, sizeof(swarm_occupied));
+}
+
+
+/**
+    Add Phantoms to the swarm, each on a clear square that no other
+    is on, away from the player where there's room.
+
+    - Parameters:
+        - number: How many Phantoms to add.
+        - hp:     Their hit points.
+
+    - Returns: The number added, which is fewer than asked for if
+               the swarm is full or no free square could be found.
+ */
+uint16_t populate(uint16_t number, int8_t hp) {
+    const uint8_t tries = 16;
+    uint16_t added = 0;
+
+    while (added < number && swarm_count < SWARM_CAPACITY) {
+        // Draw squares until one is free of the swarm: first away
+        // from the player, as the game's Phantoms are placed, then
+        // anywhere at all
+        uint16_t x = NOT_ON_BOARD;
+        uint16_t y = NOT_ON_BOARD;
+        for (uint8_t i = 0 ; i < (tries << 1) ; ++i) {
+            uint16_t new_x, new_y;
+            if (!Map::pick_clear_square(game.player.x, game.player.y, i < tries ? 4 : 0, false, &new_x, &new_y)) break;
+            if (!is_occupied((uint32_t)new_y * MAP_SIZE_MAX + new_x)) {
+                x = new_x;
+                y = new_y;
+                break;
+            }
+        }
+
+        if (x == NOT_ON_BOARD) break;
+
+        uint16_t i = swarm_count++;
+        swarm_x[i] = x;
+        swarm_y[i] = y;
+        swarm_hp[i] = hp;
+        swarm_direction[i] = DIRECTION_NORTH;
+        swarm_back_steps[i] = 0;
+        set_occupied((uint32_t)y * MAP_SIZE_MAX + x, true);
+        ++added;
+    }
+
+    #ifdef DEBUG
+    if (added < number) printf("SWARM PLACED %i OF %i\n", added, number);
+    #endif
+
+    return added;
+}
+
+
+/**
+    Move every Phantom in the swarm one square, in order, the way
+    `Phantom::move()` moves one of the game's Phantoms, stopping if
+    one of them has caught the player.
+
+    - Returns: The index of the Phantom that caught the player,
+               or `SWARM_NONE`.
+ */
+uint16_t move() {
+    uint16_t player_x = game.player.x;
+    uint16_t player_y = game.player.y;
+
+    for (uint16_t i = 0 ; i < swarm_count ; ++i) {
+        uint16_t x = swarm_x[i];
+        uint16_t y = swarm_y[i];
+        if (x == NOT_ON_BOARD || swarm_hp[i] < 1) continue;
+
+        int16_t dx = x - player_x;
+        int16_t dy = y - player_y;
+        if (dx == 0 && dy == 0) return i;
+
+        // The exits with no other Phantom beyond them
+        uint32_t square = (uint32_t)y * MAP_SIZE_MAX + x;
+        uint8_t exits = Map::get_exits(x, y);
+        uint8_t available = exits;
+        if ((exits & PHANTOM_NORTH) && is_occupied(square - MAP_SIZE_MAX)) available &= ~PHANTOM_NORTH;
+        if ((exits & PHANTOM_EAST) && is_occupied(square + 1)) available &= ~PHANTOM_EAST;
+        if ((exits & PHANTOM_SOUTH) && is_occupied(square + MAP_SIZE_MAX)) available &= ~PHANTOM_SOUTH;
+        if ((exits & PHANTOM_WEST) && is_occupied(square - 1)) available &= ~PHANTOM_WEST;
+        if (available == 0) continue;
+
+        // Where the Phantom would like to go, and the way it goes
+        uint8_t favoured = Phantom::favour(dx, dy, available, Pursuit::closer_exits(x, y), swarm_direction[i], &swarm_back_steps[i]);
+        uint8_t direction = Phantom::pick_direction(available, favoured, swarm_direction[i], &swarm_back_steps[i]);
+
+        // Make the move
+        uint16_t new_x = x + (direction == PHANTOM_EAST ? 1 : 0) - (direction == PHANTOM_WEST ? 1 : 0);
+        uint16_t new_y = y + (direction == PHANTOM_SOUTH ? 1 : 0) - (direction == PHANTOM_NORTH ? 1 : 0);
+        set_occupied(square, false);
+        set_occupied((uint32_t)new_y * MAP_SIZE_MAX + new_x, true);
+        swarm_x[i] = new_x;
+        swarm_y[i] = new_y;
+        swarm_direction[i] = direction;
+    }
+
+    return SWARM_NONE;
+}
+
+
+/**
+    Return the number of Phantoms in the swarm.
+ */
+uint16_t count() {
+    return swarm_count;
+}
+
+
+/**
+    Is there a swarm Phantom on the specified square?
+
+    - Returns: The Phantom's index in the swarm, or `SWARM_NONE`
+               if the square is empty or off the map.
+ */
+uint16_t phantom_on_square(uint16_t x, uint16_t y) {
+    if (x >= Map::width() || y >= Map::height() || !is_occupied((uint32_t)y * MAP_SIZE_MAX + x)) return SWARM_NONE;
+    for (uint16_t i = 0 ; i < swarm_count ; ++i) {
+        if (swarm_x[i] == x && swarm_y[i] == y) return i;
+    }
+
+    return SWARM_NONE;
+}
+
+
+#ifdef DEBUG
+/**
+    Check the swarm's occupancy bitboard against its Phantoms:
+    every Phantom's square should be marked, and nothing else.
+
+    - Returns: The number of squares found to be wrong.
+ */
+uint32_t check_occupancy() {
+    uint32_t errors = 0;
+    uint32_t squares = 0;
+    for (uint16_t i = 0 ; i < swarm_count ; ++i) {
+        if (swarm_x[i] >= Map::width() || swarm_y[i] >= Map::height()) continue;
+        if (!is_occupied((uint32_t)swarm_y[i] * MAP_SIZE_MAX + swarm_x[i])) {
+            printf("BAD SWARM OCCUPANCY: %i, %i NOT MARKED\n", swarm_x[i], swarm_y[i]);
+            ++errors;
+        }
+
+        ++squares;
+    }
+
+    uint32_t marked = 0;
+    for (size_t i = 0 ; i < sizeof(swarm_occupied) / sizeof(swarm_occupied[0]) ; ++i) marked += __builtin_popcount(swarm_occupied[i]);
+    if (marked != squares) {
+        printf("BAD SWARM OCCUPANCY: %lu SQUARES MARKED, NOT %lu\n", marked, squares);
+        errors += (marked > squares ? marked - squares : squares - marked);
+    }
+
+    return errors;
+}
+#endif
+
+
+/*
+    Is a square, as `y * MAP_SIZE_MAX + x`, marked in the
+    swarm's occupancy bitboard?
+ */
+static bool is_occupied(uint32_t square) {
+    return (swarm_occupied[square >> 5] >> (square & 31)) & 1;
+}
+
+
+/*
+    Mark or clear a square, as `y * MAP_SIZE_MAX + x`,
+    in the swarm's occupancy bitboard.
+ */
+static void set_occupied(uint32_t square, bool is_taken) {
+    if (is_taken) {
+        swarm_occupied[square >> 5] |= (1u << (square & 31));
+    } else {
+        swarm_occupied[square >> 5] &= ~(1u << (square & 31));
+    }
+}
+
+
+}   // namespace Swarm
@@ -0,0 +1,43 @@
+/*
+ * Phantom Slayer
+ * Phantom swarms
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _SWARM_HEADER_
+#define _SWARM_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+// The most Phantoms a swarm may have. Its storage takes
+// seven bytes a Phantom, plus an occupancy bitboard
+#ifndef SWARM_CAPACITY
+#define SWARM_CAPACITY              1024
+#endif
+
+// No Phantom, eg. because none caught the player
+#define SWARM_NONE                  0xFFFF
+
+
+/*
+ *      PROTOTYPES
+ */
+namespace Swarm {
+    void            clear();
+    uint16_t        populate(uint16_t number, int8_t hp);
+    uint16_t        move();
+    uint16_t        count();
+    uint16_t        phantom_on_square(uint16_t x, uint16_t y);
+#ifdef DEBUG
+    uint32_t        check_occupancy();
+#endif
+}
+
+
+#endif  // _SWARM_HEADER_
@@ -0,0 +1,512 @@
+/*
+ * Phantom Slayer
+ * Asset compiler
+ *
+ * Reads the art manifest and the PNG images it lists, and writes the
+ * game's asset source and header: each sheet in its flash format,
+ * its frame table, and a size report. Fails if any sheet, or all of
+ * them together, exceed their flash budgets.
+ *
+ * Usage: asset-compiler <manifest> <source out> <header out>
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <png.h>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+
+/*
+ *      CONSTANTS
+ */
+#define RLE_BLEND               0x8000
+#define MAX_RLE_WORDS           0xFFFF
+#define VALUES_PER_LINE         16
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint32_t                x;
+    uint32_t                y;
+    uint32_t                width;
+    uint32_t                height;
+} SheetFrame;
+
+typedef struct {
+    uint32_t                first_row;
+    uint32_t                top;
+    uint32_t                rows;
+} RleFrame;
+
+typedef struct {
+    string                  name;
+    string                  image;
+    string                  format;
+    uint32_t                budget;
+    vector<SheetFrame>      frames;
+
+    uint32_t                width;
+    uint32_t                height;
+    vector<uint16_t>        pixels;
+
+    vector<uint16_t>        rle_rows;
+    vector<uint16_t>        rle_data;
+    vector<RleFrame>        rle_frames;
+    uint32_t                flash_size;
+} Sheet;
+
+
+/*
+ *      PROTOTYPES
+ */
+bool        load_manifest(const string& path, vector<Sheet>* sheets, uint32_t* budget);
+bool        load_image(const string& path, Sheet* sheet);
+bool        encode_rle(Sheet* sheet);
+void        size_sheet(Sheet* sheet);
+bool        report(const vector<Sheet>& sheets, uint32_t budget, string* text);
+bool        write_source(const string& path, const vector<Sheet>& sheets, uint32_t budget, const string& report_text);
+bool        write_header(const string& path, const vector<Sheet>& sheets);
+void        write_values(std::ostream& out, const vector<uint16_t>& values);
+string      upper(const string& text);
+uint8_t     pixel_class(uint16_t pixel);
+
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        fprintf(stderr, "Usage: asset-compiler <manifest> <source out> <header out>\n");
+        return 1;
+    }
+
+    vector<Sheet> sheets;
+    uint32_t budget = 0;
+    if (!load_manifest(argv[1], &sheets, &budget)) return 1;
+
+    // Images are named relative to the manifest
+    string base = argv[1];
+    size_t slash = base.find_last_of('/');
+    base = (slash == string::npos) ? "" : base.substr(0, slash + 1);
+
+    for (Sheet& sheet : sheets) {
+        if (!load_image(base + sheet.image, &sheet)) return 1;
+        if (sheet.format == "rle" && !encode_rle(&sheet)) return 1;
+        size_sheet(&sheet);
+    }
+
+    string report_text;
+    bool in_budget = report(sheets, budget, &report_text);
+    printf("%s", report_text.c_str());
+    if (!in_budget) {
+        fprintf(stderr, "[ERROR] Art exceeds its flash budget\n");
+        return 1;
+    }
+
+    if (!write_source(argv[2], sheets, budget, report_text)) return 1;
+    if (!write_header(argv[3], sheets)) return 1;
+    return 0;
+}
+
+
+/**
+    Read the manifest: the overall budget, and each sheet
+    with its frames.
+
+    - Parameters:
+        - path:   The manifest's path.
+        - sheets: The sheets to fill in.
+        - budget: The overall flash budget to fill in.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool load_manifest(const string& path, vector<Sheet>* sheets, uint32_t* budget) {
+    std::ifstream in(path);
+    if (!in) {
+        fprintf(stderr, "[ERROR] Can't open manifest %s\n", path.c_str());
+        return false;
+    }
+
+    string line;
+    uint32_t line_number = 0;
+    while (std::getline(in, line)) {
+        ++line_number;
+        size_t hash = line.find('#');
+        if (hash != string::npos) line = line.substr(0, hash);
+
+        std::istringstream words(line);
+        string keyword;
+        if (!(words >> keyword)) continue;
+
+        bool ok = false;
+        if (keyword == "budget") {
+            ok = (bool)(words >> *budget);
+        } else if (keyword == "sheet") {
+            Sheet sheet;
+            ok = (bool)(words >> sheet.name >> sheet.image >> sheet.format >> sheet.budget);
+            ok = ok && (sheet.format == "raw" || sheet.format == "rle");
+            if (ok) sheets->push_back(sheet);
+        } else if (keyword == "frame" && !sheets->empty()) {
+            SheetFrame frame;
+            ok = (bool)(words >> frame.x >> frame.y >> frame.width >> frame.height);
+            if (ok) sheets->back().frames.push_back(frame);
+        }
+
+        if (!ok) {
+            fprintf(stderr, "[ERROR] %s:%u: bad line\n", path.c_str(), line_number);
+            return false;
+        }
+    }
+
+    for (const Sheet& sheet : *sheets) {
+        if (sheet.format == "rle" && sheet.frames.empty()) {
+            fprintf(stderr, "[ERROR] Sheet %s: 'rle' sheets need frames\n", sheet.name.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/**
+    Load a PNG into a sheet as PicoSystem colours: 4 bits per
+    channel, stored in the order green, blue, alpha, red from the
+    top nibble down.
+
+    - Parameters:
+        - path:  The image's path.
+        - sheet: The sheet to fill in.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool load_image(const string& path, Sheet* sheet) {
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path.c_str())) {
+        fprintf(stderr, "[ERROR] Can't read %s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+
+    image.format = PNG_FORMAT_RGBA;
+    vector<uint8_t> rgba(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, nullptr, rgba.data(), 0, nullptr)) {
+        fprintf(stderr, "[ERROR] Can't decode %s: %s\n", path.c_str(), image.message);
+        return false;
+    }
+
+    sheet->width = image.width;
+    sheet->height = image.height;
+    sheet->pixels.resize(image.width * image.height);
+    for (size_t i = 0 ; i < sheet->pixels.size() ; ++i) {
+        const uint8_t* p = &rgba[i * 4];
+        uint16_t r = (p[0] * 15 + 127) / 255;
+        uint16_t g = (p[1] * 15 + 127) / 255;
+        uint16_t b = (p[2] * 15 + 127) / 255;
+        uint16_t a = (p[3] * 15 + 127) / 255;
+        sheet->pixels[i] = r | (a << 4) | (b << 8) | (g << 12);
+    }
+
+    for (const SheetFrame& frame : sheet->frames) {
+        if (frame.x + frame.width > sheet->width || frame.y + frame.height > sheet->height || frame.width > 255 || frame.height > 255) {
+            fprintf(stderr, "[ERROR] Sheet %s: frame at %u,%u is out of bounds\n", sheet->name.c_str(), frame.x, frame.y);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/**
+    Run-length encode a sheet's frames, dropping any fully transparent
+    rows at the top and bottom of each.
+
+    - Parameters:
+        - sheet: The sheet to encode.
+
+    - Returns: `true` on success, `false` if the data is too large
+               for 16-bit row offsets.
+ */
+bool encode_rle(Sheet* sheet) {
+    for (const SheetFrame& frame : sheet->frames) {
+        // Trim the frame's empty rows
+        uint32_t top = frame.height;
+        uint32_t bottom = 0;
+        for (uint32_t y = 0 ; y < frame.height ; ++y) {
+            const uint16_t* row = &sheet->pixels[(frame.y + y) * sheet->width + frame.x];
+            for (uint32_t x = 0 ; x < frame.width ; ++x) {
+                if (pixel_class(row[x]) != 0) {
+                    if (y < top) top = y;
+                    bottom = y + 1;
+                    break;
+                }
+            }
+        }
+
+        if (top > bottom) top = bottom;
+        RleFrame rle_frame = {(uint32_t)sheet->rle_rows.size(), top, bottom - top};
+        sheet->rle_frames.push_back(rle_frame);
+
+        for (uint32_t y = top ; y < bottom ; ++y) {
+            const uint16_t* row = &sheet->pixels[(frame.y + y) * sheet->width + frame.x];
+            size_t run_count_at = sheet->rle_data.size();
+            sheet->rle_rows.push_back(run_count_at);
+            sheet->rle_data.push_back(0);
+
+            uint32_t x = 0;
+            uint32_t skip = 0;
+            while (x < frame.width) {
+                uint8_t kind = pixel_class(row[x]);
+                if (kind == 0) {
+                    ++skip;
+                    ++x;
+                    continue;
+                }
+
+                uint32_t end = x + 1;
+                while (end < frame.width && pixel_class(row[end]) == kind) ++end;
+                sheet->rle_data.push_back(skip);
+                sheet->rle_data.push_back((end - x) | (kind == 2 ? RLE_BLEND : 0));
+                for (uint32_t i = x ; i < end ; ++i) sheet->rle_data.push_back(row[i]);
+                sheet->rle_data[run_count_at]++;
+                skip = 0;
+                x = end;
+            }
+        }
+    }
+
+    if (sheet->rle_data.size() > MAX_RLE_WORDS) {
+        fprintf(stderr, "[ERROR] Sheet %s: encoded data too large for 16-bit row offsets\n", sheet->name.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+
+/**
+    Work out how much flash a sheet takes, tables included.
+
+    - Parameters:
+        - sheet: The sheet to size.
+ */
+void size_sheet(Sheet* sheet) {
+    // SpriteFrame is 4 bytes, as is RleFrame
+    sheet->flash_size = sheet->frames.size() * 4;
+    if (sheet->format == "rle") {
+        sheet->flash_size += (sheet->rle_rows.size() + sheet->rle_data.size()) * 2 + sheet->rle_frames.size() * 4;
+    } else {
+        sheet->flash_size += sheet->pixels.size() * 2;
+    }
+}
+
+
+/**
+    Build the size report.
+
+    - Parameters:
+        - sheets: The compiled sheets.
+        - budget: The overall flash budget.
+        - text:   The report to fill in.
+
+    - Returns: `true` if every budget is met, otherwise `false`.
+ */
+bool report(const vector<Sheet>& sheets, uint32_t budget, string* text) {
+    char line[128];
+    bool ok = true;
+    uint32_t total = 0;
+
+    snprintf(line, sizeof(line), "%-10s %-6s %9s %8s %8s %8s\n", "SHEET", "FORMAT", "SIZE", "IMAGE", "FLASH", "BUDGET");
+    *text = line;
+    for (const Sheet& sheet : sheets) {
+        char size[16];
+        snprintf(size, sizeof(size), "%ux%u", sheet.width, sheet.height);
+        snprintf(line, sizeof(line), "%-10s %-6s %9s %8u %8u %8u%s\n", sheet.name.c_str(), sheet.format.c_str(), size,
+                 (uint32_t)sheet.pixels.size() * 2, sheet.flash_size, sheet.budget, sheet.flash_size > sheet.budget ? "  OVER" : "");
+        *text += line;
+        total += sheet.flash_size;
+        if (sheet.flash_size > sheet.budget) ok = false;
+    }
+
+    snprintf(line, sizeof(line), "%-10s %-6s %9s %8s %8u %8u%s\n", "TOTAL", "", "", "", total, budget, total > budget ? "  OVER" : "");
+    *text += line;
+    return ok && total <= budget;
+}
+
+
+/**
+    Write the asset source file.
+
+    - Parameters:
+        - path:        The file's path.
+        - sheets:      The compiled sheets.
+        - budget:      The overall flash budget.
+        - report_text: The size report, which heads the file.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool write_source(const string& path, const vector<Sheet>& sheets, uint32_t budget, const string& report_text) {
+    std::ofstream out(path);
+    if (!out) {
+        fprintf(stderr, "[ERROR] Can't write %s\n", path.c_str());
+        return false;
+    }
+
+    out << "/*\n * Phantom Slayer\n * Image assets file\n *\n";
+    out << " * GENERATED by tools/asset-compiler from assets/assets.txt -- do not edit\n *\n";
+    std::istringstream lines(report_text);
+    string line;
+    while (std::getline(lines, line)) out << " * " << line << "\n";
+    out << " *\n * @version     1.1.2\n * @author      smittytone\n * @copyright   2021, Tony Smith\n * @licence     MIT\n *\n */\n";
+    out << "#include \"main.h\"\n";
+
+    string budget_sum;
+    for (const Sheet& sheet : sheets) {
+        string title = upper(sheet.name) + " SPRITES";
+        string sum;
+        out << "\n\n/*\n *      " << title << "\n */\n";
+
+        if (!sheet.frames.empty()) {
+            out << "const SpriteFrame " << sheet.name << "_frames[] = {\n";
+            for (size_t i = 0 ; i < sheet.frames.size() ; ++i) {
+                const SheetFrame& f = sheet.frames[i];
+                out << "    {" << f.x << ", " << f.y << ", " << f.width << ", " << f.height << "}" << (i + 1 < sheet.frames.size() ? ",\n" : "\n");
+            }
+
+            out << "};\n\n";
+            sum = "sizeof(" + sheet.name + "_frames)";
+        }
+
+        if (sheet.format == "rle") {
+            out << "const RleFrame " << sheet.name << "_rle_frames[] = {\n";
+            for (size_t i = 0 ; i < sheet.rle_frames.size() ; ++i) {
+                const RleFrame& f = sheet.rle_frames[i];
+                out << "    {" << f.first_row << ", " << f.top << ", " << f.rows << "}" << (i + 1 < sheet.rle_frames.size() ? ",\n" : "\n");
+            }
+
+            out << "};\n\nconst uint16_t " << sheet.name << "_rle_rows[] = {\n";
+            write_values(out, sheet.rle_rows);
+            out << "};\n\nconst uint16_t " << sheet.name << "_rle_data[] = {\n";
+            write_values(out, sheet.rle_data);
+            out << "};\n\nconst RleSheet " << sheet.name << "_sheet = {" << sheet.name << "_rle_rows, " << sheet.name << "_rle_data, " << sheet.name << "_rle_frames};\n";
+            sum += " + sizeof(" + sheet.name + "_rle_frames) + sizeof(" + sheet.name + "_rle_rows) + sizeof(" + sheet.name + "_rle_data)";
+        } else {
+            out << "const uint16_t " << sheet.name << "_sprites[] = {\n";
+            write_values(out, sheet.pixels);
+            out << "};\n";
+            sum += (sum.empty() ? "" : " + ") + string("sizeof(") + sheet.name + "_sprites)";
+        }
+
+        out << "\nstatic_assert(" << sum << " <= " << sheet.budget << ", \"" << sheet.name << " sprites exceed their flash budget\");\n";
+        budget_sum += (budget_sum.empty() ? "" : "\n              + ") + sum;
+    }
+
+    out << "\n\n/*\n *      BUDGET\n */\n";
+    out << "static_assert(" << budget_sum << "\n              <= " << budget << ", \"Sprites exceed their flash budget\");\n";
+    return (bool)out;
+}
+
+
+/**
+    Write the asset header file.
+
+    - Parameters:
+        - path:   The file's path.
+        - sheets: The compiled sheets.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool write_header(const string& path, const vector<Sheet>& sheets) {
+    std::ofstream out(path);
+    if (!out) {
+        fprintf(stderr, "[ERROR] Can't write %s\n", path.c_str());
+        return false;
+    }
+
+    out << "/*\n * Phantom Slayer\n * Image assets\n *\n";
+    out << " * GENERATED by tools/asset-compiler from assets/assets.txt -- do not edit\n *\n";
+    out << " * @version     1.1.2\n * @author      smittytone\n * @copyright   2021, Tony Smith\n * @licence     MIT\n *\n */\n";
+    out << "#ifndef _IMAGE_ASSETS_HEADER_\n#define _IMAGE_ASSETS_HEADER_\n\n\n";
+
+    char line[128];
+    out << "/*\n *      CONSTANTS\n */\n";
+    for (const Sheet& sheet : sheets) {
+        string name = upper(sheet.name);
+        snprintf(line, sizeof(line), "#define %-23s %u\n", (name + "_SHEET_WIDTH").c_str(), sheet.width);
+        out << line;
+        snprintf(line, sizeof(line), "#define %-23s %u\n", (name + "_SHEET_HEIGHT").c_str(), sheet.height);
+        out << line;
+        if (!sheet.frames.empty()) {
+            snprintf(line, sizeof(line), "#define %-23s %u\n", (name + "_FRAMES").c_str(), (uint32_t)sheet.frames.size());
+            out << line;
+        }
+
+        out << "\n";
+    }
+
+    out << "\n/*\n *      GLOBALS\n */\n";
+    for (const Sheet& sheet : sheets) {
+        if (!sheet.frames.empty()) {
+            snprintf(line, sizeof(line), "extern const %-12s %s_frames[];\n", "SpriteFrame", sheet.name.c_str());
+            out << line;
+        }
+
+        if (sheet.format == "rle") {
+            snprintf(line, sizeof(line), "extern const %-12s %s_sheet;\n", "RleSheet", sheet.name.c_str());
+        } else {
+            snprintf(line, sizeof(line), "extern const %-12s %s_sprites[];\n", "uint16_t", sheet.name.c_str());
+        }
+
+        out << line;
+    }
+
+    out << "\n\n#endif  // _IMAGE_ASSETS_HEADER_\n";
+    return (bool)out;
+}
+
+
+/*
+    Write an array's values, `VALUES_PER_LINE` to a line.
+ */
+void write_values(std::ostream& out, const vector<uint16_t>& values) {
+    char value[16];
+    for (size_t i = 0 ; i < values.size() ; ++i) {
+        if (i % VALUES_PER_LINE == 0) out << "    ";
+        snprintf(value, sizeof(value), "0x%04x", values[i]);
+        out << value;
+        if (i + 1 < values.size()) out << ((i % VALUES_PER_LINE == VALUES_PER_LINE - 1) ? ",\n" : ", ");
+    }
+
+    out << "\n";
+}
+
+
+string upper(const string& text) {
+    string result = text;
+    for (char& c : result) c = toupper(c);
+    return result;
+}
+
+
+/*
+    Pixel classes: transparent pixels are skipped, opaque ones
+    copied and the rest blended.
+ */
+uint8_t pixel_class(uint16_t pixel) {
+    uint8_t alpha = (pixel >> 4) & 0x0F;
+    return alpha == 0 ? 0 : (alpha == 0x0F ? 1 : 2);
+}
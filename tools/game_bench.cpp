@@ -0,0 +1,83 @@
+/*
+ * Phantom Slayer
+ * Host benchmarks
+ *
+ * Runs the game's benchmarks (see bench.cpp) on the host, where
+ * core 1 is a thread, so they can be compared without a device:
+ * 'bands' times whole frames drawn by both workers for each band
+ * count, 'view' the span renderer against the original
+ * primitive-by-primitive path, and 'step' the in-between views of a
+ * step against a view at rest. 'walls' checks the view distance
+ * look-up against walking the map, and times both. 'occupancy' checks
+ * the Phantom occupancy grid against scanning the Phantoms, and times
+ * both. 'sizes' times the parts of a frame that look at the map, on
+ * maps up to the largest. 'placement' checks and times placing
+ * Phantoms by the free-cell index, against drawing random squares.
+ * 'pursuit' times the Phantoms' distance field and compares the ways
+ * they can chase the player. 'swarm' times a move cycle for more and
+ * more Phantoms, as a swarm and as objects. 'schedule' compares the
+ * Phantoms' cost frame by frame with their moves all due together and
+ * spread across the move period. 'decisions' checks the Phantoms'
+ * table-driven moves against the branches they replaced, as well as
+ * timing both. With no argument, all of them run.
+ *
+ * Usage: game-bench [bands|view|step|walls|occupancy|sizes|placement|pursuit|swarm|schedule|decisions]
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    const char*             name;
+    void                    (*run)();
+} Benchmark;
+
+
+/*
+ *      PROTOTYPES
+ */
+void        init();
+
+
+int main(int argc, char* argv[]) {
+    const Benchmark benchmarks[] = {
+        {"bands",     Bench::bands},
+        {"view",      Bench::view},
+        {"step",      Bench::step},
+        {"walls",     Bench::walls},
+        {"occupancy", Bench::occupancy},
+        {"sizes",     Bench::sizes},
+        {"placement", Bench::placement},
+        {"pursuit",   Bench::pursuit},
+        {"swarm",     Bench::swarm},
+        {"schedule",  Bench::schedule},
+        {"decisions", Bench::decisions}
+    };
+
+    const Benchmark* chosen = nullptr;
+    if (argc > 1) {
+        for (const Benchmark& b : benchmarks) {
+            if (strcmp(argv[1], b.name) == 0) chosen = &b;
+        }
+
+        if (chosen == nullptr) {
+            fprintf(stderr, "Usage: game-bench [bands|view|step|walls|occupancy|sizes|placement|pursuit|swarm|schedule|decisions]\n");
+            return 1;
+        }
+    }
+
+    init();
+    for (const Benchmark& b : benchmarks) {
+        if (chosen == nullptr || chosen == &b) b.run();
+    }
+
+    return 0;
+}
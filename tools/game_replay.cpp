@@ -0,0 +1,251 @@
+/*
+ * Phantom Slayer
+ * Fixed-clock replay check
+ *
+ * Plays the game on the host from the intro screen against a fake
+ * clock, with the same scripted input, once for each of a range of
+ * update() periods, and checks that every run leaves the game in the
+ * same state: the game runs in fixed steps (see `update()` in
+ * main.cpp), so how often it's called must not change how it plays.
+ * Each run is a separate process, so each starts from a clean game.
+ *
+ * Usage: game-replay [steps]
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <string>
+#include <vector>
+#include "main.h"
+#include "host.h"
+
+using namespace picosystem;
+
+
+/*
+ *      EXTERNALLY-DEFINED GLOBALS
+ */
+extern Game         game;
+extern tinymt32_t   tinymt_store;
+
+
+/*
+ *      CONSTANTS
+ */
+// Input changes only on the step after every this many, so that
+// every period below starts an `update()` call on the step it changes
+#define INPUT_STEPS         20
+
+// State hashes are compared every this many steps
+#define CHECK_STEPS         100
+
+#define START_TIME_US       1000000
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint32_t                pressed;
+    bool                    is_fire_held;
+} Input;
+
+
+/*
+ *      PROTOTYPES
+ */
+void        init();
+void        update(uint32_t tick_ms);
+void        draw(uint32_t tick_ms);
+int         play(uint32_t period, uint32_t steps);
+bool        replay(const char* tool, uint32_t period, uint32_t steps, std::vector<std::string>* trace);
+Input       scripted_input(uint32_t step);
+uint64_t    hash_state();
+uint64_t    mix(uint64_t hash, uint64_t value);
+
+
+int main(int argc, char* argv[]) {
+    // Internal: play one run and print its state hashes
+    if (argc > 3 && strcmp(argv[1], "--period") == 0) {
+        return play(strtoul(argv[2], nullptr, 0), strtoul(argv[3], nullptr, 0));
+    }
+
+    uint32_t steps = argc > 1 ? strtoul(argv[1], nullptr, 0) : 60000;
+    steps -= (steps % CHECK_STEPS);
+    if (steps == 0) {
+        fprintf(stderr, "Usage: game-replay [steps]\n");
+        return 1;
+    }
+
+    // The first period is the step itself: the others must match it.
+    // They all start a call on the step after every INPUT_STEPS-th,
+    // and run at most SIM_MAX_STEPS steps a call
+    const uint32_t periods[] = {SIM_STEP_US, 10000, 16667, 25000, 40000, 50000, 80000};
+    std::vector<std::string> expected;
+    uint32_t errors = 0;
+
+    for (uint32_t period : periods) {
+        std::vector<std::string> trace;
+        if (!replay(argv[0], period, steps, &trace)) {
+            printf("%6u us: run failed\n", period);
+            ++errors;
+            continue;
+        }
+
+        if (expected.empty()) expected = trace;
+        size_t i = 0;
+        while (i < trace.size() && i < expected.size() && trace[i] == expected[i]) ++i;
+        if (i == expected.size() && i == trace.size()) {
+            printf("%6u us: %s\n", period, trace.back().c_str());
+        } else {
+            printf("%6u us: differs from step %u\n", period, (uint32_t)(i * CHECK_STEPS));
+            ++errors;
+        }
+    }
+
+    printf("REPLAY: %u steps, %u runs differ\n", steps, errors);
+    return errors == 0 ? 0 : 1;
+}
+
+
+/*
+    Play the game for a number of steps, calling `update()` and
+    `draw()` once every period, and print a hash of the game state
+    every CHECK_STEPS steps.
+
+    - Parameters:
+        - period: The time between calls, in us.
+        - steps:  The number of steps to play.
+
+    - Returns: The process exit code.
+ */
+int play(uint32_t period, uint32_t steps) {
+    Host::set_time(START_TIME_US);
+    init();
+
+    uint64_t elapsed = 0;
+    uint32_t done = 0;
+    uint32_t tick = 0;
+    while (done < steps) {
+        elapsed += period;
+        uint32_t due = elapsed / SIM_STEP_US;
+
+        // Only a call that runs a step takes input, and the step
+        // it goes to is the first one the call runs
+        Input input = {0, false};
+        if (due > done) input = scripted_input(done + 1);
+        Host::set_buttons(input.pressed, input.is_fire_held ? (1u << A) : 0);
+        Host::set_time(START_TIME_US + elapsed);
+        update(tick);
+        draw(tick);
+        ++tick;
+
+        for (uint32_t s = done + 1 ; s <= due ; ++s) {
+            if (s % CHECK_STEPS == 0) printf("STATE %u %016llx\n", s, (unsigned long long)hash_state());
+        }
+
+        done = due;
+    }
+
+    return 0;
+}
+
+
+/*
+    Run `play()` in a new process and collect its hashes.
+
+    - Parameters:
+        - tool:   This tool's path.
+        - period: The time between calls, in us.
+        - steps:  The number of steps to play.
+        - trace:  The step numbers and hashes, one per line.
+
+    - Returns: Whether the run completed.
+ */
+bool replay(const char* tool, uint32_t period, uint32_t steps, std::vector<std::string>* trace) {
+    std::string command = std::string(tool) + " --period " + std::to_string(period) + " " + std::to_string(steps);
+    FILE* run = popen(command.c_str(), "r");
+    if (run == nullptr) return false;
+
+    // The game may print too: keep just the hashes
+    char line[128];
+    while (fgets(line, sizeof(line), run) != nullptr) {
+        if (strncmp(line, "STATE ", 6) != 0) continue;
+        line[strcspn(line, "\n")] = 0;
+        trace->push_back(line + 6);
+    }
+
+    return pclose(run) == 0 && trace->size() == steps / CHECK_STEPS;
+}
+
+
+/*
+    The input for a step, which changes only on the first step of each
+    INPUT_STEPS: now and then a tapped key, and the fire button, held
+    down for a while at a time.
+
+    - Parameters:
+        - step: The step number.
+
+    - Returns: The buttons tapped, and whether fire is held.
+ */
+Input scripted_input(uint32_t step) {
+    const uint32_t keys[] = {UP, UP, UP, DOWN, LEFT, RIGHT, B, X, Y};
+    uint32_t block = (step - 1) / INPUT_STEPS;
+    uint64_t roll = mix(0xC0FFEE, block);
+    uint64_t hold = mix(0xF1BE, block / 4);
+
+    Input input;
+    input.pressed = 0;
+    if ((step - 1) % INPUT_STEPS == 0 && (roll & 0x03) != 0) input.pressed = 1u << keys[(roll >> 8) % 9];
+    input.is_fire_held = (hold % 3 == 0) && (block % 4 != 3);
+    return input;
+}
+
+
+/*
+    Hash the game state the simulation owns -- not what the
+    renderer writes back, such as 'dirty' or 'crosshair_delta'.
+
+    - Returns: The hash.
+ */
+uint64_t hash_state() {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    hash = mix(hash, game.clock);
+    hash = mix(hash, game.state);
+    hash = mix(hash, game.player.x | (game.player.y << 16) | ((uint64_t)game.player.direction << 32));
+    hash = mix(hash, game.level | (game.score << 16) | ((uint64_t)game.kills << 32) | ((uint64_t)game.level_kills << 48));
+    hash = mix(hash, game.level_hits | (game.map << 16) | (game.audio_range << 24));
+    hash = mix(hash, game.tele_x | (game.tele_y << 16));
+    hash = mix(hash, game.can_fire | (game.show_reticule << 1) | (game.is_firing << 2));
+    hash = mix(hash, game.zap_charge_time);
+    hash = mix(hash, game.zap_fire_time);
+    hash = mix(hash, game.last_phantom_move);
+    for (const Phantom& p : game.phantoms) {
+        hash = mix(hash, p.x | (p.y << 16) | ((uint64_t)(uint8_t)p.hp << 32) | ((uint64_t)p.direction << 40));
+        hash = mix(hash, p.next_move);
+    }
+
+    for (uint8_t i = 0 ; i < 4 ; ++i) hash = mix(hash, tinymt_store.status[i]);
+    return hash;
+}
+
+
+/*
+    Fold a value into a hash.
+
+    - Parameters:
+        - hash:  The hash so far.
+        - value: The value to add.
+
+    - Returns: The new hash.
+ */
+uint64_t mix(uint64_t hash, uint64_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+    hash ^= hash >> 31;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    return hash ^ (hash >> 29);
+}
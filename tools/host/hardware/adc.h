@@ -0,0 +1,16 @@
+/*
+ * Phantom Slayer
+ * Host stand-in for the Pico SDK's ADC header, which the game
+ * includes but doesn't yet use
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _HOST_ADC_HEADER_
+#define _HOST_ADC_HEADER_
+
+
+#endif  // _HOST_ADC_HEADER_
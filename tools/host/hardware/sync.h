@@ -0,0 +1,23 @@
+/*
+ * Phantom Slayer
+ * Host stand-in for the Pico SDK's core sync header
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _HOST_SYNC_HEADER_
+#define _HOST_SYNC_HEADER_
+
+
+/*
+ *      PROTOTYPES
+ */
+// On the host, waiting for an event just yields
+void        __wfe();
+void        __sev();
+
+
+#endif  // _HOST_SYNC_HEADER_
@@ -0,0 +1,27 @@
+/*
+ * Phantom Slayer
+ * Host controls for the stand-in SDK
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _HOST_HEADER_
+#define _HOST_HEADER_
+
+#include <cstdint>
+
+
+/*
+ *      PROTOTYPES
+ */
+namespace Host {
+    void        set_time(uint64_t now);
+    void        use_real_time();
+    void        set_buttons(uint32_t pressed, uint32_t held);
+}
+
+
+#endif  // _HOST_HEADER_
@@ -0,0 +1,353 @@
+/*
+ * Phantom Slayer
+ * Host stand-in for the PicoSystem SDK
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "picosystem.hpp"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include "host.h"
+
+
+/*
+ *      GLOBALS
+ */
+// A frozen clock, or the real one while `use_fixed_time` is unset
+std::atomic<uint64_t>   fixed_time {0};
+std::atomic<bool>       use_fixed_time {false};
+
+// The buttons tapped and held, as bits by `button` number
+uint32_t                buttons_pressed = 0;
+uint32_t                buttons_held = 0;
+
+
+/*
+ *      PICO SDK FUNCTIONS
+ */
+uint32_t time_us_32() {
+    return (uint32_t)time_us_64();
+}
+
+
+uint64_t time_us_64() {
+    if (use_fixed_time.load(std::memory_order_acquire)) return fixed_time.load(std::memory_order_relaxed);
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+void sleep_ms(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+
+void sleep_us(uint64_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+
+void stdio_init_all() {
+}
+
+
+void __wfe() {
+    std::this_thread::yield();
+}
+
+
+void __sev() {
+}
+
+
+void multicore_launch_core1(void (*entry)(void)) {
+    std::thread(entry).detach();
+}
+
+
+namespace Host {
+
+
+/**
+    Stop the clock at a given time: `time_us_64()` returns it until
+    it's set again.
+
+    - Parameters:
+        - now: The time in microseconds.
+ */
+void set_time(uint64_t now) {
+    fixed_time.store(now, std::memory_order_relaxed);
+    use_fixed_time.store(true, std::memory_order_release);
+}
+
+
+/**
+    Go back to the real clock.
+ */
+void use_real_time() {
+    use_fixed_time.store(false, std::memory_order_release);
+}
+
+
+/**
+    Set the buttons the game will read.
+
+    - Parameters:
+        - pressed: The buttons tapped, as bits by `button` number.
+        - held:    The buttons down.
+ */
+void set_buttons(uint32_t pressed, uint32_t held) {
+    buttons_pressed = pressed;
+    buttons_held = held;
+}
+
+
+}   // namespace Host
+
+
+namespace picosystem {
+
+
+/*
+ *      GLOBALS
+ */
+color_t         screen_data[240 * 240];
+buffer_t        screen_buffer = {240, 240, screen_data, false};
+buffer_t*       SCREEN = &screen_buffer;
+buffer_t*       _dt = &screen_buffer;
+color_t         _pen = 0;
+blend_func_t    _bf = COPY;
+int32_t         _cx = 0, _cy = 0, _cw = 240, _ch = 240;
+
+
+/*
+ *      STATIC PROTOTYPES
+ */
+static void     plot(int32_t x, int32_t y, color_t colour);
+
+
+void pen(color_t p) {
+    _pen = p;
+}
+
+
+void pen(int32_t r, int32_t g, int32_t b) {
+    _pen = (r & 0x0F) | 0xF0 | ((b & 0x0F) << 8) | ((g & 0x0F) << 12);
+}
+
+
+void clip() {
+    clip(0, 0, _dt->w, _dt->h);
+}
+
+
+void clip(int32_t x, int32_t y, int32_t w, int32_t h) {
+    _cx = x;
+    _cy = y;
+    _cw = w;
+    _ch = h;
+}
+
+
+void blend(blend_func_t bf) {
+    _bf = bf;
+}
+
+
+void target() {
+    _dt = SCREEN;
+}
+
+
+void target(buffer_t* dt) {
+    _dt = dt;
+}
+
+
+void cursor(int32_t x, int32_t y) {
+}
+
+
+void clear() {
+    for (int32_t i = 0 ; i < _dt->w * _dt->h ; ++i) _dt->data[i] = _pen;
+}
+
+
+void pixel(int32_t x, int32_t y) {
+    plot(x, y, _pen);
+}
+
+
+void hline(int32_t x, int32_t y, int32_t l) {
+    for (int32_t i = 0 ; i < l ; ++i) plot(x + i, y, _pen);
+}
+
+
+void rect(int32_t x, int32_t y, int32_t w, int32_t h) {
+    hline(x, y, w);
+    hline(x, y + h - 1, w);
+    for (int32_t i = 0 ; i < h ; ++i) {
+        plot(x, y + i, _pen);
+        plot(x + w - 1, y + i, _pen);
+    }
+}
+
+
+void frect(int32_t x, int32_t y, int32_t w, int32_t h) {
+    for (int32_t j = 0 ; j < h ; ++j) hline(x, y + j, w);
+}
+
+
+void fcircle(int32_t cx, int32_t cy, int32_t r) {
+    for (int32_t y = -r ; y <= r ; ++y) {
+        for (int32_t x = -r ; x <= r ; ++x) {
+            if (x * x + y * y <= r * r) plot(cx + x, cy + y, _pen);
+        }
+    }
+}
+
+
+void fpoly(const std::initializer_list<int32_t>& pts) {
+    // Scan-line fill, even-odd
+    std::vector<int32_t> p(pts);
+    int32_t n = p.size() / 2;
+    int32_t min_y = INT32_MAX;
+    int32_t max_y = INT32_MIN;
+    for (int32_t i = 0 ; i < n ; ++i) {
+        min_y = std::min(min_y, p[i * 2 + 1]);
+        max_y = std::max(max_y, p[i * 2 + 1]);
+    }
+
+    for (int32_t y = min_y ; y <= max_y ; ++y) {
+        std::vector<int32_t> nodes;
+        for (int32_t i = 0, j = n - 1 ; i < n ; j = i++) {
+            int32_t xi = p[i * 2], yi = p[i * 2 + 1];
+            int32_t xj = p[j * 2], yj = p[j * 2 + 1];
+            if ((yi < y && yj >= y) || (yj < y && yi >= y)) {
+                nodes.push_back(xi + (int32_t)((float)(y - yi) / (float)(yj - yi) * (float)(xj - xi)));
+            }
+        }
+
+        std::sort(nodes.begin(), nodes.end());
+        for (size_t k = 0 ; k + 1 < nodes.size() ; k += 2) hline(nodes[k], y, nodes[k + 1] - nodes[k] + 1);
+    }
+}
+
+
+void line(int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    // Bresenham
+    int32_t dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
+    int32_t dy = -abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
+    int32_t err = dx + dy;
+    while (true) {
+        plot(x1, y1, _pen);
+        if (x1 == x2 && y1 == y2) break;
+        int32_t e2 = err * 2;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += sx;
+        }
+
+        if (e2 <= dx) {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+
+void blit(buffer_t* src, int32_t sx, int32_t sy, int32_t w, int32_t h, int32_t dx, int32_t dy, uint32_t flags) {
+    for (int32_t j = 0 ; j < h ; ++j) {
+        for (int32_t i = 0 ; i < w ; ++i) {
+            color_t c = *src->p(sx + i, sy + j);
+            if (_bf == COPY || (c & 0xF0)) plot(dx + i, dy + j, c);
+        }
+    }
+}
+
+
+void blit(buffer_t* src, int32_t sx, int32_t sy, int32_t sw, int32_t sh, int32_t dx, int32_t dy, int32_t dw, int32_t dh, uint32_t flags) {
+    for (int32_t j = 0 ; j < dh ; ++j) {
+        for (int32_t i = 0 ; i < dw ; ++i) {
+            color_t c = *src->p(sx + i * sw / dw, sy + j * sh / dh);
+            if (c & 0xF0) plot(dx + i, dy + j, c);
+        }
+    }
+}
+
+
+void text(const std::string& t) {
+}
+
+
+void measure(const std::string& t, int32_t& w, int32_t& h, uint32_t wrap) {
+    w = t.size() * 6;
+    h = 8;
+}
+
+
+buffer_t* buffer(uint32_t w, uint32_t h, void* data) {
+    buffer_t* b = new buffer_t;
+    b->w = w;
+    b->h = h;
+    b->data = data ? (color_t*)data : new color_t[w * h];
+    b->alloc = (data == nullptr);
+    return b;
+}
+
+
+void COPY(color_t* src, uint32_t sc, color_t* dst, uint32_t c) {
+}
+
+
+void ALPHA(color_t* src, uint32_t sc, color_t* dst, uint32_t c) {
+}
+
+
+voice_t voice(uint32_t attack, uint32_t decay, uint32_t sustain, uint32_t release) {
+    return {attack, decay, sustain, release};
+}
+
+
+void play(voice_t v, uint32_t frequency, uint32_t duration, uint32_t volume) {
+}
+
+
+bool pressed(uint32_t b) {
+    return (buttons_pressed >> b) & 1;
+}
+
+
+bool button(uint32_t b) {
+    return (buttons_held >> b) & 1;
+}
+
+
+void led(uint8_t r, uint8_t g, uint8_t b) {
+}
+
+
+void backlight(uint8_t b) {
+}
+
+
+/*
+    Set a pixel of the draw target, within the clip rectangle.
+ */
+static void plot(int32_t x, int32_t y, color_t colour) {
+    if (x < _cx || y < _cy || x >= _cx + _cw || y >= _cy + _ch) return;
+    if (x < 0 || y < 0 || x >= _dt->w || y >= _dt->h) return;
+    _dt->data[x + y * _dt->w] = colour;
+}
+
+
+}   // namespace picosystem
@@ -0,0 +1,22 @@
+/*
+ * Phantom Slayer
+ * Host stand-in for the Pico SDK's multicore header
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _HOST_MULTICORE_HEADER_
+#define _HOST_MULTICORE_HEADER_
+
+
+/*
+ *      PROTOTYPES
+ */
+// On the host, core 1 is a thread
+void        multicore_launch_core1(void (*entry)(void));
+
+
+#endif  // _HOST_MULTICORE_HEADER_
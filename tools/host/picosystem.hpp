@@ -0,0 +1,118 @@
+/*
+ * Phantom Slayer
+ * Host stand-in for the PicoSystem SDK
+ *
+ * Just enough of the SDK's API for the game to build and run on the
+ * host, for the tools' tests and benchmarks: drawing goes to a plain
+ * 240 x 240 buffer, and the clock and buttons are set by `Host` (see
+ * `host.h`)
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _HOST_PICOSYSTEM_HEADER_
+#define _HOST_PICOSYSTEM_HEADER_
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <initializer_list>
+
+
+/*
+ *      PICO SDK PROTOTYPES
+ */
+uint32_t    time_us_32();
+uint64_t    time_us_64();
+void        sleep_ms(uint32_t ms);
+void        sleep_us(uint64_t us);
+void        stdio_init_all();
+
+
+namespace picosystem {
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef uint16_t color_t;
+
+struct buffer_t {
+    int32_t     w;
+    int32_t     h;
+    color_t*    data;
+    bool        alloc;
+
+    color_t* p(int32_t x, int32_t y) { return data + (x + y * w); }
+};
+
+typedef void (*blend_func_t)(color_t* src, uint32_t sc, color_t* dst, uint32_t c);
+
+struct voice_t {
+    uint32_t    attack;
+    uint32_t    decay;
+    uint32_t    sustain;
+    uint32_t    release;
+};
+
+enum button {
+    UP = 23, DOWN = 20, LEFT = 22, RIGHT = 21,
+    A = 18, B = 19, X = 17, Y = 16
+};
+
+
+/*
+ *      GLOBALS
+ */
+extern color_t          _pen;
+extern blend_func_t     _bf;
+extern buffer_t*        SCREEN;
+extern buffer_t*        _dt;
+extern int32_t          _cx, _cy, _cw, _ch;
+
+
+/*
+ *      PROTOTYPES
+ */
+void        pen(color_t p);
+void        pen(int32_t r, int32_t g, int32_t b);
+void        clip();
+void        clip(int32_t x, int32_t y, int32_t w, int32_t h);
+void        blend(blend_func_t bf);
+void        target();
+void        target(buffer_t* dt);
+void        cursor(int32_t x, int32_t y);
+
+void        clear();
+void        pixel(int32_t x, int32_t y);
+void        hline(int32_t x, int32_t y, int32_t l);
+void        rect(int32_t x, int32_t y, int32_t w, int32_t h);
+void        frect(int32_t x, int32_t y, int32_t w, int32_t h);
+void        fcircle(int32_t x, int32_t y, int32_t r);
+void        fpoly(const std::initializer_list<int32_t>& pts);
+void        line(int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+void        blit(buffer_t* src, int32_t sx, int32_t sy, int32_t w, int32_t h, int32_t dx, int32_t dy, uint32_t flags = 0);
+void        blit(buffer_t* src, int32_t sx, int32_t sy, int32_t sw, int32_t sh, int32_t dx, int32_t dy, int32_t dw, int32_t dh, uint32_t flags = 0);
+void        text(const std::string& t);
+void        measure(const std::string& t, int32_t& w, int32_t& h, uint32_t wrap = -1);
+buffer_t*   buffer(uint32_t w, uint32_t h, void* data = nullptr);
+
+void        COPY(color_t* src, uint32_t sc, color_t* dst, uint32_t c);
+void        ALPHA(color_t* src, uint32_t sc, color_t* dst, uint32_t c);
+
+voice_t     voice(uint32_t attack = 100, uint32_t decay = 50, uint32_t sustain = 80, uint32_t release = 100);
+void        play(voice_t v, uint32_t frequency, uint32_t duration = 500, uint32_t volume = 100);
+
+bool        pressed(uint32_t b);
+bool        button(uint32_t b);
+void        led(uint8_t r, uint8_t g, uint8_t b);
+void        backlight(uint8_t b);
+
+
+}   // namespace picosystem
+
+
+#endif  // _HOST_PICOSYSTEM_HEADER_
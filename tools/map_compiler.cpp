@@ -0,0 +1,437 @@
+/*
+ * Phantom Slayer
+ * Map compiler
+ *
+ * Reads the map list and writes the game's map pack source and header,
+ * and optionally the pack as a binary file. Or checks a binary pack.
+ * Either way, every map in the pack is checked and reported on, and
+ * the compiler fails if any is unplayable.
+ *
+ * Usage: map-compiler <maps> <source out> <header out> [pack out]
+ *        map-compiler --check <pack>
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "map_pack.h"
+
+using std::string;
+using std::vector;
+
+
+/*
+ *      CONSTANTS
+ */
+#define MAX_MAP_SIZE            1024
+#define VALUES_PER_LINE         16
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint16_t                start_x;
+    uint16_t                start_y;
+    vector<string>          rows;
+} SourceMap;
+
+
+/*
+ *      PROTOTYPES
+ */
+bool        load_maps(const string& path, uint16_t* width, uint16_t* height, vector<SourceMap>* maps);
+void        build_pack(uint16_t width, uint16_t height, const vector<SourceMap>& maps, vector<uint8_t>* pack);
+bool        check_pack(const uint8_t* pack, size_t size, string* text);
+uint32_t    count_areas(const uint8_t* pack, uint16_t index);
+bool        check_file(const string& path);
+bool        write_source(const string& path, const vector<uint8_t>& pack, const string& report_text);
+bool        write_header(const string& path, const vector<uint8_t>& pack);
+bool        write_pack(const string& path, const vector<uint8_t>& pack);
+
+
+int main(int argc, char* argv[]) {
+    if (argc == 3 && strcmp(argv[1], "--check") == 0) return check_file(argv[2]) ? 0 : 1;
+
+    if (argc != 4 && argc != 5) {
+        fprintf(stderr, "Usage: map-compiler <maps> <source out> <header out> [pack out]\n");
+        fprintf(stderr, "       map-compiler --check <pack>\n");
+        return 1;
+    }
+
+    uint16_t width = 0;
+    uint16_t height = 0;
+    vector<SourceMap> maps;
+    if (!load_maps(argv[1], &width, &height, &maps)) return 1;
+
+    // Check the pack as the game will see it
+    vector<uint8_t> pack;
+    build_pack(width, height, maps, &pack);
+    string report_text;
+    bool is_good = check_pack(pack.data(), pack.size(), &report_text);
+    printf("%s", report_text.c_str());
+    if (!is_good) return 1;
+
+    if (!write_source(argv[2], pack, report_text)) return 1;
+    if (!write_header(argv[3], pack)) return 1;
+    if (argc == 5 && !write_pack(argv[4], pack)) return 1;
+    return 0;
+}
+
+
+/**
+    Read the map list: the map size, then each map with its rows.
+
+    - Parameters:
+        - path:   The list's path.
+        - width:  The map width to fill in.
+        - height: The map height to fill in.
+        - maps:   The maps to fill in.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool load_maps(const string& path, uint16_t* width, uint16_t* height, vector<SourceMap>* maps) {
+    std::ifstream in(path);
+    if (!in) {
+        fprintf(stderr, "[ERROR] Can't open map list %s\n", path.c_str());
+        return false;
+    }
+
+    string line;
+    uint32_t line_number = 0;
+    while (std::getline(in, line)) {
+        ++line_number;
+
+        // Rows are read whole: '#' marks walls in them, not comments
+        if (!maps->empty() && maps->back().rows.size() < *height && !line.empty() && (line[0] == '#' || line[0] == '.')) {
+            if (line.size() != *width || line.find_first_not_of("#.") != string::npos) {
+                fprintf(stderr, "[ERROR] %s:%u: rows must be %u squares of '#' or '.'\n", path.c_str(), line_number, *width);
+                return false;
+            }
+
+            maps->back().rows.push_back(line);
+            continue;
+        }
+
+        size_t hash = line.find('#');
+        if (hash != string::npos) line = line.substr(0, hash);
+
+        std::istringstream words(line);
+        string keyword;
+        if (!(words >> keyword)) continue;
+
+        bool ok = false;
+        if (keyword == "size" && maps->empty()) {
+            uint32_t w = 0, h = 0;
+            ok = (bool)(words >> w >> h) && w > 0 && h > 0 && w <= MAX_MAP_SIZE && h <= MAX_MAP_SIZE;
+            *width = w;
+            *height = h;
+        } else if (keyword == "map" && *width > 0) {
+            ok = maps->empty() || maps->back().rows.size() == *height;
+            maps->push_back({MAP_PACK_NO_START, MAP_PACK_NO_START, {}});
+        } else if (keyword == "start" && !maps->empty() && maps->back().rows.empty()) {
+            uint32_t x = 0, y = 0;
+            ok = (bool)(words >> x >> y) && x < *width && y < *height;
+            maps->back().start_x = x;
+            maps->back().start_y = y;
+        }
+
+        if (!ok) {
+            fprintf(stderr, "[ERROR] %s:%u: bad line\n", path.c_str(), line_number);
+            return false;
+        }
+    }
+
+    if (maps->empty() || maps->back().rows.size() != *height) {
+        fprintf(stderr, "[ERROR] %s: no maps, or the last is short\n", path.c_str());
+        return false;
+    }
+
+    if (maps->size() > 0xFFFF) {
+        fprintf(stderr, "[ERROR] %s: too many maps\n", path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+
+/**
+    Pack the maps in the game's format: see 'map_pack.h'.
+
+    - Parameters:
+        - width:  The maps' width.
+        - height: The maps' height.
+        - maps:   The maps.
+        - pack:   The pack data to fill in.
+ */
+void build_pack(uint16_t width, uint16_t height, const vector<SourceMap>& maps, vector<uint8_t>* pack) {
+    MapPackHeader head = {MAP_PACK_MAGIC, MAP_PACK_VERSION, (uint16_t)maps.size(), width, height, MapPack::record_size(width, height)};
+    uint32_t row_bytes = (width + 7) >> 3;
+    pack->assign(sizeof(head) + maps.size() * head.record_size, 0);
+    memcpy(pack->data(), &head, sizeof(head));
+
+    uint8_t* record = pack->data() + sizeof(head);
+    for (const SourceMap& map : maps) {
+        MapPackMeta info = {map.start_x, map.start_y};
+        memcpy(record, &info, sizeof(info));
+
+        uint8_t* grid = record + sizeof(info);
+        for (uint16_t y = 0 ; y < height ; ++y) {
+            for (uint16_t x = 0 ; x < width ; ++x) {
+                if (map.rows[y][x] == '#') grid[y * row_bytes + (x >> 3)] |= (1 << (x & 7));
+            }
+        }
+
+        record += head.record_size;
+    }
+}
+
+
+/**
+    Validate a pack, then check each of its maps: every map needs
+    corridors, all of them joined up, and any start square must be
+    a corridor. Duplicate maps are flagged but allowed.
+
+    - Parameters:
+        - pack: The pack's data.
+        - size: The size of the data in bytes.
+        - text: A report on the pack to fill in.
+
+    - Returns: `true` if every map is playable, otherwise `false`.
+ */
+bool check_pack(const uint8_t* pack, size_t size, string* text) {
+    const char* error = nullptr;
+    if (!MapPack::validate(pack, size, &error)) {
+        fprintf(stderr, "[ERROR] Bad map pack: %s\n", error);
+        return false;
+    }
+
+    const MapPackHeader* head = MapPack::header(pack);
+    uint32_t grid_bytes = ((head->width + 7) >> 3) * head->height;
+    bool ok = true;
+    char line[128];
+
+    snprintf(line, sizeof(line), "MAPS: %u, %ux%u squares, %u bytes\n", head->count, head->width, head->height, (uint32_t)size);
+    *text = line;
+    snprintf(line, sizeof(line), "%-5s %8s %6s %9s  %s\n", "MAP", "CORRIDOR", "AREAS", "START", "NOTES");
+    *text += line;
+
+    for (uint16_t i = 0 ; i < head->count ; ++i) {
+        uint32_t clear = 0;
+        for (uint16_t y = 0 ; y < head->height ; ++y) {
+            for (uint16_t x = 0 ; x < head->width ; ++x) {
+                if (!MapPack::is_wall(pack, i, x, y)) ++clear;
+            }
+        }
+
+        uint32_t areas = count_areas(pack, i);
+        const MapPackMeta* info = MapPack::meta(pack, i);
+        char start[16] = "-";
+        if (info->start_x != MAP_PACK_NO_START) snprintf(start, sizeof(start), "%u,%u", info->start_x, info->start_y);
+
+        string notes;
+        if (clear == 0 || areas != 1) {
+            notes = clear == 0 ? "NO CORRIDORS" : "CORRIDORS NOT JOINED";
+            ok = false;
+        }
+
+        for (uint16_t j = 0 ; j < i ; ++j) {
+            if (memcmp(MapPack::grid(pack, i), MapPack::grid(pack, j), grid_bytes) == 0) {
+                notes += (notes.empty() ? "" : ", ") + string("same as map ") + std::to_string(j);
+                break;
+            }
+        }
+
+        snprintf(line, sizeof(line), "%-5u %8u %6u %9s%s%s\n", i, clear, areas, start, notes.empty() ? "" : "  ", notes.c_str());
+        *text += line;
+    }
+
+    if (!ok) fprintf(stderr, "[ERROR] Unplayable maps in the pack\n");
+    return ok;
+}
+
+
+/*
+    Count the separate corridor areas of one of a pack's maps.
+ */
+uint32_t count_areas(const uint8_t* pack, uint16_t index) {
+    const MapPackHeader* head = MapPack::header(pack);
+    uint16_t width = head->width;
+    uint16_t height = head->height;
+    vector<bool> seen((size_t)width * height, false);
+    vector<uint32_t> stack;
+    uint32_t areas = 0;
+
+    for (uint32_t square = 0 ; square < seen.size() ; ++square) {
+        if (seen[square] || MapPack::is_wall(pack, index, square % width, square / width)) continue;
+
+        // Flood the area from its first square
+        ++areas;
+        seen[square] = true;
+        stack.push_back(square);
+        while (!stack.empty()) {
+            uint32_t s = stack.back();
+            stack.pop_back();
+            uint16_t x = s % width;
+            uint16_t y = s / width;
+            const int32_t steps[4][2] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+            for (const auto& step : steps) {
+                int32_t nx = x + step[0];
+                int32_t ny = y + step[1];
+                if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+                uint32_t n = ny * width + nx;
+                if (seen[n] || MapPack::is_wall(pack, index, nx, ny)) continue;
+                seen[n] = true;
+                stack.push_back(n);
+            }
+        }
+    }
+
+    return areas;
+}
+
+
+/**
+    Check a binary pack, read in place as the game reads it.
+
+    - Parameters:
+        - path: The pack's path.
+
+    - Returns: `true` if the pack is good, otherwise `false`.
+ */
+bool check_file(const string& path) {
+    int file = open(path.c_str(), O_RDONLY);
+    struct stat info;
+    if (file < 0 || fstat(file, &info) != 0) {
+        fprintf(stderr, "[ERROR] Can't open map pack %s\n", path.c_str());
+        if (file >= 0) close(file);
+        return false;
+    }
+
+    size_t size = info.st_size;
+    void* data = size > 0 ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+    close(file);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "[ERROR] Can't map map pack %s\n", path.c_str());
+        return false;
+    }
+
+    string report_text;
+    bool is_good = check_pack((const uint8_t*)data, size, &report_text);
+    printf("%s", report_text.c_str());
+    munmap(data, size);
+    return is_good;
+}
+
+
+/**
+    Write the map pack source file.
+
+    - Parameters:
+        - path:        The file's path.
+        - pack:        The pack data.
+        - report_text: The map report, which heads the file.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool write_source(const string& path, const vector<uint8_t>& pack, const string& report_text) {
+    std::ofstream out(path);
+    if (!out) {
+        fprintf(stderr, "[ERROR] Can't write %s\n", path.c_str());
+        return false;
+    }
+
+    out << "/*\n * Phantom Slayer\n * Map pack file\n *\n";
+    out << " * GENERATED by tools/map-compiler from maps/maps.txt -- do not edit\n *\n";
+    std::istringstream lines(report_text);
+    string line;
+    while (std::getline(lines, line)) out << " * " << line << "\n";
+    out << " *\n * @version     1.1.2\n * @author      smittytone\n * @copyright   2021, Tony Smith\n * @licence     MIT\n *\n */\n";
+    out << "#include \"main.h\"\n";
+
+    out << "\n\n/*\n *      MAP PACK\n */\n";
+    out << "alignas(4) const uint8_t map_pack[] = {\n";
+    char value[8];
+    for (size_t i = 0 ; i < pack.size() ; ++i) {
+        if (i % VALUES_PER_LINE == 0) out << "    ";
+        snprintf(value, sizeof(value), "0x%02x", pack[i]);
+        out << value;
+        if (i + 1 < pack.size()) out << ((i % VALUES_PER_LINE == VALUES_PER_LINE - 1) ? ",\n" : ", ");
+    }
+
+    out << "\n};\n\nstatic_assert(sizeof(map_pack) == MAP_PACK_BYTES, \"Map pack size mismatch\");\n";
+    return (bool)out;
+}
+
+
+/**
+    Write the map pack header file.
+
+    - Parameters:
+        - path: The file's path.
+        - pack: The pack data.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool write_header(const string& path, const vector<uint8_t>& pack) {
+    std::ofstream out(path);
+    if (!out) {
+        fprintf(stderr, "[ERROR] Can't write %s\n", path.c_str());
+        return false;
+    }
+
+    const MapPackHeader* head = MapPack::header(pack.data());
+    out << "/*\n * Phantom Slayer\n * Map pack\n *\n";
+    out << " * GENERATED by tools/map-compiler from maps/maps.txt -- do not edit\n *\n";
+    out << " * @version     1.1.2\n * @author      smittytone\n * @copyright   2021, Tony Smith\n * @licence     MIT\n *\n */\n";
+    out << "#ifndef _MAP_PACK_DATA_HEADER_\n#define _MAP_PACK_DATA_HEADER_\n\n\n";
+
+    char line[128];
+    out << "/*\n *      CONSTANTS\n */\n";
+    snprintf(line, sizeof(line), "#define %-23s %u\n", "MAP_PACK_WIDTH", head->width);
+    out << line;
+    snprintf(line, sizeof(line), "#define %-23s %u\n", "MAP_PACK_HEIGHT", head->height);
+    out << line;
+    snprintf(line, sizeof(line), "#define %-23s %u\n", "MAP_PACK_BYTES", (uint32_t)pack.size());
+    out << line;
+
+    out << "\n\n/*\n *      GLOBALS\n */\n";
+    out << "extern const uint8_t    map_pack[];\n";
+    out << "\n\n#endif  // _MAP_PACK_DATA_HEADER_\n";
+    return (bool)out;
+}
+
+
+/**
+    Write the pack as a binary file.
+
+    - Parameters:
+        - path: The file's path.
+        - pack: The pack data.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool write_pack(const string& path, const vector<uint8_t>& pack) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        fprintf(stderr, "[ERROR] Can't write %s\n", path.c_str());
+        return false;
+    }
+
+    out.write((const char*)pack.data(), pack.size());
+    return (bool)out;
+}
@@ -0,0 +1,109 @@
+/*
+ * Phantom Slayer
+ * Maze generator benchmark
+ *
+ * Generates mazes from a run of seeds, and reports how fast that
+ * is and how well the mazes meet the generator's constraints.
+ *
+ * Usage: maze-bench [count] [first seed]
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include "tinymt32.h"
+#include "maze.h"
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint32_t                min;
+    uint32_t                max;
+    uint64_t                total;
+} Range;
+
+
+/*
+ *      PROTOTYPES
+ */
+void        add(Range* range, uint32_t value);
+void        show(const char* name, const Range& range, uint32_t count);
+
+
+int main(int argc, char* argv[]) {
+    uint32_t count = argc > 1 ? strtoul(argv[1], nullptr, 0) : 100000;
+    uint32_t first_seed = argc > 2 ? strtoul(argv[2], nullptr, 0) : 1;
+    if (count == 0) {
+        fprintf(stderr, "Usage: maze-bench [count] [first seed]\n");
+        return 1;
+    }
+
+    Range clear = {UINT32_MAX, 0, 0};
+    Range loops = {UINT32_MAX, 0, 0};
+    Range dead_ends = {UINT32_MAX, 0, 0};
+    Range tries = {UINT32_MAX, 0, 0};
+    uint32_t invalid = 0;
+    uint32_t disconnected = 0;
+    uint32_t mismatched = 0;
+    uint32_t rows[MAZE_SIZE];
+    uint32_t again[MAZE_SIZE];
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0 ; i < count ; ++i) {
+        MazeStats stats;
+        if (!Maze::generate(first_seed + i, rows, &stats)) ++invalid;
+        if (!stats.is_connected) ++disconnected;
+        add(&clear, stats.clear);
+        add(&loops, stats.loops);
+        add(&dead_ends, stats.dead_ends);
+        add(&tries, stats.tries);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Check that seeds reproduce their mazes
+    for (uint32_t i = 0 ; i < count ; i += 97) {
+        Maze::generate(first_seed + i, rows);
+        Maze::generate(first_seed + i, again);
+        for (uint8_t y = 0 ; y < MAZE_SIZE ; ++y) {
+            if (rows[y] != again[y]) {
+                ++mismatched;
+                break;
+            }
+        }
+    }
+
+    printf("MAZES: %u from seed %u, %ux%u squares\n", count, first_seed, MAZE_SIZE, MAZE_SIZE);
+    printf("  speed:        %.0f mazes/s (%.2f us/maze)\n", count / seconds, seconds * 1e6 / count);
+    printf("  constraints:  %u loops minimum, %u dead ends maximum\n", MAZE_MIN_LOOPS, MAZE_MAX_DEAD_ENDS);
+    printf("  invalid:      %u\n", invalid);
+    printf("  disconnected: %u\n", disconnected);
+    printf("  unrepeatable: %u\n", mismatched);
+    show("corridor", clear, count);
+    show("loops", loops, count);
+    show("dead ends", dead_ends, count);
+    show("tries", tries, count);
+    return (invalid == 0 && mismatched == 0) ? 0 : 1;
+}
+
+
+void add(Range* range, uint32_t value) {
+    if (value < range->min) range->min = value;
+    if (value > range->max) range->max = value;
+    range->total += value;
+}
+
+
+void show(const char* name, const Range& range, uint32_t count) {
+    char label[16];
+    snprintf(label, sizeof(label), "%s:", name);
+    printf("  %-13s min %u, mean %.2f, max %u\n", label, range.min, (double)range.total / count, range.max);
+}
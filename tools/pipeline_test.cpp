@@ -0,0 +1,202 @@
+/*
+ * Phantom Slayer
+ * Render pipeline test
+ *
+ * Runs the core 0 to core 1 frame handoff on the host, with core 1
+ * as a thread, and checks it: first the lock-free queue on its own,
+ * then frames drawn by both cores against the same frames drawn by
+ * one, then the game itself, stepped while core 1 draws. Build it
+ * with ThreadSanitizer (the 'pipeline-test' target does) so that
+ * any unsynchronised access between the cores is reported.
+ *
+ * Usage: pipeline-test [frames]
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <thread>
+#include "hardware/sync.h"
+#include "main.h"
+#include "host.h"
+
+using namespace picosystem;
+
+
+/*
+ *      EXTERNALLY-DEFINED GLOBALS
+ */
+extern Game         game;
+extern tinymt32_t   tinymt_store;
+extern bool         frame_pending;
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint32_t                sequence;
+    uint32_t                payload[15];
+} Item;
+
+
+/*
+ *      PROTOTYPES
+ */
+void        init();
+void        update(uint32_t tick_ms);
+void        draw(uint32_t tick_ms);
+uint32_t    test_queue(uint32_t count);
+uint32_t    test_frames(uint32_t count);
+uint32_t    test_game(uint32_t count);
+void        stage_view();
+
+
+int main(int argc, char* argv[]) {
+    uint32_t count = argc > 1 ? strtoul(argv[1], nullptr, 0) : 2000;
+    if (count == 0) {
+        fprintf(stderr, "Usage: pipeline-test [frames]\n");
+        return 1;
+    }
+
+    Host::set_time(1000);
+    init();
+
+    uint32_t errors = test_queue(count * 100);
+    errors += test_frames(count);
+    errors += test_game(count);
+    printf("PIPELINE TEST: %u errors\n", errors);
+    return errors == 0 ? 0 : 1;
+}
+
+
+/*
+    Pass items through a small queue from a second thread, and
+    check they all arrive, whole and in order.
+
+    - Returns: The number of items that didn't.
+ */
+uint32_t test_queue(uint32_t count) {
+    static Queue<Item, 4> queue;
+    std::thread producer([count] {
+        for (uint32_t i = 0 ; i < count ; ++i) {
+            Item item;
+            item.sequence = i;
+            for (uint8_t j = 0 ; j < 15 ; ++j) item.payload[j] = i * 31 + j;
+            while (!queue.push(item)) __wfe();
+        }
+    });
+
+    uint32_t errors = 0;
+    for (uint32_t i = 0 ; i < count ; ++i) {
+        Item item;
+        while (!queue.pop(&item)) __wfe();
+        bool is_bad = (item.sequence != i);
+        for (uint8_t j = 0 ; j < 15 ; ++j) is_bad |= (item.payload[j] != i * 31 + j);
+        if (is_bad) ++errors;
+    }
+
+    producer.join();
+    printf("QUEUE: %u items, %u errors\n", count, errors);
+    return errors;
+}
+
+
+/*
+    Hand views to core 1 and draw them with both cores, then draw
+    each again on core 0 alone, and compare the two.
+
+    - Returns: The number of views that differ.
+ */
+uint32_t test_frames(uint32_t count) {
+    static color_t data[240 * 240];
+    buffer_t* single = buffer(240, 240, data);
+    start_new_game();
+    game.state = IN_PLAY;
+
+    uint32_t errors = 0;
+    for (uint32_t i = 0 ; i < count ; ++i) {
+        stage_view();
+
+        Frame frame;
+        take_snapshot(&frame);
+        frame.dirty = DIRTY_VIEW;
+        frame.show_reticule = false;
+        frame.is_firing = false;
+        Pipeline::submit(frame);
+        Pipeline::wait();
+
+        target(single);
+        Gfx::draw_screen(frame, frame.viewer.x, frame.viewer.y, frame.viewer.direction);
+        target();
+
+        size_t first = VIEW_TOP * 240;
+        if (memcmp(SCREEN->data + first, single->data + first, VIEW_HEIGHT * 240 * sizeof(color_t)) != 0) ++errors;
+    }
+
+    printf("FRAMES: %u views, %u differ\n", count, errors);
+    return errors;
+}
+
+
+/*
+    Play the game a step at a time, with random input, as core 1
+    draws the frames each step publishes.
+
+    - Returns: The number of steps that left the player in a wall.
+ */
+uint32_t test_game(uint32_t count) {
+    const uint32_t keys[] = {UP, DOWN, LEFT, RIGHT, A, B, X, Y};
+    uint64_t now = 1000;
+    uint32_t held = 0;
+    uint32_t errors = 0;
+    start_new_game();
+
+    for (uint32_t i = 0 ; i < count * 10 ; ++i) {
+        uint32_t r = tinymt32_generate_uint32(&tinymt_store);
+        uint32_t pressed = (r % 6 == 0) ? (1u << keys[(r >> 8) & 7]) : 0;
+        if ((r >> 16) % 40 == 0) held ^= (1u << A);
+        Host::set_buttons(pressed, held);
+
+        now += SIM_STEP_US;
+        Host::set_time(now);
+        update(i);
+        if ((r >> 24) % 3 == 0) draw(i);
+
+        if (Map::get_square_contents(game.player.x, game.player.y) == MAP_TILE_WALL) ++errors;
+    }
+
+    // Leave core 1 idle
+    Pipeline::wait();
+    frame_pending = false;
+    printf("GAME: %u steps, %u errors, level %u, score %u\n", count * 10, errors, game.level, game.score);
+    return errors;
+}
+
+
+/*
+    Stand the player on a random clear square, facing a random way,
+    with the Phantoms on squares in front of them.
+ */
+void stage_view() {
+    uint16_t x, y;
+    Map::pick_clear_square(0, 0, 0, false, &x, &y);
+    game.player.x = x;
+    game.player.y = y;
+    game.player.direction = tinymt32_generate_uint32(&tinymt_store) & 0x03;
+
+    int8_t dx = game.player.direction == DIRECTION_EAST ? 1 : (game.player.direction == DIRECTION_WEST ? -1 : 0);
+    int8_t dy = game.player.direction == DIRECTION_SOUTH ? 1 : (game.player.direction == DIRECTION_NORTH ? -1 : 0);
+    for (Phantom& p : game.phantoms) {
+        p.set_square(NOT_ON_BOARD, NOT_ON_BOARD);
+        uint8_t ahead = 1 + tinymt32_generate_uint32(&tinymt_store) % MAX_VIEW_RANGE;
+        uint16_t px = x + dx * ahead;
+        uint16_t py = y + dy * ahead;
+        if (px < Map::width() && py < Map::height() && Map::get_square_contents(px, py) != MAP_TILE_WALL
+            && Map::phantom_on_square(px, py) == ERROR_CONDITION) {
+            p.set_square(px, py);
+        }
+    }
+}
@@ -0,0 +1,363 @@
+/*
+ * Phantom Slayer
+ * Route compiler
+ *
+ * Reads a binary map pack and writes the game's route tables source
+ * and header: for every map in the pack, the first step of a shortest
+ * path from each corridor square to each other one, so that a Phantom
+ * can find its way to the player with a lookup rather than a search.
+ *
+ * A map's table covers only its corridor squares, which are numbered
+ * in row order. Entry `to * squares + from` holds the step from square
+ * `from` towards square `to` in two bits: n for exit `1 << n`, ie. the
+ * game's `PHANTOM_*` values. Entries are packed four to a byte, from
+ * the low bits up. Where several exits lead equally far, the lowest
+ * is used. The compiler fails if any square can't reach every other.
+ *
+ * Usage: route-compiler <pack> <source out> <header out>
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "map_pack.h"
+
+using std::string;
+using std::vector;
+
+
+/*
+ *      CONSTANTS
+ */
+#define NO_SQUARE               0xFFFF
+#define MAX_TABLE_BYTES         (1024 * 1024)
+#define VALUES_PER_LINE         16
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint16_t                squares;        // Corridor squares on the map
+    uint16_t                longest;        // The longest shortest path, in steps
+    vector<uint16_t>        ranks;          // Each square's number, or `NO_SQUARE`
+    vector<uint8_t>         hops;
+} RouteTable;
+
+
+/*
+ *      PROTOTYPES
+ */
+bool        build_table(const uint8_t* pack, uint16_t index, RouteTable* table);
+uint32_t    checksum(const uint8_t* data, size_t size);
+bool        write_source(const string& path, const vector<RouteTable>& tables, const string& report_text);
+bool        write_header(const string& path, const vector<RouteTable>& tables, uint16_t width, uint16_t height, const uint8_t* pack, size_t size);
+
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        fprintf(stderr, "Usage: route-compiler <pack> <source out> <header out>\n");
+        return 1;
+    }
+
+    int file = open(argv[1], O_RDONLY);
+    struct stat info;
+    if (file < 0 || fstat(file, &info) != 0) {
+        fprintf(stderr, "[ERROR] Can't open map pack %s\n", argv[1]);
+        if (file >= 0) close(file);
+        return 1;
+    }
+
+    size_t size = info.st_size;
+    void* data = size > 0 ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+    close(file);
+    const char* error = nullptr;
+    if (data == MAP_FAILED || !MapPack::validate((const uint8_t*)data, size, &error)) {
+        fprintf(stderr, "[ERROR] Bad map pack %s: %s\n", argv[1], error != nullptr ? error : "can't map it");
+        if (data != MAP_FAILED) munmap(data, size);
+        return 1;
+    }
+
+    // Only the pack itself is checksummed: the game checks it against
+    // its own pack before using the tables
+    const uint8_t* pack = (const uint8_t*)data;
+    const MapPackHeader* head = MapPack::header(pack);
+    size_t pack_size = sizeof(MapPackHeader) + (size_t)head->count * head->record_size;
+
+    vector<RouteTable> tables(head->count);
+    uint32_t total = 0;
+    bool ok = true;
+    char line[128];
+    string report_text;
+    snprintf(line, sizeof(line), "%-5s %8s %8s %8s\n", "MAP", "SQUARES", "BYTES", "LONGEST");
+    report_text = line;
+    for (uint16_t i = 0 ; i < head->count && ok ; ++i) {
+        ok = build_table(pack, i, &tables[i]);
+        total += tables[i].hops.size() + tables[i].ranks.size() * sizeof(uint16_t);
+        snprintf(line, sizeof(line), "%-5u %8u %8u %8u\n", i, tables[i].squares, (uint32_t)tables[i].hops.size(), tables[i].longest);
+        report_text += line;
+    }
+
+    if (ok && total > MAX_TABLE_BYTES) {
+        fprintf(stderr, "[ERROR] Route tables take %u bytes, over the %u-byte budget\n", total, MAX_TABLE_BYTES);
+        ok = false;
+    }
+
+    snprintf(line, sizeof(line), "ROUTES: %u maps, %ux%u squares, %u bytes\n", head->count, head->width, head->height, total);
+    report_text = line + report_text;
+    printf("%s", report_text.c_str());
+
+    if (ok) ok = write_source(argv[2], tables, report_text)
+              && write_header(argv[3], tables, head->width, head->height, pack, pack_size);
+    munmap(data, size);
+    return ok ? 0 : 1;
+}
+
+
+/**
+    Build one of a pack's route tables, with a breadth-first search
+    of the map from each of its corridor squares in turn.
+
+    - Parameters:
+        - pack:  The pack's data.
+        - index: The map's index in the pack.
+        - table: The table to fill in.
+
+    - Returns: `true` on success, or `false` if the map's
+               corridors aren't all joined up.
+ */
+bool build_table(const uint8_t* pack, uint16_t index, RouteTable* table) {
+    const MapPackHeader* head = MapPack::header(pack);
+    uint16_t width = head->width;
+    uint16_t height = head->height;
+
+    // Number the corridor squares
+    vector<uint32_t> squares;
+    table->ranks.assign((size_t)width * height, NO_SQUARE);
+    for (uint16_t y = 0 ; y < height ; ++y) {
+        for (uint16_t x = 0 ; x < width ; ++x) {
+            if (MapPack::is_wall(pack, index, x, y)) continue;
+            if (squares.size() == NO_SQUARE) {
+                fprintf(stderr, "[ERROR] Map %u has too many corridor squares\n", index);
+                return false;
+            }
+
+            table->ranks[y * width + x] = squares.size();
+            squares.push_back(y * width + x);
+        }
+    }
+
+    uint32_t count = squares.size();
+    table->squares = count;
+    table->longest = 0;
+    table->hops.assign(((uint64_t)count * count + 3) >> 2, 0);
+
+    // Search out from each square in turn. A square's step towards
+    // it is to whichever neighbour the search reached first
+    const int32_t steps[4][2] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
+    vector<uint16_t> distance(count);
+    vector<uint32_t> queue(count);
+    for (uint32_t to = 0 ; to < count ; ++to) {
+        distance.assign(count, NO_SQUARE);
+        distance[to] = 0;
+        uint32_t head_index = 0;
+        uint32_t tail_index = 0;
+        queue[head_index++] = to;
+
+        while (tail_index < head_index) {
+            uint32_t s = queue[tail_index++];
+            int32_t x = squares[s] % width;
+            int32_t y = squares[s] / width;
+            for (const auto& step : steps) {
+                int32_t nx = x + step[0];
+                int32_t ny = y + step[1];
+                if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+                uint16_t n = table->ranks[ny * width + nx];
+                if (n == NO_SQUARE || distance[n] != NO_SQUARE) continue;
+                distance[n] = distance[s] + 1;
+                queue[head_index++] = n;
+            }
+        }
+
+        if (head_index != count) {
+            fprintf(stderr, "[ERROR] Map %u's corridors aren't joined up\n", index);
+            return false;
+        }
+
+        for (uint32_t from = 0 ; from < count ; ++from) {
+            if (distance[from] > table->longest) table->longest = distance[from];
+            if (from == to) continue;
+
+            int32_t x = squares[from] % width;
+            int32_t y = squares[from] / width;
+            for (uint8_t exit = 0 ; exit < 4 ; ++exit) {
+                int32_t nx = x + steps[exit][0];
+                int32_t ny = y + steps[exit][1];
+                if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+                uint16_t n = table->ranks[ny * width + nx];
+                if (n == NO_SQUARE || distance[n] + 1 != distance[from]) continue;
+
+                uint64_t entry = (uint64_t)to * count + from;
+                table->hops[entry >> 2] |= (exit << ((entry & 3) << 1));
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/**
+    Checksum data the way the game does: 32-bit FNV-1a.
+
+    - Parameters:
+        - data: The data.
+        - size: Its size in bytes.
+
+    - Returns: The checksum.
+ */
+uint32_t checksum(const uint8_t* data, size_t size) {
+    uint32_t hash = 0x811C9DC5;
+    for (size_t i = 0 ; i < size ; ++i) {
+        hash ^= data[i];
+        hash *= 0x01000193;
+    }
+
+    return hash;
+}
+
+
+/*
+    Write an array's values, `VALUES_PER_LINE` to a line.
+ */
+template <typename T>
+void write_values(std::ofstream& out, const vector<T>& values, const char* format) {
+    char value[16];
+    for (size_t i = 0 ; i < values.size() ; ++i) {
+        if (i % VALUES_PER_LINE == 0) out << "    ";
+        snprintf(value, sizeof(value), format, (uint32_t)values[i]);
+        out << value;
+        if (i + 1 < values.size()) out << ((i % VALUES_PER_LINE == VALUES_PER_LINE - 1) ? ",\n" : ", ");
+    }
+
+    out << "\n};\n";
+}
+
+
+/**
+    Write the route tables source file.
+
+    - Parameters:
+        - path:        The file's path.
+        - tables:      The maps' route tables.
+        - report_text: The route report, which heads the file.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool write_source(const string& path, const vector<RouteTable>& tables, const string& report_text) {
+    std::ofstream out(path);
+    if (!out) {
+        fprintf(stderr, "[ERROR] Can't write %s\n", path.c_str());
+        return false;
+    }
+
+    out << "/*\n * Phantom Slayer\n * Route tables file\n *\n";
+    out << " * GENERATED by tools/route-compiler from the map pack -- do not edit\n *\n";
+    std::istringstream lines(report_text);
+    string line;
+    while (std::getline(lines, line)) out << " * " << line << "\n";
+    out << " *\n * @version     1.1.2\n * @author      smittytone\n * @copyright   2021, Tony Smith\n * @licence     MIT\n *\n */\n";
+    out << "#include \"main.h\"\n";
+
+    vector<uint16_t> counts;
+    vector<uint32_t> offsets;
+    vector<uint16_t> ranks;
+    vector<uint8_t> hops;
+    for (const RouteTable& table : tables) {
+        counts.push_back(table.squares);
+        offsets.push_back(hops.size());
+        ranks.insert(ranks.end(), table.ranks.begin(), table.ranks.end());
+        hops.insert(hops.end(), table.hops.begin(), table.hops.end());
+    }
+
+    out << "\n\n/*\n *      ROUTE TABLES\n */\n";
+    out << "const uint16_t route_counts[] = {\n";
+    write_values(out, counts, "%u");
+    out << "\nconst uint32_t route_offsets[] = {\n";
+    write_values(out, offsets, "%u");
+    out << "\nconst uint16_t route_ranks[] = {\n";
+    write_values(out, ranks, "0x%04x");
+    out << "\nconst uint8_t route_hops[] = {\n";
+    write_values(out, hops, "0x%02x");
+
+    out << "\nstatic_assert(sizeof(route_ranks) == ROUTE_MAPS * ROUTE_WIDTH * ROUTE_HEIGHT * sizeof(uint16_t), \"Route table size mismatch\");\n";
+    return (bool)out;
+}
+
+
+/**
+    Write the route tables header file.
+
+    - Parameters:
+        - path:   The file's path.
+        - tables: The maps' route tables.
+        - width:  The maps' width.
+        - height: The maps' height.
+        - pack:   The pack's data.
+        - size:   The pack's size in bytes.
+
+    - Returns: `true` on success, otherwise `false`.
+ */
+bool write_header(const string& path, const vector<RouteTable>& tables, uint16_t width, uint16_t height, const uint8_t* pack, size_t size) {
+    std::ofstream out(path);
+    if (!out) {
+        fprintf(stderr, "[ERROR] Can't write %s\n", path.c_str());
+        return false;
+    }
+
+    out << "/*\n * Phantom Slayer\n * Route tables\n *\n";
+    out << " * GENERATED by tools/route-compiler from the map pack -- do not edit\n *\n";
+    out << " * @version     1.1.2\n * @author      smittytone\n * @copyright   2021, Tony Smith\n * @licence     MIT\n *\n */\n";
+    out << "#ifndef _ROUTES_DATA_HEADER_\n#define _ROUTES_DATA_HEADER_\n\n\n";
+
+    char line[128];
+    out << "/*\n *      CONSTANTS\n */\n";
+    out << "// The tables are good only for the map pack that\n// has this size and checksum (32-bit FNV-1a)\n";
+    snprintf(line, sizeof(line), "#define %-23s %u\n", "ROUTE_PACK_BYTES", (uint32_t)size);
+    out << line;
+    snprintf(line, sizeof(line), "#define %-23s 0x%08X\n", "ROUTE_PACK_CHECKSUM", checksum(pack, size));
+    out << line;
+    snprintf(line, sizeof(line), "#define %-23s %u\n", "ROUTE_MAPS", (uint32_t)tables.size());
+    out << line;
+    snprintf(line, sizeof(line), "#define %-23s %u\n", "ROUTE_WIDTH", width);
+    out << line;
+    snprintf(line, sizeof(line), "#define %-23s %u\n", "ROUTE_HEIGHT", height);
+    out << line;
+    snprintf(line, sizeof(line), "#define %-23s 0x%04X\n", "ROUTE_NO_SQUARE", NO_SQUARE);
+    out << line;
+
+    out << "\n\n/*\n *      GLOBALS\n */\n";
+    out << "// Each map's corridor squares, and where its table starts in 'route_hops'\n";
+    out << "extern const uint16_t   route_counts[];\n";
+    out << "extern const uint32_t   route_offsets[];\n";
+    out << "// Each map's squares' numbers, by row, or 'ROUTE_NO_SQUARE' for walls\n";
+    out << "extern const uint16_t   route_ranks[];\n";
+    out << "// The steps: see 'tools/route_compiler.cpp'\n";
+    out << "extern const uint8_t    route_hops[];\n";
+    out << "\n\n#endif  // _ROUTES_DATA_HEADER_\n";
+    return (bool)out;
+}
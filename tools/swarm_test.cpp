@@ -0,0 +1,194 @@
+/*
+ * Phantom Slayer
+ * Swarm equivalence test
+ *
+ * Moves a set of `Phantom` objects and a swarm of the same Phantoms
+ * side by side, on every stock map in each pursuit mode, as the
+ * player wanders, and checks that every move cycle leaves them the
+ * same: positions, directions, back-off state, which Phantom caught
+ * the player, and the random generator's state. The swarm moves by
+ * the same rules as `Phantom::move()`, so nothing may differ.
+ *
+ * Usage: swarm-test [cycles]
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+#include "host.h"
+
+
+/*
+ *      EXTERNALLY-DEFINED GLOBALS
+ */
+extern Game         game;
+extern tinymt32_t   tinymt_store;
+extern uint16_t     swarm_x[SWARM_CAPACITY];
+extern uint16_t     swarm_y[SWARM_CAPACITY];
+extern int8_t       swarm_hp[SWARM_CAPACITY];
+extern uint8_t      swarm_direction[SWARM_CAPACITY];
+extern uint8_t      swarm_back_steps[SWARM_CAPACITY];
+
+
+/*
+ *      CONSTANTS
+ */
+// Enough to block one another's exits on a stock map,
+// and within the map's 8-bit Phantom indexes
+#define TEST_PHANTOMS       16
+
+
+/*
+ *      PROTOTYPES
+ */
+void        init();
+uint32_t    test_map(uint8_t map, uint8_t mode, uint32_t cycles, uint32_t* catches);
+uint32_t    compare(uint8_t map, uint8_t mode, uint32_t cycle);
+void        step_player();
+
+
+int main(int argc, char* argv[]) {
+    uint32_t cycles = argc > 1 ? strtoul(argv[1], nullptr, 0) : 1000;
+    if (cycles == 0) {
+        fprintf(stderr, "Usage: swarm-test [cycles]\n");
+        return 1;
+    }
+
+    Host::set_time(1000);
+    init();
+    game.level = 1;
+
+    const uint8_t modes[] = {PURSUIT_GREEDY, PURSUIT_FIELD, PURSUIT_TABLE};
+    uint32_t errors = 0;
+    uint32_t total = 0;
+    uint32_t catches = 0;
+    for (uint8_t mode : modes) {
+        Pursuit::set_mode(mode);
+        for (uint8_t m = 0 ; m < Map::count() ; ++m) {
+            errors += test_map(m, mode, cycles, &catches);
+            total += cycles;
+        }
+    }
+
+    printf("SWARM TEST: %u cycles, %u catches, %u errors\n", total, catches, errors);
+    return errors == 0 ? 0 : 1;
+}
+
+
+/*
+    Move the Phantom objects and the swarm side by side on one map,
+    from the same squares and the same generator state.
+
+    - Parameters:
+        - map:     The stock map's index.
+        - mode:    The pursuit mode.
+        - cycles:  The number of move cycles.
+        - catches: Incremented for each time the player is caught.
+
+    - Returns: The number of cycles that didn't match.
+ */
+uint32_t test_map(uint8_t map, uint8_t mode, uint32_t cycles, uint32_t* catches) {
+    Map::select(map);
+    game.phantoms.clear();
+    Map::reset_occupancy();
+    Swarm::clear();
+    Map::pick_clear_square(0, 0, 0, false, &game.player.x, &game.player.y);
+
+    // Place the swarm, then put an object on each of its squares
+    uint16_t number = Swarm::populate(TEST_PHANTOMS, 1);
+    game.phantoms.resize(number);
+    for (uint16_t i = 0 ; i < number ; ++i) {
+        Phantom& p = game.phantoms.at(i);
+        p.hp = swarm_hp[i];
+        p.direction = swarm_direction[i];
+        p.back_steps = swarm_back_steps[i];
+        p.set_square(swarm_x[i], swarm_y[i]);
+    }
+
+    Pursuit::reset();
+    uint32_t errors = 0;
+    for (uint32_t c = 0 ; c < cycles ; ++c) {
+        step_player();
+        Pursuit::update();
+
+        // Each way of moving starts from the same generator state
+        tinymt32_t state = tinymt_store;
+        uint16_t object_catch = SWARM_NONE;
+        for (uint16_t i = 0 ; i < number ; ++i) {
+            if (game.phantoms.at(i).move()) {
+                object_catch = i;
+                break;
+            }
+        }
+
+        tinymt32_t object_state = tinymt_store;
+        tinymt_store = state;
+        uint16_t swarm_catch = Swarm::move();
+
+        uint32_t bad = compare(map, mode, c);
+        if (object_catch != swarm_catch || memcmp(&tinymt_store, &object_state, sizeof(tinymt32_t)) != 0) {
+            printf("BAD SWARM: map %u, mode %u, cycle %u: caught by %u not %u, or random state differs\n",
+                   map, mode, c, swarm_catch, object_catch);
+            ++bad;
+        }
+
+        if (bad > 0) {
+            // Don't report the same difference every cycle after
+            ++errors;
+            break;
+        }
+
+        if (object_catch != SWARM_NONE) {
+            ++(*catches);
+            Map::pick_clear_square(game.player.x, game.player.y, 4, false, &game.player.x, &game.player.y);
+        }
+    }
+
+    Swarm::clear();
+    game.phantoms.clear();
+    Map::reset_occupancy();
+    return errors;
+}
+
+
+/*
+    Compare every Phantom object with the same Phantom in the swarm.
+
+    - Returns: The number of Phantoms that differ.
+ */
+uint32_t compare(uint8_t map, uint8_t mode, uint32_t cycle) {
+    uint32_t bad = 0;
+    for (uint16_t i = 0 ; i < game.phantoms.size() ; ++i) {
+        const Phantom& p = game.phantoms.at(i);
+        if (p.x != swarm_x[i] || p.y != swarm_y[i] || p.direction != swarm_direction[i] || p.back_steps != swarm_back_steps[i]) {
+            printf("BAD SWARM: map %u, mode %u, cycle %u, phantom %u: %u,%u d%u b%u not %u,%u d%u b%u\n",
+                   map, mode, cycle, i, swarm_x[i], swarm_y[i], swarm_direction[i], swarm_back_steps[i],
+                   p.x, p.y, p.direction, p.back_steps);
+            ++bad;
+        }
+    }
+
+    return bad;
+}
+
+
+/*
+    Move the player one square, to a random exit.
+ */
+void step_player() {
+    uint8_t exits = Map::get_exits(game.player.x, game.player.y);
+    if (exits == 0) return;
+
+    uint8_t exit = 0;
+    do {
+        exit = 1 << (tinymt32_generate_uint32(&tinymt_store) & 0x03);
+    } while ((exits & exit) == 0);
+
+    if (exit == PHANTOM_NORTH) game.player.y--;
+    if (exit == PHANTOM_EAST) game.player.x++;
+    if (exit == PHANTOM_SOUTH) game.player.y++;
+    if (exit == PHANTOM_WEST) game.player.x--;
+}
@@ -0,0 +1,504 @@
+/*
+ * Phantom Slayer
+ * Span-based corridor renderer
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#include "main.h"
+
+using namespace picosystem;
+
+
+/*
+ *      EXTERNALLY-DEFINED GLOBALS
+ */
+extern Rect             rects[7];
+
+
+/*
+ *      CONSTANTS
+ */
+// Span table kinds
+#define EDGE_LEFT_CLOSED        0
+#define EDGE_LEFT_OPEN          1
+#define EDGE_RIGHT_CLOSED       2
+#define EDGE_RIGHT_OPEN         3
+
+// Palette-independent colours, ie. 'inks'
+#define INK_BACKGROUND          0
+#define INK_WALL                1
+#define INK_FLOOR               2
+#define INK_TELEPORTER          3
+
+
+/*
+ *      GLOBALS
+ */
+// The frame rects part way through a step forward, derived from
+// 'rects[]' in 'init()'; phase 0 is 'rects[]' itself
+Rect                    phase_rects[VIEW_PHASES][7];
+
+// Per-phase, per-frame, per-row wall spans
+Span                    edges[VIEW_PHASES][VIEW_FRAMES][VIEW_HEIGHT][4];
+
+// Per-phase, per-row spans for the 'infinity' far wall (frame 5 only)
+Span                    infinity[VIEW_PHASES][VIEW_HEIGHT][2];
+
+// Recently used view signatures and their row runs
+ViewCacheEntry          view_cache[VIEW_CACHE_SIZE];
+uint32_t                cache_clock = 0;
+uint32_t                hits = 0;
+uint32_t                misses = 0;
+
+// Ink row used while building a view
+uint8_t                 ink[VIEW_WIDTH];
+
+// Ink to colour, normal then teleport flash
+const color_t           palettes[2][4] = {{YELLOW, BLUE, RED, GREEN},
+                                          {RED, WHITE, WHITE, GREEN}};
+
+
+namespace View {
+
+
+/*
+ *      STATIC PROTOTYPES
+ */
+static void add_rect(Span* table, uint8_t kind, int32_t x, int32_t y, int32_t w, int32_t h);
+static void add_poly(Span* table, uint8_t stride, uint8_t kind, const int32_t* points, uint8_t count);
+static uint8_t lerp(uint8_t a, uint8_t b, uint32_t t);
+static void add_span(Span* span, int32_t x0, int32_t x1);
+static void ink_row(uint8_t* ink, uint32_t signature, uint8_t row);
+static void ink_span(uint8_t* ink, Span span, uint8_t colour);
+static void ink_fill(uint8_t* ink, int32_t x0, int32_t x1, uint8_t colour);
+static bool build(uint32_t key, ViewCacheEntry* entry);
+static ViewCacheEntry* lookup(uint32_t key);
+static void fill(color_t* p, int32_t count, color_t colour);
+
+
+/**
+    Derive the per-row span tables from the frame rects.
+    Must be called after 'rects[]' has been populated.
+ */
+void init() {
+    memset(edges, 0, sizeof(edges));
+    memset(infinity, 0, sizeof(infinity));
+
+    for (uint8_t p = 0 ; p < VIEW_PHASES ; ++p) {
+        // Part way through a step, each frame has grown towards the
+        // one in front of it. The outer frame stays at the screen edge,
+        // and the 'infinity' view's end stays put. 't' is the step
+        // fraction, in fixed point
+        uint32_t t = (p << PHASE_FIXED_SHIFT) / VIEW_PHASES;
+        phase_rects[p][0] = rects[0];
+        phase_rects[p][VIEW_FRAMES] = rects[VIEW_FRAMES];
+        for (uint8_t k = 1 ; k < VIEW_FRAMES ; ++k) {
+            Rect* r = &phase_rects[p][k];
+            r->x = lerp(rects[k].x, rects[k - 1].x, t);
+            r->y = lerp(rects[k].y, rects[k - 1].y, t);
+            r->width = lerp(rects[k].width, rects[k - 1].width, t);
+            r->height = lerp(rects[k].height, rects[k - 1].height, t);
+            r->spot = lerp(rects[k].spot, rects[k - 1].spot, t);
+        }
+
+        for (uint8_t f = 0 ; f < VIEW_FRAMES ; ++f) {
+            // Get the 'i'ner and 'o'uter frames
+            Rect i = phase_rects[p][f + 1];
+            Rect o = phase_rects[p][f];
+            int32_t xd = i.x + i.width;
+            Span* table = &edges[p][f][0][0];
+
+            // Left wall: the facing wall of an adjoining corridor, plus
+            // upper and lower triangles when there's no junction
+            add_rect(table, EDGE_LEFT_OPEN, o.x, i.y + 40, i.x - o.x - 1, i.height);
+            add_rect(table, EDGE_LEFT_CLOSED, o.x, i.y + 40, i.x - o.x - 1, i.height);
+            const int32_t lt[] = {o.x, o.y + 40, i.x - 2, i.y + 39, o.x, i.y + 39};
+            const int32_t lb[] = {o.x, i.y + i.height + 39, i.x, i.y + i.height + 39, o.x, o.y + o.height + 40};
+            add_poly(table, 4, EDGE_LEFT_CLOSED, lt, 3);
+            add_poly(table, 4, EDGE_LEFT_CLOSED, lb, 3);
+
+            // Right wall: as above, mirrored
+            add_rect(table, EDGE_RIGHT_OPEN, xd + 1, i.y + 40, o.width + o.x - xd - 1, i.height);
+            add_rect(table, EDGE_RIGHT_CLOSED, xd + 1, i.y + 40, o.width + o.x - xd - 1, i.height);
+            const int32_t rt[] = {xd + 1, i.y + 39, o.x + o.width - 1, o.y + 40, o.x + o.width - 1, i.y + 39};
+            const int32_t rb[] = {xd + 1, i.y + i.height + 39, o.x + o.width - 1, i.y + i.height + 39, o.x + o.width - 1, o.y + o.height + 40};
+            add_poly(table, 4, EDGE_RIGHT_CLOSED, rt, 3);
+            add_poly(table, 4, EDGE_RIGHT_CLOSED, rb, 3);
+        }
+
+        // The 'infinity' view's vanishing corridor edges
+        Rect r = phase_rects[p][VIEW_FRAMES];
+        int32_t ryd = r.y + r.height;
+        int32_t rxd = r.x + r.width;
+        const int32_t il[] = {r.x, r.y + 39, r.x + 4, r.y + 42, r.x + 4, ryd + 37, r.x, ryd + 39};
+        const int32_t ir[] = {rxd, r.y + 39, rxd, ryd + 39, rxd - 4, ryd + 37, rxd - 4, r.y + 42};
+        add_poly(&infinity[p][0][0], 2, 0, il, 4);
+        add_poly(&infinity[p][0][0], 2, 1, ir, 4);
+    }
+
+    // Empty the cache
+    for (uint8_t i = 0 ; i < VIEW_CACHE_SIZE ; ++i) {
+        view_cache[i].key = 0xFFFFFFFF;
+        view_cache[i].age = 0;
+    }
+}
+
+
+/**
+    Compute the view signature for the specified square: the set of
+    bits which fully determine what the corridor (not its Phantoms)
+    looks like.
+
+    - Parameters:
+        - frame:     The snapshot being drawn.
+        - x:         The square's X co-ordinate.
+        - y:         The square's Y co-ordinate.
+        - direction: The direction in which the viewer is facing.
+
+    - Returns: The view signature.
+ */
+uint32_t signature(const Frame& frame, uint16_t x, uint16_t y, uint8_t direction) {
+    uint8_t far_frame = Map::get_view_distance(x, y, direction);
+    uint8_t left_dir = (direction + 3) & 0x03;
+    uint8_t right_dir = (direction + 1) & 0x03;
+    uint8_t tele_frame = SIG_NO_TELE;
+    int8_t dx = 0;
+    int8_t dy = 0;
+
+    switch(direction) {
+        case DIRECTION_NORTH:
+            dy = -1;
+            break;
+        case DIRECTION_EAST:
+            dx = 1;
+            break;
+        case DIRECTION_SOUTH:
+            dy = 1;
+            break;
+        default:
+            dx = -1;
+    }
+
+    uint32_t sig = far_frame << SIG_FAR_SHIFT;
+    for (uint8_t f = 0 ; f <= far_frame ; ++f) {
+        uint16_t sx = x + dx * f;
+        uint16_t sy = y + dy * f;
+        if (Map::get_view_distance(sx, sy, left_dir) > 0) sig |= (1 << (SIG_LEFT_SHIFT + f));
+        if (Map::get_view_distance(sx, sy, right_dir) > 0) sig |= (1 << (SIG_RIGHT_SHIFT + f));
+        if (sx == frame.tele_x && sy == frame.tele_y) tele_frame = f;
+    }
+
+    sig |= (tele_frame << SIG_TELE_SHIFT);
+    sig |= (frame.phase << SIG_PHASE_SHIFT);
+    if (frame.state == DO_TELEPORT_ONE) sig |= SIG_PALETTE_MASK;
+    return sig;
+}
+
+
+/**
+    Find, or build, the row runs for a view signature. Signatures
+    seen recently come from the cache; others are built (and cached)
+    from the span tables.
+    NOTE Not re-entrant: call on one core only.
+
+    - Parameters:
+        - signature: A view signature from `signature()`.
+
+    - Returns: The cache entry, or `nullptr` if the view is too
+               complex to cache.
+ */
+const ViewCacheEntry* prepare(uint32_t signature) {
+    return lookup(signature & ~SIG_PALETTE_MASK);
+}
+
+
+/**
+    Paint the corridor described by a view signature into the 3D view
+    area of the specified buffer, within the specified rectangle.
+    This touches no SDK drawing state, so both cores can render the
+    same view at once provided their rectangles don't overlap.
+
+    - Parameters:
+        - target:    The buffer to paint into.
+        - signature: A view signature from `signature()`.
+        - corridor:  The signature's runs, from `prepare()`.
+        - x:         The clip rectangle's left edge, in screen co-ordinates.
+        - y:         The clip rectangle's top edge, in screen co-ordinates.
+        - w:         The clip rectangle's width.
+        - h:         The clip rectangle's height.
+        - offset:    How far left of its place in the view to paint each column.
+ */
+void render(buffer_t* target, uint32_t signature, const ViewCacheEntry* corridor, int32_t x, int32_t y, int32_t w, int32_t h, int32_t offset) {
+    const color_t* palette = palettes[(signature & SIG_PALETTE_MASK) ? 1 : 0];
+    int32_t x0 = x < 0 ? 0 : x;
+    int32_t x1 = x + w > VIEW_WIDTH ? VIEW_WIDTH : x + w;
+    int32_t row0 = y - VIEW_TOP < 0 ? 0 : y - VIEW_TOP;
+    int32_t row1 = y + h - VIEW_TOP > VIEW_HEIGHT ? VIEW_HEIGHT : y + h - VIEW_TOP;
+    if (x1 <= x0 || row1 <= row0) return;
+    color_t* dst = target->data + (VIEW_TOP + row0) * target->w - offset;
+
+    if (corridor == nullptr) {
+        // Too complex to cache, so paint it row by row
+        uint8_t row_ink[VIEW_WIDTH];
+        for (int32_t row = row0 ; row < row1 ; ++row) {
+            ink_row(row_ink, signature, row);
+            int32_t start = x0;
+            while (start < x1) {
+                int32_t end = start + 1;
+                while (end < x1 && row_ink[end] == row_ink[start]) ++end;
+                fill(dst + start, end - start, palette[row_ink[start]]);
+                start = end;
+            }
+
+            dst += target->w;
+        }
+
+        return;
+    }
+
+    for (int32_t row = row0 ; row < row1 ; ++row) {
+        int32_t start = 0;
+        for (uint16_t r = corridor->row_start[row] ; r < corridor->row_start[row + 1] ; ++r) {
+            uint16_t run = corridor->runs[r];
+            int32_t end = run >> 8;
+            int32_t from = start < x0 ? x0 : start;
+            int32_t to = end > x1 ? x1 : end;
+            if (to > from) fill(dst + from, to - from, palette[run & 0xFF]);
+            if (end >= x1) break;
+            start = end;
+        }
+
+        dst += target->w;
+    }
+}
+
+
+uint32_t cache_hits() {
+    return hits;
+}
+
+
+uint32_t cache_misses() {
+    return misses;
+}
+
+
+/*
+    Find a cached view, or build one in the least recently used slot.
+
+    - Returns: The cache entry, or `nullptr` if the view could not be cached.
+ */
+static ViewCacheEntry* lookup(uint32_t key) {
+    ViewCacheEntry* oldest = &view_cache[0];
+    ++cache_clock;
+
+    for (uint8_t i = 0 ; i < VIEW_CACHE_SIZE ; ++i) {
+        ViewCacheEntry* entry = &view_cache[i];
+        if (entry->key == key) {
+            entry->age = cache_clock;
+            ++hits;
+            return entry;
+        }
+
+        if (entry->age < oldest->age) oldest = entry;
+    }
+
+    ++misses;
+    if (!build(key, oldest)) {
+        oldest->key = 0xFFFFFFFF;
+        oldest->age = 0;
+        return nullptr;
+    }
+
+    oldest->key = key;
+    oldest->age = cache_clock;
+    return oldest;
+}
+
+
+/*
+    Run-length encode every row of a view into a cache entry.
+    Each run is the run's end X co-ordinate (upper byte) and ink.
+
+    - Returns: `false` if the runs didn't fit, otherwise `true`.
+ */
+static bool build(uint32_t key, ViewCacheEntry* entry) {
+    uint16_t count = 0;
+    for (uint8_t row = 0 ; row < VIEW_HEIGHT ; ++row) {
+        entry->row_start[row] = count;
+        ink_row(ink, key, row);
+        int32_t x = 0;
+        while (x < VIEW_WIDTH) {
+            int32_t end = x + 1;
+            while (end < VIEW_WIDTH && ink[end] == ink[x]) ++end;
+            if (count == VIEW_CACHE_RUNS) return false;
+            entry->runs[count++] = (end << 8) | ink[x];
+            x = end;
+        }
+    }
+
+    entry->row_start[VIEW_HEIGHT] = count;
+    return true;
+}
+
+
+/*
+    Fill the ink row with one row of the view, painting frames
+    from the furthest forward, just as `Gfx::draw_section()` does.
+ */
+static void ink_row(uint8_t* ink, uint32_t signature, uint8_t row) {
+    uint8_t far_frame = (signature >> SIG_FAR_SHIFT) & 0x07;
+    uint8_t tele_frame = (signature >> SIG_TELE_SHIFT) & 0x07;
+    uint8_t phase = (signature >> SIG_PHASE_SHIFT) & 0x03;
+    const Rect* frames = phase_rects[phase];
+    memset(ink, INK_BACKGROUND, VIEW_WIDTH);
+
+    for (int8_t f = far_frame ; f >= 0 ; --f) {
+        // Teleporter floor tile
+        if (f == tele_frame) {
+            Rect c = frames[f];
+            Rect b = frames[f + 1];
+            if (row >= b.y + b.height && row < c.y + c.height) ink_fill(ink, c.x, c.x + c.width, INK_TELEPORTER);
+        }
+
+        // Left and right wall segments
+        bool left_open = (signature >> (SIG_LEFT_SHIFT + f)) & 0x01;
+        bool right_open = (signature >> (SIG_RIGHT_SHIFT + f)) & 0x01;
+        ink_span(ink, edges[phase][f][row][left_open ? EDGE_LEFT_OPEN : EDGE_LEFT_CLOSED], INK_WALL);
+        ink_span(ink, edges[phase][f][row][right_open ? EDGE_RIGHT_OPEN : EDGE_RIGHT_CLOSED], INK_WALL);
+
+        Rect r = frames[f + 1];
+        if (f == far_frame) {
+            // Far wall, or the 'infinity' view
+            if (f == VIEW_FRAMES - 1) {
+                ink_span(ink, infinity[phase][row][0], INK_WALL);
+                ink_span(ink, infinity[phase][row][1], INK_WALL);
+            } else if (row >= r.y && row < r.y + r.height) {
+                ink_fill(ink, r.x, r.x + r.width, INK_WALL);
+            }
+        } else {
+            // Floor line
+            if (row == r.y + r.height - 1) ink_fill(ink, r.x, r.x + r.width + 1, INK_FLOOR);
+            if (row == r.y + r.height) ink_fill(ink, r.x - 1, r.x + r.width + 2, INK_FLOOR);
+        }
+    }
+}
+
+
+static void ink_span(uint8_t* ink, Span span, uint8_t colour) {
+    if (span.x1 > span.x0) memset(ink + span.x0, colour, span.x1 - span.x0);
+}
+
+
+static void ink_fill(uint8_t* ink, int32_t x0, int32_t x1, uint8_t colour) {
+    if (x0 < 0) x0 = 0;
+    if (x1 > VIEW_WIDTH) x1 = VIEW_WIDTH;
+    if (x1 > x0) memset(ink + x0, colour, x1 - x0);
+}
+
+
+/*
+    Add a filled rectangle, in screen co-ordinates, to a frame's
+    span table.
+ */
+static void add_rect(Span* table, uint8_t kind, int32_t x, int32_t y, int32_t w, int32_t h) {
+    for (int32_t row = y - VIEW_TOP ; row < y - VIEW_TOP + h ; ++row) {
+        if (row < 0 || row >= VIEW_HEIGHT) continue;
+        add_span(&table[row * 4 + kind], x, x + w);
+    }
+}
+
+
+/*
+    Add a filled convex polygon, in screen co-ordinates, to a span
+    table with `stride` kinds per row, using the same edge rules as
+    the SDK's `fpoly()`.
+ */
+static void add_poly(Span* table, uint8_t stride, uint8_t kind, const int32_t* points, uint8_t count) {
+    int32_t min_y = points[1];
+    int32_t max_y = points[1];
+    for (uint8_t i = 1 ; i < count ; ++i) {
+        if (points[i * 2 + 1] < min_y) min_y = points[i * 2 + 1];
+        if (points[i * 2 + 1] > max_y) max_y = points[i * 2 + 1];
+    }
+
+    for (int32_t y = min_y ; y <= max_y ; ++y) {
+        int32_t row = y - VIEW_TOP;
+        if (row < 0 || row >= VIEW_HEIGHT) continue;
+
+        // Find where the row crosses the polygon's edges
+        int32_t x0 = VIEW_WIDTH;
+        int32_t x1 = -1;
+        for (uint8_t i = 0 ; i < count ; ++i) {
+            uint8_t j = (i + 1) % count;
+            int32_t sx = points[i * 2];
+            int32_t sy = points[i * 2 + 1];
+            int32_t ex = points[j * 2];
+            int32_t ey = points[j * 2 + 1];
+            if ((sy < y && ey >= y) || (ey < y && sy >= y)) {
+                int32_t x = int32_t(sx + float(y - sy) / float(ey - sy) * float(ex - sx));
+                if (x < x0) x0 = x;
+                if (x > x1) x1 = x;
+            }
+        }
+
+        if (x1 < x0) continue;
+        add_span(&table[row * stride + kind], x0, x1 + 1);
+    }
+}
+
+
+/*
+    Widen a span to include [x0, x1). Spans on a row are contiguous,
+    so a union is just the outer bounds.
+ */
+static void add_span(Span* span, int32_t x0, int32_t x1) {
+    if (x0 < 0) x0 = 0;
+    if (x1 > VIEW_WIDTH) x1 = VIEW_WIDTH;
+    if (x1 <= x0) return;
+
+    if (span->x1 <= span->x0) {
+        span->x0 = x0;
+        span->x1 = x1;
+        return;
+    }
+
+    if (x0 < span->x0) span->x0 = x0;
+    if (x1 > span->x1) span->x1 = x1;
+}
+
+
+/*
+    Interpolate from `a` towards `b` by the fixed-point fraction `t`.
+ */
+static uint8_t lerp(uint8_t a, uint8_t b, uint32_t t) {
+    return (a * ((1 << PHASE_FIXED_SHIFT) - t) + b * t) >> PHASE_FIXED_SHIFT;
+}
+
+
+/*
+    Fill a run of pixels, two at a time where possible.
+ */
+static void fill(color_t* p, int32_t count, color_t colour) {
+    if (count <= 0) return;
+    if (((uintptr_t)p & 0x02) != 0) {
+        *p++ = colour;
+        --count;
+    }
+
+    uint32_t pair = colour | ((uint32_t)colour << 16);
+    uint32_t* q = (uint32_t*)p;
+    while (count > 1) {
+        *q++ = pair;
+        count -= 2;
+    }
+
+    if (count) *(color_t*)q = colour;
+}
+
+
+}   // namespace View
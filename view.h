@@ -0,0 +1,75 @@
+/*
+ * Phantom Slayer
+ * Span-based corridor renderer
+ *
+ * @version     1.1.2
+ * @author      smittytone
+ * @copyright   2021, Tony Smith
+ * @licence     MIT
+ *
+ */
+#ifndef _VIEW_RENDER_HEADER_
+#define _VIEW_RENDER_HEADER_
+
+
+/*
+ *      CONSTANTS
+ */
+// 3D view area, in pixels
+#define VIEW_TOP                40
+#define VIEW_WIDTH              240
+#define VIEW_HEIGHT             160
+
+// Number of frames (squares) drawn, front to back
+#define VIEW_FRAMES             6
+
+// Steps through a square: 0 is at rest, the rest are in between
+#define VIEW_PHASES             4
+#define PHASE_FIXED_SHIFT       8
+
+// Signature cache size: entries, and runs per entry
+#define VIEW_CACHE_SIZE         4
+#define VIEW_CACHE_RUNS         1024
+
+// View signature bit fields
+#define SIG_FAR_SHIFT           0       // 3 bits: furthest visible frame
+#define SIG_LEFT_SHIFT          3       // 6 bits: left side open, one bit per frame
+#define SIG_RIGHT_SHIFT         9       // 6 bits: right side open, one bit per frame
+#define SIG_TELE_SHIFT          15      // 3 bits: teleporter frame, or SIG_NO_TELE
+#define SIG_PALETTE_SHIFT       18      // 1 bit: teleport flash palette
+#define SIG_PHASE_SHIFT         19      // 2 bits: step phase
+#define SIG_NO_TELE             7
+#define SIG_PALETTE_MASK        (1 << SIG_PALETTE_SHIFT)
+
+
+/*
+ *      STRUCTURE DEFINITIONS
+ */
+typedef struct {
+    uint8_t                 x0;
+    uint8_t                 x1;
+} Span;
+
+typedef struct {
+    uint32_t                key;
+    uint32_t                age;
+    uint16_t                row_start[VIEW_HEIGHT + 1];
+    uint16_t                runs[VIEW_CACHE_RUNS];
+} ViewCacheEntry;
+
+
+/*
+ *      PROTOTYPES
+ */
+namespace View {
+    void        init();
+    uint32_t    signature(const Frame& frame, uint16_t x, uint16_t y, uint8_t direction);
+    const ViewCacheEntry* prepare(uint32_t signature);
+    void        render(buffer_t* target, uint32_t signature, const ViewCacheEntry* corridor,
+                       int32_t x, int32_t y, int32_t w, int32_t h, int32_t offset = 0);
+    uint32_t    cache_hits();
+    uint32_t    cache_misses();
+}
+
+
+#endif  // _VIEW_RENDER_HEADER_